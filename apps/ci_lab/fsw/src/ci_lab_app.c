@@ -55,7 +55,7 @@ static CFE_EVS_BinFilter_t CI_LAB_EventFilters[] =
      {CI_LAB_SOCKETCREATE_ERR_EID, 0x0000}, {CI_LAB_SOCKETBIND_ERR_EID, 0x0000}, {CI_LAB_STARTUP_INF_EID, 0x0000},
      {CI_LAB_COMMAND_ERR_EID, 0x0000},      {CI_LAB_COMMANDNOP_INF_EID, 0x0000}, {CI_LAB_COMMANDRST_INF_EID, 0x0000},
      {CI_LAB_INGEST_INF_EID, 0x0000},       {CI_LAB_INGEST_LEN_ERR_EID, 0x0000}, {CI_LAB_INGEST_ALLOC_ERR_EID, 0x0000},
-     {CI_LAB_INGEST_SEND_ERR_EID, 0x0000}};
+     {CI_LAB_INGEST_SEND_ERR_EID, 0x0000},  {CI_LAB_INGEST_DECODE_ERR_EID, 0x0000}};
 
 /** * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /* CI_Lab_AppMain() -- Application entry point and main process loop          */
@@ -249,20 +249,122 @@ void CI_LAB_ResetCounters_Internal(void)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
 /*                                                                            */
-/* CI_LAB_ReadUpLink() --                                                     */
+/* CI_LAB_IngestPacket() -- Decode one uplink packet onto the software bus    */
+/*                                                                            */
+/* Returns CFE_SUCCESS if ingest may continue with the next packet            */
 /*                                                                            */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
-void CI_LAB_ReadUpLink(void)
+int32 CI_LAB_IngestPacket(const void *PacketPtr, size_t PacketSize, CFE_SB_Buffer_t **NextIngestBufPtr)
 {
-    int                                   i;
     int32                                 status;
     uint32                                BitSize;
     CFE_SB_SoftwareBus_PubSub_Interface_t PubSubParams;
     CFE_SB_Listener_Component_t           ListenerParams;
-    EdsLib_DataTypeDB_TypeInfo_t          CmdHdrInfo;
     EdsLib_DataTypeDB_TypeInfo_t          FullCmdInfo;
     EdsLib_Id_t                           EdsId;
-    CFE_SB_Buffer_t *                     NextIngestBufPtr;
+
+    const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
+
+    BitSize = PacketSize * 8;
+
+    if (*NextIngestBufPtr == NULL)
+    {
+        *NextIngestBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(CFE_HDR_CommandHeader_Buffer_t));
+        if (*NextIngestBufPtr == NULL)
+        {
+            CFE_EVS_SendEvent(CI_LAB_INGEST_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CI: L%d, buffer allocation failed\n", __LINE__);
+            return CFE_SB_BUF_ALOC_ERR;
+        }
+    }
+
+    /* Packet is in external wire-format byte order - unpack it and copy */
+    EdsId  = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, *NextIngestBufPtr, PacketPtr,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize, 0);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(1): %d\n", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* Header decoded successfully - Now need to determine the type for the rest of the payload */
+    CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &(*NextIngestBufPtr)->Msg.BaseMsg);
+    CFE_MissionLib_UnmapListenerComponent(&ListenerParams, &PubSubParams);
+
+    status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telecommand_Interface_ID,
+                                            ListenerParams.Telecommand.TopicId, 1, 1, &EdsId);
+    if (status != CFE_MISSIONLIB_SUCCESS)
+    {
+        OS_printf("CFE_MissionLib_GetArgumentType(): %d\n", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, *NextIngestBufPtr, PacketPtr,
+                                                   sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize,
+                                                   sizeof(CFE_HDR_CommandHeader_t));
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(2): %d\n", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    /* Verify that the checksum and basic fields are correct, and recompute the length entry */
+    status = EdsLib_DataTypeDB_VerifyUnpackedObject(EDS_DB, EdsId, *NextIngestBufPtr, PacketPtr,
+                                                    EDSLIB_DATATYPEDB_RECOMPUTE_LENGTH);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_VerifyUnpackedObject(): %d\n", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &FullCmdInfo);
+    if (status != EDSLIB_SUCCESS)
+    {
+        OS_printf("EdsLib_DataTypeDB_GetTypeInfo(): %d\n", (int)status);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
+    CI_LAB_Global.HkTlm.Payload.IngestPackets++;
+    status = CFE_SB_TransmitBuffer(*NextIngestBufPtr, false);
+    CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+
+    if (status == CFE_SUCCESS)
+    {
+        /* Set NULL so a new buffer will be obtained next time around */
+        *NextIngestBufPtr = NULL;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(CI_LAB_INGEST_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CI: L%d, CFE_SB_TransmitBuffer() failed, status=%d\n", __LINE__, (int)status);
+    }
+
+    return CFE_SUCCESS;
+
+} /* End of CI_LAB_IngestPacket() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+/*                                                                            */
+/* CI_LAB_ReadUpLink() --                                                     */
+/*                                                                            */
+/* Drains the uplink socket in batches, so that a burst of packets costs one  */
+/* receive call per batch rather than one or more per packet.                 */
+/*                                                                            */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * **/
+void CI_LAB_ReadUpLink(void)
+{
+    int32                        status;
+    uint32                       i;
+    uint32                       NumIngested;
+    uint32                       NumReceived;
+    uint32                       BatchSize;
+    uint32                       BitSize;
+    EdsLib_DataTypeDB_TypeInfo_t CmdHdrInfo;
+    EdsLib_Id_t                  EdsId;
+    CFE_SB_Buffer_t *            NextIngestBufPtr;
+    OS_SockMsg_t *               Msg;
 
     const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
 
@@ -275,105 +377,71 @@ void CI_LAB_ReadUpLink(void)
         return;
     }
 
-    for (i = 0; i <= 10; i++)
+    for (i = 0; i < CI_LAB_INGEST_BATCH_SIZE; i++)
     {
-        status = OS_SocketRecvFrom(CI_LAB_Global.SocketID, CI_LAB_Global.NetworkBuffer,
-                                   sizeof(CI_LAB_Global.NetworkBuffer), &CI_LAB_Global.SocketAddress, OS_CHECK);
+        CI_LAB_Global.NetworkMsgs[i].Buffer     = CI_LAB_Global.NetworkBuffer[i];
+        CI_LAB_Global.NetworkMsgs[i].BufLen     = sizeof(CI_LAB_Global.NetworkBuffer[i]);
+        CI_LAB_Global.NetworkMsgs[i].RemoteAddr = NULL;
+    }
 
-        if (status >= 0)
+    NumIngested = 0;
+    status      = CFE_SUCCESS;
+    while (NumIngested < CI_LAB_MAX_INGEST && status == CFE_SUCCESS)
+    {
+        BatchSize = CI_LAB_MAX_INGEST - NumIngested;
+        if (BatchSize > CI_LAB_INGEST_BATCH_SIZE)
         {
-            BitSize = status;
-            BitSize *= 8;
+            BatchSize = CI_LAB_INGEST_BATCH_SIZE;
         }
-        else
+
+        status = OS_SocketRecvFromMulti(CI_LAB_Global.SocketID, CI_LAB_Global.NetworkMsgs, BatchSize, OS_CHECK);
+        if (status <= 0)
         {
-            BitSize = 0;
+            /* Nothing waiting */
+            break;
         }
 
-        if (BitSize >= CmdHdrInfo.Size.Bits)
+        NumReceived = status;
+        status      = CFE_SUCCESS;
+
+        for (i = 0; i < NumReceived && status == CFE_SUCCESS; i++)
         {
-            if (NextIngestBufPtr == NULL)
+            Msg     = &CI_LAB_Global.NetworkMsgs[i];
+            BitSize = Msg->ActualLength * 8;
+
+            if (BitSize >= CmdHdrInfo.Size.Bits)
             {
-                NextIngestBufPtr = CFE_SB_AllocateMessageBuffer(sizeof(CFE_HDR_CommandHeader_Buffer_t));
-                if (NextIngestBufPtr == NULL)
+                status = CI_LAB_IngestPacket(Msg->Buffer, Msg->ActualLength, &NextIngestBufPtr);
+                if (status != CFE_SUCCESS && status != CFE_SB_BUF_ALOC_ERR)
                 {
-                    CFE_EVS_SendEvent(CI_LAB_INGEST_ALLOC_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CI: L%d, buffer allocation failed\n", __LINE__);
-                    break;
+                    /*
+                     * The rest of the batch has already been taken off the socket,
+                     * so a bad packet is only counted and the next one is processed.
+                     * Only a buffer allocation failure stops the loop.
+                     */
+                    CI_LAB_Global.HkTlm.Payload.IngestErrors++;
+
+                    CFE_EVS_SendEvent(CI_LAB_INGEST_DECODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "CI: L%d, cmd dropped, decode failed, status=%d\n", __LINE__, (int)status);
+                    status = CFE_SUCCESS;
                 }
             }
-
-            /* Packet is in external wire-format byte order - unpack it and copy */
-            EdsId = EDSLIB_MAKE_ID(EDS_INDEX(CFE_HDR), CFE_HDR_CommandHeader_DATADICTIONARY);
-            status =
-                EdsLib_DataTypeDB_UnpackPartialObject(EDS_DB, &EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer,
-                                                      sizeof(CFE_HDR_CommandHeader_Buffer_t), BitSize, 0);
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(1): %d\n", (int)status);
-                break;
-            }
-
-            /* Header decoded successfully - Now need to determine the type for the rest of the payload */
-            CFE_MissionLib_Get_PubSub_Parameters(&PubSubParams, &NextIngestBufPtr->Msg.BaseMsg);
-            CFE_MissionLib_UnmapListenerComponent(&ListenerParams, &PubSubParams);
-
-            status = CFE_MissionLib_GetArgumentType(&CFE_SOFTWAREBUS_INTERFACE, CFE_SB_Telecommand_Interface_ID,
-                                                    ListenerParams.Telecommand.TopicId, 1, 1, &EdsId);
-            if (status != CFE_MISSIONLIB_SUCCESS)
-            {
-                OS_printf("CFE_MissionLib_GetArgumentType(): %d\n", (int)status);
-                break;
-            }
-
-            status = EdsLib_DataTypeDB_UnpackPartialObject(
-                EDS_DB, &EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer, sizeof(CFE_HDR_CommandHeader_Buffer_t),
-                BitSize, sizeof(CFE_HDR_CommandHeader_t));
-            if (status != EDSLIB_SUCCESS)
+            else if (Msg->ActualLength > 0)
             {
-                OS_printf("EdsLib_DataTypeDB_UnpackPartialObject(2): %d\n", (int)status);
-                break;
-            }
+                /* bad size, report as ingest error */
+                CI_LAB_Global.HkTlm.Payload.IngestErrors++;
 
-            /* Verify that the checksum and basic fields are correct, and recompute the length entry */
-            status = EdsLib_DataTypeDB_VerifyUnpackedObject(
-                EDS_DB, EdsId, NextIngestBufPtr, CI_LAB_Global.NetworkBuffer, EDSLIB_DATATYPEDB_RECOMPUTE_LENGTH);
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_VerifyUnpackedObject(): %d\n", (int)status);
-                break;
-            }
-
-            status = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &FullCmdInfo);
-            if (status != EDSLIB_SUCCESS)
-            {
-                OS_printf("EdsLib_DataTypeDB_GetTypeInfo(): %d\n", (int)status);
-                return;
+                CFE_EVS_SendEvent(CI_LAB_INGEST_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CI: L%d, cmd dropped, bad length=%u bits\n", __LINE__, (unsigned int)BitSize);
             }
+        }
 
-            CFE_ES_PerfLogEntry(CI_LAB_SOCKET_RCV_PERF_ID);
-            CI_LAB_Global.HkTlm.Payload.IngestPackets++;
-            status = CFE_SB_TransmitBuffer(NextIngestBufPtr, false);
-            CFE_ES_PerfLogExit(CI_LAB_SOCKET_RCV_PERF_ID);
+        NumIngested += NumReceived;
 
-            if (status == CFE_SUCCESS)
-            {
-                /* Set NULL so a new buffer will be obtained next time around */
-                NextIngestBufPtr = NULL;
-            }
-            else
-            {
-                CFE_EVS_SendEvent(CI_LAB_INGEST_SEND_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "CI: L%d, CFE_SB_TransmitBuffer() failed, status=%d\n", __LINE__, (int)status);
-            }
-        }
-        else if (status > 0)
+        if (NumReceived < BatchSize)
         {
-            /* bad size, report as ingest error */
-            CI_LAB_Global.HkTlm.Payload.IngestErrors++;
-
-            CFE_EVS_SendEvent(CI_LAB_INGEST_LEN_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "CI: L%d, cmd dropped, bad length=%u bits\n", __LINE__, (unsigned int)BitSize);
+            /* The socket has been drained */
+            break;
         }
     }
 
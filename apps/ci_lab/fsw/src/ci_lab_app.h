@@ -47,6 +47,13 @@
 #define CI_LAB_BASE_UDP_PORT 1234
 #define CI_LAB_PIPE_DEPTH    32
 
+/*
+ * Number of uplink packets received from the socket in one call, and the
+ * maximum number of packets ingested each time the uplink is read
+ */
+#define CI_LAB_INGEST_BATCH_SIZE 8
+#define CI_LAB_MAX_INGEST        16
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -59,7 +66,8 @@ typedef struct
 
     CI_LAB_HkTlm_t HkTlm;
 
-    CFE_HDR_Message_PackedBuffer_t NetworkBuffer;
+    CFE_HDR_Message_PackedBuffer_t NetworkBuffer[CI_LAB_INGEST_BATCH_SIZE];
+    OS_SockMsg_t                   NetworkMsgs[CI_LAB_INGEST_BATCH_SIZE];
 
 } CI_LAB_GlobalData_t;
 
@@ -77,6 +85,7 @@ void CI_LAB_TaskInit(void);
 void CI_LAB_ProcessCommandPacket(CFE_SB_Buffer_t *SBBufPtr);
 void CI_LAB_ResetCounters_Internal(void);
 void CI_LAB_ReadUpLink(void);
+int32 CI_LAB_IngestPacket(const void *PacketPtr, size_t PacketSize, CFE_SB_Buffer_t **NextIngestBufPtr);
 
 /*
  * Individual message handler function prototypes
@@ -29,18 +29,19 @@
 #ifndef _ci_lab_events_h_
 #define _ci_lab_events_h_
 
-#define CI_LAB_RESERVED_EID         0
-#define CI_LAB_SOCKETCREATE_ERR_EID 1
-#define CI_LAB_SOCKETBIND_ERR_EID   2
-#define CI_LAB_STARTUP_INF_EID      3
-#define CI_LAB_COMMAND_ERR_EID      4
-#define CI_LAB_COMMANDNOP_INF_EID   5
-#define CI_LAB_COMMANDRST_INF_EID   6
-#define CI_LAB_INGEST_INF_EID       7
-#define CI_LAB_INGEST_LEN_ERR_EID   8
-#define CI_LAB_INGEST_ALLOC_ERR_EID 9
-#define CI_LAB_INGEST_SEND_ERR_EID  10
-#define CI_LAB_LEN_ERR_EID          16
+#define CI_LAB_RESERVED_EID          0
+#define CI_LAB_SOCKETCREATE_ERR_EID  1
+#define CI_LAB_SOCKETBIND_ERR_EID    2
+#define CI_LAB_STARTUP_INF_EID       3
+#define CI_LAB_COMMAND_ERR_EID       4
+#define CI_LAB_COMMANDNOP_INF_EID    5
+#define CI_LAB_COMMANDRST_INF_EID    6
+#define CI_LAB_INGEST_INF_EID        7
+#define CI_LAB_INGEST_LEN_ERR_EID    8
+#define CI_LAB_INGEST_ALLOC_ERR_EID  9
+#define CI_LAB_INGEST_SEND_ERR_EID   10
+#define CI_LAB_INGEST_DECODE_ERR_EID 11
+#define CI_LAB_LEN_ERR_EID           16
 
 #endif /* _ci_lab_events_h_ */
 
@@ -70,7 +70,8 @@ typedef struct
     TO_LAB_HkTlm_t        HkTlm;
     TO_LAB_DataTypesTlm_t DataTypesTlm;
 
-    CFE_HDR_TelemetryHeader_PackedBuffer_t NetworkBuffer;
+    CFE_HDR_TelemetryHeader_PackedBuffer_t NetworkBuffer[TO_LAB_TLM_BATCH_SIZE];
+    OS_SockMsg_t                           NetworkMsgs[TO_LAB_TLM_BATCH_SIZE];
 } TO_LAB_GlobalData_t;
 
 TO_LAB_GlobalData_t TO_LAB_Global;
@@ -617,51 +618,72 @@ void TO_LAB_forward_telemetry(void)
     OS_SockAddr_t    d_addr;
     int32            status;
     int32            CFE_SB_status;
-    CFE_SB_Buffer_t *SBBufPtr;
+    int32            PackStatus;
+    CFE_SB_Buffer_t *SBBufPtrs[TO_LAB_TLM_BATCH_SIZE];
+    uint32           BufCount;
+    uint32           MsgCount;
+    uint32           i;
     size_t           DataSize;
 
     OS_SocketAddrInit(&d_addr, OS_SocketDomain_INET);
     OS_SocketAddrSetPort(&d_addr, cfgTLM_PORT);
     OS_SocketAddrFromString(&d_addr, TO_LAB_Global.tlm_dest_IP);
-    status = 0;
 
     do
     {
-        CFE_SB_status = CFE_SB_ReceiveBuffer(&SBBufPtr, TO_LAB_Global.Tlm_pipe, CFE_SB_POLL);
-
-        if ((CFE_SB_status == CFE_SUCCESS) && (TO_LAB_Global.suppress_sendto == false))
+        CFE_SB_status = CFE_SB_ReceiveBuffers(SBBufPtrs, TO_LAB_TLM_BATCH_SIZE, &BufCount, TO_LAB_Global.Tlm_pipe,
+                                              CFE_SB_POLL);
+
+        /*
+         * Pack the whole batch first, then hand it to the network in a single call.
+         * If CFE_SB_status != CFE_SUCCESS, then BufCount is 0 and no packets were received.
+         */
+        MsgCount = 0;
+        if (TO_LAB_Global.suppress_sendto == false && TO_LAB_Global.downlink_on == true)
         {
-            if (TO_LAB_Global.downlink_on == true)
-            {
-                CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
+            CFE_ES_PerfLogEntry(TO_SOCKET_SEND_PERF_ID);
 
-                DataSize      = sizeof(TO_LAB_Global.NetworkBuffer);
-                CFE_SB_status = TO_LAB_EDS_PackOutputMessage(TO_LAB_Global.NetworkBuffer, &SBBufPtr->Msg, &DataSize);
+            for (i = 0; i < BufCount; ++i)
+            {
+                DataSize   = sizeof(TO_LAB_Global.NetworkBuffer[MsgCount]);
+                PackStatus = TO_LAB_EDS_PackOutputMessage(TO_LAB_Global.NetworkBuffer[MsgCount], &SBBufPtrs[i]->Msg,
+                                                          &DataSize);
 
-                if (CFE_SB_status != CFE_SUCCESS)
+                if (PackStatus != CFE_SUCCESS)
                 {
                     CFE_EVS_SendEvent(TO_MSGID_ERR_EID, CFE_EVS_EventType_ERROR, "Error packing output: %d\n",
-                                      (int)CFE_SB_status);
+                                      (int)PackStatus);
                 }
                 else
                 {
-                    status = OS_SocketSendTo(TO_LAB_Global.TLMsockid, TO_LAB_Global.NetworkBuffer, DataSize, &d_addr);
+                    TO_LAB_Global.NetworkMsgs[MsgCount].Buffer     = TO_LAB_Global.NetworkBuffer[MsgCount];
+                    TO_LAB_Global.NetworkMsgs[MsgCount].BufLen     = DataSize;
+                    TO_LAB_Global.NetworkMsgs[MsgCount].RemoteAddr = &d_addr;
+                    ++MsgCount;
                 }
-
-                CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
-            }
-            else
-            {
-                status = 0;
             }
-            if (status < 0)
+
+            if (MsgCount > 0)
             {
-                CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
-                TO_LAB_Global.suppress_sendto = true;
+                status = OS_SocketSendToMulti(TO_LAB_Global.TLMsockid, TO_LAB_Global.NetworkMsgs, MsgCount);
+
+                /* Anything short of the full batch means a send failed */
+                if (status < (int32)MsgCount)
+                {
+                    CFE_EVS_SendEvent(TO_TLMOUTSTOP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "L%d TO sendto error %d. Tlm output suppressed\n", __LINE__, (int)status);
+                    TO_LAB_Global.suppress_sendto = true;
+                }
             }
+
+            CFE_ES_PerfLogExit(TO_SOCKET_SEND_PERF_ID);
+        }
+
+        /* The buffers are held until released, whether or not they were sent */
+        if (BufCount > 0)
+        {
+            CFE_SB_ReleaseBuffers(SBBufPtrs, BufCount, TO_LAB_Global.Tlm_pipe);
         }
-        /* If CFE_SB_status != CFE_SUCCESS, then no packet was received from CFE_SB_ReceiveBuffer() */
     } while (CFE_SB_status == CFE_SUCCESS);
 }
 
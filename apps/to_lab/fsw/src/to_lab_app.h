@@ -54,6 +54,12 @@
  */
 #define TO_LAB_TLM_PIPE_DEPTH OS_QUEUE_MAX_DEPTH
 
+/**
+ * Maximum number of telemetry buffers taken from the pipe in one receive call,
+ * which is also the number of packets sent to the network in one send call
+ */
+#define TO_LAB_TLM_BATCH_SIZE 16
+
 #define cfgTLM_ADDR        "192.168.1.81"
 #define cfgTLM_PORT        1235
 #define TO_LAB_VERSION_NUM "5.1.0"
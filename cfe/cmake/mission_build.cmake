@@ -440,6 +440,7 @@ function(prepare)
 
   # Include all the EDS libaries and tools which are built for the host system
   include_directories(${MISSION_BINARY_DIR}/inc)
+  add_subdirectory(${crc_MISSION_DIR} eds/crc)
   add_subdirectory(${MISSION_SOURCE_DIR}/tools/eds/edslib eds/edslib)
   add_subdirectory(${MISSION_SOURCE_DIR}/tools/eds/tool   eds/tool)
   add_subdirectory(${MISSION_SOURCE_DIR}/tools/eds/cfecfs eds/cfecfs)
@@ -24,6 +24,7 @@ set(MISSION_CORE_INTERFACES
 # NOTE: Everything in this list becomes part of the "core_api" interface above.
 # Missions may add/remove/replace components in this list as needed.
 set(MISSION_CORE_MODULES
+    "crc"           # shared CRC engine, must precede its users (edslib, es)
     "edslib"
     "missionlib"
     "es"
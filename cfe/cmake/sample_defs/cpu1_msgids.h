@@ -115,20 +115,21 @@
 /*
 ** CFE Telemetry Message Id's
 */
-#define CFE_ES_HK_TLM_MID           CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_HK_TLM_TOPICID)
-#define CFE_EVS_HK_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_HK_TLM_TOPICID)
-#define CFE_TEST_HK_TLM_MID         CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TEST_HK_TLM_TOPICID)
-#define CFE_SB_HK_TLM_MID           CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_HK_TLM_TOPICID)
-#define CFE_TBL_HK_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TBL_HK_TLM_TOPICID)
-#define CFE_TIME_HK_TLM_MID         CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TIME_HK_TLM_TOPICID)
-#define CFE_TIME_DIAG_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TIME_DIAG_TLM_TOPICID)
-#define CFE_EVS_LONG_EVENT_MSG_MID  CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_LONG_EVENT_MSG_TOPICID)
-#define CFE_EVS_SHORT_EVENT_MSG_MID CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_SHORT_EVENT_MSG_TOPICID)
-#define CFE_SB_STATS_TLM_MID        CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_STATS_TLM_TOPICID)
-#define CFE_ES_APP_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_APP_TLM_TOPICID)
-#define CFE_TBL_REG_TLM_MID         CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TBL_REG_TLM_TOPICID)
-#define CFE_SB_ALLSUBS_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ALLSUBS_TLM_TOPICID)
-#define CFE_SB_ONESUB_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ONESUB_TLM_TOPICID)
-#define CFE_ES_MEMSTATS_TLM_MID     CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_MEMSTATS_TLM_TOPICID)
+#define CFE_ES_HK_TLM_MID            CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_HK_TLM_TOPICID)
+#define CFE_EVS_HK_TLM_MID           CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_HK_TLM_TOPICID)
+#define CFE_TEST_HK_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TEST_HK_TLM_TOPICID)
+#define CFE_SB_HK_TLM_MID            CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_HK_TLM_TOPICID)
+#define CFE_TBL_HK_TLM_MID           CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TBL_HK_TLM_TOPICID)
+#define CFE_TIME_HK_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TIME_HK_TLM_TOPICID)
+#define CFE_TIME_DIAG_TLM_MID        CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TIME_DIAG_TLM_TOPICID)
+#define CFE_EVS_LONG_EVENT_MSG_MID   CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_LONG_EVENT_MSG_TOPICID)
+#define CFE_EVS_SHORT_EVENT_MSG_MID  CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_SHORT_EVENT_MSG_TOPICID)
+#define CFE_EVS_BINARY_EVENT_MSG_MID CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_EVS_BINARY_EVENT_MSG_TOPICID)
+#define CFE_SB_STATS_TLM_MID         CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_STATS_TLM_TOPICID)
+#define CFE_ES_APP_TLM_MID           CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_APP_TLM_TOPICID)
+#define CFE_TBL_REG_TLM_MID          CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_TBL_REG_TLM_TOPICID)
+#define CFE_SB_ALLSUBS_TLM_MID       CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ALLSUBS_TLM_TOPICID)
+#define CFE_SB_ONESUB_TLM_MID        CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_SB_ONESUB_TLM_TOPICID)
+#define CFE_ES_MEMSTATS_TLM_MID      CFE_PLATFORM_TLM_TOPICID_TO_MID(CFE_MISSION_ES_MEMSTATS_TLM_TOPICID)
 
 #endif /* CPU1_MSGIDS_H */
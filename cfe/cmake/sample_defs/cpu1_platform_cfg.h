@@ -919,7 +919,8 @@
 **  \par Description:
 **       Defines the maximum size of the performance data buffer. Units are number of
 **       performance data entries. An entry is defined by a 32 bit data word followed
-**       by a 64 bit time stamp.
+**       by a 64 bit time stamp.  A further 32 bit sequence word per entry is kept in
+**       the reset area, so that entries can be added without a lock.
 **
 **  \par Limits
 **       There is a lower limit of 1025.  There are no restrictions on the upper limit
@@ -1431,15 +1432,41 @@
 **  \cfeevscfg Default EVS Message Format Mode
 **
 **  \par Description:
-**       Defines the default message format (long or short) for event messages being
-**       sent to the ground. Choose between #CFE_EVS_MsgFormat_LONG or
-**       #CFE_EVS_MsgFormat_SHORT.
+**       Defines the default message format (long, short or binary) for event messages
+**       being sent to the ground. Choose between #CFE_EVS_MsgFormat_LONG,
+**       #CFE_EVS_MsgFormat_SHORT or #CFE_EVS_MsgFormat_BINARY.  Binary format
+**       messages carry the format string ID and packed arguments instead of
+**       the message text, which ground tools expand using the event format
+**       catalog generated by the build.
 **
 **  \par Limits
-**       The valid settings are #CFE_EVS_MsgFormat_LONG or #CFE_EVS_MsgFormat_SHORT
+**       The valid settings are #CFE_EVS_MsgFormat_LONG, #CFE_EVS_MsgFormat_SHORT
+**       or #CFE_EVS_MsgFormat_BINARY
 */
 #define CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE CFE_EVS_MsgFormat_LONG
 
+/**
+**  \cfeevscfg Depth of the Per-Application Deferred Event Queue
+**
+**  \par Description:
+**       When non-zero, events sent by registered applications are not formatted
+**       and output on the caller's thread.  Instead the event ID, type, timestamp
+**       and a copy of the format arguments are placed into a per-application
+**       queue, and an EVS child task formats, logs and sends them.  This keeps
+**       the cost of an event burst off time-critical application threads.
+**
+**       Events that arrive while the sending application's queue is full are
+**       discarded and counted in the EVS housekeeping telemetry.
+**
+**       A value of zero selects the traditional synchronous behavior, and no
+**       queue memory is allocated.
+**
+**  \par Limits
+**       Must be zero or a power of two of at least 2.  Each entry occupies roughly
+**       twice #CFE_MISSION_EVS_MAX_MESSAGE_LENGTH bytes per application.
+*/
+#define CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH 0
+
 /* Platform Configuration Parameters for Table Service (TBL) */
 
 /**
@@ -1650,12 +1677,13 @@
 **      During startup, some tasks may need to synchronize their own initialization
 **      with the initialization of other applications in the system.
 **
-**      CFE ES implements an API to accomplish this, that performs a task delay (sleep)
-**      while polling the overall system state until other tasks are ready.
+**      CFE ES implements an API to accomplish this.  Waiting tasks normally block on
+**      a semaphore that ES gives whenever the system or application state changes.
 **
-**      This value controls the amount of time that the CFE_ES_ApplicationSyncDelay
-**      will sleep between each check of the system state.  This should be large enough
-**      to allow other tasks to run, but not so large as to noticeably delay the startup
+**      This value controls the amount of time that the startup sync waits will sleep
+**      between each check of the system state if that semaphore is not usable, in
+**      which case ES falls back to polling.  This should be large enough to allow
+**      other tasks to run, but not so large as to noticeably delay the startup
 **      completion.
 **
 **      Units are in milliseconds
@@ -1708,4 +1736,60 @@
 */
 #define CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC 1000
 
+/** \cfeescfg Startup script module load workers
+**
+**  \par Description:
+**      The number of helper tasks CFE ES creates to load application modules listed
+**      in the startup script.  Consecutive CFE_APP entries have their modules loaded
+**      and entry points looked up concurrently by these tasks and the ES startup task.
+**      Each CFE_LIB entry is loaded only after all preceding apps, and before any
+**      following app is loaded.  App main tasks are always created in script order.
+**
+**      If set to zero, all modules are loaded one at a time by the ES startup task.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to zero.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS 4
+
+/** \cfeescfg Startup script module load worker stack size
+**
+**  \par Description:
+**      The stack size of each startup script module load worker task.  The OS
+**      loader may run library constructors on this stack, so it is larger than
+**      the stack of the ES startup task.
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than
+**       or equal to 2048.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_STACK_SIZE 32768
+
+/** \cfeescfg Startup script module load worker priority
+**
+**  \par Description:
+**      The priority of the startup script module load worker tasks.
+**
+**  \par Limits:
+**       Must be defined as an integer value between 0 and 255,
+**       where lower numbers are higher priority.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY 68
+
+/** \cfeescfg Startup script module load worker timeout
+**
+**  \par Description:
+**      The time the ES startup task waits for the load workers to finish a batch
+**      of module loads, or to exit at the end of the startup script.  A worker
+**      that does not finish in time is deleted and reported in the syslog, and
+**      the remaining modules are loaded by the ES startup task itself.
+**
+**      Units are in milliseconds
+**
+**  \par Limits:
+**       Must be defined as an integer value that is greater than zero.
+*/
+#define CFE_PLATFORM_ES_STARTUP_LOAD_TIMEOUT_MSEC 10000
+
 #endif /* CPU1_PLATFORM_CFG_H */
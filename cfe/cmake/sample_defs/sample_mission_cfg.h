@@ -44,11 +44,10 @@
 
 /** \name Checksum/CRC algorithm identifiers */
 /** \{ */
-#define CFE_MISSION_ES_CRC_8  1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
-#define CFE_MISSION_ES_CRC_16 2 /**< \brief CRC (16 bit additive - returns 32 bit total) */
-#define CFE_MISSION_ES_CRC_32                                                              \
-    3 /**< \brief CRC (32 bit additive - returns 32 bit total) (Currently not implemented) \
-       */
+#define CFE_MISSION_ES_CRC_8   1 /**< \brief CRC ( 8 bit additive - returns 32 bit total) (Currently not implemented) */
+#define CFE_MISSION_ES_CRC_16  2 /**< \brief CRC-16/ARC (returns 32 bit total) */
+#define CFE_MISSION_ES_CRC_32  3 /**< \brief CRC-32 as used by IEEE 802.3 and zlib (returns 32 bit total) */
+#define CFE_MISSION_ES_CRC_32C 4 /**< \brief CRC-32C (Castagnoli) (returns 32 bit total) */
 /** \} */
 
 /**
@@ -60,7 +59,9 @@
 **      Table Image data integrity values.
 **
 **  \par Limits
-**      Currently only CFE_MISSION_ES_CRC_16 is supported (see #CFE_MISSION_ES_CRC_16)
+**      Must be CFE_MISSION_ES_CRC_16, CFE_MISSION_ES_CRC_32 or CFE_MISSION_ES_CRC_32C.
+**      Changing this changes the CRC of all table images and CDS blocks, so
+**      ground tools that check table CRCs must use the same algorithm.
 */
 #define CFE_MISSION_ES_DEFAULT_CRC CFE_MISSION_ES_CRC_16
 
@@ -67,6 +67,7 @@ void CFE_TestMain(void)
     ESCounterTestSetup();
     ESInfoTestSetup();
     ESMemPoolTestSetup();
+    ESMemPoolPerformanceTestSetup();
     ESMiscTestSetup();
     ESPerfTestSetup();
     ESResourceIDTestSetup();
@@ -78,12 +79,14 @@ void CFE_TestMain(void)
     MessageIdTestSetup();
     MsgApiTestSetup();
     ResourceIdMiscTestSetup();
+    SBPerformanceTestSetup();
     SBPipeMangSetup();
     SBSendRecvTestSetup();
     SBSubscriptionTestSetup();
     TBLContentAccessTestSetup();
     TBLContentMangTestSetup();
     TBLInformationTestSetup();
+    TBLPerformanceTestSetup();
     TBLRegistrationTestSetup();
     TimeArithmeticTestSetup();
     TimeConversionTestSetup();
@@ -79,6 +79,7 @@ void ESCDSTestSetup(void);
 void ESCounterTestSetup(void);
 void ESInfoTestSetup(void);
 void ESMemPoolTestSetup(void);
+void ESMemPoolPerformanceTestSetup(void);
 void ESMiscTestSetup(void);
 void ESPerfTestSetup(void);
 void ESResourceIDTestSetup(void);
@@ -90,12 +91,14 @@ void FSUtilTestSetup(void);
 void MessageIdTestSetup(void);
 void MsgApiTestSetup(void);
 void ResourceIdMiscTestSetup(void);
+void SBPerformanceTestSetup(void);
 void SBPipeMangSetup(void);
 void SBSendRecvTestSetup(void);
 void SBSubscriptionTestSetup(void);
 void TBLContentAccessTestSetup(void);
 void TBLContentMangTestSetup(void);
 void TBLInformationTestSetup(void);
+void TBLPerformanceTestSetup(void);
 void TBLRegistrationTestSetup(void);
 void TimeArithmeticTestSetup(void);
 void TimeConversionTestSetup(void);
@@ -0,0 +1,228 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Performance benchmark of the ES memory pool
+ * CFE_ES_GetPoolBuf - Gets a buffer from the memory pool.
+ * CFE_ES_PutPoolBuf - Releases a buffer to the memory pool.
+ *
+ * A number of child tasks repeatedly get and put a buffer from the same
+ * pool.  Each task uses a different buffer size, so with lock-free free
+ * lists the tasks do not share a bucket.  The aggregate rate of get/put
+ * pairs per second is reported for 1 to 16 tasks, for a pool using only
+ * the mutex, a pool with lock-free free lists, and a pool with lock-free
+ * free lists and a per-task cache.
+ *
+ * The results are informational only; the benchmark is intended to be run on
+ * the target before and after changes to the memory pool for comparison.
+ */
+
+#include "cfe_test.h"
+
+#define CFE_FT_POOLPERF_MAX_TASKS      16
+#define CFE_FT_POOLPERF_PAIRS_PER_TASK 20000
+#define CFE_FT_POOLPERF_POOL_SIZE      65536
+
+/*
+ * State for a single task
+ */
+typedef struct
+{
+    volatile bool Done;
+    uint32        Errors;
+    size_t        BufSize;
+} CFE_FT_PoolPerfTask_t;
+
+/*
+ * Overall benchmark state, shared between the test task and the child tasks
+ */
+typedef struct
+{
+    volatile bool         Running;
+    volatile uint32       NumClaimed;
+    osal_id_t             ClaimMutex;
+    uint32                RunNumber;
+    CFE_ES_MemHandle_t    PoolID;
+    CFE_FT_PoolPerfTask_t Task[CFE_FT_POOLPERF_MAX_TASKS];
+    CFE_ES_PoolAlign_t    Mem[CFE_FT_POOLPERF_POOL_SIZE / sizeof(CFE_ES_PoolAlign_t)];
+} CFE_FT_PoolPerfState_t;
+
+static CFE_FT_PoolPerfState_t CFE_FT_PoolPerf;
+
+void CFE_FT_PoolPerfChildTask(void)
+{
+    CFE_FT_PoolPerfTask_t *Task;
+    CFE_ES_MemPoolBuf_t    BufPtr;
+    uint32                 i;
+
+    /* Claim the next task slot */
+    OS_MutSemTake(CFE_FT_PoolPerf.ClaimMutex);
+    Task = &CFE_FT_PoolPerf.Task[CFE_FT_PoolPerf.NumClaimed];
+    ++CFE_FT_PoolPerf.NumClaimed;
+    OS_MutSemGive(CFE_FT_PoolPerf.ClaimMutex);
+
+    /* Wait for all tasks to be ready, so they all start at the same time */
+    while (!CFE_FT_PoolPerf.Running)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (i = 0; i < CFE_FT_POOLPERF_PAIRS_PER_TASK; ++i)
+    {
+        if (CFE_ES_GetPoolBuf(&BufPtr, CFE_FT_PoolPerf.PoolID, Task->BufSize) != (int32)Task->BufSize)
+        {
+            ++Task->Errors;
+            break;
+        }
+
+        /* Touch the buffer, as a real user would */
+        *((uint8 *)BufPtr) = (uint8)i;
+
+        if (CFE_ES_PutPoolBuf(CFE_FT_PoolPerf.PoolID, BufPtr) != (int32)Task->BufSize)
+        {
+            ++Task->Errors;
+            break;
+        }
+    }
+
+    Task->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+/*
+ * Runs the given number of tasks against a new pool created with the given options.
+ * Returns the rate in get/put pairs per second.
+ */
+uint32 CFE_FT_PoolPerfRun(uint32 Options, uint32 NumTasks)
+{
+    CFE_ES_TaskId_t TaskId;
+    OS_time_t       StartTime;
+    OS_time_t       EndTime;
+    int64           ElapsedUs;
+    uint32          NumDone;
+    uint32          NumErrors;
+    uint32          i;
+    char            TaskName[OS_MAX_API_NAME];
+
+    UtAssert_INT32_EQ(CFE_ES_PoolCreateEx(&CFE_FT_PoolPerf.PoolID, CFE_FT_PoolPerf.Mem, sizeof(CFE_FT_PoolPerf.Mem),
+                                          0, NULL, Options),
+                      CFE_SUCCESS);
+
+    memset(CFE_FT_PoolPerf.Task, 0, sizeof(CFE_FT_PoolPerf.Task));
+    CFE_FT_PoolPerf.Running    = false;
+    CFE_FT_PoolPerf.NumClaimed = 0;
+    ++CFE_FT_PoolPerf.RunNumber;
+
+    /* A different size for each task, spread over the default block sizes */
+    for (i = 0; i < NumTasks; ++i)
+    {
+        CFE_FT_PoolPerf.Task[i].BufSize = 24 + (i * 60);
+    }
+
+    for (i = 0; i < NumTasks; ++i)
+    {
+        /* The tasks from a previous run may not be cleaned up yet, so use unique names */
+        snprintf(TaskName, sizeof(TaskName), "POOLPERF%u.%u", (unsigned int)CFE_FT_PoolPerf.RunNumber,
+                 (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, TaskName, CFE_FT_PoolPerfChildTask,
+                                                 CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE,
+                                                 CFE_PLATFORM_ES_PERF_CHILD_PRIORITY, 0),
+                          CFE_SUCCESS);
+    }
+
+    /* Give the tasks a chance to reach their start line */
+    while (CFE_FT_PoolPerf.NumClaimed < NumTasks)
+    {
+        OS_TaskDelay(10);
+    }
+
+    OS_GetLocalTime(&StartTime);
+    CFE_FT_PoolPerf.Running = true;
+
+    do
+    {
+        OS_TaskDelay(1);
+
+        NumDone = 0;
+        for (i = 0; i < NumTasks; ++i)
+        {
+            if (CFE_FT_PoolPerf.Task[i].Done)
+            {
+                ++NumDone;
+            }
+        }
+    } while (NumDone < NumTasks);
+
+    OS_GetLocalTime(&EndTime);
+
+    NumErrors = 0;
+    for (i = 0; i < NumTasks; ++i)
+    {
+        NumErrors += CFE_FT_PoolPerf.Task[i].Errors;
+    }
+    UtAssert_UINT32_EQ(NumErrors, 0);
+
+    UtAssert_INT32_EQ(CFE_ES_PoolDelete(CFE_FT_PoolPerf.PoolID), CFE_SUCCESS);
+
+    ElapsedUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (ElapsedUs <= 0)
+    {
+        ElapsedUs = 1;
+    }
+
+    return (uint32)(((int64)NumTasks * CFE_FT_POOLPERF_PAIRS_PER_TASK * 1000000) / ElapsedUs);
+}
+
+void TestMemPoolThroughput(void)
+{
+    static const uint32 TaskCounts[] = {1, 2, 4, 8, 16};
+    uint32              MutexRate;
+    uint32              LockFreeRate;
+    uint32              CacheRate;
+    uint32              i;
+
+    UtPrintf("Testing: CFE_ES_GetPoolBuf/CFE_ES_PutPoolBuf throughput");
+
+    UtAssert_INT32_EQ(OS_MutSemCreate(&CFE_FT_PoolPerf.ClaimMutex, "PoolPerfMutex", 0), OS_SUCCESS);
+
+    for (i = 0; i < (sizeof(TaskCounts) / sizeof(TaskCounts[0])); ++i)
+    {
+        MutexRate    = CFE_FT_PoolPerfRun(CFE_ES_USE_MUTEX, TaskCounts[i]);
+        LockFreeRate = CFE_FT_PoolPerfRun(CFE_ES_USE_MUTEX | CFE_ES_POOL_LOCK_FREE, TaskCounts[i]);
+        CacheRate    = CFE_FT_PoolPerfRun(CFE_ES_USE_MUTEX | CFE_ES_POOL_LOCK_FREE | CFE_ES_POOL_TASK_CACHE,
+                                          TaskCounts[i]);
+
+        UtPrintf("%2u task(s): mutex %lu pairs/s, lock-free %lu pairs/s, lock-free+cache %lu pairs/s",
+                 (unsigned int)TaskCounts[i], (unsigned long)MutexRate, (unsigned long)LockFreeRate,
+                 (unsigned long)CacheRate);
+    }
+
+    UtAssert_INT32_EQ(OS_MutSemDelete(CFE_FT_PoolPerf.ClaimMutex), OS_SUCCESS);
+}
+
+void ESMemPoolPerformanceTestSetup(void)
+{
+    UtTest_Add(TestMemPoolThroughput, NULL, NULL, "Test ES Memory Pool Throughput");
+}
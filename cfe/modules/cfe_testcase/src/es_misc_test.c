@@ -55,11 +55,70 @@ void TestCalculateCRC(void)
     UtAssert_VOIDCALL(Result = CFE_ES_CalculateCRC(Data, sizeof(Data), 0, CFE_MISSION_ES_CRC_32));
     UtAssert_MIR("Confirm CRC32 of \"%s\" is %lu", Data, (unsigned long)Result);
 
+    /* Standard check values */
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+#ifdef CFE_MISSION_ES_CRC_32C
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
+#endif
+
     /* NULL input or 0 size returns input crc */
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(NULL, sizeof(Data), inputCrc, CFE_MISSION_ES_CRC_16), inputCrc);
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(Data, 0, inputCrc, CFE_MISSION_ES_CRC_16), inputCrc);
 }
 
+/*
+ * Reports the rate of CFE_ES_CalculateCRC in bytes per second for each algorithm.
+ * The results are informational only, for comparison between builds and targets.
+ */
+void TestCalculateCRCThroughput(void)
+{
+    static uint8 Buffer[16384];
+    static const struct
+    {
+        uint32      TypeCRC;
+        const char *Name;
+    } Algorithms[] = {
+        {CFE_MISSION_ES_CRC_16, "CRC16"},
+        {CFE_MISSION_ES_CRC_32, "CRC32"},
+#ifdef CFE_MISSION_ES_CRC_32C
+        {CFE_MISSION_ES_CRC_32C, "CRC32C"},
+#endif
+    };
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     ElapsedUs;
+    uint32    Crc;
+    uint32    i;
+    uint32    j;
+
+    UtPrintf("Testing: CFE_ES_CalculateCRC throughput");
+
+    for (i = 0; i < sizeof(Buffer); ++i)
+    {
+        Buffer[i] = (uint8)(i * 31);
+    }
+
+    for (i = 0; i < (sizeof(Algorithms) / sizeof(Algorithms[0])); ++i)
+    {
+        Crc = 0;
+        OS_GetLocalTime(&StartTime);
+        for (j = 0; j < 1024; ++j)
+        {
+            Crc = CFE_ES_CalculateCRC(Buffer, sizeof(Buffer), Crc, Algorithms[i].TypeCRC);
+        }
+        OS_GetLocalTime(&EndTime);
+
+        ElapsedUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+        if (ElapsedUs <= 0)
+        {
+            ElapsedUs = 1;
+        }
+
+        UtAssert_MIR("%s: %lu bytes/s (CRC 0x%08lx)", Algorithms[i].Name,
+                     (unsigned long)(((int64)sizeof(Buffer) * 1024 * 1000000) / ElapsedUs), (unsigned long)Crc);
+    }
+}
+
 void TestWriteToSysLog(void)
 {
     const char *TestString = "Test String for CFE_ES_WriteToSysLog Functional Test";
@@ -109,6 +168,7 @@ void TestBackgroundWakeup(void)
 void ESMiscTestSetup(void)
 {
     UtTest_Add(TestCalculateCRC, NULL, NULL, "Test Calculate CRC");
+    UtTest_Add(TestCalculateCRCThroughput, NULL, NULL, "Test Calculate CRC Throughput");
     UtTest_Add(TestWriteToSysLog, NULL, NULL, "Test Write To Sys Log");
     UtTest_Add(TestProcessAsyncEvent, NULL, NULL, "Test Process Async Event");
     UtTest_Add(TestBackgroundWakeup, NULL, NULL, "Test Background Wakeup");
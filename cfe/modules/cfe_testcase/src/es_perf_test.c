@@ -65,10 +65,36 @@ void TestPerfLogTrigger(void)
     UtAssert_VOIDCALL(CFE_ES_PerfLogExit(126));
 }
 
+/*
+ * Reports the average cost of a marker, for comparison purposes only.
+ * This depends on whether performance data collection was started
+ * in the functional test workflow.
+ */
+void TestPerfLogAddCost(void)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     ElapsedNs;
+    uint32    i;
+
+    OS_GetLocalTime(&StartTime);
+    for (i = 0; i < 100000; ++i)
+    {
+        CFE_ES_PerfLogEntry(CFE_MISSION_ES_PERF_MAX_IDS - 1);
+        CFE_ES_PerfLogExit(CFE_MISSION_ES_PERF_MAX_IDS - 1);
+    }
+    OS_GetLocalTime(&EndTime);
+
+    ElapsedNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(EndTime, StartTime));
+
+    UtPrintf("CFE_ES_PerfLogAdd: %ld ns per marker", (long)(ElapsedNs / 200000));
+}
+
 void ESPerfTestSetup(void)
 {
     UtTest_Add(TestPerfLogEntry, NULL, NULL, "Test PerfLogEntry");
     UtTest_Add(TestPerfLogExit, NULL, NULL, "Test PerfLogExit");
     UtTest_Add(TestPerfLogAdd, NULL, NULL, "Test PerfLogAdd");
     UtTest_Add(TestPerfLogTrigger, NULL, NULL, "Test Perf Trigger");
+    UtTest_Add(TestPerfLogAddCost, NULL, NULL, "Test PerfLogAdd Cost");
 }
@@ -0,0 +1,407 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Performance benchmark of the SB transmit path
+ * CFE_SB_TransmitMsg - Transmit a message.
+ * CFE_SB_TransmitMsgs - Transmit several messages.
+ *
+ * A number of child tasks publish the same telemetry MsgId concurrently while
+ * the test task drains the subscribed pipe.  The publishers share a window of
+ * credits the size of the pipe depth, which the test task hands back as it
+ * receives, so the pipe never overflows and every message must arrive.  The
+ * aggregate rate (msgs/s) and the 50th/99th percentile latency of the individual
+ * transmit calls are reported.
+ *
+ * The test task also sends bursts of messages, first with separate calls to
+ * CFE_SB_TransmitMsg and then with a single call to CFE_SB_TransmitMsgs per
+ * burst, and the rate of each is reported.
+ *
+ * The results are informational only; the benchmark is intended to be run on
+ * the target before and after changes to the SB transmit path for comparison.
+ */
+
+#include <stdlib.h>
+
+#include "cfe_test.h"
+#include "cfe_msgids.h"
+
+#include "cfe_testcase_eds_typedefs.h"
+
+/* A simple telemetry message */
+typedef CFE_TEST_TestTlm_t CFE_FT_TestTlmMessage_t;
+
+#define CFE_FT_SBPERF_MAX_PUBLISHERS   16
+#define CFE_FT_SBPERF_MSGS_PER_PUBLISH 1000
+#define CFE_FT_SBPERF_PIPE_DEPTH       64
+#define CFE_FT_SBPERF_BURST_SIZE       32
+#define CFE_FT_SBPERF_NUM_BURSTS       200
+
+/*
+ * State for a single publisher task
+ */
+typedef struct
+{
+    volatile bool Done;
+    uint32        TransmitErrors;
+    uint32 *      Latency; /* Slice of the global sample array, in nanoseconds */
+} CFE_FT_SBPerfPublisher_t;
+
+/*
+ * Overall benchmark state, shared between the test task and the publishers
+ */
+typedef struct
+{
+    volatile bool            Running;
+    volatile uint32          NumClaimed;
+    osal_id_t                ClaimMutex;
+    osal_id_t                CreditSem; /* One count per free pipe slot */
+    CFE_FT_SBPerfPublisher_t Pub[CFE_FT_SBPERF_MAX_PUBLISHERS];
+    uint32                   Latency[CFE_FT_SBPERF_MAX_PUBLISHERS * CFE_FT_SBPERF_MSGS_PER_PUBLISH];
+} CFE_FT_SBPerfState_t;
+
+/*
+ * Messages for the burst comparison, kept off the stack
+ */
+typedef struct
+{
+    CFE_FT_TestTlmMessage_t  Msg[CFE_FT_SBPERF_BURST_SIZE];
+    const CFE_MSG_Message_t *MsgPtr[CFE_FT_SBPERF_BURST_SIZE];
+    CFE_SB_Buffer_t *        RcvPtr[CFE_FT_SBPERF_BURST_SIZE];
+} CFE_FT_SBPerfBurst_t;
+
+static CFE_FT_SBPerfState_t CFE_FT_SBPerf;
+static CFE_FT_SBPerfBurst_t CFE_FT_SBPerfBurst;
+
+static const CFE_SB_MsgId_t CFE_FT_SBPERF_MSGID = CFE_SB_MSGID_WRAP_VALUE(CFE_TEST_HK_TLM_MID);
+
+static int CFE_FT_SBPerfCompareLatency(const void *p1, const void *p2)
+{
+    uint32 v1 = *((const uint32 *)p1);
+    uint32 v2 = *((const uint32 *)p2);
+
+    if (v1 < v2)
+    {
+        return -1;
+    }
+    if (v1 > v2)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+void CFE_FT_SBPerfPublisherTask(void)
+{
+    CFE_FT_SBPerfPublisher_t *Pub;
+    CFE_FT_TestTlmMessage_t   TlmMsg;
+    OS_time_t                 StartTime;
+    OS_time_t                 EndTime;
+    int64                     ElapsedNs;
+    uint32                    i;
+
+    /* Claim the next publisher slot */
+    OS_MutSemTake(CFE_FT_SBPerf.ClaimMutex);
+    Pub = &CFE_FT_SBPerf.Pub[CFE_FT_SBPerf.NumClaimed];
+    ++CFE_FT_SBPerf.NumClaimed;
+    OS_MutSemGive(CFE_FT_SBPerf.ClaimMutex);
+
+    CFE_MSG_Init(CFE_MSG_PTR(TlmMsg.TelemetryHeader), CFE_FT_SBPERF_MSGID, sizeof(TlmMsg));
+
+    /* Wait for all publishers to be ready, so they all start at the same time */
+    while (!CFE_FT_SBPerf.Running)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (i = 0; i < CFE_FT_SBPERF_MSGS_PER_PUBLISH; ++i)
+    {
+        TlmMsg.TlmPayload = i;
+
+        /* Wait for room in the pipe, this is not part of the measured latency */
+        OS_CountSemTake(CFE_FT_SBPerf.CreditSem);
+
+        OS_GetLocalTime(&StartTime);
+        if (CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmMsg.TelemetryHeader), true) != CFE_SUCCESS)
+        {
+            ++Pub->TransmitErrors;
+        }
+        OS_GetLocalTime(&EndTime);
+
+        ElapsedNs = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(EndTime, StartTime));
+        if (ElapsedNs > 0xFFFFFFFF)
+        {
+            ElapsedNs = 0xFFFFFFFF;
+        }
+        Pub->Latency[i] = (uint32)ElapsedNs;
+    }
+
+    Pub->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+void CFE_FT_SBPerfRun(uint32 NumPublishers)
+{
+    CFE_SB_PipeId_t  PipeId;
+    CFE_ES_TaskId_t  TaskId;
+    CFE_SB_Buffer_t *MsgBuf;
+    OS_time_t        StartTime;
+    OS_time_t        EndTime;
+    int64            ElapsedUs;
+    uint32           NumSamples;
+    uint32           NumReceived;
+    uint32           NumErrors;
+    uint32           NumDone;
+    uint32           i;
+    char             TaskName[OS_MAX_API_NAME];
+    int32            Status;
+
+    memset(&CFE_FT_SBPerf.Pub, 0, sizeof(CFE_FT_SBPerf.Pub));
+    CFE_FT_SBPerf.Running    = false;
+    CFE_FT_SBPerf.NumClaimed = 0;
+    NumSamples               = NumPublishers * CFE_FT_SBPERF_MSGS_PER_PUBLISH;
+
+    for (i = 0; i < NumPublishers; ++i)
+    {
+        CFE_FT_SBPerf.Pub[i].Latency = &CFE_FT_SBPerf.Latency[i * CFE_FT_SBPERF_MSGS_PER_PUBLISH];
+    }
+
+    UtAssert_INT32_EQ(OS_CountSemCreate(&CFE_FT_SBPerf.CreditSem, "SBPerfCredit", CFE_FT_SBPERF_PIPE_DEPTH, 0),
+                      OS_SUCCESS);
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, CFE_FT_SBPERF_PIPE_DEPTH, "SBPerfPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(
+        CFE_SB_SubscribeEx(CFE_FT_SBPERF_MSGID, PipeId, CFE_SB_DEFAULT_QOS, CFE_FT_SBPERF_PIPE_DEPTH),
+        CFE_SUCCESS);
+
+    for (i = 0; i < NumPublishers; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), "SBPERF_PUB%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, TaskName, CFE_FT_SBPerfPublisherTask,
+                                                 CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE,
+                                                 CFE_PLATFORM_ES_PERF_CHILD_PRIORITY, 0),
+                          CFE_SUCCESS);
+    }
+
+    /* Give the publishers a chance to reach their start line */
+    while (CFE_FT_SBPerf.NumClaimed < NumPublishers)
+    {
+        OS_TaskDelay(10);
+    }
+
+    OS_GetLocalTime(&StartTime);
+    CFE_FT_SBPerf.Running = true;
+
+    /* Drain the pipe until all publishers are finished and nothing is left */
+    NumReceived = 0;
+    NumDone     = 0;
+    while (NumDone < NumPublishers)
+    {
+        Status = CFE_SB_ReceiveBuffer(&MsgBuf, PipeId, 10);
+        if (Status == CFE_SUCCESS)
+        {
+            ++NumReceived;
+            OS_CountSemGive(CFE_FT_SBPerf.CreditSem);
+        }
+        else if (Status == CFE_SB_TIME_OUT)
+        {
+            NumDone = 0;
+            for (i = 0; i < NumPublishers; ++i)
+            {
+                if (CFE_FT_SBPerf.Pub[i].Done)
+                {
+                    ++NumDone;
+                }
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    OS_GetLocalTime(&EndTime);
+
+    /* If the drain stopped early, release any publishers still waiting for credits */
+    for (i = NumReceived; i < NumSamples; ++i)
+    {
+        OS_CountSemGive(CFE_FT_SBPerf.CreditSem);
+    }
+    do
+    {
+        NumDone = 0;
+        for (i = 0; i < NumPublishers; ++i)
+        {
+            if (CFE_FT_SBPerf.Pub[i].Done)
+            {
+                ++NumDone;
+            }
+        }
+        if (NumDone < NumPublishers)
+        {
+            OS_TaskDelay(10);
+        }
+    } while (NumDone < NumPublishers);
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+    UtAssert_INT32_EQ(OS_CountSemDelete(CFE_FT_SBPerf.CreditSem), OS_SUCCESS);
+
+    NumErrors = 0;
+    for (i = 0; i < NumPublishers; ++i)
+    {
+        NumErrors += CFE_FT_SBPerf.Pub[i].TransmitErrors;
+    }
+    UtAssert_UINT32_EQ(NumErrors, 0);
+
+    /* The publishers never have more than a pipe's worth of messages in flight, so none may be dropped */
+    UtAssert_UINT32_EQ(NumReceived, NumSamples);
+
+    ElapsedUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+    if (ElapsedUs <= 0)
+    {
+        ElapsedUs = 1;
+    }
+
+    qsort(CFE_FT_SBPerf.Latency, NumSamples, sizeof(CFE_FT_SBPerf.Latency[0]), CFE_FT_SBPerfCompareLatency);
+
+    UtPrintf("CFE_SB_TransmitMsg, %u publisher(s): %lu msgs/s, p50=%lu ns, p99=%lu ns, received=%lu/%lu",
+             (unsigned int)NumPublishers, (unsigned long)((NumSamples * 1000000LL) / ElapsedUs),
+             (unsigned long)CFE_FT_SBPerf.Latency[NumSamples / 2],
+             (unsigned long)CFE_FT_SBPerf.Latency[(NumSamples * 99) / 100], (unsigned long)NumReceived,
+             (unsigned long)NumSamples);
+}
+
+void TestTransmitMsgThroughput(void)
+{
+    UtPrintf("Testing: CFE_SB_TransmitMsg throughput and latency");
+
+    UtAssert_INT32_EQ(OS_MutSemCreate(&CFE_FT_SBPerf.ClaimMutex, "SBPerfMutex", 0), OS_SUCCESS);
+
+    CFE_FT_SBPerfRun(1);
+    CFE_FT_SBPerfRun(4);
+    CFE_FT_SBPerfRun(16);
+
+    UtAssert_INT32_EQ(OS_MutSemDelete(CFE_FT_SBPerf.ClaimMutex), OS_SUCCESS);
+}
+
+/*
+ * Sends all bursts to the pipe, either one message at a time or as a batch,
+ * draining the pipe after each burst.  Only the transmit calls are timed.
+ * Returns the rate in msgs/s.
+ */
+uint32 CFE_FT_SBPerfBurstRun(CFE_SB_PipeId_t PipeId, bool Batched)
+{
+    OS_time_t StartTime;
+    OS_time_t EndTime;
+    int64     ElapsedNs;
+    uint32    NumReceived;
+    uint32    NumErrors;
+    uint32    Count;
+    uint32    Burst;
+    uint32    i;
+
+    ElapsedNs   = 0;
+    NumReceived = 0;
+    NumErrors   = 0;
+
+    for (Burst = 0; Burst < CFE_FT_SBPERF_NUM_BURSTS; ++Burst)
+    {
+        OS_GetLocalTime(&StartTime);
+        if (Batched)
+        {
+            if (CFE_SB_TransmitMsgs(CFE_FT_SBPerfBurst.MsgPtr, CFE_FT_SBPERF_BURST_SIZE, true, NULL) != CFE_SUCCESS)
+            {
+                ++NumErrors;
+            }
+        }
+        else
+        {
+            for (i = 0; i < CFE_FT_SBPERF_BURST_SIZE; ++i)
+            {
+                if (CFE_SB_TransmitMsg(CFE_FT_SBPerfBurst.MsgPtr[i], true) != CFE_SUCCESS)
+                {
+                    ++NumErrors;
+                }
+            }
+        }
+        OS_GetLocalTime(&EndTime);
+
+        ElapsedNs += OS_TimeGetTotalNanoseconds(OS_TimeSubtract(EndTime, StartTime));
+
+        while (CFE_SB_ReceiveBuffers(CFE_FT_SBPerfBurst.RcvPtr, CFE_FT_SBPERF_BURST_SIZE, &Count, PipeId,
+                                     CFE_SB_POLL) == CFE_SUCCESS)
+        {
+            NumReceived += Count;
+            CFE_SB_ReleaseBuffers(CFE_FT_SBPerfBurst.RcvPtr, Count, PipeId);
+        }
+    }
+
+    UtAssert_UINT32_EQ(NumErrors, 0);
+    UtAssert_UINT32_EQ(NumReceived, CFE_FT_SBPERF_NUM_BURSTS * CFE_FT_SBPERF_BURST_SIZE);
+
+    if (ElapsedNs <= 0)
+    {
+        ElapsedNs = 1;
+    }
+
+    return (uint32)((CFE_FT_SBPERF_NUM_BURSTS * CFE_FT_SBPERF_BURST_SIZE * 1000000000LL) / ElapsedNs);
+}
+
+void TestTransmitMsgsThroughput(void)
+{
+    CFE_SB_PipeId_t PipeId;
+    uint32          SingleRate;
+    uint32          BatchRate;
+    uint32          i;
+
+    UtPrintf("Testing: CFE_SB_TransmitMsgs throughput compared to CFE_SB_TransmitMsg");
+
+    for (i = 0; i < CFE_FT_SBPERF_BURST_SIZE; ++i)
+    {
+        CFE_MSG_Init(CFE_MSG_PTR(CFE_FT_SBPerfBurst.Msg[i].TelemetryHeader), CFE_FT_SBPERF_MSGID,
+                     sizeof(CFE_FT_SBPerfBurst.Msg[i]));
+        CFE_FT_SBPerfBurst.Msg[i].TlmPayload = i;
+        CFE_FT_SBPerfBurst.MsgPtr[i]         = CFE_MSG_PTR(CFE_FT_SBPerfBurst.Msg[i].TelemetryHeader);
+    }
+
+    UtAssert_INT32_EQ(CFE_SB_CreatePipe(&PipeId, CFE_FT_SBPERF_PIPE_DEPTH, "SBPerfPipe"), CFE_SUCCESS);
+    UtAssert_INT32_EQ(
+        CFE_SB_SubscribeEx(CFE_FT_SBPERF_MSGID, PipeId, CFE_SB_DEFAULT_QOS, CFE_FT_SBPERF_PIPE_DEPTH),
+        CFE_SUCCESS);
+
+    SingleRate = CFE_FT_SBPerfBurstRun(PipeId, false);
+    BatchRate  = CFE_FT_SBPerfBurstRun(PipeId, true);
+
+    UtAssert_INT32_EQ(CFE_SB_DeletePipe(PipeId), CFE_SUCCESS);
+
+    UtPrintf("%u bursts of %u: CFE_SB_TransmitMsg %lu msgs/s, CFE_SB_TransmitMsgs %lu msgs/s",
+             (unsigned int)CFE_FT_SBPERF_NUM_BURSTS, (unsigned int)CFE_FT_SBPERF_BURST_SIZE,
+             (unsigned long)SingleRate, (unsigned long)BatchRate);
+}
+
+void SBPerformanceTestSetup(void)
+{
+    UtTest_Add(TestTransmitMsgThroughput, NULL, NULL, "Test SB Transmit Throughput");
+    UtTest_Add(TestTransmitMsgsThroughput, NULL, NULL, "Test SB Batch Transmit Throughput");
+}
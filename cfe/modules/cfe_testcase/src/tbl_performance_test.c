@@ -0,0 +1,294 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Performance benchmark of table access
+ * CFE_TBL_GetAddress - Obtains the current address of the contents of a table.
+ * CFE_TBL_ReleaseAddress - Releases a previously obtained table address.
+ *
+ * A set of double buffered tables is read by a number of child tasks at
+ * 100 Hz, each task accessing its tables through its own shared handles, as
+ * separate applications would.  Meanwhile the test task keeps loading new
+ * contents into the tables one at a time, so readers regularly see a buffer
+ * swap and loads are regularly refused while a reader still holds the
+ * inactive buffer.  The average and worst case time of a get/release pair,
+ * the number of updates seen by readers, and the number of refused loads are
+ * reported.
+ *
+ * The results are informational only; the benchmark is intended to be run on
+ * the target before and after changes to table services for comparison.
+ */
+
+#include "cfe_test.h"
+
+#define CFE_FT_TBLPERF_NUM_TABLES      50
+#define CFE_FT_TBLPERF_NUM_TASKS       20
+#define CFE_FT_TBLPERF_TABLES_PER_TASK 5
+#define CFE_FT_TBLPERF_CYCLES          500
+#define CFE_FT_TBLPERF_CYCLE_MSEC      10
+
+/*
+ * State for a single task
+ */
+typedef struct
+{
+    volatile bool    Done;
+    uint32           Errors;
+    uint32           Updates;
+    int64            TotalUs;
+    int64            MaxUs;
+    CFE_TBL_Handle_t Handles[CFE_FT_TBLPERF_TABLES_PER_TASK];
+} CFE_FT_TblPerfTask_t;
+
+/*
+ * Overall benchmark state, shared between the test task and the child tasks
+ */
+typedef struct
+{
+    volatile bool        Running;
+    volatile uint32      NumClaimed;
+    osal_id_t            ClaimMutex;
+    CFE_TBL_Handle_t     OwnerHandles[CFE_FT_TBLPERF_NUM_TABLES];
+    CFE_FT_TblPerfTask_t Task[CFE_FT_TBLPERF_NUM_TASKS];
+} CFE_FT_TblPerfState_t;
+
+static CFE_FT_TblPerfState_t CFE_FT_TblPerf;
+
+void CFE_FT_TblPerfChildTask(void)
+{
+    CFE_FT_TblPerfTask_t *Task;
+    TBL_TEST_Table_t *    TblPtr;
+    OS_time_t             StartTime;
+    OS_time_t             EndTime;
+    int64                 ElapsedUs;
+    int32                 Status;
+    uint32                Cycle;
+    uint32                i;
+
+    /* Claim the next task slot */
+    OS_MutSemTake(CFE_FT_TblPerf.ClaimMutex);
+    Task = &CFE_FT_TblPerf.Task[CFE_FT_TblPerf.NumClaimed];
+    ++CFE_FT_TblPerf.NumClaimed;
+    OS_MutSemGive(CFE_FT_TblPerf.ClaimMutex);
+
+    /* Wait for all tasks to be ready, so they all start at the same time */
+    while (!CFE_FT_TblPerf.Running)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (Cycle = 0; Cycle < CFE_FT_TBLPERF_CYCLES; ++Cycle)
+    {
+        for (i = 0; i < CFE_FT_TBLPERF_TABLES_PER_TASK; ++i)
+        {
+            OS_GetLocalTime(&StartTime);
+
+            Status = CFE_TBL_GetAddress((void **)&TblPtr, Task->Handles[i]);
+            if (Status == CFE_TBL_INFO_UPDATED)
+            {
+                ++Task->Updates;
+            }
+            else if (Status != CFE_SUCCESS)
+            {
+                ++Task->Errors;
+                continue;
+            }
+
+            /* Read the table, as a real user would */
+            if (TblPtr->Int1 != TblPtr->Int2)
+            {
+                ++Task->Errors;
+            }
+
+            Status = CFE_TBL_ReleaseAddress(Task->Handles[i]);
+            if (Status != CFE_SUCCESS && Status != CFE_TBL_INFO_UPDATED)
+            {
+                ++Task->Errors;
+            }
+
+            OS_GetLocalTime(&EndTime);
+
+            ElapsedUs = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(EndTime, StartTime));
+            Task->TotalUs += ElapsedUs;
+            if (ElapsedUs > Task->MaxUs)
+            {
+                Task->MaxUs = ElapsedUs;
+            }
+        }
+
+        OS_TaskDelay(CFE_FT_TBLPERF_CYCLE_MSEC);
+    }
+
+    Task->Done = true;
+
+    CFE_ES_ExitChildTask();
+}
+
+void TestTableAccessLatency(void)
+{
+    CFE_ES_TaskId_t  TaskId;
+    TBL_TEST_Table_t TestTable;
+    char             TblName[CFE_TBL_MAX_FULL_NAME_LEN];
+    char             SharedTblName[CFE_TBL_MAX_FULL_NAME_LEN];
+    char             TaskName[OS_MAX_API_NAME];
+    int32            Status;
+    int64            TotalUs;
+    int64            MaxUs;
+    uint32           NumDone;
+    uint32           NumErrors;
+    uint32           NumUpdates;
+    uint32           NumLoads;
+    uint32           NumRefused;
+    uint32           i;
+    uint32           j;
+
+    UtPrintf("Testing: CFE_TBL_GetAddress/CFE_TBL_ReleaseAddress latency under load");
+
+    memset(&CFE_FT_TblPerf, 0, sizeof(CFE_FT_TblPerf));
+    UtAssert_INT32_EQ(OS_MutSemCreate(&CFE_FT_TblPerf.ClaimMutex, "TblPerfMutex", 0), OS_SUCCESS);
+
+    /* Every table always holds two equal values, so a torn read can be detected */
+    TestTable.Int1 = 0;
+    TestTable.Int2 = 0;
+
+    for (i = 0; i < CFE_FT_TBLPERF_NUM_TABLES; ++i)
+    {
+        snprintf(TblName, sizeof(TblName), "TblPerf%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_TBL_Register(&CFE_FT_TblPerf.OwnerHandles[i], TblName, sizeof(TBL_TEST_Table_t),
+                                           CFE_TBL_OPT_DBL_BUFFER, NULL),
+                          CFE_SUCCESS);
+        UtAssert_INT32_EQ(CFE_TBL_Load(CFE_FT_TblPerf.OwnerHandles[i], CFE_TBL_SRC_ADDRESS, &TestTable), CFE_SUCCESS);
+    }
+
+    /*
+     * The child tasks stand in for separate applications.  Each gets its own
+     * shared handle for every table it reads, so each table is shared by two
+     * tasks and every handle carries its own buffer hold.
+     */
+    for (i = 0; i < CFE_FT_TBLPERF_NUM_TASKS; ++i)
+    {
+        for (j = 0; j < CFE_FT_TBLPERF_TABLES_PER_TASK; ++j)
+        {
+            snprintf(SharedTblName, sizeof(SharedTblName), "CFE_TEST_APP.TblPerf%u",
+                     (unsigned int)(((i * CFE_FT_TBLPERF_TABLES_PER_TASK) + j) % CFE_FT_TBLPERF_NUM_TABLES));
+            UtAssert_INT32_EQ(CFE_TBL_Share(&CFE_FT_TblPerf.Task[i].Handles[j], SharedTblName), CFE_SUCCESS);
+        }
+    }
+
+    for (i = 0; i < CFE_FT_TBLPERF_NUM_TASKS; ++i)
+    {
+        snprintf(TaskName, sizeof(TaskName), "TBLPERF%u", (unsigned int)i);
+        UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, TaskName, CFE_FT_TblPerfChildTask,
+                                                 CFE_ES_TASK_STACK_ALLOCATE, CFE_PLATFORM_ES_PERF_CHILD_STACK_SIZE,
+                                                 CFE_PLATFORM_ES_PERF_CHILD_PRIORITY, 0),
+                          CFE_SUCCESS);
+    }
+
+    /* Give the tasks a chance to reach their start line */
+    while (CFE_FT_TblPerf.NumClaimed < CFE_FT_TBLPERF_NUM_TASKS)
+    {
+        OS_TaskDelay(10);
+    }
+
+    CFE_FT_TblPerf.Running = true;
+
+    /* Keep loading new contents, one table per cycle, until all readers are done */
+    NumLoads   = 0;
+    NumRefused = 0;
+    i          = 0;
+    do
+    {
+        ++TestTable.Int1;
+        ++TestTable.Int2;
+
+        Status = CFE_TBL_Load(CFE_FT_TblPerf.OwnerHandles[i], CFE_TBL_SRC_ADDRESS, &TestTable);
+        if (Status == CFE_SUCCESS)
+        {
+            ++NumLoads;
+        }
+        else if (Status == CFE_TBL_ERR_NO_BUFFER_AVAIL)
+        {
+            ++NumRefused;
+        }
+        else
+        {
+            UtAssert_Failed("Load of table %u failed: %ld", (unsigned int)i, (long)Status);
+        }
+
+        i = (i + 1) % CFE_FT_TBLPERF_NUM_TABLES;
+
+        OS_TaskDelay(CFE_FT_TBLPERF_CYCLE_MSEC);
+
+        NumDone = 0;
+        for (j = 0; j < CFE_FT_TBLPERF_NUM_TASKS; ++j)
+        {
+            if (CFE_FT_TblPerf.Task[j].Done)
+            {
+                ++NumDone;
+            }
+        }
+    } while (NumDone < CFE_FT_TBLPERF_NUM_TASKS);
+
+    TotalUs    = 0;
+    MaxUs      = 0;
+    NumErrors  = 0;
+    NumUpdates = 0;
+    for (i = 0; i < CFE_FT_TBLPERF_NUM_TASKS; ++i)
+    {
+        TotalUs += CFE_FT_TblPerf.Task[i].TotalUs;
+        NumErrors += CFE_FT_TblPerf.Task[i].Errors;
+        NumUpdates += CFE_FT_TblPerf.Task[i].Updates;
+        if (CFE_FT_TblPerf.Task[i].MaxUs > MaxUs)
+        {
+            MaxUs = CFE_FT_TblPerf.Task[i].MaxUs;
+        }
+
+        for (j = 0; j < CFE_FT_TBLPERF_TABLES_PER_TASK; ++j)
+        {
+            UtAssert_INT32_EQ(CFE_TBL_Unregister(CFE_FT_TblPerf.Task[i].Handles[j]), CFE_SUCCESS);
+        }
+    }
+    UtAssert_UINT32_EQ(NumErrors, 0);
+
+    for (i = 0; i < CFE_FT_TBLPERF_NUM_TABLES; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_TBL_Unregister(CFE_FT_TblPerf.OwnerHandles[i]), CFE_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_MutSemDelete(CFE_FT_TblPerf.ClaimMutex), OS_SUCCESS);
+
+    UtPrintf("%u tables, %u tasks at %u Hz: get/release avg %lu ns, max %lu us",
+             (unsigned int)CFE_FT_TBLPERF_NUM_TABLES, (unsigned int)CFE_FT_TBLPERF_NUM_TASKS,
+             (unsigned int)(1000 / CFE_FT_TBLPERF_CYCLE_MSEC),
+             (unsigned long)((TotalUs * 1000) /
+                             (CFE_FT_TBLPERF_NUM_TASKS * CFE_FT_TBLPERF_TABLES_PER_TASK * CFE_FT_TBLPERF_CYCLES)),
+             (unsigned long)MaxUs);
+    UtPrintf("%lu loads, %lu refused while the inactive buffer was held, %lu updates seen by readers",
+             (unsigned long)NumLoads, (unsigned long)NumRefused, (unsigned long)NumUpdates);
+}
+
+void TBLPerformanceTestSetup(void)
+{
+    UtTest_Add(TestTableAccessLatency, NULL, NULL, "Test Table Access Latency");
+}
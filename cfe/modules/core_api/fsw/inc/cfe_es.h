@@ -999,6 +999,7 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 ** \param[in]   InputCRC    A starting value for use in the CRC calculation.  This parameter
 **                          allows the user to calculate the CRC of non-contiguous blocks as
 **                          a single value.  Nominally, the user should set this value to zero.
+**                          For CFE_MISSION_ES_CRC_16 only the low 16 bits are used.
 **
 ** \param[in]   TypeCRC     One of the following CRC algorithm selections:
 **                          \arg \c CFE_MISSION_ES_CRC_8 -  (Not currently implemented)
@@ -1007,7 +1008,16 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...) OS_PRINTF(1, 2
 **                                  Initialization: 0x0000 <BR>
 **                                  Reflect Input/Output: true <BR>
 **                                  XorOut: 0x0000
-**                          \arg \c CFE_MISSION_ES_CRC_32 - (not currently implemented)
+**                          \arg \c CFE_MISSION_ES_CRC_32 - CRC-32 <BR>
+**                                  Polynomial: 0x04C11DB7 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
+**                          \arg \c CFE_MISSION_ES_CRC_32C - CRC-32C (Castagnoli) <BR>
+**                                  Polynomial: 0x1EDC6F41 <BR>
+**                                  Initialization: 0xFFFFFFFF <BR>
+**                                  Reflect Input/Output: true <BR>
+**                                  XorOut: 0xFFFFFFFF
 **
 ** \return The result of the CRC calculation on the specified memory block.
 **         If the TypeCRC is unimplemented will return 0.
@@ -1279,6 +1289,11 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 **        -# The size of the pool must be an integral number of 32-bit words
 **        -# The start address of the pool must be 32-bit aligned
 **        -# 168 bytes are used for internal bookkeeping, therefore, they will not be available for allocation.
+**        -# If #CFE_ES_POOL_TASK_CACHE is set, each task that uses the pool takes one additional block
+**           from the pool on first use for its cache.  Up to a few free blocks of each size are then
+**           kept in that cache rather than being returned to the pool.  When a task's cache fills,
+**           its blocks move to a small depot shared by all tasks of the pool, where other tasks
+**           can reuse them, so blocks may be allocated and released by different tasks.
 **
 ** \param[out]   PoolID        A pointer to the variable the caller wishes to have the memory pool handle kept in
 *@nonnull.
@@ -1302,8 +1317,10 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 **                             #CFE_PLATFORM_ES_MEM_BLOCK_SIZE_01 through #CFE_PLATFORM_ES_MAX_BLOCK_SIZE.  If the
 **                             pointer is equal to NULL, the default block sizes are used.
 **
-** \param[in]   UseMutex       Flag indicating whether the new memory pool will be processing with mutex handling or
-**                             not. Valid parameter values are #CFE_ES_USE_MUTEX and #CFE_ES_NO_MUTEX
+** \param[in]   Options        Flag indicating whether the new memory pool will be processing with mutex handling or
+**                             not. Valid parameter values are #CFE_ES_USE_MUTEX and #CFE_ES_NO_MUTEX, which may
+**                             be combined with #CFE_ES_POOL_TASK_CACHE to enable a per-task block cache and
+**                             #CFE_ES_POOL_LOCK_FREE to enable lock-free free lists.
 **
 ** \return Execution status, see \ref CFEReturnCodes
 ** \retval #CFE_SUCCESS                       \copybrief CFE_SUCCESS
@@ -1315,7 +1332,7 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
 **
 ******************************************************************************/
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
-                                 const size_t *BlockSizes, bool UseMutex);
+                                 const size_t *BlockSizes, uint32 Options);
 
 /*****************************************************************************/
 /**
@@ -1430,7 +1447,9 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr);
 **        by the calling Application.
 **
 ** \par Assumptions, External Events, and Notes:
-**        None
+**        Blocks held in a per-task cache or the shared depot (see #CFE_ES_POOL_TASK_CACHE)
+**        are counted as allocated in the block statistics.  The CacheHits and CacheMisses counters are
+**        only incremented for pools created with a per-task cache.
 **
 ** \param[out]   BufPtr      Pointer to #CFE_ES_MemPoolStats_t data structure @nonnull to be
 **                           filled with memory statistics. *BufPtr is the Memory Pool Statistics stored in given
@@ -1510,6 +1529,11 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
 **      if DataStart == DataEnd then the buffer is either empty or full
 **      depending on the value of the DataCount
 **
+**  Entries are added without taking a lock, so this may be called from
+**  any task or from a tight loop without blocking.  Each call reserves
+**  its own slot in the buffer, and the entries are merged into timestamp
+**  order when the buffer is written to a file.
+**
 **  Time is stored as 2 32 bit integers, (TimerLower32, TimerUpper32):
 **      TimerLower32 is the current value of the hardware timer register.
 **      TimerUpper32 is the number of times the timer has rolled over.
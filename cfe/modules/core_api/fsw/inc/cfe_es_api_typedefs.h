@@ -187,7 +187,27 @@ typedef void *CFE_ES_MemPoolBuf_t;
 #define CFE_ES_TASK_STACK_ALLOCATE NULL /* aka OS_TASK_STACK_ALLOCATE in proposed OSAL change */
 /** \} */
 
-#define CFE_ES_NO_MUTEX  false /**< \brief Indicates that the memory pool selection will not use a semaphore */
-#define CFE_ES_USE_MUTEX true  /**< \brief Indicates that the memory pool selection will use a semaphore */
+/** \name Memory Pool Options */
+/** \{ */
+#define CFE_ES_NO_MUTEX  0x00 /**< \brief Indicates that the memory pool selection will not use a semaphore */
+#define CFE_ES_USE_MUTEX 0x01 /**< \brief Indicates that the memory pool selection will use a semaphore */
+
+/**
+ * \brief Indicates that the memory pool will keep a small cache of free blocks for each task
+ *
+ * May be combined with #CFE_ES_USE_MUTEX.  Get and put requests that can be
+ * served from the calling task's own cache do not take the pool semaphore.
+ */
+#define CFE_ES_POOL_TASK_CACHE 0x02
+
+/**
+ * \brief Indicates that the memory pool will use lock-free free lists
+ *
+ * May be combined with #CFE_ES_USE_MUTEX.  Returning a block, and getting a
+ * block of a size that was returned before, do not take the pool semaphore.
+ * The semaphore is still used when a new block has to be created.
+ */
+#define CFE_ES_POOL_LOCK_FREE 0x04
+/** \} */
 
 #endif /* CFE_ES_API_TYPEDEFS_H */
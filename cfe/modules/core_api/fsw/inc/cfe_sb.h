@@ -425,6 +425,42 @@ CFE_Status_t CFE_SB_UnsubscribeLocal(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeI
 **/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Transmit several messages
+**
+** \par Description
+**          This routine transmits each of the specified messages in order, exactly
+**          as if #CFE_SB_TransmitMsg were called for each one.  The messages are
+**          all validated first, and the route lookups, buffer allocations, and
+**          deliveries are then done for a group of messages at a time under a
+**          single hold of the software bus lock, rather than once per message.
+**
+** \par Assumptions, External Events, and Notes:
+**          - A failure to send one message does not prevent the others from being sent.
+**          - The same IncrementSequenceCount value is applied to every message.
+**          - Any events are sent after the software bus lock is released, in message order.
+**
+** \param[in]  MsgPtrArray  Array of pointers to the messages to be sent @nonnull.  Each
+**                          entry must point to the first byte of a message header.
+** \param[in]  Count        Number of entries in MsgPtrArray
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+** \param[out] StatusArray  Optional array of Count entries which is set to the
+**                          status of each individual message, may be NULL
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         All messages were sent successfully
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_MSG_TOO_BIG  \copybrief CFE_SB_MSG_TOO_BIG
+** \retval #CFE_SB_BUF_ALOC_ERR \covtest \copybrief CFE_SB_BUF_ALOC_ERR
+**
+** If more than one message failed, the status of the first one is returned.
+**/
+CFE_Status_t CFE_SB_TransmitMsgs(const CFE_MSG_Message_t *const *MsgPtrArray, uint32 Count,
+                                 bool IncrementSequenceCount, CFE_Status_t *StatusArray);
+
 /*****************************************************************************/
 /**
 ** \brief Receive a message from a software bus pipe
@@ -465,6 +501,92 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
 ** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
 **/
 CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Receive a batch of messages from a software bus pipe
+**
+** \par Description
+**          This routine retrieves up to \c MaxCount messages from the specified
+**          pipe in a single call.  If the pipe is empty, this routine will block
+**          until either a new message comes in or the timeout value is reached.
+**          Once at least one message has been received, any further messages
+**          that are already on the pipe are also returned, without blocking.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Unlike #CFE_SB_ReceiveBuffer, the buffers returned by this routine
+**             are not released by the next receive call.  They remain valid until
+**             they are explicitly released by #CFE_SB_ReleaseBuffers, which must
+**             be called once for every buffer that was returned, or until the pipe
+**             is deleted.
+**          -# Buffers are held by the pipe until released, and the number that may be
+**             outstanding on one pipe is limited.  Fewer than \c MaxCount messages are
+**             returned when the pipe is close to the limit, and #CFE_SB_BUF_ALOC_ERR
+**             when it is reached.
+**          -# Calling this routine releases the buffer from a previous
+**             #CFE_SB_ReceiveBuffer call on the same pipe, in the same way as
+**             #CFE_SB_ReceiveBuffer does.
+**          -# Several tasks may call this routine on the same pipe, each processing
+**             its own batch.
+**          -# The pipe is locked once for the whole batch, rather than twice per message.
+**          -# If an error occurs in this API, *CountPtr is set to zero and no buffers
+**             are returned.
+**
+** \param[out] BufPtrArray  An array of at least \c MaxCount buffer pointers @nonnull.
+**                          On success the first *CountPtr entries point to the received
+**                          software bus buffers.  These should be used as read-only pointers.
+**
+** \param[in]  MaxCount     The maximum number of messages to receive @nonzero.
+**
+** \param[out] CountPtr     Set to the number of messages received @nonnull.
+**
+** \param[in]  PipeId       The pipe ID of the pipe containing the messages to be obtained.
+**
+** \param[in]  TimeOut      The number of milliseconds to wait for a new message if the
+**                          pipe is empty at the time of the call.  This can also be set
+**                          to #CFE_SB_POLL for a non-blocking receive or
+**                          #CFE_SB_PEND_FOREVER to wait forever for a message to arrive.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_TIME_OUT     \copybrief CFE_SB_TIME_OUT
+** \retval #CFE_SB_PIPE_RD_ERR  \covtest \copybrief CFE_SB_PIPE_RD_ERR
+** \retval #CFE_SB_NO_MESSAGE   \copybrief CFE_SB_NO_MESSAGE
+** \retval #CFE_SB_BUF_ALOC_ERR \copybrief CFE_SB_BUF_ALOC_ERR
+**/
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut);
+
+/*****************************************************************************/
+/**
+** \brief Release a batch of buffers obtained from #CFE_SB_ReceiveBuffers
+**
+** \par Description
+**          This routine releases the software bus buffers that were returned by
+**          #CFE_SB_ReceiveBuffers, once the caller has finished processing them.
+**          All buffers are released under a single lock.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# The buffers must not be accessed after they are released.
+**          -# This must not be used for buffers returned by #CFE_SB_ReceiveBuffer, which
+**             are released implicitly, nor for buffers from #CFE_SB_AllocateMessageBuffer.
+**          -# Every entry must be a buffer that was received from \c PipeId and has not
+**             been released yet.  Any other entry, including NULL, is not released and
+**             causes #CFE_SB_BAD_ARGUMENT to be returned, but the valid entries are still
+**             released.
+**
+** \param[in]  BufPtrArray  The array of buffer pointers to release @nonnull.
+**
+** \param[in]  Count        The number of entries in the array.
+**
+** \param[in]  PipeId       The pipe ID the buffers were received from.
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS         \copybrief CFE_SUCCESS
+** \retval #CFE_SB_BAD_ARGUMENT \copybrief CFE_SB_BAD_ARGUMENT
+**/
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, CFE_SB_PipeId_t PipeId);
 /** @} */
 
 /** @defgroup CFEAPISBZeroCopy cFE Zero Copy APIs
@@ -567,6 +689,44 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr);
 **/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount);
 
+/*****************************************************************************/
+/**
+** \brief Transmit several buffers
+**
+** \par Description
+**          This routine transmits each of the specified zero copy buffers in order,
+**          exactly as if #CFE_SB_TransmitBuffer were called for each one.  The buffers
+**          are all validated first, and the route lookups and deliveries are then
+**          done for a group of buffers at a time under a single hold of the software
+**          bus lock, rather than once per buffer.
+**
+** \par Assumptions, External Events, and Notes:
+**          -# Each buffer for which the status is CFE_SUCCESS is consumed, the same as
+**             with a successful call to #CFE_SB_TransmitBuffer.
+**          -# Each buffer for which the status is an error is not changed, and is
+**             still owned by the calling application.  A StatusArray must be passed
+**             in for the caller to know which buffers those are.
+**          -# The same IncrementSequenceCount value is applied to every buffer.
+**
+** \param[in]  BufPtrArray  Array of pointers to the buffers to be sent @nonnull.
+** \param[in]  Count        Number of entries in BufPtrArray
+** \param[in] IncrementSequenceCount Boolean to increment the internally tracked
+**                                   sequence count and update the message if the
+**                                   buffer contains a telemetry message
+** \param[out] StatusArray  Optional array of Count entries which is set to the
+**                          status of each individual buffer, may be NULL
+**
+** \return Execution status, see \ref CFEReturnCodes
+** \retval #CFE_SUCCESS           All buffers were sent successfully
+** \retval #CFE_SB_BAD_ARGUMENT   \copybrief CFE_SB_BAD_ARGUMENT
+** \retval #CFE_SB_BUFFER_INVALID \copybrief CFE_SB_BUFFER_INVALID
+** \retval #CFE_SB_MSG_TOO_BIG    \copybrief CFE_SB_MSG_TOO_BIG
+**
+** If more than one buffer failed, the status of the first one is returned.
+**/
+CFE_Status_t CFE_SB_TransmitBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, bool IncrementSequenceCount,
+                                    CFE_Status_t *StatusArray);
+
 /** @} */
 
 /** @defgroup CFEAPISBMessageCharacteristics cFE Message Characteristics APIs
@@ -678,7 +678,7 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
  * ----------------------------------------------------
  */
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
-                                 const size_t *BlockSizes, bool UseMutex)
+                                 const size_t *BlockSizes, uint32 Options)
 {
     UT_GenStub_SetupReturnBuffer(CFE_ES_PoolCreateEx, CFE_Status_t);
 
@@ -687,7 +687,7 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     UT_GenStub_AddParam(CFE_ES_PoolCreateEx, size_t, Size);
     UT_GenStub_AddParam(CFE_ES_PoolCreateEx, uint16, NumBlockSizes);
     UT_GenStub_AddParam(CFE_ES_PoolCreateEx, const size_t *, BlockSizes);
-    UT_GenStub_AddParam(CFE_ES_PoolCreateEx, bool, UseMutex);
+    UT_GenStub_AddParam(CFE_ES_PoolCreateEx, uint32, Options);
 
     UT_GenStub_Execute(CFE_ES_PoolCreateEx, Basic, NULL);
 
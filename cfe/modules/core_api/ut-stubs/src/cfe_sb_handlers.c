@@ -213,6 +213,31 @@ void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *UserObj, UT_EntryKey_t FuncKey
     }
 }
 
+/*------------------------------------------------------------
+ *
+ * Default handler for CFE_SB_ReceiveBuffers coverage stub function
+ *
+ *------------------------------------------------------------*/
+void UT_DefaultHandler_CFE_SB_ReceiveBuffers(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    CFE_SB_Buffer_t **BufPtrArray = UT_Hook_GetArgValueByName(Context, "BufPtrArray", CFE_SB_Buffer_t **);
+    uint32            MaxCount    = UT_Hook_GetArgValueByName(Context, "MaxCount", uint32);
+    uint32 *          CountPtr    = UT_Hook_GetArgValueByName(Context, "CountPtr", uint32 *);
+
+    int32  status;
+    size_t CopiedSize;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    CopiedSize = 0;
+    if (status >= 0)
+    {
+        CopiedSize = UT_Stub_CopyToLocal(UT_KEY(CFE_SB_ReceiveBuffers), BufPtrArray, MaxCount * sizeof(*BufPtrArray));
+    }
+
+    *CountPtr = CopiedSize / sizeof(*BufPtrArray);
+}
+
 /*------------------------------------------------------------
  *
  * Default handler for CFE_SB_TransmitMsg coverage stub function
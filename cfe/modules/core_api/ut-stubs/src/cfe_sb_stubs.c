@@ -38,6 +38,7 @@ extern void UT_DefaultHandler_CFE_SB_IsValidMsgId(void *, UT_EntryKey_t, const U
 extern void UT_DefaultHandler_CFE_SB_MessageStringGet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_MessageStringSet(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_ReceiveBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_CFE_SB_ReceiveBuffers(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_SetUserDataLength(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_TimeStampMsg(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_CFE_SB_TransmitBuffer(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -269,6 +270,45 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
     return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReceiveBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReceiveBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_Buffer_t **, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32, MaxCount);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, uint32 *, CountPtr);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, CFE_SB_PipeId_t, PipeId);
+    UT_GenStub_AddParam(CFE_SB_ReceiveBuffers, int32, TimeOut);
+
+    UT_GenStub_Execute(CFE_SB_ReceiveBuffers, Basic, UT_DefaultHandler_CFE_SB_ReceiveBuffers);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReceiveBuffers, CFE_Status_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_ReleaseBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, CFE_SB_PipeId_t PipeId)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_ReleaseBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_ReleaseBuffers, CFE_SB_Buffer_t *const *, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_ReleaseBuffers, uint32, Count);
+    UT_GenStub_AddParam(CFE_SB_ReleaseBuffers, CFE_SB_PipeId_t, PipeId);
+
+    UT_GenStub_Execute(CFE_SB_ReleaseBuffers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_ReleaseBuffers, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_ReleaseMessageBuffer()
@@ -398,6 +438,26 @@ CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequen
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitBuffer, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitBuffers()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, bool IncrementSequenceCount,
+                                    CFE_Status_t *StatusArray)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitBuffers, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitBuffers, CFE_SB_Buffer_t *const *, BufPtrArray);
+    UT_GenStub_AddParam(CFE_SB_TransmitBuffers, uint32, Count);
+    UT_GenStub_AddParam(CFE_SB_TransmitBuffers, bool, IncrementSequenceCount);
+    UT_GenStub_AddParam(CFE_SB_TransmitBuffers, CFE_Status_t *, StatusArray);
+
+    UT_GenStub_Execute(CFE_SB_TransmitBuffers, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitBuffers, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_TransmitMsg()
@@ -415,6 +475,26 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
     return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsg, CFE_Status_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for CFE_SB_TransmitMsgs()
+ * ----------------------------------------------------
+ */
+CFE_Status_t CFE_SB_TransmitMsgs(const CFE_MSG_Message_t *const *MsgPtrArray, uint32 Count,
+                                 bool IncrementSequenceCount, CFE_Status_t *StatusArray)
+{
+    UT_GenStub_SetupReturnBuffer(CFE_SB_TransmitMsgs, CFE_Status_t);
+
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgs, const CFE_MSG_Message_t *const *, MsgPtrArray);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgs, uint32, Count);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgs, bool, IncrementSequenceCount);
+    UT_GenStub_AddParam(CFE_SB_TransmitMsgs, CFE_Status_t *, StatusArray);
+
+    UT_GenStub_Execute(CFE_SB_TransmitMsgs, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(CFE_SB_TransmitMsgs, CFE_Status_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for CFE_SB_Unsubscribe()
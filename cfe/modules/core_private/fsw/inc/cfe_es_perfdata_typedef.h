@@ -66,10 +66,32 @@ typedef struct
     uint32          TriggerMask[CFE_ES_PERF_32BIT_WORDS_IN_MASK];
 } CFE_ES_PerfMetaData_t;
 
+/*
+ * Capture state for lock-free writes to the data buffer
+ *
+ * Writers reserve a slot by atomically incrementing NextSeq, so concurrent
+ * writers never share a slot.  Once the entry is written, the sequence number
+ * plus one is stored in EntrySeq for that slot, so that entries which were not
+ * completely written can be identified and dropped when the log is dumped.
+ *
+ * This is not part of the dump file format, the MetaData fields describing the
+ * buffer contents are computed from this when the log is dumped.
+ */
+typedef struct
+{
+    volatile uint32 NextSeq;        /* sequence number of the next entry to be written */
+    volatile uint32 TriggerClaimed; /* nonzero once a writer has claimed the trigger */
+    volatile uint32 TriggerSeq;     /* sequence number of the trigger entry */
+    volatile uint32 TriggerLimit;   /* number of entries to capture from the trigger on, or 0 for no limit */
+    uint32          Finalized;      /* nonzero once the buffer has been compacted and sorted for a dump */
+    volatile uint32 EntrySeq[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+} CFE_ES_PerfCapture_t;
+
 typedef struct
 {
     CFE_ES_PerfMetaData_t  MetaData;
     CFE_ES_PerfDataEntry_t DataBuffer[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+    CFE_ES_PerfCapture_t   Capture;
 } CFE_ES_PerfData_t;
 
 #endif /* CFE_ES_PERFDATA_TYPEDEF_H */
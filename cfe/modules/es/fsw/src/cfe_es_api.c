@@ -466,6 +466,8 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
             */
             CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+            CFE_ES_NotifyAppStateChange();
+
             /*
             ** Suspend the Application until ES kills it.
             ** It might be better to have a way of suspending the app in the OS
@@ -493,6 +495,7 @@ void CFE_ES_ExitApp(uint32 ExitStatus)
 bool CFE_ES_RunLoop(uint32 *RunStatus)
 {
     bool                ReturnCode;
+    bool                StateChanged;
     CFE_ES_AppRecord_t *AppRecPtr;
 
     /*
@@ -522,6 +525,8 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         return false;
     }
 
+    StateChanged = false;
+
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     /*
@@ -536,6 +541,7 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
         if (AppRecPtr->AppState < CFE_ES_AppState_RUNNING)
         {
             AppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+            StateChanged        = true;
         }
 
         /*
@@ -570,6 +576,11 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    if (StateChanged)
+    {
+        CFE_ES_NotifyAppStateChange();
+    }
+
     return (ReturnCode);
 }
 
@@ -584,10 +595,16 @@ bool CFE_ES_RunLoop(uint32 *RunStatus)
 CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMilliseconds)
 {
     int32               Status = CFE_SUCCESS;
+    int32               OsStatus;
     CFE_ES_AppRecord_t *AppRecPtr;
     uint32              RequiredAppState;
     uint32              WaitTime;
     uint32              WaitRemaining;
+    int64               ElapsedTime;
+    bool                StateChanged;
+    bool                StateReached;
+    OS_time_t           StartTime;
+    OS_time_t           CurrTime;
 
     /*
      * Calling app is assumed to have completed its own initialization up to the point
@@ -595,6 +612,8 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
      *
      * Determine the implicit app state based on the system state it is indicating
      */
+    StateChanged = false;
+
     CFE_ES_LockSharedData(__func__, __LINE__);
 
     /*
@@ -641,37 +660,85 @@ CFE_Status_t CFE_ES_WaitForSystemState(uint32 MinSystemState, uint32 TimeOutMill
         if (AppRecPtr->AppState < RequiredAppState)
         {
             AppRecPtr->AppState = RequiredAppState;
+            StateChanged        = true;
         }
     }
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    if (StateChanged)
+    {
+        CFE_ES_NotifyAppStateChange();
+    }
+
     /*
-     * Do the actual delay loop.
+     * Do the actual wait.
      *
      * This is only dependent on the main (startup) task updating the global variable
-     * to be at least the state requested.
+     * to be at least the state requested.  The check and the registration as a waiter
+     * are done under the same lock that CFE_ES_SetSystemState() uses, so a state change
+     * cannot be missed between the two.
      */
     WaitRemaining = TimeOutMilliseconds;
-    while (CFE_ES_Global.SystemState < MinSystemState)
+    CFE_PSP_GetTime(&StartTime);
+    while (true)
     {
-        /* TBD: Very Crude timing here, but not sure if it matters,
-         * as this is only done during startup, not real work */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+        CFE_ES_LockSharedData(__func__, __LINE__);
+        StateReached = (CFE_ES_Global.SystemState >= MinSystemState);
+        if (!StateReached && WaitRemaining > 0)
         {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+            ++CFE_ES_Global.SystemStateWaiters;
         }
-        else if (WaitRemaining > 0)
+        CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+        if (StateReached)
         {
-            WaitTime = WaitRemaining;
+            break;
         }
-        else
+
+        if (WaitRemaining == 0)
         {
             Status = CFE_ES_OPERATION_TIMED_OUT;
             break;
         }
 
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
+        OsStatus = OS_CountSemTimedWait(CFE_ES_Global.SystemStateSem, WaitRemaining);
+        if (OsStatus == OS_SEM_TIMEOUT)
+        {
+            WaitRemaining = 0;
+        }
+        else if (OsStatus != OS_SUCCESS)
+        {
+            /* semaphore is not usable, fall back to polling */
+            if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+            {
+                WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+            }
+            else
+            {
+                WaitTime = WaitRemaining;
+            }
+
+            OS_TaskDelay(WaitTime);
+            WaitRemaining -= WaitTime;
+        }
+        else
+        {
+            CFE_PSP_GetTime(&CurrTime);
+            ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, StartTime));
+            if (ElapsedTime < 0)
+            {
+                ElapsedTime = 0;
+            }
+
+            if (ElapsedTime < TimeOutMilliseconds)
+            {
+                WaitRemaining = TimeOutMilliseconds - (uint32)ElapsedTime;
+            }
+            else
+            {
+                WaitRemaining = 0;
+            }
+        }
     }
 
     return Status;
@@ -1255,6 +1322,7 @@ CFE_Status_t CFE_ES_GetTaskInfo(CFE_ES_TaskInfo_t *TaskInfo, CFE_ES_TaskId_t Tas
         TaskInfo->ExecutionCounter = TaskRecPtr->ExecutionCounter;
         TaskInfo->StackSize        = TaskRecPtr->StartParams.StackSize;
         TaskInfo->Priority         = TaskRecPtr->StartParams.Priority;
+        TaskInfo->CpuMask          = TaskRecPtr->StartParams.CpuMask;
 
         /*
         ** Get the Application Details
@@ -1355,8 +1423,9 @@ CFE_Status_t CFE_ES_CreateChildTask(CFE_ES_TaskId_t *TaskIdPtr, const char *Task
         }
         else
         {
-            ParentAppId = CFE_ES_AppRecordGetID(AppRecPtr);
-            ReturnCode  = CFE_SUCCESS;
+            ParentAppId    = CFE_ES_AppRecordGetID(AppRecPtr);
+            Params.CpuMask = AppRecPtr->StartParams.ChildCpuMask;
+            ReturnCode     = CFE_SUCCESS;
         } /* end If AppID is valid */
 
         CFE_ES_UnlockSharedData(__func__, __LINE__);
@@ -1626,62 +1695,38 @@ CFE_Status_t CFE_ES_WriteToSysLog(const char *SpecStringPtr, ...)
  *-----------------------------------------------------------------*/
 uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, uint32 TypeCRC)
 {
-    uint32       i;
-    int16        Index;
-    int16        Crc = 0;
-    const uint8 *BufPtr;
-    uint8        ByteValue;
-
-    static const uint16 CrcTable[256] = {
-
-        0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1,
-        0xC481, 0x0440, 0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40,
-        0xC901, 0x09C0, 0x0880, 0xC841, 0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1,
-        0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41, 0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
-        0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040, 0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1,
-        0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441, 0x3C00, 0xFCC1, 0xFD81, 0x3D40,
-        0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840, 0x2800, 0xE8C1,
-        0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-        0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0,
-        0x2080, 0xE041, 0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740,
-        0xA501, 0x65C0, 0x6480, 0xA441, 0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0,
-        0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840, 0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
-        0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40, 0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1,
-        0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041, 0x5000, 0x90C1, 0x9181, 0x5140,
-        0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440, 0x9C01, 0x5CC0,
-        0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-        0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0,
-        0x4C80, 0x8C41, 0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341,
-        0x4100, 0x81C1, 0x8081, 0x4040
-
-    };
+    uint32 Crc = 0;
 
     if (DataPtr == NULL || DataLength == 0)
     {
         return InputCRC;
     }
 
+    /*
+     * It is assumed that the supplied buffer is in a
+     * directly-accessible memory space that does not
+     * require special logic to access
+     */
     switch (TypeCRC)
     {
         case CFE_MISSION_ES_CRC_32:
-            CFE_ES_WriteToSysLog("%s: Calculate CRC32 not Implemented\n", __func__);
+            Crc = CRC_Compute(CRC_ALGORITHM_CRC32, InputCRC, DataPtr, DataLength);
             break;
 
-        case CFE_MISSION_ES_CRC_16:
-            Crc    = (int16)(0xFFFF & InputCRC);
-            BufPtr = (const uint8 *)DataPtr;
+#ifdef CFE_MISSION_ES_CRC_32C
+        case CFE_MISSION_ES_CRC_32C:
+            Crc = CRC_Compute(CRC_ALGORITHM_CRC32C, InputCRC, DataPtr, DataLength);
+            break;
+#endif
 
-            for (i = 0; i < DataLength; i++, BufPtr++)
-            {
-                /*
-                 * It is assumed that the supplied buffer is in a
-                 * directly-accessible memory space that does not
-                 * require special logic to access
-                 */
-                ByteValue = *BufPtr;
-                Index     = ((Crc ^ ByteValue) & 0x00FF);
-                Crc       = ((Crc >> 8) & 0x00FF) ^ CrcTable[Index];
-            }
+        case CFE_MISSION_ES_CRC_16:
+            /*
+             * The 16 bit CRC has historically been returned via a signed
+             * 16 bit value, so results with the high bit set are sign
+             * extended.  This is preserved for compatibility with stored
+             * CRCs (e.g. table headers and CDS blocks) and ground tools.
+             */
+            Crc = (uint32)(int16)CRC_Compute(CRC_ALGORITHM_CRC16_ARC, InputCRC & 0xFFFF, DataPtr, DataLength);
             break;
 
         case CFE_MISSION_ES_CRC_8:
@@ -1691,7 +1736,7 @@ uint32 CFE_ES_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputC
         default:
             break;
     }
-    return (Crc);
+    return Crc;
 }
 
 /*----------------------------------------------------------------
@@ -42,6 +42,7 @@
 #include "cfe_sb_core_internal.h"
 #include "cfe_tbl_core_internal.h"
 #include "cfe_time_core_internal.h"
+#include "osapi-atomic.h"
 
 #include <stdio.h>
 #include <string.h> /* memset() */
@@ -51,6 +52,7 @@
 ** Defines
 */
 #define ES_START_BUFF_SIZE 128
+#define ES_START_READ_SIZE 1024 /* Bytes read from the startup script per OS_read() call */
 
 /*
 **
@@ -75,17 +77,22 @@
 void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
 {
     char        ES_AppLoadBuffer[ES_START_BUFF_SIZE]; /* A buffer of for a line in a file */
+    char        ES_AppReadBuffer[ES_START_READ_SIZE]; /* A block of raw data read from the file */
     char        ScriptFileName[OS_MAX_PATH_LEN];
     const char *TokenList[CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE];
     uint32      NumTokens;
     uint32      NumLines;
     uint32      BuffLen; /* Length of the current buffer */
+    uint32      ReadPos;
     osal_id_t   AppFile = OS_OBJECT_ID_UNDEFINED;
     int32       Status;
     int32       OsStatus;
     char        c;
     bool        LineTooLong = false;
     bool        FileOpened  = false;
+    bool        EndOfScript = false;
+    OS_time_t   StartTime;
+    OS_time_t   EndTime;
 
     /*
     ** Get the ES startup script filename.
@@ -161,6 +168,14 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
     {
         CFE_ES_WriteToSysLog("%s: Opened ES App Startup file: %s\n", __func__, ScriptFileName);
 
+        CFE_PSP_GetTime(&StartTime);
+
+        /*
+        ** Apps are queued as they are parsed, and their modules loaded by a pool of
+        ** workers.  The queue is flushed at each library and at the end of the script.
+        */
+        CFE_ES_StartupLoadBegin();
+
         memset(ES_AppLoadBuffer, 0x0, ES_START_BUFF_SIZE);
         BuffLen      = 0;
         NumTokens    = 0;
@@ -170,10 +185,13 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
         /*
         ** Parse the lines from the file. If it has an error
         ** or reaches EOF, then abort the loop.
+        **
+        ** The file is read in large blocks rather than one character
+        ** at a time; a typical script is consumed by a single read.
         */
-        while (1)
+        while (!EndOfScript)
         {
-            OsStatus = OS_read(AppFile, &c, 1);
+            OsStatus = OS_read(AppFile, ES_AppReadBuffer, sizeof(ES_AppReadBuffer));
             if (OsStatus < OS_SUCCESS)
             {
                 CFE_ES_WriteToSysLog("%s: Error Reading Startup file. EC = %ld\n", __func__, (long)OsStatus);
@@ -186,9 +204,19 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                 */
                 break;
             }
-            else if (c != '!')
+
+            for (ReadPos = 0; ReadPos < (uint32)OsStatus; ++ReadPos)
             {
-                if (c <= ' ')
+                c = ES_AppReadBuffer[ReadPos];
+                if (c == '!')
+                {
+                    /*
+                    ** break when EOF character '!' is reached
+                    */
+                    EndOfScript = true;
+                    break;
+                }
+                else if (c <= ' ')
                 {
                     /*
                     ** Skip all white space in the file
@@ -266,14 +294,14 @@ void CFE_ES_StartApplications(uint32 ResetType, const char *StartFilePath)
                     NumTokens = 0;
                 }
             }
-            else
-            {
-                /*
-                ** break when EOF character '!' is reached
-                */
-                break;
-            }
         }
+
+        CFE_ES_StartupLoadEnd();
+
+        CFE_PSP_GetTime(&EndTime);
+        CFE_ES_WriteToSysLog("%s: Processed %u startup file entries in %ld ms\n", __func__, (unsigned int)NumLines,
+                             (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime)));
+
         /*
         ** close the file
         */
@@ -301,6 +329,8 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     } IdBuf;
     int32                   Status;
     CFE_ES_AppStartParams_t ParamBuf;
+    OS_time_t               StartTime;
+    OS_time_t               EndTime;
 
     /*
     ** Check to see if the correct number of items were parsed
@@ -330,6 +360,8 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
 
     strncpy(ParamBuf.BasicInfo.InitSymbolName, TokenList[2], sizeof(ParamBuf.BasicInfo.InitSymbolName) - 1);
 
+    CFE_PSP_GetTime(&StartTime);
+
     if (strcmp(EntryType, "CFE_APP") == 0)
     {
         CFE_ES_WriteToSysLog("%s: Loading file: %s, APP: %s\n", __func__, ParamBuf.BasicInfo.FileName, ModuleName);
@@ -369,6 +401,33 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
             ParamBuf.ExceptionAction = (CFE_ES_ExceptionAction_Enum_t)ParsedValue;
         }
 
+        /*
+        ** The CPU affinity masks are optional and default to no restriction.
+        ** Child tasks inherit the main task mask unless given their own.
+        */
+        if (NumTokens > 8)
+        {
+            ParamBuf.MainTaskInfo.CpuMask = strtoul(TokenList[8], NULL, 0);
+        }
+        if (NumTokens > 9)
+        {
+            ParamBuf.ChildCpuMask = strtoul(TokenList[9], NULL, 0);
+        }
+        else
+        {
+            ParamBuf.ChildCpuMask = ParamBuf.MainTaskInfo.CpuMask;
+        }
+
+        /*
+        ** While the startup script is processed, the app is queued so its module
+        ** can be loaded concurrently with the apps that follow it.  The load time
+        ** is then reported when the queue is flushed.
+        */
+        if (CFE_ES_Global.StartupLoadQueue.Active)
+        {
+            return CFE_ES_StartupLoadQueueApp(ModuleName, &ParamBuf);
+        }
+
         /*
         ** Now create the application
         */
@@ -378,6 +437,17 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     {
         CFE_ES_WriteToSysLog("%s: Loading shared library: %s\n", __func__, ParamBuf.BasicInfo.FileName);
 
+        /*
+        ** Apps listed after the library may depend on it, so it must be loaded and
+        ** initialized before any of them.  Apps queued before it are started first,
+        ** which keeps the overall script order.
+        */
+        if (CFE_ES_Global.StartupLoadQueue.Active)
+        {
+            CFE_ES_StartupLoadFlush();
+            CFE_PSP_GetTime(&StartTime);
+        }
+
         /*
         ** Now load the library
         */
@@ -386,9 +456,17 @@ int32 CFE_ES_ParseFileEntry(const char **TokenList, uint32 NumTokens)
     else
     {
         CFE_ES_WriteToSysLog("%s: Unexpected EntryType %s in startup file.\n", __func__, EntryType);
-        Status = CFE_ES_ERR_APP_CREATE;
+        return CFE_ES_ERR_APP_CREATE;
     }
 
+    /*
+    ** Report how long the load took, including module load, symbol lookup
+    ** and app task creation or library init
+    */
+    CFE_PSP_GetTime(&EndTime);
+    CFE_ES_WriteToSysLog("%s: %s load time %ld ms, RC=0x%08x\n", __func__, ModuleName,
+                         (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime)), (unsigned int)Status);
+
     return (Status);
 }
 
@@ -600,13 +678,14 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
     /*
      * Create the primary task for the newly loaded task
      */
-    OsStatus = OS_TaskCreate(&OsalTaskId,              /* task id */
-                             TaskName,                 /* task name matches app name for main task */
-                             CFE_ES_TaskEntryPoint,    /* task function pointer */
-                             OSAL_TASK_STACK_ALLOCATE, /* stack pointer (allocate) */
-                             Params->StackSize,        /* stack size */
-                             Params->Priority,         /* task priority */
-                             OS_FP_ENABLED);           /* task options */
+    OsStatus = OS_TaskCreateWithAffinity(&OsalTaskId,                      /* task id */
+                                         TaskName,                         /* matches app name for main task */
+                                         CFE_ES_TaskEntryPoint,            /* task function pointer */
+                                         OSAL_TASK_STACK_ALLOCATE,         /* stack pointer (allocate) */
+                                         Params->StackSize,                /* stack size */
+                                         Params->Priority,                 /* task priority */
+                                         OS_FP_ENABLED,                    /* task options */
+                                         OSAL_CPUMASK_C(Params->CpuMask)); /* processors the task may run on */
 
     CFE_ES_LockSharedData(__func__, __LINE__);
 
@@ -669,6 +748,39 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params)
+{
+    CFE_Status_t     Status;
+    CFE_ResourceId_t PendingResourceId;
+
+    Status = CFE_ES_AppCreateReserve(&PendingResourceId, AppName, Params);
+
+    /*
+     * If ID allocation was not successful, return now.
+     * A message regarding the issue should have already been logged
+     */
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+     * Load the module based on StartParams configured above.
+     */
+    Status = CFE_ES_AppCreateLoad(PendingResourceId);
+
+    return CFE_ES_AppCreateFinish(ApplicationIdPtr, PendingResourceId, Status);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppCreateReserve
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreateReserve(CFE_ResourceId_t *PendingResourceIdPtr, const char *AppName,
+                              const CFE_ES_AppStartParams_t *Params)
 {
     CFE_Status_t        Status;
     CFE_ES_AppRecord_t *AppRecPtr;
@@ -700,10 +812,8 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     ** validation test.  So this function effectively has exclusive access
     ** without holding the global lock.
     **
-    ** IMPORTANT: it must set the ID to something else before leaving
-    ** this function or else the resource will be leaked.  After this
-    ** point, execution must proceed to the end of the function to
-    ** guarantee that the entry is either completed or freed.
+    ** IMPORTANT: the caller must set the ID to something else via
+    ** CFE_ES_AppCreateFinish() or else the resource will be leaked.
     */
 
     /*
@@ -762,19 +872,45 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
-    /*
-     * If ID allocation was not successful, return now.
-     * A message regarding the issue should have already been logged
-     */
-    if (Status != CFE_SUCCESS)
-    {
-        return Status;
-    }
+    *PendingResourceIdPtr = PendingResourceId;
 
-    /*
-     * Load the module based on StartParams configured above.
-     */
-    Status = CFE_ES_LoadModule(PendingResourceId, AppName, &AppRecPtr->StartParams.BasicInfo, &AppRecPtr->LoadStatus);
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppCreateLoad
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreateLoad(CFE_ResourceId_t PendingResourceId)
+{
+    CFE_ES_AppRecord_t *AppRecPtr;
+
+    /* The entry is RESERVED, so no other task modifies it and it can be used without the lock */
+    AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
+
+    return CFE_ES_LoadModule(PendingResourceId, AppRecPtr->AppName, &AppRecPtr->StartParams.BasicInfo,
+                             &AppRecPtr->LoadStatus);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_AppCreateFinish
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_AppCreateFinish(CFE_ES_AppId_t *ApplicationIdPtr, CFE_ResourceId_t PendingResourceId, int32 LoadStatus)
+{
+    CFE_Status_t        Status;
+    CFE_ES_AppRecord_t *AppRecPtr;
+
+    AppRecPtr = CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(PendingResourceId));
+    Status    = LoadStatus;
 
     /*
      * If the Load was OK, then complete the initialization
@@ -783,7 +919,7 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     {
         Status =
             CFE_ES_StartAppTask(&AppRecPtr->MainTaskId, /* Task ID (output) stored in App Record as main task */
-                                AppName,                /* Main Task name matches app name */
+                                AppRecPtr->AppName,     /* Main Task name matches app name */
                                 (CFE_ES_TaskEntryFuncPtr_t)
                                     AppRecPtr->LoadStatus.InitSymbolAddress, /* Init Symbol is main task entry point */
                                 &AppRecPtr->StartParams.MainTaskInfo,        /* Main task parameters */
@@ -825,6 +961,320 @@ int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, co
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadBegin
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadBegin(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    char                       WorkerName[OS_MAX_API_NAME];
+    int32                      OsStatus;
+    uint32                     i;
+
+    memset(QueuePtr, 0, sizeof(*QueuePtr));
+    QueuePtr->WorkSem = OS_OBJECT_ID_UNDEFINED;
+    QueuePtr->DoneSem = OS_OBJECT_ID_UNDEFINED;
+    for (i = 0; i < CFE_ES_STARTUP_LOAD_MAX_WORKERS; ++i)
+    {
+        QueuePtr->WorkerIds[i] = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    OsStatus = OS_CountSemCreate(&QueuePtr->WorkSem, "ES_LOAD_WORK", 0, 0);
+    if (OsStatus == OS_SUCCESS)
+    {
+        OsStatus = OS_CountSemCreate(&QueuePtr->DoneSem, "ES_LOAD_DONE", 0, 0);
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Cannot create load worker semaphores, EC = %ld\n", __func__, (long)OsStatus);
+    }
+    else
+    {
+        while (QueuePtr->NumWorkers < CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS)
+        {
+            snprintf(WorkerName, sizeof(WorkerName), "ES_LOAD_%u", (unsigned int)QueuePtr->NumWorkers);
+
+            /*
+             * These are plain OSAL tasks rather than ES child tasks, as the ES startup
+             * task is not an app.  They are tracked here and deleted if they stall.
+             */
+            OsStatus = OS_TaskCreate(&QueuePtr->WorkerIds[QueuePtr->NumWorkers], WorkerName,
+                                     CFE_ES_StartupLoadWorkerMain, OSAL_TASK_STACK_ALLOCATE,
+                                     CFE_PLATFORM_ES_STARTUP_LOAD_STACK_SIZE, CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY,
+                                     OS_FP_ENABLED);
+            if (OsStatus != OS_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: Cannot create load worker %s, EC = %ld\n", __func__, WorkerName,
+                                     (long)OsStatus);
+                break;
+            }
+
+            ++QueuePtr->NumWorkers;
+        }
+    }
+
+    /*
+     * The queue is used even without workers, in which case this task
+     * loads every module itself when the queue is flushed.
+     */
+    QueuePtr->Active = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadQueueApp
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_StartupLoadQueueApp(const char *AppName, const CFE_ES_AppStartParams_t *Params)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    CFE_ES_StartupLoadEntry_t *EntryPtr;
+    CFE_ResourceId_t           PendingResourceId;
+    int32                      Status;
+
+    /*
+     * Each queued app holds a reserved app table entry until the queue is flushed,
+     * and the queue has one entry per app table entry, so it cannot overflow.
+     */
+    Status = CFE_ES_AppCreateReserve(&PendingResourceId, AppName, Params);
+    if (Status == CFE_SUCCESS)
+    {
+        EntryPtr                    = &QueuePtr->Entries[QueuePtr->NumEntries];
+        EntryPtr->PendingResourceId = PendingResourceId;
+        EntryPtr->Status            = CFE_ES_ERR_APP_CREATE;
+        ++QueuePtr->NumEntries;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadRunQueue
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_StartupLoadRunQueue(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    CFE_ES_StartupLoadEntry_t *EntryPtr;
+    OS_time_t                  StartTime;
+    OS_time_t                  EndTime;
+    uint32                     Index;
+    uint32                     Count;
+
+    Count = 0;
+    while (true)
+    {
+        Index = OS_AtomicFetchAdd32(&QueuePtr->NextEntry, 1);
+        if (Index >= QueuePtr->NumEntries)
+        {
+            break;
+        }
+
+        EntryPtr = &QueuePtr->Entries[Index];
+
+        CFE_PSP_GetTime(&StartTime);
+        EntryPtr->Status = CFE_ES_AppCreateLoad(EntryPtr->PendingResourceId);
+        CFE_PSP_GetTime(&EndTime);
+
+        EntryPtr->LoadTime = OS_TimeSubtract(EndTime, StartTime);
+        ++Count;
+    }
+
+    return Count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadWorkerMain
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadWorkerMain(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+
+    /*
+     * Each batch takes one WorkSem token and gives one DoneSem token.
+     * The queue contents are only changed by the startup task while it
+     * holds all of the DoneSem tokens, so no locking is needed here.
+     */
+    while (OS_CountSemTake(QueuePtr->WorkSem) == OS_SUCCESS && !QueuePtr->Shutdown)
+    {
+        CFE_ES_StartupLoadRunQueue();
+        OS_CountSemGive(QueuePtr->DoneSem);
+    }
+
+    /* Let the startup task know this worker is done with the semaphores */
+    OS_CountSemGive(QueuePtr->DoneSem);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadWaitWorkers
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadWaitWorkers(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    int32                      OsStatus;
+    uint32                     i;
+
+    OsStatus = OS_SUCCESS;
+    for (i = 0; i < QueuePtr->NumWorkers && OsStatus == OS_SUCCESS; ++i)
+    {
+        OsStatus = OS_CountSemTimedWait(QueuePtr->DoneSem, CFE_PLATFORM_ES_STARTUP_LOAD_TIMEOUT_MSEC);
+    }
+
+    if (OsStatus != OS_SUCCESS)
+    {
+        /*
+         * A token cannot be matched to the worker that gave it, so every worker
+         * that still exists is deleted, and the queue carries on without them.
+         */
+        CFE_ES_WriteToSysLog("%s: Load worker did not respond, EC = %ld\n", __func__, (long)OsStatus);
+
+        for (i = 0; i < QueuePtr->NumWorkers; ++i)
+        {
+            OsStatus = OS_TaskDelete(QueuePtr->WorkerIds[i]);
+            if (OsStatus == OS_SUCCESS)
+            {
+                CFE_ES_WriteToSysLog("%s: Deleted load worker task %lu\n", __func__,
+                                     OS_ObjectIdToInteger(QueuePtr->WorkerIds[i]));
+            }
+            QueuePtr->WorkerIds[i] = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        QueuePtr->NumWorkers = 0;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadFlush
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadFlush(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    CFE_ES_StartupLoadEntry_t *EntryPtr;
+    CFE_ES_AppId_t             AppId;
+    char                       AppName[OS_MAX_API_NAME];
+    OS_time_t                  StartTime;
+    OS_time_t                  EndTime;
+    int32                      Status;
+    uint32                     LocalCount;
+    uint32                     i;
+
+    if (QueuePtr->NumEntries == 0)
+    {
+        return;
+    }
+
+    /*
+     * Start the batch on all workers and load modules here as well.  Then wait
+     * until every worker has finished, so none of them is still using an entry.
+     */
+    for (i = 0; i < QueuePtr->NumWorkers; ++i)
+    {
+        OS_CountSemGive(QueuePtr->WorkSem);
+    }
+
+    LocalCount = CFE_ES_StartupLoadRunQueue();
+
+    CFE_ES_StartupLoadWaitWorkers();
+
+    CFE_ES_WriteToSysLog("%s: Loaded %u modules, %u by load workers\n", __func__, (unsigned int)QueuePtr->NumEntries,
+                         (unsigned int)(QueuePtr->NumEntries - LocalCount));
+
+    /*
+     * Start the apps in script order.  Any app with a failed module
+     * load has its app table entry freed here.
+     */
+    for (i = 0; i < QueuePtr->NumEntries; ++i)
+    {
+        EntryPtr = &QueuePtr->Entries[i];
+
+        strncpy(AppName, CFE_ES_LocateAppRecordByID(CFE_ES_APPID_C(EntryPtr->PendingResourceId))->AppName,
+                sizeof(AppName) - 1);
+        AppName[sizeof(AppName) - 1] = 0;
+
+        CFE_PSP_GetTime(&StartTime);
+        Status = CFE_ES_AppCreateFinish(&AppId, EntryPtr->PendingResourceId, EntryPtr->Status);
+        CFE_PSP_GetTime(&EndTime);
+
+        CFE_ES_WriteToSysLog("%s: %s load time %ld ms, start time %ld ms, RC=0x%08x\n", __func__, AppName,
+                             (long)OS_TimeGetTotalMilliseconds(EntryPtr->LoadTime),
+                             (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(EndTime, StartTime)),
+                             (unsigned int)Status);
+    }
+
+    QueuePtr->NumEntries = 0;
+    OS_AtomicStore32(&QueuePtr->NextEntry, 0);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_StartupLoadEnd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_StartupLoadEnd(void)
+{
+    CFE_ES_StartupLoadQueue_t *QueuePtr = &CFE_ES_Global.StartupLoadQueue;
+    uint32                     i;
+
+    CFE_ES_StartupLoadFlush();
+
+    /* Stop the workers, and wait for all of them before deleting the semaphores */
+    QueuePtr->Shutdown = true;
+    for (i = 0; i < QueuePtr->NumWorkers; ++i)
+    {
+        OS_CountSemGive(QueuePtr->WorkSem);
+    }
+    CFE_ES_StartupLoadWaitWorkers();
+
+    /* The workers delete themselves on exit */
+    for (i = 0; i < QueuePtr->NumWorkers; ++i)
+    {
+        QueuePtr->WorkerIds[i] = OS_OBJECT_ID_UNDEFINED;
+    }
+
+    if (OS_ObjectIdDefined(QueuePtr->WorkSem))
+    {
+        OS_CountSemDelete(QueuePtr->WorkSem);
+    }
+    if (OS_ObjectIdDefined(QueuePtr->DoneSem))
+    {
+        OS_CountSemDelete(QueuePtr->DoneSem);
+    }
+
+    QueuePtr->NumWorkers = 0;
+    QueuePtr->Active     = false;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_LoadLibrary
@@ -1558,6 +2008,11 @@ int32 CFE_ES_CleanUpApp(CFE_ES_AppId_t AppId)
 
     CFE_ES_UnlockSharedData(__func__, __LINE__);
 
+    /*
+     * An app that is removed no longer holds up the startup sync
+     */
+    CFE_ES_NotifyAppStateChange();
+
     return (ReturnCode);
 }
 
@@ -41,11 +41,12 @@
 
 #include "cfe_es_api_typedefs.h"
 #include "cfe_fs_api_typedefs.h"
+#include "osapi-clock.h"
 
 /*
 ** Macro Definitions
 */
-#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 8
+#define CFE_ES_STARTSCRIPT_MAX_TOKENS_PER_LINE 10
 
 /*
 ** Type Definitions
@@ -105,6 +106,7 @@ typedef struct
 {
     size_t                     StackSize;
     CFE_ES_TaskPriority_Atom_t Priority;
+    uint32                     CpuMask; /* Processors the task may run on, 0 for no restriction */
 
 } CFE_ES_TaskStartParams_t;
 
@@ -124,6 +126,7 @@ typedef struct
 
     CFE_ES_TaskStartParams_t      MainTaskInfo;
     CFE_ES_ExceptionAction_Enum_t ExceptionAction;
+    uint32                        ChildCpuMask; /* Processors the app's child tasks may run on */
 
 } CFE_ES_AppStartParams_t;
 
@@ -183,6 +186,51 @@ typedef struct
     uint8  LastScanCommandCount;
 } CFE_ES_AppTableScanState_t;
 
+/*
+** CFE_ES_StartupLoadEntry_t is an app from the startup script whose
+** module is waiting to be loaded, or has been loaded, by the load workers.
+*/
+typedef struct
+{
+    CFE_ResourceId_t PendingResourceId; /* The app table entry, in RESERVED state until created */
+    int32            Status;            /* Result of the module load */
+    OS_time_t        LoadTime;          /* Time taken by the module load and symbol lookup */
+} CFE_ES_StartupLoadEntry_t;
+
+/*
+** Size of the load worker table, which needs at least one entry even when
+** CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS is zero.
+*/
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS > 0
+#define CFE_ES_STARTUP_LOAD_MAX_WORKERS CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS
+#else
+#define CFE_ES_STARTUP_LOAD_MAX_WORKERS 1
+#endif
+
+/*
+** CFE_ES_StartupLoadQueue_t is an internal structure used to load the app
+** modules listed in the startup script concurrently.
+**
+** The ES startup task adds consecutive apps to the queue and then starts a
+** batch, where it and the worker tasks each claim entries until none are left.
+** The startup task waits for every worker to finish the batch before it creates
+** the app tasks in script order and reuses the queue.  If a worker does not
+** finish in time, all workers are deleted and the startup task loads the rest
+** of the modules itself.
+*/
+typedef struct
+{
+    bool                      Active;     /* Set while the startup script is being processed */
+    bool                      Shutdown;   /* Set to make the workers exit */
+    uint32                    NumWorkers; /* Number of worker tasks created */
+    osal_id_t                 WorkSem;    /* Given once per worker to start a batch */
+    osal_id_t                 DoneSem;    /* Given by a worker when it finishes a batch or exits */
+    osal_id_t                 WorkerIds[CFE_ES_STARTUP_LOAD_MAX_WORKERS]; /* Worker tasks, until deleted */
+    uint32                    NumEntries;
+    volatile uint32           NextEntry; /* Next entry to be claimed, updated atomically */
+    CFE_ES_StartupLoadEntry_t Entries[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+} CFE_ES_StartupLoadQueue_t;
+
 /*****************************************************************************/
 /*
 ** Function prototypes
@@ -256,6 +304,88 @@ int32 CFE_ES_StartAppTask(CFE_ES_TaskId_t *TaskIdPtr, const char *TaskName, CFE_
  */
 int32 CFE_ES_AppCreate(CFE_ES_AppId_t *ApplicationIdPtr, const char *AppName, const CFE_ES_AppStartParams_t *Params);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Allocates an app table entry for a new app.
+ *
+ * This is the first step of CFE_ES_AppCreate().  On success the entry is left in the
+ * RESERVED state, and CFE_ES_AppCreateFinish() must be called to complete or free it.
+ */
+int32 CFE_ES_AppCreateReserve(CFE_ResourceId_t *PendingResourceIdPtr, const char *AppName,
+                              const CFE_ES_AppStartParams_t *Params);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads the module for an app table entry allocated by CFE_ES_AppCreateReserve().
+ *
+ * This does not take the ES lock, so the modules of different apps may be loaded
+ * concurrently.
+ */
+int32 CFE_ES_AppCreateLoad(CFE_ResourceId_t PendingResourceId);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Completes the creation of an app whose module was loaded by CFE_ES_AppCreateLoad().
+ *
+ * If LoadStatus is successful the main task is started.  The app table entry is then
+ * either made valid or freed, depending on the overall result.
+ */
+int32 CFE_ES_AppCreateFinish(CFE_ES_AppId_t *ApplicationIdPtr, CFE_ResourceId_t PendingResourceId, int32 LoadStatus);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Creates the startup module load worker tasks, and enables the startup load queue.
+ *
+ * If the workers cannot be created, the queue is still used but all modules are
+ * loaded by the calling task.
+ */
+void CFE_ES_StartupLoadBegin(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Adds an app from the startup script to the startup load queue.
+ *
+ * The app table entry is allocated immediately.  The module is loaded and the
+ * app started by the next call to CFE_ES_StartupLoadFlush().
+ */
+int32 CFE_ES_StartupLoadQueueApp(const char *AppName, const CFE_ES_AppStartParams_t *Params);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads the modules of all queued apps, then starts the apps in the order they were queued.
+ */
+void CFE_ES_StartupLoadFlush(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Flushes the startup load queue, then stops the worker tasks and disables the queue.
+ */
+void CFE_ES_StartupLoadEnd(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Loads queued modules until no unclaimed entries are left in the startup load queue.
+ *
+ * \returns The number of entries loaded by the calling task
+ */
+uint32 CFE_ES_StartupLoadRunQueue(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Entry point of the startup module load worker tasks.
+ */
+void CFE_ES_StartupLoadWorkerMain(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * Waits for each startup module load worker to give the done semaphore.
+ *
+ * Waits up to #CFE_PLATFORM_ES_STARTUP_LOAD_TIMEOUT_MSEC for each worker.  If any
+ * worker does not respond in time, every worker task that still exists is deleted
+ * and reported in the syslog, and the queue continues without workers.
+ */
+void CFE_ES_StartupLoadWaitWorkers(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * This function loads and initializes a cFE Shared Library.
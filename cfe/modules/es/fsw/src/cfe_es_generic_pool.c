@@ -35,11 +35,24 @@
 ** Includes
 */
 #include "cfe_es_module_all.h"
+#include "osapi-atomic.h"
 
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
+/*
+** Macro Definitions
+*/
+
+/*
+ * Layout of the tagged free list head used in lock-free mode.  The block
+ * offset is in the lower bits and the update tag is in the upper bits.
+ */
+#define CFE_ES_GENERIC_POOL_FREE_OFFSET_BITS 48
+#define CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK ((((uint64)1) << CFE_ES_GENERIC_POOL_FREE_OFFSET_BITS) - 1)
+#define CFE_ES_GENERIC_POOL_FREE_TAG_INCR    (((uint64)1) << CFE_ES_GENERIC_POOL_FREE_OFFSET_BITS)
+
 /*****************************************************************************/
 /*
 ** Functions
@@ -47,26 +60,103 @@
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_ES_GenPoolFindBucket
+ * Function: CFE_ES_GenPoolSizeClass
  *
  * Internal helper routine only, not part of API.
  *
- * Find the appropriate bucket given a requested block size
+ * Get the size class of a given block size.  Sizes below 4 each
+ * have their own class, above that each power of two is split into
+ * 4 classes.  Classes increase with size.
  *
  *-----------------------------------------------------------------*/
-uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
+uint32 CFE_ES_GenPoolSizeClass(size_t Size)
 {
-    uint16 Index;
+    uint32 Msb;
+    uint32 Shift;
+    size_t Value;
+
+    if (Size < (1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS))
+    {
+        return Size;
+    }
 
-    for (Index = 0; Index < PoolRecPtr->NumBuckets; ++Index)
+    /* Find the most significant bit with a fixed number of steps */
+    Msb   = 0;
+    Value = Size;
+    for (Shift = 4 * sizeof(size_t); Shift > 0; Shift >>= 1)
     {
-        if (ReqSize <= PoolRecPtr->Buckets[Index].BlockSize)
+        if ((Value >> Shift) != 0)
         {
-            /* it fits - stop here */
-            break;
+            Value >>= Shift;
+            Msb += Shift;
         }
     }
 
+    /* The class is made from the MSB position and the bits just below it */
+    Shift = Msb - CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS;
+    return ((Shift + 1) << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) +
+           ((Size >> Shift) & ((1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) - 1));
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolSizeClassMin
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Get the smallest size in a size class, the inverse of CFE_ES_GenPoolSizeClass
+ *
+ *-----------------------------------------------------------------*/
+size_t CFE_ES_GenPoolSizeClassMin(uint32 SizeClass)
+{
+    uint32 Shift;
+
+    if (SizeClass < (1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS))
+    {
+        return SizeClass;
+    }
+
+    Shift = (SizeClass >> CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) - 1;
+    if ((Shift + CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) >= (8 * sizeof(size_t)))
+    {
+        /* Class is not reachable with this size_t */
+        return ~((size_t)0);
+    }
+
+    return ((size_t)((1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) +
+                     (SizeClass & ((1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) - 1))))
+           << Shift;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolFindBucket
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize)
+{
+    uint16 Index;
+
+    /*
+     * The table gives the first bucket that can hold the smallest size in the
+     * class.  A class covers a range of sizes, so a larger request in the
+     * same class may need one of the following buckets.
+     */
+    Index = PoolRecPtr->SizeClassBucket[CFE_ES_GenPoolSizeClass(ReqSize)];
+    while (Index < PoolRecPtr->NumBuckets && ReqSize > PoolRecPtr->Buckets[Index].BlockSize)
+    {
+        ++Index;
+    }
+
+    if (Index >= PoolRecPtr->NumBuckets)
+    {
+        /* Too large for any bucket */
+        return 0;
+    }
+
     /*
      * Invert output such that if a bucket wasn't found, this
      * will return 0.  A valid bucket ID will be nonzero.
@@ -96,6 +186,70 @@ CFE_ES_GenPoolBucket_t *CFE_ES_GenPoolGetBucketState(CFE_ES_GenPoolRecord_t *Poo
     return &PoolRecPtr->Buckets[Index];
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolRecycleLockFree
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Find and re-allocate a previously returned block, in lock-free mode
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolRecycleLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                    size_t *BlockOffsetPtr)
+{
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    size_t                  BlockOffset;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    uint64                  Head;
+    uint64                  NextHead;
+    uint16                  RecycleBucketId;
+
+    BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+    if (BucketPtr == NULL)
+    {
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    Head = OS_AtomicLoad64(&BucketPtr->FreeListHead);
+    do
+    {
+        BlockOffset = (size_t)(Head & CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK);
+        if (BlockOffset == 0)
+        {
+            /* no buffers in pool to recycle */
+            return CFE_ES_BUFFER_NOT_IN_POOL;
+        }
+
+        /*
+         * Another task may take this block and change its descriptor before the
+         * swap below.  The tag is changed on every update of the head, so the
+         * swap fails in that case and the stale NextOffset is not used.
+         */
+        PoolRecPtr->Retrieve(PoolRecPtr, BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE, &BdPtr);
+        NextHead = ((Head & ~CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK) + CFE_ES_GENERIC_POOL_FREE_TAG_INCR) |
+                   (BdPtr->NextOffset & CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK);
+    } while (!OS_AtomicCompareExchange64(&BucketPtr->FreeListHead, &Head, NextHead));
+
+    /* The block now belongs to this caller */
+    RecycleBucketId = BdPtr->Allocated - CFE_ES_MEMORY_DEALLOCATED;
+    if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || RecycleBucketId != BucketId)
+    {
+        /* sanity check failed - possible pool corruption?  The block is not used again. */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+    BdPtr->ActualSize = NewSize;
+    BdPtr->NextOffset = 0;
+
+    OS_AtomicFetchAdd32(&BucketPtr->RecycleCount, 1);
+
+    *BlockOffsetPtr = BlockOffset;
+
+    return CFE_SUCCESS;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_GenPoolRecyclePoolBlock
@@ -116,6 +270,11 @@ int32 CFE_ES_GenPoolRecyclePoolBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16
     uint16                  RecycleBucketId;
     int32                   Status;
 
+    if (PoolRecPtr->LockFree)
+    {
+        return CFE_ES_GenPoolRecycleLockFree(PoolRecPtr, BucketId, NewSize, BlockOffsetPtr);
+    }
+
     BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
     if (BucketPtr == NULL || BucketPtr->RecycleCount == BucketPtr->ReleaseCount || BucketPtr->FirstOffset == 0)
     {
@@ -250,6 +409,7 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
     cpuaddr                 AlignMask;
     uint32                  i;
     uint32                  j;
+    size_t                  ClassMinSize;
     CFE_ES_GenPoolBucket_t *BucketPtr;
 
     /*
@@ -328,9 +488,66 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
         return CFE_ES_ERR_MEM_BLOCK_SIZE;
     }
 
+    /*
+     * Build the size class table.  Each entry is the first bucket which can
+     * hold the smallest size of that class, or NumBuckets if none can.
+     */
+    j = 0;
+    for (i = 0; i < CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES; ++i)
+    {
+        ClassMinSize = CFE_ES_GenPoolSizeClassMin(i);
+        while (j < NumBlockSizes && PoolRecPtr->Buckets[j].BlockSize < ClassMinSize)
+        {
+            ++j;
+        }
+        PoolRecPtr->SizeClassBucket[i] = j;
+    }
+
+    return CFE_SUCCESS;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolEnableLockFree
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr)
+{
+    if ((uint64)PoolRecPtr->PoolMaxOffset > CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK)
+    {
+        /* offsets would not fit in the tagged free list head */
+        return CFE_ES_BAD_ARGUMENT;
+    }
+
+    PoolRecPtr->LockFree = true;
+
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolRecycleBlock
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolRecycleBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize)
+{
+    uint16 BucketId;
+
+    BucketId = CFE_ES_GenPoolFindBucket(PoolRecPtr, ReqSize);
+    if (BucketId == 0)
+    {
+        return CFE_ES_ERR_MEM_BLOCK_SIZE;
+    }
+
+    return CFE_ES_GenPoolRecyclePoolBlock(PoolRecPtr, BucketId, ReqSize, BlockOffsetPtr);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_GenPoolCalcMinSize
@@ -456,6 +673,8 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     CFE_ES_GenPoolBD_t *    BdPtr;
     int32                   Status;
     uint16                  BucketId;
+    uint64                  Head;
+    uint64                  NextHead;
 
     if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
     {
@@ -475,9 +694,25 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
             BucketPtr->BlockSize < BdPtr->ActualSize)
         {
             /* This does not appear to be a valid data buffer */
-            ++PoolRecPtr->ValidationErrorCount;
+            OS_AtomicFetchAdd32(&PoolRecPtr->ValidationErrorCount, 1);
             Status = CFE_ES_POOL_BLOCK_INVALID;
         }
+        else if (PoolRecPtr->LockFree)
+        {
+            BdPtr->Allocated = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+            *BlockSizePtr    = BdPtr->ActualSize;
+
+            /* Push onto the free stack, see CFE_ES_GenPoolRecycleLockFree() */
+            Head = OS_AtomicLoad64(&BucketPtr->FreeListHead);
+            do
+            {
+                BdPtr->NextOffset = (size_t)(Head & CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK);
+                NextHead = ((Head & ~CFE_ES_GENERIC_POOL_FREE_OFFSET_MASK) + CFE_ES_GENERIC_POOL_FREE_TAG_INCR) |
+                           BlockOffset;
+            } while (!OS_AtomicCompareExchange64(&BucketPtr->FreeListHead, &Head, NextHead));
+
+            OS_AtomicFetchAdd32(&BucketPtr->ReleaseCount, 1);
+        }
         else
         {
             BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
@@ -496,6 +731,98 @@ int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSi
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolSetBlockCached
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolSetBlockCached(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *BucketIdPtr, size_t *BlockSizePtr,
+                                   size_t BlockOffset)
+{
+    size_t                  DescOffset;
+    CFE_ES_GenPoolBucket_t *BucketPtr;
+    CFE_ES_GenPoolBD_t *    BdPtr;
+    int32                   Status;
+    uint16                  BucketId;
+
+    if (BlockOffset >= PoolRecPtr->TailPosition || BlockOffset < CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE)
+    {
+        /* outside the bounds of the pool */
+        return CFE_ES_BUFFER_NOT_IN_POOL;
+    }
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        BucketId  = BdPtr->Allocated - CFE_ES_MEMORY_ALLOCATED;
+        BucketPtr = CFE_ES_GenPoolGetBucketState(PoolRecPtr, BucketId);
+
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BucketPtr == NULL || BdPtr->ActualSize == 0 ||
+            BucketPtr->BlockSize < BdPtr->ActualSize)
+        {
+            /* This does not appear to be a valid data buffer - the caller should use the normal put path */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            /*
+             * Mark as deallocated so a second put of the same block is caught, but
+             * do not link it into the bucket free stack - the caller keeps it.
+             */
+            BdPtr->Allocated  = CFE_ES_MEMORY_DEALLOCATED + BucketId;
+            BdPtr->NextOffset = 0;
+            *BlockSizePtr     = BdPtr->ActualSize;
+            *BucketIdPtr      = BucketId;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GenPoolSetBlockInUse
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_ES_GenPoolSetBlockInUse(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                  size_t BlockOffset)
+{
+    size_t              DescOffset;
+    CFE_ES_GenPoolBD_t *BdPtr;
+    int32               Status;
+
+    DescOffset = BlockOffset - CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE;
+
+    Status = PoolRecPtr->Retrieve(PoolRecPtr, DescOffset, &BdPtr);
+    if (Status == CFE_SUCCESS)
+    {
+        if (BdPtr->CheckBits != CFE_ES_CHECK_PATTERN || BdPtr->Allocated != (CFE_ES_MEMORY_DEALLOCATED + BucketId))
+        {
+            /* sanity check failed - possible pool corruption? */
+            Status = CFE_ES_POOL_BLOCK_INVALID;
+        }
+        else
+        {
+            BdPtr->Allocated  = CFE_ES_MEMORY_ALLOCATED + BucketId; /* Flag memory block as allocated */
+            BdPtr->ActualSize = NewSize;
+
+            Status = PoolRecPtr->Commit(PoolRecPtr, DescOffset, BdPtr);
+        }
+    }
+
+    return Status;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_GenPoolRebuild
@@ -51,6 +51,13 @@
 #define CFE_ES_GENERIC_POOL_DESCRIPTOR_SIZE \
     sizeof(CFE_ES_GenPoolBD_t) /* amount of space to reserve with every allocation */
 
+/*
+ * Number of entries in the size class table used to find the bucket for a request.
+ * There are 4 size classes for each power of two which can be represented in a size_t.
+ */
+#define CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS 2
+#define CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES   ((1 << CFE_ES_GENERIC_POOL_SIZE_CLASS_SUBBITS) * 8 * sizeof(size_t))
+
 /*
 ** Type Definitions
 */
@@ -70,6 +77,13 @@ typedef struct CFE_ES_GenPoolBucket
     uint32 AllocationCount; /**< Total number of buffers of this block size that exist (initial get) */
     uint32 ReleaseCount;    /**< Total number of buffers that have been released (put back) */
     uint32 RecycleCount;    /**< Total number of buffers that have been recycled (get after put) */
+
+    /**
+     * Top of the "free stack" when the pool is in lock-free mode, used instead of FirstOffset.
+     * The lower bits hold the block offset and the upper bits hold a tag which is
+     * changed on every update, so a stale compare-and-swap cannot succeed (ABA problem).
+     */
+    volatile uint64 FreeListHead;
 } CFE_ES_GenPoolBucket_t;
 
 /*
@@ -114,8 +128,16 @@ struct CFE_ES_GenPoolRecord
     uint32 AllocationCount;      /**< Total number of block allocations of any size */
     uint32 ValidationErrorCount; /**< Count of validation errors */
 
+    bool LockFree; /**< Set by CFE_ES_GenPoolEnableLockFree(), free lists use atomic operations */
+
     uint16                 NumBuckets; /**< Number of entries in the "Buckets" array that are valid */
     CFE_ES_GenPoolBucket_t Buckets[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Bucket States */
+
+    /**
+     * Index into Buckets of the smallest bucket which can hold the smallest
+     * size in each size class.  Built by CFE_ES_GenPoolInitialize().
+     */
+    uint8 SizeClassBucket[CFE_ES_GENERIC_POOL_NUM_SIZE_CLASSES];
 };
 
 /*****************************************************************************/
@@ -145,6 +167,44 @@ int32 CFE_ES_GenPoolInitialize(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t StartO
                                size_t AlignSize, uint16 NumBlockSizes, const size_t *BlockSizeList,
                                CFE_ES_PoolRetrieve_Func_t RetrieveFunc, CFE_ES_PoolCommit_Func_t CommitFunc);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Switch a pool to lock-free free lists
+ *
+ * After this call, returning a block to the pool with CFE_ES_GenPoolPutBlock() and
+ * recycling a returned block with CFE_ES_GenPoolRecycleBlock() use atomic operations
+ * on a separate free list for each bucket, and do not require the caller to serialize
+ * access to the pool.  CFE_ES_GenPoolGetBlock() and other calls which may create a
+ * new block still need to be serialized with each other.
+ *
+ * This must only be used with memory mapped pools, where the retrieve function
+ * returns a pointer into the pool and the commit function does nothing.  It must
+ * be called right after CFE_ES_GenPoolInitialize(), before any blocks are allocated.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolEnableLockFree(CFE_ES_GenPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Gets a previously returned block from the pool
+ *
+ * This only recycles a block which was returned to the pool, it never
+ * creates a new block.  If the pool is in lock-free mode, this does not
+ * need to be serialized with other calls.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BlockOffsetPtr  Location to output block offset
+ * \param[in]    ReqSize        Size of block requested
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ * \retval #CFE_ES_BUFFER_NOT_IN_POOL if there is no returned block of the right size
+ * \retval #CFE_ES_ERR_MEM_BLOCK_SIZE if the size is larger than the biggest bucket
+ */
+int32 CFE_ES_GenPoolRecycleBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOffsetPtr, size_t ReqSize);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Gets a block from the pool
@@ -175,6 +235,60 @@ int32 CFE_ES_GenPoolGetBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockOf
  */
 int32 CFE_ES_GenPoolPutBlock(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t *BlockSizePtr, size_t BlockOffset);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Find the bucket for a given request size
+ *
+ * This uses the size class table built at initialization, so the cost does
+ * not depend on the number of buckets.  The table is not changed after
+ * initialization, so this does not require the pool to be locked.
+ *
+ * \param[in] PoolRecPtr     Pointer to pool structure
+ * \param[in] ReqSize        Size of block requested
+ *
+ * \return Bucket ID (nonzero) which can hold the request, or 0 if the size is too large
+ */
+uint16 CFE_ES_GenPoolFindBucket(CFE_ES_GenPoolRecord_t *PoolRecPtr, size_t ReqSize);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Mark an allocated block as free, without returning it to the pool
+ *
+ * This validates the block the same way as CFE_ES_GenPoolPutBlock() and marks
+ * it as deallocated, but the block is not placed on the bucket free list.  The
+ * caller keeps the block for a later call to CFE_ES_GenPoolSetBlockInUse().
+ *
+ * Only the block descriptor is modified, so the pool does not need to be locked
+ * as long as the caller owns the block.  No error counters are incremented; on
+ * failure the caller should use CFE_ES_GenPoolPutBlock() to get the normal handling.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[out]   BucketIdPtr    Location to output the bucket ID of the block
+ * \param[out]   BlockSizePtr   Location to output original allocation size
+ * \param[in]    BlockOffset    Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolSetBlockCached(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 *BucketIdPtr, size_t *BlockSizePtr,
+                                   size_t BlockOffset);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Mark a block kept by CFE_ES_GenPoolSetBlockCached() as allocated again
+ *
+ * Only the block descriptor is modified, so the pool does not need to be locked
+ * as long as the caller owns the block.
+ *
+ * \param[inout] PoolRecPtr     Pointer to pool structure
+ * \param[in]    BucketId       Bucket ID of the block
+ * \param[in]    NewSize        Size of block requested
+ * \param[in]    BlockOffset    Offset of data block
+ *
+ * \return #CFE_SUCCESS, or error code \ref CFEReturnCodes
+ */
+int32 CFE_ES_GenPoolSetBlockInUse(CFE_ES_GenPoolRecord_t *PoolRecPtr, uint16 BucketId, size_t NewSize,
+                                  size_t BlockOffset);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * \brief Rebuild list of free blocks in pool
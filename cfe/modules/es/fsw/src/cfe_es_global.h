@@ -43,6 +43,7 @@
 #include "cfe_es_erlog_typedef.h"
 #include "cfe_es_resetdata_typedef.h"
 #include "cfe_es_cds.h"
+#include "osapi-clock.h"
 
 #include <signal.h> /* for sig_atomic_t */
 
@@ -152,6 +153,15 @@ typedef struct
     ** Startup Sync
     */
     volatile sig_atomic_t SystemState;
+    osal_id_t             AppStateSyncSem;    /**< Given by apps when their state advances during startup */
+    osal_id_t             SystemStateSem;     /**< Given once per waiter when SystemState advances */
+    uint32                SystemStateWaiters; /**< Number of tasks blocked on SystemStateSem */
+    OS_time_t             SystemStateTime[CFE_ES_SystemState_OPERATIONAL + 1]; /**< Entry time of each state */
+
+    /*
+    ** Startup script module loading
+    */
+    CFE_ES_StartupLoadQueue_t StartupLoadQueue;
 
     /*
     ** ES Task Table
@@ -35,6 +35,7 @@
 ** Includes
 */
 #include "cfe_es_module_all.h"
+#include "osapi-atomic.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -162,6 +163,255 @@ CFE_ES_MemPoolRecord_t *CFE_ES_LocateMemPoolRecordByID(CFE_ES_MemHandle_t PoolID
     return MemPoolRecPtr;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_MemPoolGetTaskCache
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_ES_MemPoolTaskCache_t *CFE_ES_MemPoolGetTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    osal_id_t                  TaskId;
+    osal_index_t               TaskIdx;
+    size_t                     DataOffset;
+    int32                      Status;
+
+    TaskId = OS_TaskGetId();
+    if (OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, TaskId, &TaskIdx) != OS_SUCCESS || TaskIdx >= OS_MAX_TASKS)
+    {
+        /* Not an OSAL task, so it cannot have a cache */
+        return NULL;
+    }
+
+    /*
+     * Only the task at this index reads or writes its slot, so this
+     * does not need the mutex except for the initial allocation.
+     */
+    DataOffset = PoolRecPtr->TaskCacheOffset[TaskIdx];
+    if (DataOffset == 0)
+    {
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
+
+        Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, sizeof(CFE_ES_MemPoolTaskCache_t));
+
+        if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
+
+        if (Status != CFE_SUCCESS)
+        {
+            return NULL;
+        }
+
+        CachePtr = (CFE_ES_MemPoolTaskCache_t *)(PoolRecPtr->BaseAddr + DataOffset);
+        memset(CachePtr, 0, sizeof(*CachePtr));
+        CachePtr->OwnerTaskId = TaskId;
+
+        PoolRecPtr->TaskCacheOffset[TaskIdx] = DataOffset;
+    }
+    else
+    {
+        CachePtr = (CFE_ES_MemPoolTaskCache_t *)(PoolRecPtr->BaseAddr + DataOffset);
+
+        /*
+         * If the task index was reused, the previous owner has exited.  The
+         * blocks in its cache are still valid free blocks, so the new task
+         * can simply take over the cache.
+         */
+        if (!OS_ObjectIdEqual(CachePtr->OwnerTaskId, TaskId))
+        {
+            CachePtr->OwnerTaskId = TaskId;
+        }
+    }
+
+    return CachePtr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_MemPoolDepotGet
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolDepotGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, CFE_ES_MemPoolMagazine_t *MagPtr)
+{
+    CFE_ES_MemPoolDepot_t *DepotPtr;
+    bool                   IsLoaded;
+
+    DepotPtr = &PoolRecPtr->Depot[BucketId - 1];
+
+    /*
+     * The depot is shared by all tasks.  Pools without a mutex
+     * are serialized by the caller, as for the rest of the pool.
+     */
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+    }
+
+    IsLoaded = (DepotPtr->Count > 0);
+    if (IsLoaded)
+    {
+        --DepotPtr->Count;
+        *MagPtr = DepotPtr->Magazine[DepotPtr->Count];
+    }
+
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    return IsLoaded;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_MemPoolDepotPut
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolDepotPut(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, CFE_ES_MemPoolMagazine_t *MagPtr)
+{
+    CFE_ES_MemPoolDepot_t *DepotPtr;
+    bool                   IsStored;
+
+    DepotPtr = &PoolRecPtr->Depot[BucketId - 1];
+
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemTake(PoolRecPtr->MutexId);
+    }
+
+    IsStored = (DepotPtr->Count < CFE_ES_MEMPOOL_DEPOT_DEPTH);
+    if (IsStored)
+    {
+        DepotPtr->Magazine[DepotPtr->Count] = *MagPtr;
+        ++DepotPtr->Count;
+    }
+
+    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    {
+        OS_MutSemGive(PoolRecPtr->MutexId);
+    }
+
+    if (IsStored)
+    {
+        MagPtr->Count = 0;
+    }
+
+    return IsStored;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_MemPoolCacheGet
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolCacheGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    CFE_ES_MemPoolMagazine_t * MagPtr;
+    uint16                     BucketId;
+    size_t                     DataOffset;
+
+    BucketId = CFE_ES_GenPoolFindBucket(&PoolRecPtr->Pool, Size);
+    if (BucketId == 0)
+    {
+        /* Too big for any bucket, let the normal path report it */
+        return false;
+    }
+
+    CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr);
+    if (CachePtr == NULL)
+    {
+        return false;
+    }
+
+    MagPtr = &CachePtr->Magazine[BucketId - 1];
+    if (MagPtr->Count == 0)
+    {
+        /* The depot may hold blocks released by other tasks */
+        CFE_ES_MemPoolDepotGet(PoolRecPtr, BucketId, MagPtr);
+    }
+
+    while (MagPtr->Count > 0)
+    {
+        --MagPtr->Count;
+        DataOffset = MagPtr->BlockOffset[MagPtr->Count];
+
+        /*
+         * This only fails if the descriptor was overwritten while the
+         * block was in the cache.  The block is dropped in that case.
+         */
+        if (CFE_ES_GenPoolSetBlockInUse(&PoolRecPtr->Pool, BucketId, Size, DataOffset) == CFE_SUCCESS)
+        {
+            *DataOffsetPtr = DataOffset;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_MemPoolCachePut
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool CFE_ES_MemPoolCachePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset)
+{
+    CFE_ES_MemPoolTaskCache_t *CachePtr;
+    CFE_ES_MemPoolMagazine_t * MagPtr;
+    uint16                     BucketId;
+    size_t                     DataSize;
+
+    CachePtr = CFE_ES_MemPoolGetTaskCache(PoolRecPtr);
+    if (CachePtr == NULL)
+    {
+        return false;
+    }
+
+    /*
+     * On failure the block is left as-is, and the normal path
+     * will do the error reporting and counting.
+     */
+    if (CFE_ES_GenPoolSetBlockCached(&PoolRecPtr->Pool, &BucketId, &DataSize, DataOffset) != CFE_SUCCESS)
+    {
+        return false;
+    }
+
+    MagPtr = &CachePtr->Magazine[BucketId - 1];
+    if (MagPtr->Count >= CFE_ES_MEMPOOL_CACHE_DEPTH && !CFE_ES_MemPoolDepotPut(PoolRecPtr, BucketId, MagPtr))
+    {
+        /* Cache and depot are full, so restore the block and return it to the pool instead */
+        CFE_ES_GenPoolSetBlockInUse(&PoolRecPtr->Pool, BucketId, DataSize, DataOffset);
+        return false;
+    }
+
+    MagPtr->BlockOffset[MagPtr->Count] = DataOffset;
+    ++MagPtr->Count;
+
+    *DataSizePtr = DataSize;
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_PoolCreateNoSem
@@ -199,7 +449,7 @@ CFE_Status_t CFE_ES_PoolCreate(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t
  *
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_t Size, uint16 NumBlockSizes,
-                                 const size_t *BlockSizes, bool UseMutex)
+                                 const size_t *BlockSizes, uint32 Options)
 {
     int32                   OsStatus;
     int32                   Status;
@@ -299,10 +549,15 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
     Status = CFE_ES_GenPoolInitialize(&PoolRecPtr->Pool, 0, Size, Alignment, NumBlockSizes, BlockSizes,
                                       CFE_ES_MemPoolDirectRetrieve, CFE_ES_MemPoolDirectCommit);
 
+    if (Status == CFE_SUCCESS && (Options & CFE_ES_POOL_LOCK_FREE) != 0)
+    {
+        Status = CFE_ES_GenPoolEnableLockFree(&PoolRecPtr->Pool);
+    }
+
     /*
      * If successful, complete the process.
      */
-    if (Status == CFE_SUCCESS && UseMutex == CFE_ES_USE_MUTEX)
+    if (Status == CFE_SUCCESS && (Options & CFE_ES_USE_MUTEX) != 0)
     {
         /*
         ** Construct a name for the Mutex from the address
@@ -329,6 +584,7 @@ CFE_Status_t CFE_ES_PoolCreateEx(CFE_ES_MemHandle_t *PoolID, void *MemPtr, size_
          * This is only relevant for memory-mapped pools which is why it is done here.
          */
         PoolRecPtr->BaseAddr = (cpuaddr)MemPtr;
+        PoolRecPtr->UseCache = ((Options & CFE_ES_POOL_TASK_CACHE) != 0);
 
         /*
          * Get the calling context.
@@ -447,29 +703,63 @@ int32 CFE_ES_GetPoolBuf(CFE_ES_MemPoolBuf_t *BufPtr, CFE_ES_MemHandle_t Handle,
     }
 
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * If the pool has per-task caches, try the cache of the
+     * calling task first.  This does not need the mutex.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (PoolRecPtr->UseCache && CFE_ES_MemPoolCacheGet(PoolRecPtr, &DataOffset, Size))
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        OS_AtomicFetchAdd32(&PoolRecPtr->CacheHits, 1);
+        Status = CFE_SUCCESS;
     }
+    else
+    {
+        if (PoolRecPtr->UseCache)
+        {
+            OS_AtomicFetchAdd32(&PoolRecPtr->CacheMisses, 1);
+        }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+        /*
+         * With lock-free free lists, a returned block can be
+         * recycled without the mutex.  Only creating a new
+         * block from the unused part of the pool needs it.
+         */
+        if (PoolRecPtr->Pool.LockFree)
+        {
+            Status = CFE_ES_GenPoolRecycleBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+        }
+        else
+        {
+            Status = CFE_ES_BUFFER_NOT_IN_POOL;
+        }
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        if (Status != CFE_SUCCESS)
+        {
+            /*
+             * Real work begins here.
+             * If pool is mutex-protected, take the mutex now.
+             */
+            if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+            {
+                OS_MutSemTake(PoolRecPtr->MutexId);
+            }
+
+            /*
+             * Fundamental work is done as a generic routine.
+             *
+             * If successful, this gets an offset, which can then
+             * be translated into a pointer to return to the caller.
+             */
+            Status = CFE_ES_GenPoolGetBlock(&PoolRecPtr->Pool, &DataOffset, Size);
+
+            /*
+             * Real work ends here.
+             * If pool is mutex-protected, release the mutex now.
+             */
+            if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+            {
+                OS_MutSemGive(PoolRecPtr->MutexId);
+            }
+        }
     }
 
     /* If not successful, return error now */
@@ -560,6 +850,7 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
     size_t                  DataSize;
     size_t                  DataOffset;
     int32                   Status;
+    bool                    UseMutex;
 
     if (BufPtr == NULL)
     {
@@ -576,32 +867,51 @@ int32 CFE_ES_PutPoolBuf(CFE_ES_MemHandle_t Handle, CFE_ES_MemPoolBuf_t BufPtr)
         return (CFE_ES_ERR_RESOURCEID_NOT_VALID);
     }
 
+    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+
     /*
-     * Real work begins here.
-     * If pool is mutex-protected, take the mutex now.
+     * If the pool has per-task caches, try to keep the block in
+     * the cache of the calling task.  This does not need the mutex.
      */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
+    if (PoolRecPtr->UseCache && CFE_ES_MemPoolCachePut(PoolRecPtr, &DataSize, DataOffset))
     {
-        OS_MutSemTake(PoolRecPtr->MutexId);
+        OS_AtomicFetchAdd32(&PoolRecPtr->CacheHits, 1);
+        Status = CFE_SUCCESS;
     }
+    else
+    {
+        if (PoolRecPtr->UseCache)
+        {
+            OS_AtomicFetchAdd32(&PoolRecPtr->CacheMisses, 1);
+        }
 
-    DataOffset = (cpuaddr)BufPtr - PoolRecPtr->BaseAddr;
+        /*
+         * Real work begins here.
+         * If pool is mutex-protected, take the mutex now.
+         * With lock-free free lists, the put does not need it.
+         */
+        UseMutex = (OS_ObjectIdDefined(PoolRecPtr->MutexId) && !PoolRecPtr->Pool.LockFree);
+        if (UseMutex)
+        {
+            OS_MutSemTake(PoolRecPtr->MutexId);
+        }
 
-    /*
-     * Fundamental work is done as a generic routine.
-     *
-     * If successful, this gets an offset, which can then
-     * be translated into a pointer to return to the caller.
-     */
-    Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
+        /*
+         * Fundamental work is done as a generic routine.
+         *
+         * If successful, this gets an offset, which can then
+         * be translated into a pointer to return to the caller.
+         */
+        Status = CFE_ES_GenPoolPutBlock(&PoolRecPtr->Pool, &DataSize, DataOffset);
 
-    /*
-     * Real work ends here.
-     * If pool is mutex-protected, release the mutex now.
-     */
-    if (OS_ObjectIdDefined(PoolRecPtr->MutexId))
-    {
-        OS_MutSemGive(PoolRecPtr->MutexId);
+        /*
+         * Real work ends here.
+         * If pool is mutex-protected, release the mutex now.
+         */
+        if (UseMutex)
+        {
+            OS_MutSemGive(PoolRecPtr->MutexId);
+        }
     }
 
     /*
@@ -687,6 +997,9 @@ CFE_Status_t CFE_ES_GetMemPoolStats(CFE_ES_MemPoolStats_t *BufPtr, CFE_ES_MemHan
         }
     }
 
+    BufPtr->CacheHits   = OS_AtomicLoad32(&PoolRecPtr->CacheHits);
+    BufPtr->CacheMisses = OS_AtomicLoad32(&PoolRecPtr->CacheMisses);
+
     /*
      * Real work ends here.
      * If pool is mutex-protected, release the mutex now.
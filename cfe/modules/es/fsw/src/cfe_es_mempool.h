@@ -36,6 +36,53 @@
 #include "common_types.h"
 #include "cfe_resourceid.h"
 #include "cfe_es_generic_pool.h"
+#include "cfe_platform_cfg.h"
+#include "osconfig.h"
+
+/**
+ * Number of free blocks of each size kept in a per-task cache
+ */
+#define CFE_ES_MEMPOOL_CACHE_DEPTH 4
+
+/**
+ * Free blocks of a single bucket (block size) held by one task
+ */
+typedef struct
+{
+    uint32 Count;                                   /**< Number of valid entries in BlockOffset */
+    size_t BlockOffset[CFE_ES_MEMPOOL_CACHE_DEPTH]; /**< Data offsets of the cached blocks */
+} CFE_ES_MemPoolMagazine_t;
+
+/**
+ * Number of full magazines of each size kept in the shared depot
+ */
+#define CFE_ES_MEMPOOL_DEPOT_DEPTH 2
+
+/**
+ * Full magazines of a single bucket, shared by all tasks
+ *
+ * A task whose magazine is full on put moves it here, and a task whose
+ * magazine is empty on get reloads from here.  This lets blocks released
+ * by one task be reused by another, e.g. SB buffers which are allocated by
+ * the sender and released by the receiver.
+ */
+typedef struct
+{
+    uint32                   Count;                                /**< Number of full magazines */
+    CFE_ES_MemPoolMagazine_t Magazine[CFE_ES_MEMPOOL_DEPOT_DEPTH]; /**< The full magazines */
+} CFE_ES_MemPoolDepot_t;
+
+/**
+ * Per-task block cache
+ *
+ * This is stored in a block taken from the pool itself the first
+ * time a task uses the pool, and is only accessed by that task.
+ */
+typedef struct
+{
+    osal_id_t                OwnerTaskId; /**< Task that this cache belongs to */
+    CFE_ES_MemPoolMagazine_t Magazine[CFE_PLATFORM_ES_POOL_MAX_BUCKETS]; /**< Indexed by bucket ID - 1 */
+} CFE_ES_MemPoolTaskCache_t;
 
 typedef struct
 {
@@ -71,8 +118,94 @@ typedef struct
      * Optional Mutex for serializing get/put operations
      */
     osal_id_t MutexId;
+
+    /**
+     * Set if the pool was created with #CFE_ES_POOL_TASK_CACHE
+     */
+    bool UseCache;
+
+    /**
+     * Data offset of the cache block for each OSAL task, indexed by
+     * the task index.  Zero if the task does not have a cache yet.
+     */
+    size_t TaskCacheOffset[OS_MAX_TASKS];
+
+    /**
+     * Shared depot of full magazines, indexed by bucket ID - 1.
+     * Accessed under the pool mutex, if configured.
+     */
+    CFE_ES_MemPoolDepot_t Depot[CFE_PLATFORM_ES_POOL_MAX_BUCKETS];
+
+    /**
+     * Cache counters, reported in the pool statistics
+     */
+    volatile uint32 CacheHits;
+    volatile uint32 CacheMisses;
 } CFE_ES_MemPoolRecord_t;
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the per-task cache of the calling task
+ *
+ * If the calling task does not yet have a cache for this pool, one
+ * is allocated from the pool.  This takes the pool mutex, if configured.
+ *
+ * @param[in]   PoolRecPtr  Pointer to the pool record, which must use a cache
+ * @returns Pointer to the cache, or NULL if the task cannot have a cache
+ */
+CFE_ES_MemPoolTaskCache_t *CFE_ES_MemPoolGetTaskCache(CFE_ES_MemPoolRecord_t *PoolRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Reload an empty magazine from the shared depot
+ *
+ * This takes the pool mutex, if configured.
+ *
+ * @param[in]   PoolRecPtr  Pointer to the pool record, which must use a cache
+ * @param[in]   BucketId    Bucket ID of the magazine
+ * @param[out]  MagPtr      Magazine to load, which must be empty
+ * @returns true if a full magazine was taken from the depot, false if the depot is empty
+ */
+bool CFE_ES_MemPoolDepotGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, CFE_ES_MemPoolMagazine_t *MagPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Move a full magazine into the shared depot
+ *
+ * This takes the pool mutex, if configured.  On success the magazine is left empty.
+ *
+ * @param[in]    PoolRecPtr  Pointer to the pool record, which must use a cache
+ * @param[in]    BucketId    Bucket ID of the magazine
+ * @param[inout] MagPtr      Magazine to store, which must be full
+ * @returns true if the magazine was stored, false if the depot is full
+ */
+bool CFE_ES_MemPoolDepotPut(CFE_ES_MemPoolRecord_t *PoolRecPtr, uint16 BucketId, CFE_ES_MemPoolMagazine_t *MagPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get a block from the per-task cache of the calling task
+ *
+ * @param[in]   PoolRecPtr     Pointer to the pool record, which must use a cache
+ * @param[out]  DataOffsetPtr  Location to output the data offset of the block
+ * @param[in]   Size           Size of block requested
+ * @returns true if the request was served from the cache, false if the caller must use the pool
+ */
+bool CFE_ES_MemPoolCacheGet(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataOffsetPtr, size_t Size);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Put a block into the per-task cache of the calling task
+ *
+ * The block is validated the same as a normal put.  If it is not valid,
+ * or both the cache and the depot for its size are full, the block is not changed.
+ *
+ * @param[in]   PoolRecPtr     Pointer to the pool record, which must use a cache
+ * @param[out]  DataSizePtr    Location to output the original size of the block
+ * @param[in]   DataOffset     Data offset of the block
+ * @returns true if the block was put in the cache, false if the caller must use the pool
+ */
+bool CFE_ES_MemPoolCachePut(CFE_ES_MemPoolRecord_t *PoolRecPtr, size_t *DataSizePtr, size_t DataOffset);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain an index value correlating to an ES Memory Pool ID
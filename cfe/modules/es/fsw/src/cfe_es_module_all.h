@@ -54,4 +54,6 @@
 #include "cfe_es_resource.h"
 #include "cfe_es_log.h"
 
+#include "crc_engine.h"
+
 #endif /* CFE_ES_MODULE_ALL_H */
@@ -30,6 +30,7 @@
 ** Include Section
 */
 #include "cfe_es_module_all.h"
+#include "osapi-atomic.h"
 
 #include <string.h>
 
@@ -87,6 +88,8 @@ void CFE_ES_SetupPerfVariables(uint32 ResetType)
         Perf->MetaData.InvalidMarkerReported = false;
         Perf->MetaData.FilterTriggerMaskSize = CFE_ES_PERF_32BIT_WORDS_IN_MASK;
 
+        memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+
         for (i = 0; i < CFE_ES_PERF_32BIT_WORDS_IN_MASK; i++)
         {
             Perf->MetaData.FilterMask[i]  = CFE_PLATFORM_ES_PERF_FILTMASK_INIT;
@@ -108,12 +111,7 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     CFE_ES_PerfDumpGlobal_t *PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
     CFE_ES_PerfDumpState_t   CurrentState  = PerfDumpState->CurrentState;
     uint32                   Result;
-    CFE_ES_PerfData_t *      Perf;
-
-    /*
-    ** Set the pointer to the data area
-    */
-    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+    CFE_ES_PerfLogExtent_t   Extent;
 
     /* note this reads the data "live" without exclusion and as such it
      * may change even between checking the state and checking the value.
@@ -123,7 +121,8 @@ uint32 CFE_ES_GetPerfLogDumpRemaining(void)
     {
         /* dump is requested but not yet to entry writing state,
          * report the entire data count from perf log */
-        Result = Perf->MetaData.DataCount;
+        CFE_ES_GetPerfLogExtent(&Extent);
+        Result = Extent.DataCount;
     }
     else if (CurrentState == CFE_ES_PerfDumpState_WRITE_PERF_ENTRIES)
     {
@@ -171,15 +170,17 @@ int32 CFE_ES_StartPerfDataCmd(const CFE_ES_StartPerfDataCmd_t *data)
             CFE_ES_Global.TaskData.CommandCounter++;
 
             /* Taking lock here as this might be changing states from one active mode to another.
-             * In that case, need to make sure that the log is not written to while resetting the counters. */
+             * Writers do not take the lock, so the log is set idle before resetting the counters. */
             OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+            OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+            memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
             Perf->MetaData.Mode                  = CmdPtr->TriggerMode;
             Perf->MetaData.TriggerCount          = 0;
             Perf->MetaData.DataStart             = 0;
             Perf->MetaData.DataEnd               = 0;
             Perf->MetaData.DataCount             = 0;
             Perf->MetaData.InvalidMarkerReported = false;
-            Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER; /* this must be done last */
+            OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER); /* this must be done last */
             OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STARTCMD_EID, CFE_EVS_EventType_DEBUG,
@@ -217,6 +218,7 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
     const CFE_ES_StopPerfCmd_Payload_t *CmdPtr        = &data->Payload;
     CFE_ES_PerfDumpGlobal_t *           PerfDumpState = &CFE_ES_Global.BackgroundPerfDumpState;
     CFE_ES_PerfData_t *                 Perf;
+    CFE_ES_PerfLogExtent_t              Extent;
     int32                               Status;
 
     /*
@@ -241,6 +243,8 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 
         if (Status == CFE_SUCCESS)
         {
+            CFE_ES_GetPerfLogExtent(&Extent);
+
             PerfDumpState->PendingState = CFE_ES_PerfDumpState_INIT;
             CFE_ES_BackgroundWakeup();
 
@@ -248,7 +252,7 @@ int32 CFE_ES_StopPerfDataCmd(const CFE_ES_StopPerfDataCmd_t *data)
 
             CFE_EVS_SendEvent(CFE_ES_PERF_STOPCMD_EID, CFE_EVS_EventType_DEBUG,
                               "Perf Stop Cmd Rcvd, will write %d entries.%dmS dly every %d entries",
-                              (int)Perf->MetaData.DataCount, (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
+                              (int)Extent.DataCount, (int)CFE_PLATFORM_ES_PERF_CHILD_MS_DELAY,
                               (int)CFE_PLATFORM_ES_PERF_ENTRIES_BTWN_DLYS);
         }
         else
@@ -356,6 +360,12 @@ bool CFE_ES_RunPerfLogDump(uint32 ElapsedTime, void *Arg)
 
                 case CFE_ES_PerfDumpState_LOCK_DATA:
                     OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+
+                    /*
+                     * Entries are written without a lock, so merge them into
+                     * timestamp order and set the MetaData before writing it.
+                     */
+                    CFE_ES_PerfLogFinalize();
                     break;
 
                 case CFE_ES_PerfDumpState_WRITE_FS_HDR:
@@ -581,6 +591,226 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
     return CFE_SUCCESS;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogTriggerLimit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogTriggerLimit(uint32 Mode)
+{
+    uint32 Limit;
+
+    switch (Mode)
+    {
+        case CFE_ES_PERF_TRIGGER_START:
+            Limit = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+            break;
+        case CFE_ES_PERF_TRIGGER_CENTER:
+            Limit = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2;
+            break;
+        case CFE_ES_PERF_TRIGGER_END:
+            Limit = 1;
+            break;
+        default:
+            Limit = 0;
+            break;
+    }
+
+    return Limit;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogCaptureEnd
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 CFE_ES_PerfLogCaptureEnd(uint32 *TriggerCountPtr)
+{
+    CFE_ES_PerfCapture_t *Capture;
+    uint32                EndSeq;
+    uint32                TriggerCount;
+
+    Capture = &CFE_ES_Global.ResetDataPtr->Perf.Capture;
+
+    EndSeq       = OS_AtomicLoad32(&Capture->NextSeq);
+    TriggerCount = 0;
+
+    if (Capture->TriggerClaimed != 0)
+    {
+        /*
+         * Writers which reserve a slot after the trigger limit do not
+         * write an entry, but the reservation still advances NextSeq.
+         */
+        TriggerCount = EndSeq - Capture->TriggerSeq;
+        if (Capture->TriggerLimit != 0 && TriggerCount > Capture->TriggerLimit)
+        {
+            TriggerCount = Capture->TriggerLimit;
+            EndSeq       = Capture->TriggerSeq + TriggerCount;
+        }
+    }
+
+    *TriggerCountPtr = TriggerCount;
+
+    return EndSeq;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_GetPerfLogExtent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_GetPerfLogExtent(CFE_ES_PerfLogExtent_t *Extent)
+{
+    CFE_ES_PerfData_t *Perf;
+    uint32             EndSeq;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+
+    if (Perf->Capture.Finalized)
+    {
+        Extent->TriggerCount = Perf->MetaData.TriggerCount;
+        Extent->DataStart    = Perf->MetaData.DataStart;
+        Extent->DataEnd      = Perf->MetaData.DataEnd;
+        Extent->DataCount    = Perf->MetaData.DataCount;
+    }
+    else
+    {
+        EndSeq = CFE_ES_PerfLogCaptureEnd(&Extent->TriggerCount);
+
+        if (EndSeq < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+        {
+            Extent->DataCount = EndSeq;
+        }
+        else
+        {
+            Extent->DataCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        }
+
+        Extent->DataStart = (EndSeq - Extent->DataCount) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+        Extent->DataEnd   = EndSeq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_PerfLogFinalize
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_PerfLogFinalize(void)
+{
+    CFE_ES_PerfData_t *     Perf;
+    CFE_ES_PerfCapture_t *  Capture;
+    CFE_ES_PerfDataEntry_t  Entry;
+    CFE_ES_PerfDataEntry_t *PrevPtr;
+    uint32                  EndSeq;
+    uint32                  Seq;
+    uint32                  Slot;
+    uint32                  Dest;
+    uint32                  FirstSlot;
+    uint32                  Count;
+    uint32                  TriggerCount;
+    uint32                  i;
+    uint32                  j;
+
+    /*
+    ** Set the pointer to the data area
+    */
+    Perf    = &CFE_ES_Global.ResetDataPtr->Perf;
+    Capture = &Perf->Capture;
+
+    if (Capture->Finalized)
+    {
+        return;
+    }
+
+    EndSeq = CFE_ES_PerfLogCaptureEnd(&TriggerCount);
+
+    /*
+     * Walk the slots in sequence order, ending with the last entry captured,
+     * and compact the entries which were completely written.  Slots holding
+     * an entry from a different sequence number (or none) are skipped.
+     *
+     * An entry only ever moves to a slot which was already visited, and the
+     * sequence marks are cleared as they are consumed.  At the 32-bit
+     * sequence rollover the slot mapping is discontinuous, in which case an
+     * entry may be lost, but it is never duplicated.
+     */
+    FirstSlot = 0;
+    Count     = 0;
+    for (i = 0; i < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE; ++i)
+    {
+        Seq  = EndSeq - CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + i;
+        Slot = Seq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+
+        if (Capture->EntrySeq[Slot] == (Seq + 1) && Capture->EntrySeq[Slot] != 0)
+        {
+            if (Count == 0)
+            {
+                FirstSlot = Slot;
+            }
+
+            Dest = (FirstSlot + Count) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+
+            Capture->EntrySeq[Slot] = 0;
+            Capture->EntrySeq[Dest] = 0;
+            if (Dest != Slot)
+            {
+                Perf->DataBuffer[Dest] = Perf->DataBuffer[Slot];
+            }
+
+            ++Count;
+        }
+    }
+
+    /*
+     * Concurrent writers may reserve slots in a different order than they
+     * read the timebase, so merge the entries into timestamp order.  The
+     * entries are nearly in order already, so an insertion sort is used.
+     */
+    for (i = 1; i < Count; ++i)
+    {
+        Entry = Perf->DataBuffer[(FirstSlot + i) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+
+        j = i;
+        while (j > 0)
+        {
+            PrevPtr = &Perf->DataBuffer[(FirstSlot + j - 1) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE];
+            if (PrevPtr->TimerUpper32 < Entry.TimerUpper32 ||
+                (PrevPtr->TimerUpper32 == Entry.TimerUpper32 && PrevPtr->TimerLower32 <= Entry.TimerLower32))
+            {
+                break;
+            }
+
+            Perf->DataBuffer[(FirstSlot + j) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE] = *PrevPtr;
+            --j;
+        }
+
+        Perf->DataBuffer[(FirstSlot + j) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE] = Entry;
+    }
+
+    Perf->MetaData.TriggerCount = TriggerCount;
+    Perf->MetaData.DataStart    = FirstSlot;
+    Perf->MetaData.DataEnd      = (FirstSlot + Count) % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->MetaData.DataCount    = Count;
+
+    Capture->Finalized = true;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_ES_PerfLogAdd
@@ -592,16 +822,21 @@ int32 CFE_ES_SetPerfTriggerMaskCmd(const CFE_ES_SetPerfTriggerMaskCmd_t *data)
 void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 {
     CFE_ES_PerfDataEntry_t EntryData;
-    uint32                 DataEnd;
     CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfCapture_t * Capture;
+    uint32                 Seq;
+    uint32                 Slot;
+    uint32                 State;
+    uint32                 Expected;
 
     /*
     ** Set the pointer to the data area
     */
-    Perf = &CFE_ES_Global.ResetDataPtr->Perf;
+    Perf    = &CFE_ES_Global.ResetDataPtr->Perf;
+    Capture = &Perf->Capture;
 
     /*
-     * If the global state is idle, exit immediately without locking or doing anything
+     * If the global state is idle, exit immediately without doing anything
      */
     if (Perf->MetaData.State == CFE_ES_PERF_IDLE)
     {
@@ -624,11 +859,8 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
 
     /*
      * check if this ID is filtered.
-     * This is also done outside the lock -
      * normally masks should NOT be changed while perf log is active / non-idle,
-     * so although this is reading a global it should be constant, and this avoids
-     * locking (and potential task switch) if the data is ultimately not going to
-     * be written to the log.
+     * so although this is reading a global it should be constant.
      */
     if (!CFE_ES_TEST_LONG_MASK(Perf->MetaData.FilterMask, Marker))
     {
@@ -636,82 +868,65 @@ void CFE_ES_PerfLogAdd(uint32 Marker, uint32 EntryExit)
     }
 
     /*
-     * prepare the entry data (timestamp) before locking,
-     * just in case the locking operation incurs a delay
+     * prepare the entry data (timestamp) before reserving a slot,
+     * so the slot order is as close as possible to the timestamp order
      */
     EntryData.Data = (Marker | (EntryExit << CFE_MISSION_ES_PERF_EXIT_BIT));
     CFE_PSP_Get_Timebase(&EntryData.TimerUpper32, &EntryData.TimerLower32);
 
     /*
-     * Acquire the perflog mutex before writing into the shared area.
-     * Note this lock is held for long periods while a background dump
-     * is taking place, but the dump should never be active at the
-     * same time that a capture/record is taking place.
+     * Reserve a slot.  Every writer gets a unique sequence number, so
+     * concurrent writers never share a slot and no lock is needed.
+     * Instrumented code is never blocked by another task or by a dump.
      */
-    OS_MutSemTake(CFE_ES_Global.PerfDataMutex);
+    Seq = OS_AtomicFetchAdd32(&Capture->NextSeq, 1);
 
-    /*
-     * Confirm that the global is still non-idle after lock
-     * (state could become idle while getting lock)
-     */
-    if (Perf->MetaData.State != CFE_ES_PERF_IDLE)
-    {
-        /* copy data to next perflog slot */
-        DataEnd                   = Perf->MetaData.DataEnd;
-        Perf->DataBuffer[DataEnd] = EntryData;
+    State = OS_AtomicLoad32(&Perf->MetaData.State);
 
-        ++DataEnd;
-        if (DataEnd >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
+    /* waiting for trigger - only the first writer with a trigger marker claims it */
+    if (State == CFE_ES_PERF_WAITING_FOR_TRIGGER && CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
+    {
+        Expected = 0;
+        if (OS_AtomicCompareExchange32(&Capture->TriggerClaimed, &Expected, 1))
         {
-            DataEnd = 0;
+            Capture->TriggerSeq   = Seq;
+            Capture->TriggerLimit = CFE_ES_PerfLogTriggerLimit(Perf->MetaData.Mode);
+            OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
         }
-        Perf->MetaData.DataEnd = DataEnd;
 
-        /* we have filled up the buffer */
-        if (Perf->MetaData.DataCount < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-        {
-            Perf->MetaData.DataCount++;
-        }
-        else
-        {
-            /* after the buffer fills up start and end point to the same entry since we
-               are now overwriting old data */
-            Perf->MetaData.DataStart = Perf->MetaData.DataEnd;
-        }
+        State = OS_AtomicLoad32(&Perf->MetaData.State);
+    }
 
-        /* waiting for trigger */
-        if (Perf->MetaData.State == CFE_ES_PERF_WAITING_FOR_TRIGGER)
-        {
-            if (CFE_ES_TEST_LONG_MASK(Perf->MetaData.TriggerMask, Marker))
-            {
-                Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-            }
-        }
+    /*
+     * Confirm that the state is still non-idle
+     * (state could become idle while reserving the slot)
+     */
+    if (State == CFE_ES_PERF_IDLE)
+    {
+        return;
+    }
 
-        /* triggered */
-        if (Perf->MetaData.State == CFE_ES_PERF_TRIGGERED)
-        {
-            Perf->MetaData.TriggerCount++;
-            if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_START)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_CENTER)
-            {
-                if (Perf->MetaData.TriggerCount >= CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2)
-                {
-                    Perf->MetaData.State = CFE_ES_PERF_IDLE;
-                }
-            }
-            else if (Perf->MetaData.Mode == CFE_ES_PERF_TRIGGER_END)
-            {
-                Perf->MetaData.State = CFE_ES_PERF_IDLE;
-            }
-        }
+    /*
+     * Once triggered, only the configured number of entries from the
+     * trigger on are captured.  Writers which reserved an earlier slot
+     * may still be finishing, the dump allows time for that.
+     */
+    if (State == CFE_ES_PERF_TRIGGERED && Capture->TriggerLimit != 0 &&
+        (int32)(Seq - Capture->TriggerSeq) >= (int32)Capture->TriggerLimit)
+    {
+        OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+        return;
     }
 
-    OS_MutSemGive(CFE_ES_Global.PerfDataMutex);
+    /* copy data to the reserved slot, then mark it as complete */
+    Slot                   = Seq % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
+    Perf->DataBuffer[Slot] = EntryData;
+    OS_AtomicStore32(&Capture->EntrySeq[Slot], Seq + 1);
+
+    /* the last entry after the trigger completes the capture */
+    if (State == CFE_ES_PERF_TRIGGERED && Capture->TriggerLimit != 0 &&
+        (int32)(Seq + 1 - Capture->TriggerSeq) >= (int32)Capture->TriggerLimit)
+    {
+        OS_AtomicStore32(&Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    }
 }
@@ -112,6 +112,21 @@ typedef struct
     size_t    FileSize;                      /* Total file size, for progress reporting in telemetry */
 } CFE_ES_PerfDumpGlobal_t;
 
+/*
+ * Extent of the data in the performance log buffer
+ *
+ * While data is being captured, the writers do not update the
+ * corresponding MetaData fields, so this is computed on request
+ * for telemetry and progress reporting.
+ */
+typedef struct
+{
+    uint32 TriggerCount; /* number of entries captured since the trigger */
+    uint32 DataStart;    /* buffer index of the first entry */
+    uint32 DataEnd;      /* buffer index after the last entry */
+    uint32 DataCount;    /* number of entries in the buffer */
+} CFE_ES_PerfLogExtent_t;
+
 /*
  * Helper function to obtain the progress/remaining items from
  * the background task that is writing the performance log data
@@ -126,6 +141,54 @@ typedef struct
  */
 uint32 CFE_ES_GetPerfLogDumpRemaining(void);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the sequence number after the last entry captured
+ *
+ * This accounts for the trigger limit, as writers which reserve a slot after
+ * the limit is reached do not write an entry.
+ *
+ * @param[out] TriggerCountPtr Set to the number of entries captured since the trigger, or 0 if not triggered
+ * @returns The sequence number after the last entry captured
+ */
+uint32 CFE_ES_PerfLogCaptureEnd(uint32 *TriggerCountPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Obtain the current extent of the performance log
+ *
+ * If the log has been prepared for a dump, this reports the MetaData fields.
+ * Otherwise it is computed from the capture state, and may include entries
+ * which are later dropped because they were not completely written.
+ *
+ * @param[out] Extent Buffer to store the extent
+ */
+void CFE_ES_GetPerfLogExtent(CFE_ES_PerfLogExtent_t *Extent);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the number of entries captured once a trigger occurs
+ *
+ * @param[in] Mode The trigger mode
+ * @returns The number of entries including the trigger entry, or 0 if the mode does not limit the capture
+ */
+uint32 CFE_ES_PerfLogTriggerLimit(uint32 Mode);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Prepare the performance log buffer for writing
+ *
+ * Entries are written to the buffer without a lock, in the order the
+ * writers reserved their slots.  This drops any entry which was not
+ * completely written or which was captured after the trigger limit,
+ * compacts the remaining entries, sorts them by timestamp, and sets
+ * the MetaData fields describing the buffer contents.
+ *
+ * This must only be called once capture has stopped.  It does nothing
+ * if the buffer was already prepared since capture was last started.
+ */
+void CFE_ES_PerfLogFinalize(void);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Write performance data to a file
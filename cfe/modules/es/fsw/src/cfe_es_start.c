@@ -43,6 +43,7 @@
 #include <string.h>
 
 static int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds);
+static void  CFE_ES_ReportStartupTiming(void);
 
 /***************************************************************************/
 
@@ -88,6 +89,13 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Indicate that the CFE is the earliest initialization state
     */
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
+    CFE_PSP_GetTime(&CFE_ES_Global.SystemStateTime[CFE_ES_SystemState_EARLY_INIT]);
+
+    /*
+    ** Set up the CRC engine tables while still single threaded,
+    ** before anything (CDS, tables, apps) calculates a CRC
+    */
+    CRC_Initialize();
 
     /*
     ** Create the ES Shared Data Mutex
@@ -155,6 +163,37 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
         return;
     }
 
+    /*
+    ** Create the startup sync semaphores
+    ** Apps give AppStateSyncSem as they advance through their init states, and ES gives
+    ** SystemStateSem once per waiting app whenever the system state advances.
+    */
+    OsStatus = OS_CountSemCreate(&CFE_ES_Global.AppStateSyncSem, "ES_APP_SYNC", 0, 0);
+    if (OsStatus == OS_SUCCESS)
+    {
+        OsStatus = OS_CountSemCreate(&CFE_ES_Global.SystemStateSem, "ES_SYS_SYNC", 0, 0);
+    }
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_SysLogWrite_Unsync("%s: Error: ES Startup Sync Semaphore could not be created. RC=%ld\n", __func__,
+                                  (long)OsStatus);
+
+        /*
+        ** Delay to allow the message to be read
+        */
+        OS_TaskDelay(CFE_ES_PANIC_DELAY);
+
+        /*
+        ** cFE Cannot continue to start up.
+        */
+        CFE_PSP_Panic(CFE_PSP_PANIC_STARTUP_SEM);
+
+        /*
+         * Normally CFE_PSP_Panic() will not return but it will under UT
+         */
+        return;
+    }
+
     /*
     ** Announce the startup
     */
@@ -182,7 +221,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Indicate that the CFE core is now starting up / going multi-threaded
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_STARTUP state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_STARTUP;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_STARTUP);
 
     /*
     ** Create the tasks, OS objects, and initialize hardware
@@ -193,7 +232,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Indicate that the CFE core is ready
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering CORE_READY state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_CORE_READY);
 
     /*
     ** Start the cFE Applications from the disk using the file
@@ -215,7 +254,7 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     }
 
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering APPS_INIT state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_APPS_INIT);
 
     /*
      * Wait for applications to be "RUNNING" before moving to operational system state.
@@ -233,7 +272,89 @@ void CFE_ES_Main(uint32 StartType, uint32 StartSubtype, uint32 ModeId, const cha
     ** Startup is fully complete
     */
     CFE_ES_WriteToSysLog("%s: CFE_ES_Main entering OPERATIONAL state\n", __func__);
-    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_SetSystemState(CFE_ES_SystemState_OPERATIONAL);
+
+    CFE_ES_ReportStartupTiming();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_SetSystemState
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_SetSystemState(uint32 NewState)
+{
+    uint32 Waiters;
+
+    CFE_ES_LockSharedData(__func__, __LINE__);
+
+    CFE_ES_Global.SystemState = NewState;
+    if (NewState < (sizeof(CFE_ES_Global.SystemStateTime) / sizeof(CFE_ES_Global.SystemStateTime[0])))
+    {
+        CFE_PSP_GetTime(&CFE_ES_Global.SystemStateTime[NewState]);
+    }
+
+    Waiters                          = CFE_ES_Global.SystemStateWaiters;
+    CFE_ES_Global.SystemStateWaiters = 0;
+
+    CFE_ES_UnlockSharedData(__func__, __LINE__);
+
+    /*
+     * Wake every task that registered itself as waiting.  Each waiter re-checks
+     * the state after waking, so a token left behind by a waiter that already
+     * timed out only causes one extra check by whoever takes it next.
+     */
+    while (Waiters > 0)
+    {
+        OS_CountSemGive(CFE_ES_Global.SystemStateSem);
+        --Waiters;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_NotifyAppStateChange
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_ES_NotifyAppStateChange(void)
+{
+    /*
+     * Only the startup sequence waits on this, so there is no need to
+     * keep accumulating tokens once the system is operational.
+     */
+    if (CFE_ES_Global.SystemState < CFE_ES_SystemState_OPERATIONAL)
+    {
+        OS_CountSemGive(CFE_ES_Global.AppStateSyncSem);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_ES_ReportStartupTiming
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Writes the time at which each startup state was entered, relative
+ * to the start of EARLY_INIT, to the system log.
+ *
+ *-----------------------------------------------------------------*/
+static void CFE_ES_ReportStartupTiming(void)
+{
+    const OS_time_t *StateTime = CFE_ES_Global.SystemStateTime;
+    OS_time_t        StartTime = StateTime[CFE_ES_SystemState_EARLY_INIT];
+
+    CFE_ES_WriteToSysLog(
+        "%s: Startup timing (ms): CORE_STARTUP=%ld CORE_READY=%ld APPS_INIT=%ld OPERATIONAL=%ld\n", __func__,
+        (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(StateTime[CFE_ES_SystemState_CORE_STARTUP], StartTime)),
+        (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(StateTime[CFE_ES_SystemState_CORE_READY], StartTime)),
+        (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(StateTime[CFE_ES_SystemState_APPS_INIT], StartTime)),
+        (long)OS_TimeGetTotalMilliseconds(OS_TimeSubtract(StateTime[CFE_ES_SystemState_OPERATIONAL], StartTime)));
 }
 
 /*----------------------------------------------------------------
@@ -891,20 +1012,27 @@ void CFE_ES_CreateObjects(void)
  * Internal helper routine only, not part of API.
  *
  * Waits for all of the applications that CFE has started thus far to
- * reach the indicated state, by polling the app counters in a delay loop.
+ * reach the indicated state.  Apps give the AppStateSyncSem whenever their
+ * state advances, so the app counters are only re-checked when something
+ * has actually changed.
  *
  *-----------------------------------------------------------------*/
 int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
 {
     int32               Status;
+    int32               OsStatus;
     uint32              i;
     uint32              WaitTime;
     uint32              WaitRemaining;
+    int64               ElapsedTime;
     uint32              AppNotReadyCounter;
     CFE_ES_AppRecord_t *AppRecPtr;
+    OS_time_t           StartTime;
+    OS_time_t           CurrTime;
 
     Status        = CFE_ES_OPERATION_TIMED_OUT;
     WaitRemaining = TimeOutMilliseconds;
+    CFE_PSP_GetTime(&StartTime);
     while (true)
     {
         AppNotReadyCounter = 0;
@@ -931,24 +1059,54 @@ int32 CFE_ES_MainTaskSyncDelay(uint32 AppStateId, uint32 TimeOutMilliseconds)
             break;
         }
 
+        if (WaitRemaining == 0)
+        {
+            break;
+        }
+
         /*
-         * Must delay and check again
+         * Block until some app reports a state change.  Tokens left over from
+         * an earlier phase just cause an extra pass through the table.
          */
-        if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+        OsStatus = OS_CountSemTimedWait(CFE_ES_Global.AppStateSyncSem, WaitRemaining);
+        if (OsStatus == OS_SEM_TIMEOUT)
         {
-            WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+            /* check one last time in case the final app changed state right at the deadline */
+            WaitRemaining = 0;
         }
-        else if (WaitRemaining > 0)
+        else if (OsStatus != OS_SUCCESS)
         {
-            WaitTime = WaitRemaining;
+            /* semaphore is not usable, fall back to polling */
+            if (WaitRemaining > CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC)
+            {
+                WaitTime = CFE_PLATFORM_ES_STARTUP_SYNC_POLL_MSEC;
+            }
+            else
+            {
+                WaitTime = WaitRemaining;
+            }
+
+            OS_TaskDelay(WaitTime);
+            WaitRemaining -= WaitTime;
         }
         else
         {
-            break;
-        }
+            CFE_PSP_GetTime(&CurrTime);
+            ElapsedTime = OS_TimeGetTotalMilliseconds(OS_TimeSubtract(CurrTime, StartTime));
+            if (ElapsedTime < 0)
+            {
+                ElapsedTime = 0;
+            }
 
-        OS_TaskDelay(WaitTime);
-        WaitRemaining -= WaitTime;
+            if (ElapsedTime < TimeOutMilliseconds)
+            {
+                WaitRemaining = TimeOutMilliseconds - (uint32)ElapsedTime;
+            }
+            else
+            {
+                WaitRemaining = 0;
+            }
+        }
     }
 
     return Status;
@@ -101,6 +101,25 @@ extern void CFE_ES_CreateObjects(void);
  */
 extern void CFE_ES_SetupResetVariables(uint32 StartType, uint32 StartSubtype, uint32 BootSource);
 
+/*
+ * Name: CFE_ES_SetSystemState
+ *
+ * Purpose: This function advances the global system state, records the time at
+ *          which the state was entered, and wakes any tasks waiting in
+ *          CFE_ES_WaitForSystemState().
+ *
+ */
+extern void CFE_ES_SetSystemState(uint32 NewState);
+
+/*
+ * Name: CFE_ES_NotifyAppStateChange
+ *
+ * Purpose: This function notifies the ES startup sequence that an application
+ *          has changed state.  It has no effect once the system is operational.
+ *
+ */
+extern void CFE_ES_NotifyAppStateChange(void);
+
 /*
  * Name: CFE_ES_InitializeFileSystems
  *
@@ -460,9 +460,10 @@ int32 CFE_ES_TaskInit(void)
  *-----------------------------------------------------------------*/
 int32 CFE_ES_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
 {
-    OS_heap_prop_t HeapProp;
-    int32          OsStatus;
-    uint32         PerfIdx;
+    OS_heap_prop_t         HeapProp;
+    int32                  OsStatus;
+    uint32                 PerfIdx;
+    CFE_ES_PerfLogExtent_t PerfExtent;
 
     /*
     ** Get command execution counters, system log entry count & bytes used.
@@ -491,12 +492,13 @@ int32 CFE_ES_HousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
         CFE_ES_Global.ResetDataPtr->ResetVars.MaxProcessorResetCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.BootSource = CFE_ES_Global.ResetDataPtr->ResetVars.BootSource;
 
+    CFE_ES_GetPerfLogExtent(&PerfExtent);
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfState        = CFE_ES_Global.ResetDataPtr->Perf.MetaData.State;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfMode         = CFE_ES_Global.ResetDataPtr->Perf.MetaData.Mode;
-    CFE_ES_Global.TaskData.HkPacket.Payload.PerfTriggerCount = CFE_ES_Global.ResetDataPtr->Perf.MetaData.TriggerCount;
-    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataStart    = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataStart;
-    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataEnd      = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataEnd;
-    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataCount    = CFE_ES_Global.ResetDataPtr->Perf.MetaData.DataCount;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfTriggerCount = PerfExtent.TriggerCount;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataStart    = PerfExtent.DataStart;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataEnd      = PerfExtent.DataEnd;
+    CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataCount    = PerfExtent.DataCount;
     CFE_ES_Global.TaskData.HkPacket.Payload.PerfDataToWrite  = CFE_ES_GetPerfLogDumpRemaining();
 
     /*
@@ -720,7 +722,9 @@ int32 CFE_ES_StartAppCmd(const CFE_ES_StartAppCmd_t *data)
         }
 
         StartParams.MainTaskInfo.Priority = cmd->Priority;
+        StartParams.MainTaskInfo.CpuMask  = 0;
         StartParams.ExceptionAction       = cmd->ExceptionAction;
+        StartParams.ChildCpuMask          = 0;
 
         /*
         ** Invoke application loader/startup function.
@@ -318,6 +318,24 @@
 #error CFE_PLATFORM_ES_START_TASK_STACK_SIZE must be greater than or equal to 2048
 #endif
 
+#if CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS < 0
+#error CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS cannot be less than 0!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOAD_STACK_SIZE < 2048
+#error CFE_PLATFORM_ES_STARTUP_LOAD_STACK_SIZE must be greater than or equal to 2048
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY < 0
+#error CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY cannot be less than 0!
+#elif CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY > 255
+#error CFE_PLATFORM_ES_STARTUP_LOAD_PRIORITY cannot be greater than 255!
+#endif
+
+#if CFE_PLATFORM_ES_STARTUP_LOAD_TIMEOUT_MSEC < 1
+#error CFE_PLATFORM_ES_STARTUP_LOAD_TIMEOUT_MSEC must be greater than 0!
+#endif
+
 #if ((CFE_MISSION_MAX_API_LEN % 4) != 0)
 #error CFE_MISSION_MAX_API_LEN must be a multiple of 4
 #endif
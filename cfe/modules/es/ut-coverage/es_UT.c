@@ -56,6 +56,12 @@
  */
 #define ES_UT_CDS_LARGE_TEST_SIZE (128 * 1024)
 
+/*
+ * Enough memory pool blocks to fill one task
+ * cache and the shared depot, plus one more
+ */
+#define ES_UT_DEPOT_TEST_BLOCKS ((CFE_ES_MEMPOOL_DEPOT_DEPTH + 1) * CFE_ES_MEMPOOL_CACHE_DEPTH + 1)
+
 extern CFE_ES_Global_t CFE_ES_Global;
 
 extern int32 dummy_function(void);
@@ -595,6 +601,28 @@ static void ES_UT_SetupForOSCleanup(void)
     UT_SetHookFunction(UT_KEY(OS_ForEachObject), ES_UT_SetupOSCleanupHook, NULL);
 }
 
+/*
+ * Returns the first app record in use, such as one created by parsing a startup script entry
+ */
+static CFE_ES_AppRecord_t *ES_UT_FindUsedAppRecord(void)
+{
+    uint32              i;
+    CFE_ES_AppRecord_t *AppRecPtr;
+
+    AppRecPtr = CFE_ES_Global.AppTable;
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        if (CFE_ES_AppRecordIsUsed(AppRecPtr))
+        {
+            return AppRecPtr;
+        }
+        ++AppRecPtr;
+    }
+
+    UtAssert_Failed("No app record in use");
+    return CFE_ES_Global.AppTable;
+}
+
 typedef struct
 {
     uint32 AppType;
@@ -628,6 +656,14 @@ static int32 ES_UT_SetAppStateHook(void *UserObj, int32 StubRetcode, uint32 Call
     return StubRetcode;
 }
 
+static int32 ES_UT_SetSystemStateHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                      const UT_StubContext_t *Context)
+{
+    /* simulate the ES main task advancing the state while the caller is blocked */
+    CFE_ES_SetSystemState(CFE_ES_SystemState_APPS_INIT);
+    return StubRetcode;
+}
+
 void UtTest_Setup(void)
 {
     UT_Init("es");
@@ -645,8 +681,11 @@ void UtTest_Setup(void)
     UT_ADD_TEST(TestGenericCounterAPI);
     UT_ADD_TEST(TestCDS);
     UT_ADD_TEST(TestGenericPool);
+    UT_ADD_TEST(TestGenericPoolLockFree);
     UT_ADD_TEST(TestCDSMempool);
     UT_ADD_TEST(TestESMempool);
+    UT_ADD_TEST(TestESMempoolCache);
+    UT_ADD_TEST(TestESMempoolLockFree);
     UT_ADD_TEST(TestSysLog);
     UT_ADD_TEST(TestBackground);
 }
@@ -678,6 +717,12 @@ void ES_ResetUnitTest(void)
      */
     CFE_ES_Global.ResetDataPtr = ES_UT_PersistentResetData;
 
+    /*
+     * The startup sync waits re-check their condition whenever the semaphore is
+     * given, so a stub that always succeeds would never let them time out.
+     */
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWait), OS_SEM_TIMEOUT);
+
 } /* end ES_ResetUnitTest() */
 
 void TestInit(void)
@@ -702,9 +747,11 @@ void TestInit(void)
 
     /* Go through ES_Main and cover normal paths */
     UT_SetDummyFuncRtn(OS_SUCCESS);
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWait), OS_SEM_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, CFE_PSP_RST_SUBTYPE_POWER_CYCLE, 1, "ut_startup");
     UtAssert_STUB_COUNT(CFE_PSP_Panic, 0);
+    UtAssert_UINT32_EQ(CFE_ES_Global.SystemState, CFE_ES_SystemState_OPERATIONAL);
 }
 
 void TestStartupErrorPaths(void)
@@ -755,11 +802,27 @@ void TestStartupErrorPaths(void)
     UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
     UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(CFE_PSP_Panic)), 1);
 
+    /* Perform ES main startup with an app state sync semaphore creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
+    UtAssert_STUB_COUNT(CFE_PSP_Panic, 1);
+
+    /* Perform ES main startup with a system state sync semaphore creation failure */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_Panic), &PanicStatus, sizeof(PanicStatus), false);
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    UtAssert_UINT32_EQ(PanicStatus, CFE_PSP_PANIC_STARTUP_SEM);
+    UtAssert_STUB_COUNT(CFE_PSP_Panic, 1);
+
     /* Perform ES main startup with an ES Shared Data mutex creation failure */
     ES_ResetUnitTest();
     UT_SetDummyFuncRtn(OS_SUCCESS);
     UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_CANNOT_OPEN_ES_APP_STARTUP]);
 
@@ -768,12 +831,22 @@ void TestStartupErrorPaths(void)
     StateHook.AppState = CFE_ES_AppState_RUNNING;
     StateHook.AppType =
         CFE_ES_AppType_CORE; /* by only setting core apps, it will appear as if external apps did not start */
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, &StateHook);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, &StateHook);
     UT_SetReadBuffer(StartupScript, strlen(StartupScript));
     CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_2]);
 
+    /* Same startup sync failure, but with the sync semaphore unusable so it falls back to polling */
+    ES_ResetUnitTest();
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWait), OS_ERROR);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, &StateHook);
+    UT_SetReadBuffer(StartupScript, strlen(StartupScript));
+    CFE_ES_Main(CFE_PSP_RST_TYPE_POWERON, 1, 1, "ut_startup");
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_1]);
+    CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_STARTUP_SYNC_FAIL_2]);
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(OS_TaskDelay)));
+
     /* Perform a power on reset with a hardware special sub-type */
     ES_ResetUnitTest();
     CFE_ES_SetupResetVariables(CFE_PSP_RST_TYPE_POWERON, CFE_PSP_RST_SUBTYPE_HW_SPECIAL_COMMAND, 1);
@@ -954,7 +1027,7 @@ void TestStartupErrorPaths(void)
         ++TaskRecPtr;
     }
 
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_RECORD_USED]);
 
@@ -973,7 +1046,7 @@ void TestStartupErrorPaths(void)
     }
 
     UT_SetDeferredRetcode(UT_KEY(CFE_TBL_EarlyInit), 1, -1);
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_RECORD_USED]);
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_EARLYINIT]);
@@ -982,9 +1055,9 @@ void TestStartupErrorPaths(void)
      * creating a core app
      */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     UT_SetDefaultReturnValue(UT_KEY(OS_BinSemCreate), OS_ERROR);
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_CreateObjects();
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_CORE_APP_CREATE]);
 
@@ -1076,6 +1149,37 @@ void TestStartupErrorPaths(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_CORE, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
     CFE_ES_Global.SystemState = CFE_ES_SystemState_EARLY_INIT;
     CFE_UtAssert_SUCCESS(CFE_ES_WaitForSystemState(CFE_ES_SystemState_EARLY_INIT, 0));
+
+    /* Test waking up when ES advances the system state */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetHookFunction(UT_KEY(OS_CountSemTimedWait), ES_UT_SetSystemStateHook, NULL);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SUCCESS);
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC));
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2); /* one app state notification, one wakeup */
+    UtAssert_ZERO(CFE_ES_Global.SystemStateWaiters);
+
+    /* Test falling back to polling if the system state semaphore is not usable */
+    ES_ResetUnitTest();
+    ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_EARLY_INIT, NULL, &AppRecPtr, NULL);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_CORE_READY;
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTimedWait), OS_ERROR);
+    UtAssert_INT32_EQ(
+        CFE_ES_WaitForSystemState(CFE_ES_SystemState_APPS_INIT, CFE_PLATFORM_ES_STARTUP_SCRIPT_TIMEOUT_MSEC),
+        CFE_ES_OPERATION_TIMED_OUT);
+    UtAssert_NONZERO(UT_GetStubCount(UT_KEY(OS_TaskDelay)));
+
+    /* App state notifications are only sent while the system is starting up */
+    ES_ResetUnitTest();
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_OPERATIONAL;
+    CFE_ES_NotifyAppStateChange();
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    CFE_ES_Global.SystemState = CFE_ES_SystemState_APPS_INIT;
+    CFE_ES_NotifyAppStateChange();
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 }
 
 static void ES_UT_UnusedAppTask(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -1225,9 +1329,100 @@ void TestApps(void)
     /* Test successfully starting an application */
     ES_ResetUnitTest();
     UT_SetReadBuffer(StartupScript, NumBytes);
-    UT_SetHookFunction(UT_KEY(OS_TaskCreate), ES_UT_SetAppStateHook, NULL);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
     CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
     CFE_UtAssert_PRINTF(UT_OSP_MESSAGES[UT_OSP_ES_APP_STARTUP_OPEN]);
+    UtAssert_STUB_COUNT(OS_read, 1); /* whole script consumed in a single read */
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 3);
+    UtAssert_STUB_COUNT(OS_TaskCreate, CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 3);
+    UtAssert_BOOL_FALSE(CFE_ES_Global.StartupLoadQueue.Active);
+
+    /* Test a startup script without the '!' terminator, which is read until EOF */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes - 1);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 0);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 3);
+
+    /* Test starting applications when the module load workers cannot be created */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_TaskCreate, 1);
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 3);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 2);
+
+    /* Test starting applications when the module load worker semaphores cannot be created */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemCreate), 2, OS_ERROR);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_TaskCreate, 0);
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 3);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+
+    /* Test starting applications when the module load workers do not finish in time */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTimedWait), 1, OS_SEM_TIMEOUT);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_CountSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelete, CFE_PLATFORM_ES_STARTUP_LOAD_WORKERS);
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 3);
+    UtAssert_ZERO(CFE_ES_Global.StartupLoadQueue.NumWorkers);
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 2);
+
+    /* Test starting applications where one queued app fails to load */
+    ES_ResetUnitTest();
+    UT_SetReadBuffer(StartupScript, NumBytes);
+    UT_SetDeferredRetcode(UT_KEY(OS_ModuleLoad), 2, OS_ERROR);
+    UT_SetHookFunction(UT_KEY(OS_TaskCreateWithAffinity), ES_UT_SetAppStateHook, NULL);
+    CFE_ES_StartApplications(CFE_PSP_RST_TYPE_PROCESSOR, "ut_startup");
+    UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 2);
+    UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 2);
+
+    /* Test that a library entry starts the apps queued before it, and is then loaded */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupLoadQueue.Active = true;
+    {
+        const char *AppTokens[] = {"CFE_APP", "/cf/apps/ci.bundle", "CI_task_main", "CI_APP", "70", "4096", "0x0", "1"};
+        const char *LibTokens[] = {"CFE_LIB", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "1"};
+
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(AppTokens, 8));
+        UtAssert_UINT32_EQ(CFE_ES_Global.StartupLoadQueue.NumEntries, 1);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 0);
+        UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 0);
+
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(LibTokens, 8));
+        UtAssert_ZERO(CFE_ES_Global.StartupLoadQueue.NumEntries);
+        UtAssert_STUB_COUNT(OS_ModuleLoad, 2);
+        UtAssert_STUB_COUNT(OS_TaskCreateWithAffinity, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredExternalApps, 1);
+        UtAssert_UINT32_EQ(CFE_ES_Global.RegisteredLibs, 1);
+    }
+
+    /* Test the module load worker, which runs one batch per token until the take fails */
+    ES_ResetUnitTest();
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    CFE_ES_StartupLoadWorkerMain();
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 2); /* one batch done, one exit */
+
+    /* Test the module load worker exiting when told to shut down */
+    ES_ResetUnitTest();
+    CFE_ES_Global.StartupLoadQueue.Shutdown = true;
+    CFE_ES_StartupLoadWorkerMain();
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
 
     /* Test parsing the startup script with an unknown entry type */
     ES_ResetUnitTest();
@@ -1247,7 +1442,7 @@ void TestApps(void)
 
     /* Test application loading and creation with a task creation failure */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     ES_UT_SetupAppStartParams(&StartParams, "ut/filename", "EntryPoint", 170, 4096, 1);
     UtAssert_INT32_EQ(CFE_ES_AppCreate(&AppId, "AppName", &StartParams), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     /* Verify requirement to report error */
@@ -1439,7 +1634,7 @@ void TestApps(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
     UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_RESTART;
     OS_ModuleLoad(&UtAppRecPtr->LoadStatus.ModuleId, NULL, NULL, 0);
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
     UtAssert_VOIDCALL(CFE_ES_ProcessControlRequest(AppId));
     CFE_UtAssert_EVENTSENT(CFE_ES_RESTART_APP_ERR3_EID);
@@ -1462,7 +1657,7 @@ void TestApps(void)
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
     UtAppRecPtr->ControlReq.AppControlRequest = CFE_ES_RunStatus_SYS_RELOAD;
     OS_ModuleLoad(&UtAppRecPtr->LoadStatus.ModuleId, NULL, NULL, 0);
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     AppId = CFE_ES_AppRecordGetID(UtAppRecPtr);
     UtAssert_VOIDCALL(CFE_ES_ProcessControlRequest(AppId));
     CFE_UtAssert_EVENTSENT(CFE_ES_RELOAD_APP_ERR3_EID);
@@ -1764,6 +1959,32 @@ void TestApps(void)
         CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 8));
     }
 
+    /* Test parsing the startup script for a cFE application with CPU affinity
+     * masks for the main task and child tasks
+     */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "0", "0x2", "0xC"};
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 10));
+        UtAppRecPtr = ES_UT_FindUsedAppRecord();
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.MainTaskInfo.CpuMask, 0x2);
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.ChildCpuMask, 0xC);
+    }
+
+    /* Test parsing the startup script for a cFE application where the
+     * child tasks inherit the main task CPU affinity mask
+     */
+    ES_ResetUnitTest();
+    {
+        const char *TokenList[] = {"CFE_APP", "/cf/apps/tst_lib.bundle", "TST_LIB_Init", "TST_LIB", "0", "0", "0x0",
+                                   "0", "0x2"};
+        CFE_UtAssert_SUCCESS(CFE_ES_ParseFileEntry(TokenList, 9));
+        UtAppRecPtr = ES_UT_FindUsedAppRecord();
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.MainTaskInfo.CpuMask, 0x2);
+        UtAssert_UINT32_EQ(UtAppRecPtr->StartParams.ChildCpuMask, 0x2);
+    }
+
     /* Test scanning and acting on the application table where the timer
      * expires for a waiting application
      */
@@ -2467,6 +2688,96 @@ void TestGenericPool(void)
     CFE_UtAssert_SUCCESS(CFE_ES_GenPoolRebuild(&Pool1));
 }
 
+void TestGenericPoolLockFree(void)
+{
+    CFE_ES_GenPoolRecord_t Pool;
+    size_t                 Offset1;
+    size_t                 Offset2;
+    size_t                 Offset3;
+    size_t                 BlockSize;
+    size_t                 ReqSize;
+    uint16                 ExpectedId;
+    uint16                 i;
+    uint32                 Mismatches;
+    CFE_ES_BlockStats_t    BlockStats;
+    CFE_ES_GenPoolBD_t *   BdPtr;
+    static const size_t    UT_POOL_BLOCK_SIZES[] = {60, 20, 16, 40, 128, 17};
+
+    ES_ResetUnitTest();
+
+    memset(&UT_MemPoolDirectBuffer, 0xee, sizeof(UT_MemPoolDirectBuffer));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolInitialize(&Pool, 0, sizeof(UT_MemPoolDirectBuffer.Data), 8,
+                                                  sizeof(UT_POOL_BLOCK_SIZES) / sizeof(UT_POOL_BLOCK_SIZES[0]),
+                                                  UT_POOL_BLOCK_SIZES, ES_UT_PoolDirectRetrieve,
+                                                  ES_UT_PoolDirectCommit));
+
+    /* The size class lookup must select the same bucket as a search of the sorted list */
+    Mismatches = 0;
+    for (ReqSize = 0; ReqSize <= 200; ++ReqSize)
+    {
+        ExpectedId = 0;
+        for (i = 0; i < Pool.NumBuckets; ++i)
+        {
+            if (ReqSize <= Pool.Buckets[i].BlockSize)
+            {
+                ExpectedId = Pool.NumBuckets - i;
+                break;
+            }
+        }
+
+        if (CFE_ES_GenPoolFindBucket(&Pool, ReqSize) != ExpectedId)
+        {
+            UtPrintf("Size %lu: bucket %u, expected %u", (unsigned long)ReqSize,
+                     (unsigned int)CFE_ES_GenPoolFindBucket(&Pool, ReqSize), (unsigned int)ExpectedId);
+            ++Mismatches;
+        }
+    }
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_UINT32_EQ(CFE_ES_GenPoolFindBucket(&Pool, ~((size_t)0)), 0);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolEnableLockFree(&Pool));
+
+    /* Nothing has been returned yet */
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRecycleBlock(&Pool, &Offset1, 10), CFE_ES_BUFFER_NOT_IN_POOL);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRecycleBlock(&Pool, &Offset1, 1000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset1, 10));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset2, 12));
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset1));
+    UtAssert_UINT32_EQ(BlockSize, 10);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset2));
+    UtAssert_UINT32_EQ(BlockSize, 12);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset2), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* Returned blocks are recycled in LIFO order, by either call */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolRecycleBlock(&Pool, &Offset3, 14));
+    CFE_UtAssert_MEMOFFSET_EQ(Offset3, Offset2);
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolGetBlock(&Pool, &Offset3, 16));
+    CFE_UtAssert_MEMOFFSET_EQ(Offset3, Offset1);
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRecycleBlock(&Pool, &Offset3, 16), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    CFE_ES_GenPoolGetBucketUsage(&Pool, CFE_ES_GenPoolFindBucket(&Pool, 16), &BlockStats);
+    UtAssert_UINT32_EQ(BlockStats.NumCreated, 2);
+    UtAssert_UINT32_EQ(BlockStats.NumFree, 0);
+
+    /* A corrupted block on the free list is not handed out */
+    CFE_UtAssert_SUCCESS(CFE_ES_GenPoolPutBlock(&Pool, &BlockSize, Offset1));
+    BdPtr            = (CFE_ES_GenPoolBD_t *)((void *)&UT_MemPoolDirectBuffer.Data[Offset1 - sizeof(*BdPtr)]);
+    BdPtr->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_GenPoolRecycleBlock(&Pool, &Offset3, 16), CFE_ES_BUFFER_NOT_IN_POOL);
+
+    /* Offsets of a very large pool do not fit in the tagged free list head */
+    Pool.PoolMaxOffset = ~((size_t)0);
+    if (sizeof(size_t) > 6)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GenPoolEnableLockFree(&Pool), CFE_ES_BAD_ARGUMENT);
+    }
+    else
+    {
+        CFE_UtAssert_SUCCESS(CFE_ES_GenPoolEnableLockFree(&Pool));
+    }
+}
+
 void TestTask(void)
 {
     uint32    ResetType;
@@ -2647,7 +2958,7 @@ void TestTask(void)
 
     /* Test app create with an OS task create failure */
     ES_ResetUnitTest();
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, sizeof(CmdBuf.StartAppCmd), UT_TPID_CFE_ES_CMD_START_APP_CC);
     CFE_UtAssert_EVENTSENT(CFE_ES_START_ERR_EID);
 
@@ -3539,8 +3850,10 @@ void TestPerf(void)
 
     UtPrintf("Begin Test Performance Log");
 
-    CFE_ES_PerfData_t *Perf;
-    void *             TempBuff;
+    CFE_ES_PerfData_t *    Perf;
+    CFE_ES_PerfLogExtent_t PerfExtent;
+    void *                 TempBuff;
+    uint32                 i;
 
     /*
     ** Set the pointer to the data area
@@ -3714,51 +4027,78 @@ void TestPerf(void)
 
     /* Test successful addition of a new entry to the performance log */
     ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
     Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.TriggerCount          = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     Perf->MetaData.InvalidMarkerReported = false;
-    Perf->MetaData.DataEnd               = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
     CFE_ES_PerfLogAdd(CFE_MISSION_ES_PERF_MAX_IDS, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.InvalidMarkerReported, true);
+    UtAssert_UINT32_EQ(Perf->Capture.NextSeq, 0);
 
     /* Test addition of a new entry to the performance log with START
-     * trigger mode
+     * trigger mode, which captures a full buffer from the trigger on
      */
     ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
     Perf->MetaData.InvalidMarkerReported = true;
+    Perf->MetaData.State                 = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.Mode                  = CFE_ES_PERF_TRIGGER_START;
-    Perf->MetaData.DataCount             = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1;
+    Perf->MetaData.FilterMask[0]         = 0xFFFF;
     Perf->MetaData.TriggerMask[0]        = 0xFFFF;
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_UINT32_EQ(Perf->Capture.TriggerSeq, 0);
+    UtAssert_UINT32_EQ(Perf->Capture.TriggerLimit, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[0], 1);
+    Perf->Capture.NextSeq = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1;
+    CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PERF_TRIGGER_START);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE - 1],
+                       CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
 
     /* Test addition of a new entry to the performance log with CENTER
-     * trigger mode
+     * trigger mode, after the trigger limit was reached by another writer
      */
     ES_ResetUnitTest();
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PERF_TRIGGER_CENTER;
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode          = CFE_ES_PERF_TRIGGER_CENTER;
+    Perf->Capture.TriggerClaimed = 1;
+    Perf->Capture.TriggerLimit   = CFE_ES_PerfLogTriggerLimit(CFE_ES_PERF_TRIGGER_CENTER);
+    Perf->Capture.NextSeq        = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PERF_TRIGGER_CENTER);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 + 1], 0);
 
     /* Test addition of a new entry to the performance log with END
-     * trigger mode
+     * trigger mode, which stops with the trigger entry
      */
     ES_ResetUnitTest();
-    Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
     Perf->MetaData.Mode  = CFE_ES_PERF_TRIGGER_END;
     CFE_ES_PerfLogAdd(1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.Mode, CFE_ES_PERF_TRIGGER_END);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_IDLE);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[0], 1);
+
+    /* Test a trigger marker when the trigger was already claimed by another writer */
+    ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->Capture.TriggerClaimed = 1;
+    CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[0], 1);
 
     /* Test addition where state goes to idle after first check */
     ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
     Perf->MetaData.State = CFE_ES_PERF_TRIGGERED;
-    UT_SetHandlerFunction(UT_KEY(OS_MutSemTake), ES_UT_SetPerfIdle, NULL);
+    UT_SetHandlerFunction(UT_KEY(CFE_PSP_Get_Timebase), ES_UT_SetPerfIdle, NULL);
     CFE_ES_PerfLogAdd(1, 0);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[0], 0);
 
     /* Test addition of a new entry to the performance log with an invalid
      * marker after an invalid marker has already been reported
@@ -3773,62 +4113,126 @@ void TestPerf(void)
      * is not in the filter mask
      */
     ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
     Perf->MetaData.State         = CFE_ES_PERF_TRIGGERED;
     Perf->MetaData.FilterMask[0] = 0x0;
-    Perf->MetaData.DataEnd       = 0;
     CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 0);
-
-    /* Test addition of a new entry to the performance log with the data count
-     * below the maximum allowed
-     */
-    ES_ResetUnitTest();
-    Perf->MetaData.State         = CFE_ES_PERF_WAITING_FOR_TRIGGER;
-    Perf->MetaData.DataCount     = 0;
-    Perf->MetaData.FilterMask[0] = 0xffff;
-    CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 1);
+    UtAssert_UINT32_EQ(Perf->Capture.NextSeq, 0);
 
     /* Test addition of a new entry to the performance log with a marker that
      * is not in the trigger mask
      */
     ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
     Perf->MetaData.State          = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.FilterMask[0]  = 0xffff;
     Perf->MetaData.TriggerMask[0] = 0x0;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_WAITING_FOR_TRIGGER);
-
-    /* Test addition of a new entry to the performance log with a start
-     * trigger mode and the trigger count is less the buffer size
-     */
-    ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount   = 0;
-    Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_START;
-    Perf->MetaData.TriggerMask[0] = 0xffff;
-    CFE_ES_PerfLogAdd(0x1, 0);
-    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 1);
+    UtAssert_UINT32_EQ(Perf->Capture.NextSeq, 1);
+    UtAssert_UINT32_EQ(Perf->Capture.EntrySeq[0], 1);
 
     /* Test addition of a new entry to the performance log with a center
      * trigger mode and the trigger count is less than half the buffer size
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 2;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = CFE_ES_PERF_TRIGGER_CENTER;
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->MetaData.State          = CFE_ES_PERF_TRIGGERED;
+    Perf->MetaData.Mode           = CFE_ES_PERF_TRIGGER_CENTER;
+    Perf->MetaData.TriggerMask[0] = 0xffff;
+    Perf->Capture.TriggerClaimed  = 1;
+    Perf->Capture.TriggerLimit    = CFE_ES_PerfLogTriggerLimit(CFE_ES_PERF_TRIGGER_CENTER);
+    Perf->Capture.NextSeq         = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE / 2 - 2;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
     /* Test addition of a new entry to the performance log with an invalid
-     * trigger mode
+     * trigger mode, which does not limit the capture
      */
     ES_ResetUnitTest();
-    Perf->MetaData.TriggerCount = 0;
-    Perf->MetaData.State        = CFE_ES_PERF_TRIGGERED;
-    Perf->MetaData.Mode         = -1;
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->MetaData.State = CFE_ES_PERF_WAITING_FOR_TRIGGER;
+    Perf->MetaData.Mode  = -1;
+    CFE_ES_PerfLogAdd(0x1, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
+    UtAssert_UINT32_EQ(Perf->Capture.TriggerLimit, 0);
+    Perf->Capture.NextSeq = 2 * CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE;
     CFE_ES_PerfLogAdd(0x1, 0);
     UtAssert_UINT32_EQ(Perf->MetaData.State, CFE_ES_PERF_TRIGGERED);
 
+    /* Test the extent of the log while capturing, limited by the trigger */
+    ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->Capture.NextSeq        = 5;
+    Perf->Capture.TriggerClaimed = 1;
+    Perf->Capture.TriggerSeq     = 3;
+    Perf->Capture.TriggerLimit   = 1;
+    CFE_ES_GetPerfLogExtent(&PerfExtent);
+    UtAssert_UINT32_EQ(PerfExtent.TriggerCount, 1);
+    UtAssert_UINT32_EQ(PerfExtent.DataStart, 0);
+    UtAssert_UINT32_EQ(PerfExtent.DataEnd, 4);
+    UtAssert_UINT32_EQ(PerfExtent.DataCount, 4);
+    Perf->Capture.NextSeq      = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 3;
+    Perf->Capture.TriggerLimit = 0;
+    CFE_ES_GetPerfLogExtent(&PerfExtent);
+    UtAssert_UINT32_EQ(PerfExtent.TriggerCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(PerfExtent.DataStart, 3);
+    UtAssert_UINT32_EQ(PerfExtent.DataEnd, 3);
+    UtAssert_UINT32_EQ(PerfExtent.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+
+    /* Test preparing the log for a dump, which drops an incomplete entry
+     * and sorts the remaining entries by timestamp
+     */
+    ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->Capture.NextSeq                = 4;
+    Perf->DataBuffer[0].TimerUpper32     = 1;
+    Perf->DataBuffer[0].TimerLower32     = 30;
+    Perf->Capture.EntrySeq[0]            = 1;
+    Perf->DataBuffer[1].TimerUpper32     = 1;
+    Perf->DataBuffer[1].TimerLower32     = 10;
+    Perf->Capture.EntrySeq[1]            = 2;
+    Perf->DataBuffer[2].TimerUpper32     = 0;
+    Perf->DataBuffer[2].TimerLower32     = 0;
+    Perf->DataBuffer[3].TimerUpper32     = 0;
+    Perf->DataBuffer[3].TimerLower32     = 50;
+    Perf->Capture.EntrySeq[3]            = 4;
+    CFE_ES_PerfLogFinalize();
+    UtAssert_BOOL_TRUE(Perf->Capture.Finalized);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 0);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 3);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, 3);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, 0);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[0].TimerLower32, 50);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[1].TimerLower32, 10);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[2].TimerLower32, 30);
+
+    /* A second call does nothing, and the extent is reported from the metadata */
+    Perf->MetaData.DataCount = 2;
+    CFE_ES_PerfLogFinalize();
+    CFE_ES_GetPerfLogExtent(&PerfExtent);
+    UtAssert_UINT32_EQ(PerfExtent.DataCount, 2);
+
+    /* Test preparing the log for a dump after the buffer wrapped around */
+    ES_ResetUnitTest();
+    memset((void *)&Perf->Capture, 0, sizeof(Perf->Capture));
+    Perf->Capture.NextSeq        = CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 2;
+    Perf->Capture.TriggerClaimed = 1;
+    Perf->Capture.TriggerSeq     = 2;
+    for (i = 2; i < CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 2; ++i)
+    {
+        Perf->DataBuffer[i % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE].TimerUpper32 = 0;
+        Perf->DataBuffer[i % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE].TimerLower32 = i;
+        Perf->Capture.EntrySeq[i % CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE]        = i + 1;
+    }
+    CFE_ES_PerfLogFinalize();
+    UtAssert_UINT32_EQ(Perf->MetaData.DataStart, 2);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataEnd, 2);
+    UtAssert_UINT32_EQ(Perf->MetaData.DataCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->MetaData.TriggerCount, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[2].TimerLower32, 2);
+    UtAssert_UINT32_EQ(Perf->DataBuffer[1].TimerLower32, CFE_PLATFORM_ES_PERF_DATA_BUFFER_SIZE + 1);
+
     /* Test performance data collection start with an invalid message length */
     ES_ResetUnitTest();
     UT_CallTaskPipe(CFE_ES_TaskPipe, &CmdBuf.Msg, 0, UT_TPID_CFE_ES_CMD_START_PERF_DATA_CC);
@@ -3925,6 +4329,7 @@ void TestPerf(void)
     OS_OpenCreate(&CFE_ES_Global.BackgroundPerfDumpState.FileDesc, "UT", 0, OS_WRITE_ONLY);
     CFE_ES_Global.BackgroundPerfDumpState.CurrentState = CFE_ES_PerfDumpState_WRITE_PERF_METADATA;
     CFE_ES_Global.BackgroundPerfDumpState.StateCounter = 10;
+    Perf->Capture.Finalized                            = true;
     Perf->MetaData.DataCount                           = 100;
     /* in states other than WRITE_PERF_ENTRIES, it should report the full size of the log */
     UtAssert_UINT32_EQ(CFE_ES_GetPerfLogDumpRemaining(), 100);
@@ -4196,9 +4601,11 @@ void TestAPI(void)
     /* Test getting task information using the task ID */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, &UtTaskRecPtr);
-    TaskId                = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
-    UtAppRecPtr->AppState = CFE_ES_AppState_RUNNING;
+    TaskId                            = CFE_ES_TaskRecordGetID(UtTaskRecPtr);
+    UtAppRecPtr->AppState             = CFE_ES_AppState_RUNNING;
+    UtTaskRecPtr->StartParams.CpuMask = 0x3;
     CFE_UtAssert_SUCCESS(CFE_ES_GetTaskInfo(&TaskInfo, TaskId));
+    UtAssert_UINT32_EQ(TaskInfo.CpuMask, 0x3);
 
     /* Test getting task information using the task ID with parent inactive */
     ES_ResetUnitTest();
@@ -4227,7 +4634,7 @@ void TestAPI(void)
     /* Test creating a child task with an OS task create failure */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, NULL, NULL);
-    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreate), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskCreateWithAffinity), OS_ERROR);
     UtAssert_INT32_EQ(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0),
                       CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
     /* Verify requirement to report error */
@@ -4267,7 +4674,10 @@ void TestAPI(void)
     /* Test successfully creating a child task */
     ES_ResetUnitTest();
     ES_UT_SetupSingleAppId(CFE_ES_AppType_EXTERNAL, CFE_ES_AppState_RUNNING, NULL, &UtAppRecPtr, NULL);
+    UtAppRecPtr->StartParams.ChildCpuMask = 0x4;
     CFE_UtAssert_SUCCESS(CFE_ES_CreateChildTask(&TaskId, "TaskName", TestAPI, StackBuf, sizeof(StackBuf), 400, 0));
+    UtTaskRecPtr = CFE_ES_LocateTaskRecordByID(TaskId);
+    UtAssert_UINT32_EQ(UtTaskRecPtr->StartParams.CpuMask, 0x4);
 
     /* Test common entry point */
     ES_ResetUnitTest();
@@ -4398,11 +4808,19 @@ void TestAPI(void)
     ES_ResetUnitTest();
     UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_16), 2688);
 
-    /* Test calculating a CRC on a range of memory using CRC type 32
-     * NOTE: This capability is not currently implemented in cFE
-     */
+    /* Test that a 16 bit CRC with the high bit set is sign extended, as it always has been */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_16), 0xFFFFBB3D);
+
+    /* Test calculating a CRC on a range of memory using CRC type 32 */
     ES_ResetUnitTest();
-    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 0);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32), 1314624383);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32), 0xCBF43926);
+
+    /* Test calculating a CRC on a range of memory using CRC type 32C */
+    ES_ResetUnitTest();
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC(&Data, 12, 345353, CFE_MISSION_ES_CRC_32C), 942868152);
+    UtAssert_UINT32_EQ(CFE_ES_CalculateCRC("123456789", 9, 0, CFE_MISSION_ES_CRC_32C), 0xE3069283);
 
     /* Test calculating a CRC on a range of memory using an invalid CRC type
      */
@@ -5510,6 +5928,156 @@ void TestESMempool(void)
     UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID1, NULL), CFE_ES_BAD_ARGUMENT);
 }
 
+void TestESMempoolCache(void)
+{
+    CFE_ES_MemHandle_t    PoolID;
+    uint8                 Buffer[8192];
+    CFE_ES_MemPoolBuf_t   addressp1 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolBuf_t   addressp2 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolBuf_t   BufList[CFE_ES_MEMPOOL_CACHE_DEPTH + 1];
+    CFE_ES_MemPoolBuf_t   DepotList[ES_UT_DEPOT_TEST_BLOCKS];
+    CFE_ES_MemPoolStats_t Stats;
+    uint32                i;
+
+    UtPrintf("Begin Test ES memory pool task cache");
+
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateEx(&PoolID, Buffer, sizeof(Buffer), 0, NULL, CFE_ES_USE_MUTEX | CFE_ES_POOL_TASK_CACHE));
+
+    /* The first get is served by the pool, the put goes into the task cache */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 256), 256);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), 256);
+
+    /* A block in the cache is free, so putting it again must fail */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+
+    /* The next get of the same size is the same block, from the cache */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 256), 256);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBufInfo(PoolID, addressp2), 256);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), 256);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CacheHits, 3);
+    UtAssert_UINT32_EQ(Stats.CacheMisses, 2);
+
+    /* Fill the cache, the last put does not fit and the full magazine moves to the depot */
+    for (i = 0; i <= CFE_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&BufList[i], PoolID, 256), 256);
+    }
+    for (i = 0; i <= CFE_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, BufList[i]), 256);
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CacheHits, 3 + 1 + CFE_ES_MEMPOOL_CACHE_DEPTH + 1);
+    UtAssert_UINT32_EQ(Stats.CacheMisses, 2 + CFE_ES_MEMPOOL_CACHE_DEPTH);
+
+    /* Requests that are too large are not served from the cache */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 99000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* A caller which is not an OSAL task uses the pool directly */
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 64), 64);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), 64);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CacheHits, 3 + 1 + CFE_ES_MEMPOOL_CACHE_DEPTH + 1);
+    UtAssert_UINT32_EQ(Stats.CacheMisses, 2 + CFE_ES_MEMPOOL_CACHE_DEPTH + 3);
+
+    /* A corrupted block is not accepted into the cache */
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 64), 64);
+    ((CFE_ES_GenPoolBD_t *)((cpuaddr)addressp1 - sizeof(CFE_ES_GenPoolBD_t)))->CheckBits = 0;
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), CFE_ES_POOL_BLOCK_INVALID);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+
+    /*
+     * Blocks allocated by one task and released by another, as SB buffers are,
+     * go back to the allocating task through the depot
+     */
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateEx(&PoolID, Buffer, sizeof(Buffer), 0, NULL, CFE_ES_NO_MUTEX | CFE_ES_POOL_TASK_CACHE));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), 1); /* sender */
+    for (i = 0; i < ES_UT_DEPOT_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&DepotList[i], PoolID, 256), 256);
+    }
+
+    /* The receiver cache and the depot fill up, then the last block goes back to the pool */
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), 2); /* receiver */
+    for (i = 0; i < ES_UT_DEPOT_TEST_BLOCKS; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, DepotList[i]), 256);
+    }
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CacheHits, ES_UT_DEPOT_TEST_BLOCKS - 1);
+    UtAssert_UINT32_EQ(Stats.CacheMisses, ES_UT_DEPOT_TEST_BLOCKS + 1);
+
+    /* The sender reloads its empty cache from the depot, last magazine first */
+    UT_SetDefaultReturnValue(UT_KEY(OS_TaskGetId), 1);
+    for (i = 0; i < CFE_ES_MEMPOOL_DEPOT_DEPTH * CFE_ES_MEMPOOL_CACHE_DEPTH; ++i)
+    {
+        UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 256), 256);
+        if (i == 0)
+        {
+            UtAssert_ADDRESS_EQ(addressp1, DepotList[CFE_ES_MEMPOOL_DEPOT_DEPTH * CFE_ES_MEMPOOL_CACHE_DEPTH - 1]);
+        }
+    }
+
+    /* Once the depot is empty the sender is served by the pool */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 256), 256);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_GetMemPoolStats(&Stats, PoolID));
+    UtAssert_UINT32_EQ(Stats.CacheHits,
+                       ES_UT_DEPOT_TEST_BLOCKS - 1 + CFE_ES_MEMPOOL_DEPOT_DEPTH * CFE_ES_MEMPOOL_CACHE_DEPTH);
+    UtAssert_UINT32_EQ(Stats.CacheMisses, ES_UT_DEPOT_TEST_BLOCKS + 2);
+
+    UT_ClearDefaultReturnValue(UT_KEY(OS_TaskGetId));
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+}
+
+void TestESMempoolLockFree(void)
+{
+    CFE_ES_MemHandle_t  PoolID;
+    uint8               Buffer[2048];
+    CFE_ES_MemPoolBuf_t addressp1 = CFE_ES_MEMPOOLBUF_C(0);
+    CFE_ES_MemPoolBuf_t addressp2 = CFE_ES_MEMPOOLBUF_C(0);
+    uint32              TakeCount;
+
+    UtPrintf("Begin Test ES memory pool lock-free free lists");
+
+    ES_ResetUnitTest();
+    CFE_UtAssert_SUCCESS(
+        CFE_ES_PoolCreateEx(&PoolID, Buffer, sizeof(Buffer), 0, NULL, CFE_ES_USE_MUTEX | CFE_ES_POOL_LOCK_FREE));
+
+    /* Creating a new block needs the mutex */
+    TakeCount = UT_GetStubCount(UT_KEY(OS_MutSemTake));
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 256), 256);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), TakeCount + 1);
+
+    /* Returning and recycling the block does not */
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp1), 256);
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp2, PoolID, 200), 200);
+    UtAssert_ADDRESS_EQ(addressp2, addressp1);
+    UtAssert_UINT32_EQ(UT_GetStubCount(UT_KEY(OS_MutSemTake)), TakeCount + 1);
+
+    /* Errors are still reported */
+    UtAssert_INT32_EQ(CFE_ES_GetPoolBuf(&addressp1, PoolID, 99000), CFE_ES_ERR_MEM_BLOCK_SIZE);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), 200);
+    UtAssert_INT32_EQ(CFE_ES_PutPoolBuf(PoolID, addressp2), CFE_ES_POOL_BLOCK_INVALID);
+
+    CFE_UtAssert_SUCCESS(CFE_ES_PoolDelete(PoolID));
+}
+
 /* Tests to fill gaps in coverage in SysLog */
 void TestSysLog(void)
 {
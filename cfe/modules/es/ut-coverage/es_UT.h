@@ -245,10 +245,44 @@ void TestCDSMempool(void);
 ******************************************************************************/
 void TestESMempool(void);
 
+/*****************************************************************************/
+/**
+** \brief Perform tests on the per-task block cache of the ES memory pools
+**
+** \par Description
+**        This function tests allocation and release through the task cache,
+**        cache overflow into the shared depot, reuse of blocks released by
+**        another task, fallback to the pool and the cache statistics.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolCache(void);
+
+/*****************************************************************************/
+/**
+** \brief Perform tests on ES memory pools with lock-free free lists
+**
+** \par Description
+**        This function tests that blocks are returned and recycled
+**        without the pool mutex, and that errors are still reported.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void TestESMempoolLockFree(void);
+
 void TestSysLog(void);
 void TestResourceID(void);
 void TestGenericCounterAPI(void);
 void TestGenericPool(void);
+void TestGenericPoolLockFree(void);
 void TestLibs(void);
 
 #endif /* ES_UT_H */
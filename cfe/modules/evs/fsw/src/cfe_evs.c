@@ -106,6 +106,8 @@ CFE_Status_t CFE_EVS_Register(const void *Filters, uint16 NumEventFilters, uint1
                 AppDataPtr->BinFilters[i].Count   = 0;
             }
 
+            EVS_RebuildFilterHash(AppDataPtr);
+
             EVS_AppDataSetUsed(AppDataPtr, AppID);
         }
     }
@@ -150,7 +152,7 @@ CFE_Status_t CFE_EVS_SendEvent(uint16 EventID, uint16 EventType, const char *Spe
 
             /* Send the event packets */
             va_start(Ptr, Spec);
-            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            EVS_SubmitEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
             va_end(Ptr);
         }
     }
@@ -195,7 +197,7 @@ CFE_Status_t CFE_EVS_SendEventWithAppID(uint16 EventID, uint16 EventType, CFE_ES
 
         /* Send the event packets */
         va_start(Ptr, Spec);
-        EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+        EVS_SubmitEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
         va_end(Ptr);
     }
 
@@ -235,7 +237,7 @@ CFE_Status_t CFE_EVS_SendTimedEvent(CFE_TIME_SysTime_t Time, uint16 EventID, uin
         {
             /* Send the event packets */
             va_start(Ptr, Spec);
-            EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
+            EVS_SubmitEventTelemetry(AppDataPtr, EventID, EventType, &Time, Spec, Ptr);
             va_end(Ptr);
         }
     }
@@ -268,7 +270,7 @@ int32 CFE_EVS_ResetFilter(uint16 EventID)
         }
         else
         {
-            FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindEventID(EventID, AppDataPtr);
 
             if (FilterPtr != NULL)
             {
@@ -0,0 +1,1145 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/*
+**
+**  File: cfe_evs_deferred.c
+**
+**  Title: Event Services - Deferred event processing
+**
+**  Purpose: Queues events from registered applications and formats, logs
+**           and sends them from an EVS child task.
+**
+*/
+
+/* Include Files */
+#include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "osapi-atomic.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+/* Defines */
+#define CFE_EVS_DEFERRED_SEM_NAME         "EVS_DEFER_SEM"
+#define CFE_EVS_DEFERRED_MUTEX_NAME       "EVS_DEFER_MUT"
+#define CFE_EVS_DEFERRED_CHILD_NAME       "EVS_DEFER_TASK"
+#define CFE_EVS_DEFERRED_CHILD_STACK_PTR  CFE_ES_TASK_STACK_ALLOCATE
+#define CFE_EVS_DEFERRED_CHILD_STACK_SIZE CFE_PLATFORM_EVS_START_TASK_STACK_SIZE
+#define CFE_EVS_DEFERRED_CHILD_PRIORITY   CFE_PLATFORM_EVS_START_TASK_PRIORITY
+#define CFE_EVS_DEFERRED_CHILD_FLAGS      0
+
+#define CFE_EVS_DEFERRED_QUEUE_MASK (CFE_EVS_DEFERRED_QUEUE_SIZE - 1)
+
+/*
+ * Longest single conversion specification that can be captured, and the
+ * size of the buffer used to rebuild it with any '*' values filled in.
+ */
+#define CFE_EVS_DEFERRED_MAX_CONV_LENGTH 24
+#define CFE_EVS_DEFERRED_SUBSPEC_SIZE    64
+
+/*
+ * Argument classes of a conversion specification
+ */
+typedef enum
+{
+    EVS_DeferredArg_INVALID = 0, /* cannot be captured, caller must format the message */
+    EVS_DeferredArg_PERCENT,     /* literal "%%", no argument */
+    EVS_DeferredArg_SIGNED,      /* signed integer, or character */
+    EVS_DeferredArg_UNSIGNED,    /* unsigned integer */
+    EVS_DeferredArg_DOUBLE,      /* floating point */
+    EVS_DeferredArg_STRING,      /* zero-terminated string */
+    EVS_DeferredArg_POINTER      /* pointer, printed as an address */
+} EVS_DeferredArgClass_t;
+
+/*
+ * Integer length modifiers of a conversion specification
+ */
+typedef enum
+{
+    EVS_DeferredLength_NONE = 0,
+    EVS_DeferredLength_HH,
+    EVS_DeferredLength_H,
+    EVS_DeferredLength_L,
+    EVS_DeferredLength_LL,
+    EVS_DeferredLength_J,
+    EVS_DeferredLength_Z,
+    EVS_DeferredLength_T
+} EVS_DeferredLength_t;
+
+/*
+ * A parsed conversion specification.  The offsets are relative to the
+ * leading '%' character and delimit the flags, width and precision.
+ */
+typedef struct
+{
+    EVS_DeferredArgClass_t ArgClass;
+    EVS_DeferredLength_t   Length;
+    bool                   StarWidth;
+    bool                   StarPrecision;
+    size_t                 FlagsEnd;
+    size_t                 WidthEnd;
+    size_t                 PrecisionEnd;
+    size_t                 SpecLength;
+} EVS_DeferredConv_t;
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredParseConv
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Parses the conversion specification starting at the '%' character
+ * at Spec.  Anything that cannot be safely captured and replayed is
+ * reported as EVS_DeferredArg_INVALID.
+ *
+ *-----------------------------------------------------------------*/
+static void EVS_DeferredParseConv(const char *Spec, EVS_DeferredConv_t *Conv)
+{
+    size_t Pos = 1;
+
+    memset(Conv, 0, sizeof(*Conv));
+
+    /* Flags */
+    while (Spec[Pos] != 0 && strchr("-+ #0'", Spec[Pos]) != NULL)
+    {
+        ++Pos;
+    }
+    Conv->FlagsEnd = Pos;
+
+    /* Width */
+    if (Spec[Pos] == '*')
+    {
+        Conv->StarWidth = true;
+        ++Pos;
+    }
+    else
+    {
+        while (isdigit((unsigned char)Spec[Pos]))
+        {
+            ++Pos;
+        }
+
+        if (Spec[Pos] == '$')
+        {
+            /* Positional arguments are not supported */
+            return;
+        }
+    }
+    Conv->WidthEnd = Pos;
+
+    /* Precision */
+    if (Spec[Pos] == '.')
+    {
+        ++Pos;
+        if (Spec[Pos] == '*')
+        {
+            Conv->StarPrecision = true;
+            ++Pos;
+        }
+        else
+        {
+            while (isdigit((unsigned char)Spec[Pos]))
+            {
+                ++Pos;
+            }
+        }
+    }
+    Conv->PrecisionEnd = Pos;
+
+    /* Length modifier - 'L' (long double) is deliberately not recognized */
+    switch (Spec[Pos])
+    {
+        case 'h':
+            ++Pos;
+            Conv->Length = EVS_DeferredLength_H;
+            if (Spec[Pos] == 'h')
+            {
+                ++Pos;
+                Conv->Length = EVS_DeferredLength_HH;
+            }
+            break;
+        case 'l':
+            ++Pos;
+            Conv->Length = EVS_DeferredLength_L;
+            if (Spec[Pos] == 'l')
+            {
+                ++Pos;
+                Conv->Length = EVS_DeferredLength_LL;
+            }
+            break;
+        case 'j':
+            ++Pos;
+            Conv->Length = EVS_DeferredLength_J;
+            break;
+        case 'z':
+            ++Pos;
+            Conv->Length = EVS_DeferredLength_Z;
+            break;
+        case 't':
+            ++Pos;
+            Conv->Length = EVS_DeferredLength_T;
+            break;
+        default:
+            break;
+    }
+
+    /* Conversion */
+    switch (Spec[Pos])
+    {
+        case 'd':
+        case 'i':
+            Conv->ArgClass = EVS_DeferredArg_SIGNED;
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            Conv->ArgClass = EVS_DeferredArg_UNSIGNED;
+            break;
+        case 'c':
+            /* "%lc" is a wide character */
+            if (Conv->Length == EVS_DeferredLength_NONE)
+            {
+                Conv->ArgClass = EVS_DeferredArg_SIGNED;
+            }
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            /* "l" has no effect on floating point conversions */
+            if (Conv->Length == EVS_DeferredLength_NONE || Conv->Length == EVS_DeferredLength_L)
+            {
+                Conv->ArgClass = EVS_DeferredArg_DOUBLE;
+            }
+            break;
+        case 's':
+            /* "%ls" is a wide string */
+            if (Conv->Length == EVS_DeferredLength_NONE)
+            {
+                Conv->ArgClass = EVS_DeferredArg_STRING;
+            }
+            break;
+        case 'p':
+            if (Conv->Length == EVS_DeferredLength_NONE)
+            {
+                Conv->ArgClass = EVS_DeferredArg_POINTER;
+            }
+            break;
+        case '%':
+            if (Pos == 1)
+            {
+                Conv->ArgClass = EVS_DeferredArg_PERCENT;
+            }
+            break;
+        default:
+            /* includes "%n" and the end of the string */
+            break;
+    }
+
+    Conv->SpecLength = Pos + 1;
+    if (Conv->SpecLength > CFE_EVS_DEFERRED_MAX_CONV_LENGTH)
+    {
+        Conv->ArgClass = EVS_DeferredArg_INVALID;
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredPut
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Appends a value to the captured data, if it fits
+ *
+ *-----------------------------------------------------------------*/
+static bool EVS_DeferredPut(char *Data, size_t *Used, const void *Src, size_t Size)
+{
+    if (Size > (CFE_EVS_DEFERRED_DATA_SIZE - *Used))
+    {
+        return false;
+    }
+
+    memcpy(&Data[*Used], Src, Size);
+    *Used += Size;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredGet
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Reads the next value from the captured data
+ *
+ *-----------------------------------------------------------------*/
+static void EVS_DeferredGet(const char **Cursor, void *Dst, size_t Size)
+{
+    memcpy(Dst, *Cursor, Size);
+    *Cursor += Size;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredCapture
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_DeferredCapture(char *Data, const char *MsgSpec, va_list ArgPtr)
+{
+    EVS_DeferredConv_t Conv;
+    const char *       Spec;
+    const char *       StrPtr;
+    size_t             Used;
+    size_t             StrLength;
+    size_t             MaxLength;
+    int                IntValue;
+    int                Precision;
+    int64              SignedValue;
+    uint64             UnsignedValue;
+    double             DoubleValue;
+    void *             PtrValue;
+
+    Used = 0;
+    if (!EVS_DeferredPut(Data, &Used, MsgSpec, strlen(MsgSpec) + 1))
+    {
+        return false;
+    }
+
+    Spec = strchr(MsgSpec, '%');
+    while (Spec != NULL)
+    {
+        EVS_DeferredParseConv(Spec, &Conv);
+        if (Conv.ArgClass == EVS_DeferredArg_INVALID)
+        {
+            return false;
+        }
+
+        if (Conv.StarWidth)
+        {
+            IntValue = va_arg(ArgPtr, int);
+            if (!EVS_DeferredPut(Data, &Used, &IntValue, sizeof(IntValue)))
+            {
+                return false;
+            }
+        }
+
+        Precision = -1;
+        if (Conv.StarPrecision)
+        {
+            Precision = va_arg(ArgPtr, int);
+            if (!EVS_DeferredPut(Data, &Used, &Precision, sizeof(Precision)))
+            {
+                return false;
+            }
+        }
+        else if (Conv.PrecisionEnd > Conv.WidthEnd)
+        {
+            Precision = atoi(&Spec[Conv.WidthEnd + 1]);
+        }
+
+        switch (Conv.ArgClass)
+        {
+            case EVS_DeferredArg_SIGNED:
+                switch (Conv.Length)
+                {
+                    case EVS_DeferredLength_L:
+                        SignedValue = va_arg(ArgPtr, long);
+                        break;
+                    case EVS_DeferredLength_LL:
+                        SignedValue = va_arg(ArgPtr, long long);
+                        break;
+                    case EVS_DeferredLength_J:
+                        SignedValue = va_arg(ArgPtr, intmax_t);
+                        break;
+                    case EVS_DeferredLength_Z:
+                        SignedValue = (int64)va_arg(ArgPtr, size_t);
+                        break;
+                    case EVS_DeferredLength_T:
+                        SignedValue = va_arg(ArgPtr, ptrdiff_t);
+                        break;
+                    default:
+                        /* char and short are promoted to int */
+                        SignedValue = va_arg(ArgPtr, int);
+                        break;
+                }
+                if (!EVS_DeferredPut(Data, &Used, &SignedValue, sizeof(SignedValue)))
+                {
+                    return false;
+                }
+                break;
+
+            case EVS_DeferredArg_UNSIGNED:
+                switch (Conv.Length)
+                {
+                    case EVS_DeferredLength_L:
+                        UnsignedValue = va_arg(ArgPtr, unsigned long);
+                        break;
+                    case EVS_DeferredLength_LL:
+                        UnsignedValue = va_arg(ArgPtr, unsigned long long);
+                        break;
+                    case EVS_DeferredLength_J:
+                        UnsignedValue = va_arg(ArgPtr, uintmax_t);
+                        break;
+                    case EVS_DeferredLength_Z:
+                        UnsignedValue = va_arg(ArgPtr, size_t);
+                        break;
+                    case EVS_DeferredLength_T:
+                        UnsignedValue = (uint64)va_arg(ArgPtr, ptrdiff_t);
+                        break;
+                    default:
+                        UnsignedValue = va_arg(ArgPtr, unsigned int);
+                        break;
+                }
+                if (!EVS_DeferredPut(Data, &Used, &UnsignedValue, sizeof(UnsignedValue)))
+                {
+                    return false;
+                }
+                break;
+
+            case EVS_DeferredArg_DOUBLE:
+                DoubleValue = va_arg(ArgPtr, double);
+                if (!EVS_DeferredPut(Data, &Used, &DoubleValue, sizeof(DoubleValue)))
+                {
+                    return false;
+                }
+                break;
+
+            case EVS_DeferredArg_POINTER:
+                PtrValue = va_arg(ArgPtr, void *);
+                if (!EVS_DeferredPut(Data, &Used, &PtrValue, sizeof(PtrValue)))
+                {
+                    return false;
+                }
+                break;
+
+            case EVS_DeferredArg_STRING:
+                StrPtr = va_arg(ArgPtr, const char *);
+                if (StrPtr == NULL)
+                {
+                    /* Let the caller's vsnprintf() decide how to handle this */
+                    return false;
+                }
+
+                /*
+                 * Nothing beyond the message length can appear in the output, and
+                 * with a precision the argument need not be terminated at all.
+                 * Scan one byte at a time, so nothing past the terminator is read.
+                 */
+                MaxLength = CFE_MISSION_EVS_MAX_MESSAGE_LENGTH;
+                if (Precision >= 0 && (size_t)Precision < MaxLength)
+                {
+                    MaxLength = Precision;
+                }
+                StrLength = 0;
+                while (StrLength < MaxLength && StrPtr[StrLength] != 0)
+                {
+                    ++StrLength;
+                }
+
+                if (!EVS_DeferredPut(Data, &Used, StrPtr, StrLength) || !EVS_DeferredPut(Data, &Used, "", 1))
+                {
+                    return false;
+                }
+                break;
+
+            default:
+                /* "%%" has no argument */
+                break;
+        }
+
+        Spec = strchr(&Spec[Conv.SpecLength], '%');
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredFormatConv
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Formats a single captured conversion with snprintf(), passing the
+ * value with the type that the conversion specification expects.
+ *
+ *-----------------------------------------------------------------*/
+static int EVS_DeferredFormatConv(char *Buffer, size_t BufSize, const char *Spec, const EVS_DeferredConv_t *Conv,
+                                  const char **Cursor)
+{
+    char   SubSpec[CFE_EVS_DEFERRED_SUBSPEC_SIZE];
+    size_t SubLength;
+    int    IntValue;
+    int64  SignedValue;
+    uint64 UnsignedValue;
+    double DoubleValue;
+    void * PtrValue;
+    int    Result;
+
+    /* Rebuild the specification with any '*' width or precision filled in */
+    memcpy(SubSpec, Spec, Conv->FlagsEnd);
+    SubLength = Conv->FlagsEnd;
+
+    if (Conv->StarWidth)
+    {
+        EVS_DeferredGet(Cursor, &IntValue, sizeof(IntValue));
+        SubLength += snprintf(&SubSpec[SubLength], sizeof(SubSpec) - SubLength, "%d", IntValue);
+    }
+    else
+    {
+        memcpy(&SubSpec[SubLength], &Spec[Conv->FlagsEnd], Conv->WidthEnd - Conv->FlagsEnd);
+        SubLength += Conv->WidthEnd - Conv->FlagsEnd;
+    }
+
+    if (Conv->StarPrecision)
+    {
+        /* A negative precision is taken as if the precision were omitted */
+        EVS_DeferredGet(Cursor, &IntValue, sizeof(IntValue));
+        if (IntValue >= 0)
+        {
+            SubLength += snprintf(&SubSpec[SubLength], sizeof(SubSpec) - SubLength, ".%d", IntValue);
+        }
+    }
+    else
+    {
+        memcpy(&SubSpec[SubLength], &Spec[Conv->WidthEnd], Conv->PrecisionEnd - Conv->WidthEnd);
+        SubLength += Conv->PrecisionEnd - Conv->WidthEnd;
+    }
+
+    memcpy(&SubSpec[SubLength], &Spec[Conv->PrecisionEnd], Conv->SpecLength - Conv->PrecisionEnd);
+    SubLength += Conv->SpecLength - Conv->PrecisionEnd;
+    SubSpec[SubLength] = 0;
+
+    switch (Conv->ArgClass)
+    {
+        case EVS_DeferredArg_SIGNED:
+            EVS_DeferredGet(Cursor, &SignedValue, sizeof(SignedValue));
+            switch (Conv->Length)
+            {
+                case EVS_DeferredLength_L:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (long)SignedValue);
+                    break;
+                case EVS_DeferredLength_LL:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (long long)SignedValue);
+                    break;
+                case EVS_DeferredLength_J:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (intmax_t)SignedValue);
+                    break;
+                case EVS_DeferredLength_Z:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (size_t)SignedValue);
+                    break;
+                case EVS_DeferredLength_T:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (ptrdiff_t)SignedValue);
+                    break;
+                default:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (int)SignedValue);
+                    break;
+            }
+            break;
+
+        case EVS_DeferredArg_UNSIGNED:
+            EVS_DeferredGet(Cursor, &UnsignedValue, sizeof(UnsignedValue));
+            switch (Conv->Length)
+            {
+                case EVS_DeferredLength_L:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (unsigned long)UnsignedValue);
+                    break;
+                case EVS_DeferredLength_LL:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (unsigned long long)UnsignedValue);
+                    break;
+                case EVS_DeferredLength_J:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (uintmax_t)UnsignedValue);
+                    break;
+                case EVS_DeferredLength_Z:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (size_t)UnsignedValue);
+                    break;
+                case EVS_DeferredLength_T:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (ptrdiff_t)UnsignedValue);
+                    break;
+                default:
+                    Result = snprintf(Buffer, BufSize, SubSpec, (unsigned int)UnsignedValue);
+                    break;
+            }
+            break;
+
+        case EVS_DeferredArg_DOUBLE:
+            EVS_DeferredGet(Cursor, &DoubleValue, sizeof(DoubleValue));
+            Result = snprintf(Buffer, BufSize, SubSpec, DoubleValue);
+            break;
+
+        case EVS_DeferredArg_POINTER:
+            EVS_DeferredGet(Cursor, &PtrValue, sizeof(PtrValue));
+            Result = snprintf(Buffer, BufSize, SubSpec, PtrValue);
+            break;
+
+        case EVS_DeferredArg_STRING:
+            Result = snprintf(Buffer, BufSize, SubSpec, *Cursor);
+            *Cursor += strlen(*Cursor) + 1;
+            break;
+
+        default:
+            Result = snprintf(Buffer, BufSize, "%%");
+            break;
+    }
+
+    return Result;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredFormat
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int EVS_DeferredFormat(char *Buffer, size_t BufSize, const char *Data)
+{
+    EVS_DeferredConv_t Conv;
+    const char *       Spec;
+    const char *       Cursor;
+    size_t             Pos;
+    int                Result;
+
+    Spec   = Data;
+    Cursor = Data + strlen(Data) + 1;
+    Pos    = 0;
+
+    while (*Spec != 0)
+    {
+        if (*Spec != '%')
+        {
+            if ((Pos + 1) < BufSize)
+            {
+                Buffer[Pos] = *Spec;
+            }
+            ++Pos;
+            ++Spec;
+            continue;
+        }
+
+        /* The data was captured from this same specification, so this cannot fail */
+        EVS_DeferredParseConv(Spec, &Conv);
+        if (Conv.ArgClass == EVS_DeferredArg_INVALID)
+        {
+            Result = -1;
+            break;
+        }
+
+        if (Pos < BufSize)
+        {
+            Result = EVS_DeferredFormatConv(&Buffer[Pos], BufSize - Pos, Spec, &Conv, &Cursor);
+        }
+        else
+        {
+            Result = EVS_DeferredFormatConv(NULL, 0, Spec, &Conv, &Cursor);
+        }
+
+        if (Result < 0)
+        {
+            break;
+        }
+
+        Pos += Result;
+        Spec += Conv.SpecLength;
+    }
+
+    if (BufSize > 0)
+    {
+        Buffer[(Pos < BufSize) ? Pos : (BufSize - 1)] = 0;
+    }
+
+    if (*Spec != 0)
+    {
+        return -1;
+    }
+
+    return (int)Pos;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredPackValue
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Appends the low Size bytes of a value to the packed arguments,
+ * most significant byte first, if they fit
+ *
+ *-----------------------------------------------------------------*/
+static bool EVS_DeferredPackValue(uint8 *Args, size_t ArgSize, size_t *Used, uint64 Value, size_t Size)
+{
+    if (Size > (ArgSize - *Used))
+    {
+        return false;
+    }
+
+    while (Size > 0)
+    {
+        --Size;
+        Args[*Used] = (uint8)(Value >> (8 * Size));
+        ++(*Used);
+    }
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredPackArgs
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 EVS_DeferredPackArgs(uint8 *Args, size_t ArgSize, const char *Data)
+{
+    EVS_DeferredConv_t Conv;
+    const char *       Spec;
+    const char *       Cursor;
+    size_t             Used;
+    size_t             StrLength;
+    size_t             MaxLength;
+    size_t             IntSize;
+    int                IntValue;
+    int64              SignedValue;
+    uint64             UnsignedValue;
+    double             DoubleValue;
+    void *             PtrValue;
+    bool               Fits;
+
+    Cursor = Data + strlen(Data) + 1;
+    Used   = 0;
+    Fits   = true;
+
+    Spec = strchr(Data, '%');
+    while (Spec != NULL && Fits)
+    {
+        /* The data was captured from this same specification, so this cannot fail */
+        EVS_DeferredParseConv(Spec, &Conv);
+        if (Conv.ArgClass == EVS_DeferredArg_INVALID)
+        {
+            return -1;
+        }
+
+        if (Conv.StarWidth)
+        {
+            EVS_DeferredGet(&Cursor, &IntValue, sizeof(IntValue));
+            Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, (uint32)IntValue, 4);
+        }
+
+        if (Conv.StarPrecision)
+        {
+            EVS_DeferredGet(&Cursor, &IntValue, sizeof(IntValue));
+            Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, (uint32)IntValue, 4);
+        }
+
+        /* Integers are packed at the width the conversion prints, not the width they were passed at */
+        switch (Conv.Length)
+        {
+            case EVS_DeferredLength_HH:
+                IntSize = 1;
+                break;
+            case EVS_DeferredLength_H:
+                IntSize = 2;
+                break;
+            case EVS_DeferredLength_NONE:
+                IntSize = 4;
+                break;
+            default:
+                IntSize = 8;
+                break;
+        }
+
+        switch (Conv.ArgClass)
+        {
+            case EVS_DeferredArg_SIGNED:
+                EVS_DeferredGet(&Cursor, &SignedValue, sizeof(SignedValue));
+                Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, (uint64)SignedValue, IntSize);
+                break;
+
+            case EVS_DeferredArg_UNSIGNED:
+                EVS_DeferredGet(&Cursor, &UnsignedValue, sizeof(UnsignedValue));
+                Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, UnsignedValue, IntSize);
+                break;
+
+            case EVS_DeferredArg_DOUBLE:
+                EVS_DeferredGet(&Cursor, &DoubleValue, sizeof(DoubleValue));
+                memcpy(&UnsignedValue, &DoubleValue, sizeof(UnsignedValue));
+                Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, UnsignedValue, 8);
+                break;
+
+            case EVS_DeferredArg_POINTER:
+                EVS_DeferredGet(&Cursor, &PtrValue, sizeof(PtrValue));
+                Fits = Fits && EVS_DeferredPackValue(Args, ArgSize, &Used, (uintptr_t)PtrValue, 8);
+                break;
+
+            case EVS_DeferredArg_STRING:
+                StrLength = strlen(Cursor) + 1;
+                if (StrLength > (ArgSize - Used))
+                {
+                    Fits = false;
+                }
+                else
+                {
+                    memcpy(&Args[Used], Cursor, StrLength);
+                    Used += StrLength;
+                }
+                Cursor += StrLength;
+                break;
+
+            default:
+                /* "%%" has no argument */
+                break;
+        }
+
+        Spec = strchr(&Spec[Conv.SpecLength], '%');
+    }
+
+    if (!Fits)
+    {
+        return -1;
+    }
+
+    return (int32)Used;
+}
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredQueueInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_DeferredQueueInit(void)
+{
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        CFE_EVS_Global.DeferredQueue[i].WriteIndex = 0;
+        CFE_EVS_Global.DeferredQueue[i].ReadIndex  = 0;
+
+        /* A slot is free for the sender that claims index N when its sequence is N */
+        for (j = 0; j < CFE_EVS_DEFERRED_QUEUE_SIZE; ++j)
+        {
+            CFE_EVS_Global.DeferredQueue[i].Events[j].Sequence = j;
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredPush
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_DeferredPush(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                      const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+    EVS_DeferredQueue_t *QueuePtr;
+    EVS_DeferredEvent_t *EventPtr;
+    uint32               Pos;
+    uint32               Expected;
+    int32                Diff;
+    va_list              ArgCopy;
+
+    QueuePtr = &CFE_EVS_Global.DeferredQueue[AppDataPtr - CFE_EVS_Global.AppData];
+
+    /*
+     * Claim a slot.  A slot whose sequence equals the write index is free; one
+     * whose sequence is behind it still holds an event from the previous lap,
+     * meaning the queue is full.
+     */
+    Pos = OS_AtomicLoad32(&QueuePtr->WriteIndex);
+    while (true)
+    {
+        EventPtr = &QueuePtr->Events[Pos & CFE_EVS_DEFERRED_QUEUE_MASK];
+        Diff     = (int32)(OS_AtomicLoad32(&EventPtr->Sequence) - Pos);
+
+        if (Diff == 0)
+        {
+            /* On failure Pos is updated to the current write index */
+            if (OS_AtomicCompareExchange32(&QueuePtr->WriteIndex, &Pos, Pos + 1))
+            {
+                break;
+            }
+        }
+        else if (Diff < 0)
+        {
+            OS_AtomicFetchAdd32(&CFE_EVS_Global.DeferredOverflowCount, 1);
+            return false;
+        }
+        else
+        {
+            /* Another sender claimed this slot first */
+            Pos = OS_AtomicLoad32(&QueuePtr->WriteIndex);
+        }
+    }
+
+    EventPtr->EventID   = EventID;
+    EventPtr->EventType = EventType;
+    EventPtr->TimeStamp = *TimeStamp;
+    EventPtr->MsgSpec   = MsgSpec;
+
+    va_copy(ArgCopy, ArgPtr);
+    EventPtr->IsFormatted = !EVS_DeferredCapture(EventPtr->Data, MsgSpec, ArgCopy);
+    va_end(ArgCopy);
+
+    if (EventPtr->IsFormatted)
+    {
+        EventPtr->ExpandedLength = vsnprintf(EventPtr->Data, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, MsgSpec, ArgPtr);
+    }
+
+    /* Publish the event to the deferred task */
+    OS_AtomicStore32(&EventPtr->Sequence, Pos + 1);
+
+    /* Only the first sender after the task last looked needs to wake it */
+    Expected = 0;
+    if (OS_AtomicCompareExchange32(&CFE_EVS_Global.DeferredPending, &Expected, 1))
+    {
+        OS_BinSemGive(CFE_EVS_Global.DeferredSemID);
+    }
+
+    return true;
+}
+#endif
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SubmitEventTelemetry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SubmitEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                              const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+    if (CFE_EVS_Global.DeferredActive)
+    {
+        /* Overflow is counted within EVS_DeferredPush() */
+        EVS_DeferredPush(AppDataPtr, EventID, EventType, TimeStamp, MsgSpec, ArgPtr);
+        return;
+    }
+#endif
+
+    EVS_GenerateEventTelemetry(AppDataPtr, EventID, EventType, TimeStamp, MsgSpec, ArgPtr);
+}
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredDrainQueue
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Processes all published events in one application's queue.
+ * Must only be called by one thread at a time.
+ *
+ *-----------------------------------------------------------------*/
+static uint32 EVS_DeferredDrainQueue(EVS_AppData_t *AppDataPtr, EVS_DeferredQueue_t *QueuePtr)
+{
+    CFE_EVS_LongEventTlm_t    LongEventTlm;
+    CFE_EVS_BinaryEventTlm_t  BinaryEventTlm;
+    CFE_EVS_BinaryEventTlm_t *BinaryEventTlmPtr;
+    EVS_DeferredEvent_t *     EventPtr;
+    CFE_TIME_SysTime_t        TimeStamp;
+    uint32                    Pos;
+    uint32                    Count;
+    int                       ExpandedLength;
+
+    Count = 0;
+    while (true)
+    {
+        Pos      = QueuePtr->ReadIndex;
+        EventPtr = &QueuePtr->Events[Pos & CFE_EVS_DEFERRED_QUEUE_MASK];
+
+        /* The sequence becomes Pos + 1 once the sender has finished filling the slot */
+        if ((int32)(OS_AtomicLoad32(&EventPtr->Sequence) - (Pos + 1)) < 0)
+        {
+            break;
+        }
+
+        CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                     sizeof(LongEventTlm));
+        LongEventTlm.Payload.PacketID.EventID   = EventPtr->EventID;
+        LongEventTlm.Payload.PacketID.EventType = EventPtr->EventType;
+        TimeStamp                               = EventPtr->TimeStamp;
+
+        /* The binary form must also be packed while the captured arguments are still in the slot */
+        BinaryEventTlmPtr = NULL;
+        if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_BINARY &&
+            !EventPtr->IsFormatted && EVS_PackBinaryEvent(&BinaryEventTlm, EventPtr->MsgSpec, EventPtr->Data))
+        {
+            BinaryEventTlmPtr = &BinaryEventTlm;
+        }
+
+        if (BinaryEventTlmPtr != NULL && !EVS_EventTextNeeded())
+        {
+            /* Only the binary form is sent, so the text is not expanded at all */
+            ExpandedLength                  = 0;
+            LongEventTlm.Payload.Message[0] = 0;
+        }
+        else if (EventPtr->IsFormatted)
+        {
+            ExpandedLength = EventPtr->ExpandedLength;
+            strncpy((char *)LongEventTlm.Payload.Message, EventPtr->Data, sizeof(LongEventTlm.Payload.Message) - 1);
+            LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 1] = 0;
+        }
+        else
+        {
+            ExpandedLength = EVS_DeferredFormat((char *)LongEventTlm.Payload.Message,
+                                                sizeof(LongEventTlm.Payload.Message), EventPtr->Data);
+        }
+
+        /* Release the slot before doing any output, so senders are not held up by it */
+        OS_AtomicStore32(&EventPtr->Sequence, Pos + CFE_EVS_DEFERRED_QUEUE_SIZE);
+        QueuePtr->ReadIndex = Pos + 1;
+
+        EVS_SendEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, &TimeStamp, BinaryEventTlmPtr);
+        ++Count;
+    }
+
+    return Count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_ProcessDeferredEvents
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 EVS_ProcessDeferredEvents(void)
+{
+    uint32 i;
+    uint32 Count;
+
+    /*
+     * Clear the pending flag before looking at the queues.  Any event published
+     * after this point sets it again and gives the semaphore, so nothing is missed.
+     */
+    OS_AtomicStore32(&CFE_EVS_Global.DeferredPending, 0);
+    OS_AtomicThreadFence();
+
+    Count = 0;
+
+    OS_MutSemTake(CFE_EVS_Global.DeferredMutexID);
+    for (i = 0; i < CFE_PLATFORM_ES_MAX_APPLICATIONS; ++i)
+    {
+        Count += EVS_DeferredDrainQueue(&CFE_EVS_Global.AppData[i], &CFE_EVS_Global.DeferredQueue[i]);
+    }
+    OS_MutSemGive(CFE_EVS_Global.DeferredMutexID);
+
+    return Count;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredTask
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_DeferredTask(void)
+{
+    int32 OsStatus;
+
+    while (true)
+    {
+        OsStatus = OS_BinSemTake(CFE_EVS_Global.DeferredSemID);
+        if (OsStatus != OS_SUCCESS)
+        {
+            /* should never occur */
+            CFE_ES_WriteToSysLog("%s: Failed to take deferred event sem: %ld\n", __func__, (long)OsStatus);
+            break;
+        }
+
+        EVS_ProcessDeferredEvents();
+    }
+
+    /* Fall back to sending events directly, after flushing what is already queued */
+    CFE_EVS_Global.DeferredActive = false;
+    EVS_ProcessDeferredEvents();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_DeferredInit
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 EVS_DeferredInit(void)
+{
+    int32 Status;
+    int32 OsStatus;
+
+    OsStatus = OS_BinSemCreate(&CFE_EVS_Global.DeferredSemID, CFE_EVS_DEFERRED_SEM_NAME, 0, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to create deferred event sem: %ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    OsStatus = OS_MutSemCreate(&CFE_EVS_Global.DeferredMutexID, CFE_EVS_DEFERRED_MUTEX_NAME, 0);
+    if (OsStatus != OS_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to create deferred event mutex: %ld\n", __func__, (long)OsStatus);
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    Status = CFE_ES_CreateChildTask(&CFE_EVS_Global.DeferredTaskID, CFE_EVS_DEFERRED_CHILD_NAME, EVS_DeferredTask,
+                                    CFE_EVS_DEFERRED_CHILD_STACK_PTR, CFE_EVS_DEFERRED_CHILD_STACK_SIZE,
+                                    CFE_EVS_DEFERRED_CHILD_PRIORITY, CFE_EVS_DEFERRED_CHILD_FLAGS);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Failed to create deferred event task: %08lx\n", __func__, (unsigned long)Status);
+        return Status;
+    }
+
+    CFE_EVS_Global.DeferredActive = true;
+
+    return CFE_SUCCESS;
+}
+#endif
@@ -0,0 +1,178 @@
+/*
+**  GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**  Copyright (c) 2006-2019 United States Government as represented by
+**  the Administrator of the National Aeronautics and Space Administration.
+**  All Rights Reserved.
+**
+**  Licensed under the Apache License, Version 2.0 (the "License");
+**  you may not use this file except in compliance with the License.
+**  You may obtain a copy of the License at
+**
+**    http://www.apache.org/licenses/LICENSE-2.0
+**
+**  Unless required by applicable law or agreed to in writing, software
+**  distributed under the License is distributed on an "AS IS" BASIS,
+**  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**  See the License for the specific language governing permissions and
+**  limitations under the License.
+*/
+
+/**
+ * @file
+ *
+ *  Title:    Event Services - Deferred event processing.
+ *
+ *  Purpose:
+ *            Unit specification for deferred event processing.
+ *
+ *  Design Notes:
+ *
+ *  When deferred processing is enabled, events sent through the public API
+ *  are not formatted on the calling thread.  The caller copies the event ID,
+ *  type, timestamp, format string and the format arguments into a slot of
+ *  a per-application ring, and an EVS child task later formats, logs and
+ *  sends the queued events in batches.
+ *
+ *  Each ring is a bounded multi-producer/single-consumer queue where each slot
+ *  carries a sequence number, so senders never block each other or the
+ *  deferred task.  When a ring is full the event is discarded and counted.
+ *
+ *  A va_list cannot outlive the call that produced it, so the arguments
+ *  are captured by walking the format string: numeric values are stored
+ *  widened to 64 bits and strings are copied.  Formats that cannot be
+ *  captured this way (e.g. "%n", positional arguments, wide characters, long
+ *  double) are formatted by the caller into the slot instead, which still
+ *  defers logging and all output.
+ *
+ *  References:
+ *     Flight Software Branch C Coding Standard Version 1.0a
+ *
+ */
+
+#ifndef CFE_EVS_DEFERRED_H
+#define CFE_EVS_DEFERRED_H
+
+/********************* Include Files  ************************/
+
+#include <stdarg.h>
+
+#include "cfe_evs_task.h" /* EVS internal definitions */
+#include "cfe_time_api_typedefs.h"
+
+/* ==============   Section I: Function Prototypes =========== */
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Initialize the deferred event queues
+ *
+ * Resets all per-application rings to empty.  Called once during early init.
+ */
+void EVS_DeferredQueueInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Start deferred event processing
+ *
+ * Creates the resources and child task used to process deferred events,
+ * and then enables queuing of events from registered applications.
+ *
+ * @return CFE_SUCCESS on success, or an error code if a resource could not be created
+ */
+int32 EVS_DeferredInit(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Deferred event processing task
+ *
+ * Entry point of the EVS child task that processes deferred events.
+ * Pends on the wakeup semaphore and drains all queues on each wakeup.
+ */
+void EVS_DeferredTask(void);
+#endif
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Send or queue an event from a registered application
+ *
+ * If deferred processing is active the event is placed into the
+ * application's queue, otherwise it is sent directly via
+ * EVS_GenerateEventTelemetry().  The caller must have already checked
+ * that the event is not filtered.
+ */
+void EVS_SubmitEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                              const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Place an event into the application's deferred queue
+ *
+ * @return true if the event was queued, false if the queue was full
+ */
+bool EVS_DeferredPush(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                      const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Process all queued events
+ *
+ * Formats, logs and sends every event currently in the deferred queues.
+ * Called from the deferred task, and when an application is cleaned up
+ * so that no queued events refer to a freed application record.
+ *
+ * @return the number of events processed
+ */
+uint32 EVS_ProcessDeferredEvents(void);
+#endif
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Capture a format string and its arguments
+ *
+ * Copies the format string and the arguments it refers to into Data,
+ * which must be at least #CFE_EVS_DEFERRED_DATA_SIZE bytes.
+ *
+ * @param Data    output buffer for the captured data
+ * @param MsgSpec format string
+ * @param ArgPtr  format arguments, consumed by this call
+ *
+ * @return true if captured, false if the format cannot be captured or does not
+ *         fit, in which case the caller must format the message itself
+ */
+bool EVS_DeferredCapture(char *Data, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Pack captured arguments for a binary format event message
+ *
+ * Converts arguments captured by EVS_DeferredCapture() to the layout
+ * described for the Args field of the binary event message, which ground
+ * tools can decode using only the format string.
+ *
+ * @param Args    output buffer for the packed arguments
+ * @param ArgSize size of the output buffer
+ * @param Data    captured format string and arguments
+ *
+ * @return the number of bytes used in Args, or negative if they do not fit
+ */
+int32 EVS_DeferredPackArgs(uint8 *Args, size_t ArgSize, const char *Data);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Expand a captured message
+ *
+ * Produces the message text from a format string and arguments captured
+ * by EVS_DeferredPush().  Behaves like snprintf(): the output is always
+ * terminated and the return value is the full expanded length.
+ *
+ * @param Buffer  output buffer
+ * @param BufSize size of the output buffer
+ * @param Data    captured format string and arguments
+ *
+ * @return the full length of the expanded message, or negative on error
+ */
+int EVS_DeferredFormat(char *Buffer, size_t BufSize, const char *Data);
+
+#endif /* CFE_EVS_DEFERRED_H */
@@ -33,6 +33,7 @@
 #include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
 #include "cfe_version.h"        /* cFE version definitions */
 #include "cfe_evs_verify.h"
+#include "osapi-atomic.h"
 
 #include <string.h>
 
@@ -64,6 +65,9 @@ int32 CFE_EVS_EarlyInit(void)
     CFE_ES_ResetData_t *CFE_EVS_ResetDataPtr = (CFE_ES_ResetData_t *)NULL;
 
     memset(&CFE_EVS_Global, 0, sizeof(CFE_EVS_Global));
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+    EVS_DeferredQueueInit();
+#endif
 
     /* Initialize housekeeping packet */
     CFE_MSG_Init(CFE_MSG_PTR(CFE_EVS_Global.EVS_TlmPkt.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_HK_TLM_MID),
@@ -182,6 +186,17 @@ int32 CFE_EVS_CleanUpApp(CFE_ES_AppId_t AppID)
     }
     else if (EVS_AppDataIsMatch(AppDataPtr, AppID))
     {
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+        /* Flush any queued events while the app record is still valid */
+        if (CFE_EVS_Global.DeferredActive)
+        {
+            EVS_ProcessDeferredEvents();
+        }
+#endif
+
+        /* The format strings of the app may be unloaded, and their addresses reused */
+        OS_AtomicFetchAdd32(&CFE_EVS_Global.FormatIdGeneration, 1);
+
         EVS_AppDataSetFree(AppDataPtr);
     }
 
@@ -302,6 +317,16 @@ int32 CFE_EVS_TaskInit(void)
         return Status;
     }
 
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+    /* Start processing events from applications in the background */
+    Status = EVS_DeferredInit();
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_ES_WriteToSysLog("%s: Deferred event init Failed:RC=0x%08X\n", __func__, (unsigned int)Status);
+        return Status;
+    }
+#endif
+
     /* Write the AppID to the global location, now that the rest of initialization is done */
     CFE_EVS_Global.EVS_AppID = AppID;
     EVS_SendEvent(CFE_EVS_STARTUP_EID, CFE_EVS_EventType_INFORMATION, "cFE EVS Initialized: %s", CFE_VERSION_STRING);
@@ -348,6 +373,7 @@ int32 CFE_EVS_ClearLogCmd(const CFE_EVS_ClearLogCmd_t *data)
 int32 CFE_EVS_ReportHousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
 {
     uint32                i, j;
+    uint32                DeferredOverflowCount;
     EVS_AppData_t *       AppDataPtr;
     CFE_EVS_AppTlmData_t *AppTlmDataPtr;
 
@@ -356,6 +382,14 @@ int32 CFE_EVS_ReportHousekeepingCmd(const CFE_MSG_CommandHeader_t *data)
     CFE_EVS_Global.EVS_TlmPkt.Payload.LogMode            = CFE_EVS_Global.EVS_LogPtr->LogMode;
     CFE_EVS_Global.EVS_TlmPkt.Payload.LogOverflowCounter = CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter;
 
+    /* Events discarded by senders, saturated to the telemetry field size */
+    DeferredOverflowCount = OS_AtomicLoad32(&CFE_EVS_Global.DeferredOverflowCount);
+    if (DeferredOverflowCount > CFE_EVS_MAX_EVENT_SEND_COUNT)
+    {
+        DeferredOverflowCount = CFE_EVS_MAX_EVENT_SEND_COUNT;
+    }
+    CFE_EVS_Global.EVS_TlmPkt.Payload.DeferredOverflowCounter = DeferredOverflowCount;
+
     /* Write event state data for registered apps to telemetry packet */
     AppDataPtr    = CFE_EVS_Global.AppData;
     AppTlmDataPtr = CFE_EVS_Global.EVS_TlmPkt.Payload.AppData;
@@ -405,6 +439,7 @@ int32 CFE_EVS_ResetCountersCmd(const CFE_EVS_ResetCountersCmd_t *data)
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter     = 0;
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter    = 0;
     CFE_EVS_Global.EVS_TlmPkt.Payload.UnregisteredAppCounter = 0;
+    OS_AtomicStore32(&CFE_EVS_Global.DeferredOverflowCount, 0);
 
     EVS_SendEvent(CFE_EVS_RSTCNT_EID, CFE_EVS_EventType_DEBUG, "Reset Counters Command Received");
 
@@ -437,7 +472,7 @@ int32 CFE_EVS_SetFilterCmd(const CFE_EVS_SetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -685,7 +720,8 @@ int32 CFE_EVS_SetEventFormatModeCmd(const CFE_EVS_SetEventFormatModeCmd_t *data)
     const CFE_EVS_SetEventFormatMode_Payload_t *CmdPtr = &data->Payload;
     int32                                       Status;
 
-    if ((CmdPtr->MsgFormat == CFE_EVS_MsgFormat_SHORT) || (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_LONG))
+    if ((CmdPtr->MsgFormat == CFE_EVS_MsgFormat_SHORT) || (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_LONG) ||
+        (CmdPtr->MsgFormat == CFE_EVS_MsgFormat_BINARY))
     {
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CmdPtr->MsgFormat;
 
@@ -1005,7 +1041,7 @@ int32 CFE_EVS_ResetFilterCmd(const CFE_EVS_ResetFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -1123,7 +1159,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
     if (Status == CFE_SUCCESS)
     {
         /* Check to see if this event is already registered for filtering */
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         /* FilterPtr != NULL means that this Event ID was found as already being registered */
         if (FilterPtr != NULL)
@@ -1137,7 +1173,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
         else
         {
             /* now check to see if there is a free slot */
-            FilterPtr = EVS_FindEventID(CFE_EVS_FREE_SLOT, AppDataPtr->BinFilters);
+            FilterPtr = EVS_FindFreeFilter(AppDataPtr);
 
             if (FilterPtr != NULL)
             {
@@ -1145,6 +1181,7 @@ int32 CFE_EVS_AddEventFilterCmd(const CFE_EVS_AddEventFilterCmd_t *data)
                 FilterPtr->EventID = CmdPtr->EventID;
                 FilterPtr->Mask    = CmdPtr->Mask;
                 FilterPtr->Count   = 0;
+                EVS_RebuildFilterHash(AppDataPtr);
 
                 EVS_SendEvent(CFE_EVS_ADDFILTER_EID, CFE_EVS_EventType_DEBUG,
                               "Add Filter Command Received with AppName = %s, EventID = 0x%08x, Mask = 0x%04x",
@@ -1206,7 +1243,7 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
 
     if (Status == CFE_SUCCESS)
     {
-        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr->BinFilters);
+        FilterPtr = EVS_FindEventID(CmdPtr->EventID, AppDataPtr);
 
         if (FilterPtr != NULL)
         {
@@ -1214,6 +1251,7 @@ int32 CFE_EVS_DeleteEventFilterCmd(const CFE_EVS_DeleteEventFilterCmd_t *data)
             FilterPtr->EventID = CFE_EVS_FREE_SLOT;
             FilterPtr->Mask    = CFE_EVS_NO_MASK;
             FilterPtr->Count   = 0;
+            EVS_RebuildFilterHash(AppDataPtr);
 
             EVS_SendEvent(CFE_EVS_DELFILTER_EID, CFE_EVS_EventType_DEBUG,
                           "Delete Filter Command Received with AppName = %s, EventID = 0x%08x", LocalName,
@@ -50,6 +50,7 @@
 #include "cfe_evs_log_typedef.h"
 #include "cfe_sb_api_typedefs.h"
 #include "cfe_evs_events.h"
+#include "cfe_time_api_typedefs.h"
 
 /*********************  Macro and Constant Type Definitions   ***************************/
 
@@ -70,6 +71,36 @@
 #error CFE_EVS_MAX_PORT_MSG_LENGTH cannot be greater than OS_BUFFER_SIZE!
 #endif
 
+/* Missions that predate deferred event processing get the synchronous behavior */
+#ifndef CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH
+#define CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH 0
+#endif
+
+/* Slots in each per-app deferred event queue, no queue storage is allocated if this is zero */
+#define CFE_EVS_DEFERRED_QUEUE_SIZE CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH
+
+/*
+ * Size of the per-app event filter hash index.  This is the smallest power of
+ * two that keeps the index at most half full, so lookups need few probes.
+ */
+#if CFE_PLATFORM_EVS_MAX_EVENT_FILTERS <= 8
+#define CFE_EVS_FILTER_HASH_SIZE 16
+#elif CFE_PLATFORM_EVS_MAX_EVENT_FILTERS <= 16
+#define CFE_EVS_FILTER_HASH_SIZE 32
+#elif CFE_PLATFORM_EVS_MAX_EVENT_FILTERS <= 32
+#define CFE_EVS_FILTER_HASH_SIZE 64
+#elif CFE_PLATFORM_EVS_MAX_EVENT_FILTERS <= 64
+#define CFE_EVS_FILTER_HASH_SIZE 128
+#else
+#define CFE_EVS_FILTER_HASH_SIZE 256
+#endif
+
+/* Holds a copy of the format string followed by the captured arguments */
+#define CFE_EVS_DEFERRED_DATA_SIZE (2 * CFE_MISSION_EVS_MAX_MESSAGE_LENGTH)
+
+/* Number of binary event format IDs remembered by format string address, must be a power of two */
+#define CFE_EVS_FORMAT_ID_CACHE_SIZE 64
+
 /************************  Internal Structure Definitions  *****************************/
 
 typedef struct
@@ -87,6 +118,7 @@ typedef struct
     CFE_ES_AppId_t UnregAppID;
 
     EVS_BinFilter_t BinFilters[CFE_PLATFORM_EVS_MAX_EVENT_FILTERS]; /* Array of binary filters */
+    uint8           FilterHash[CFE_EVS_FILTER_HASH_SIZE]; /* BinFilters index + 1 by EventID hash, 0 if unused */
 
     uint8  ActiveFlag;           /* Application event service active flag */
     uint8  EventTypesActiveFlag; /* Application event types active flag */
@@ -104,6 +136,38 @@ typedef struct
 
 } CFE_EVS_AppDataFile_t;
 
+typedef struct
+{
+    volatile uint32      Sequence;   /* Odd while the entry is being written, see EVS_GetFormatID() */
+    volatile uint32      Generation; /* Value of FormatIdGeneration when the entry was written */
+    const char *volatile MsgSpec;    /* Format string address of the call site, NULL if unused */
+    volatile uint32      FormatID;   /* CRC-32 of the format string */
+
+} EVS_FormatIdCacheEntry_t;
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+typedef struct
+{
+    uint32             Sequence;       /* Ring slot sequence number, see EVS_DeferredPush() */
+    uint16             EventID;        /* Numerical event identifier */
+    uint16             EventType;      /* Event type/severity */
+    CFE_TIME_SysTime_t TimeStamp;      /* Time the event was sent */
+    int32              ExpandedLength; /* Length reported by vsnprintf(), if IsFormatted */
+    bool               IsFormatted;    /* Data holds message text rather than captured arguments */
+    const char *       MsgSpec;        /* Format string of the call site, identifies its binary format ID */
+    char               Data[CFE_EVS_DEFERRED_DATA_SIZE];
+
+} EVS_DeferredEvent_t;
+
+typedef struct
+{
+    uint32              WriteIndex; /* Next slot to be claimed by a sender */
+    uint32              ReadIndex;  /* Next slot to be processed, only used by the deferred task */
+    EVS_DeferredEvent_t Events[CFE_EVS_DEFERRED_QUEUE_SIZE];
+
+} EVS_DeferredQueue_t;
+#endif
+
 /* Global data structure */
 typedef struct
 {
@@ -120,6 +184,26 @@ typedef struct
     osal_id_t                 EVS_SharedDataMutexID;
     CFE_ES_AppId_t            EVS_AppID;
 
+    /*
+    ** Deferred event processing, indexed the same as AppData
+    */
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+    EVS_DeferredQueue_t DeferredQueue[CFE_PLATFORM_ES_MAX_APPLICATIONS];
+#endif
+    uint32              DeferredPending;       /* Nonzero while a wakeup of the deferred task is outstanding */
+    uint32              DeferredOverflowCount; /* Events discarded because a queue was full */
+    bool                DeferredActive;        /* Events from registered apps are being queued */
+    osal_id_t           DeferredSemID;
+    osal_id_t           DeferredMutexID;
+    CFE_ES_TaskId_t     DeferredTaskID;
+
+    /*
+    ** Binary event format IDs by format string address, invalidated
+    ** as a whole by incrementing the generation
+    */
+    EVS_FormatIdCacheEntry_t FormatIdCache[CFE_EVS_FORMAT_ID_CACHE_SIZE];
+    uint32                   FormatIdGeneration;
+
 } CFE_EVS_Global_t;
 
 /*
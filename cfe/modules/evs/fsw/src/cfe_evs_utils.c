@@ -30,7 +30,9 @@
 
 /* Include Files */
 #include "cfe_evs_module_all.h" /* All EVS internal definitions and API */
+#include "osapi-atomic.h"
 
+#include <stddef.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -190,6 +192,13 @@ int32 EVS_NotRegistered(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t CallerID)
     return (CFE_EVS_APP_NOT_REGISTERED);
 }
 
+/* EVS_IsTypeEnabled() relies on the event type mask bits being in event type order */
+CompileTimeAssert(CFE_EVS_DEBUG_BIT == (1 << (CFE_EVS_EventType_DEBUG - CFE_EVS_EventType_DEBUG)) &&
+                      CFE_EVS_INFORMATION_BIT == (1 << (CFE_EVS_EventType_INFORMATION - CFE_EVS_EventType_DEBUG)) &&
+                      CFE_EVS_ERROR_BIT == (1 << (CFE_EVS_EventType_ERROR - CFE_EVS_EventType_DEBUG)) &&
+                      CFE_EVS_CRITICAL_BIT == (1 << (CFE_EVS_EventType_CRITICAL - CFE_EVS_EventType_DEBUG)),
+                  EVS_EventTypeBitOrder);
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_IsFiltered
@@ -201,118 +210,168 @@ int32 EVS_NotRegistered(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t CallerID)
 bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 {
     EVS_BinFilter_t *FilterPtr;
-    bool             Filtered = false;
+    bool             Filtered;
+    uint16           Count;
     char             AppName[OS_MAX_API_NAME];
 
-    if (AppDataPtr->ActiveFlag == false)
+    /* Is this type of event enabled for this application? */
+    if (!EVS_IsTypeEnabled(AppDataPtr, EventType))
     {
-        /* All events are disabled for this application */
-        Filtered = true;
+        return true;
     }
-    else
-        switch (EventType)
+
+    FilterPtr = EVS_FindEventID(EventID, AppDataPtr);
+
+    /* Does this event ID have an event filter table entry? */
+    if (FilterPtr == NULL)
+    {
+        return false;
+    }
+
+    /*
+     * Maintain event iteration count.  Apps may send the same event from more
+     * than one task, so each sender claims a distinct count value.
+     */
+    Count = OS_AtomicLoad16(&FilterPtr->Count);
+    do
+    {
+        if (Count >= CFE_EVS_MAX_FILTER_COUNT)
         {
-            case CFE_EVS_EventType_DEBUG:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_DEBUG_BIT) == 0)
-                {
-                    /* Debug events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_INFORMATION:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_INFORMATION_BIT) == 0)
-                {
-                    /* Informational events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_ERROR:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_ERROR_BIT) == 0)
-                {
-                    /* Error events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            case CFE_EVS_EventType_CRITICAL:
-
-                if ((AppDataPtr->EventTypesActiveFlag & CFE_EVS_CRITICAL_BIT) == 0)
-                {
-                    /* Critical events are disabled for this application */
-                    Filtered = true;
-                }
-                break;
-
-            default:
-
-                /* Invalid Event Type */
-                Filtered = true;
-                break;
+            /* Filter is locked until reset */
+            break;
         }
+    } while (!OS_AtomicCompareExchange16(&FilterPtr->Count, &Count, Count + 1));
 
-    /* Is this type of event enabled for this application? */
-    if (Filtered == false)
+    /* This iteration of the event ID is filtered if any masked bit of its count is set */
+    Filtered = ((FilterPtr->Mask & Count) != 0);
+
+    /* Is it time to lock this filter? */
+    if (Count == (CFE_EVS_MAX_FILTER_COUNT - 1))
     {
-        FilterPtr = EVS_FindEventID(EventID, AppDataPtr->BinFilters);
+        CFE_ES_GetAppName(AppName, EVS_AppDataGetID(AppDataPtr), sizeof(AppName));
+
+        EVS_SendEvent(CFE_EVS_FILTER_MAX_EID, CFE_EVS_EventType_INFORMATION,
+                      "Max filter count reached, AppName = %s, EventID = 0x%08x: Filter locked until reset",
+                      AppName, (unsigned int)EventID);
+    }
+
+    return (Filtered);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_FilterHash
+ *
+ * Internal helper routine only, not part of API.
+ *
+ * Returns the first hash index slot to probe for an event ID.  Event IDs are
+ * usually small and sequential, so they are spread by a multiplicative hash.
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32 EVS_FilterHash(uint16 EventID)
+{
+    return (((uint32)EventID * 0x9E3779B1) >> 16) & (CFE_EVS_FILTER_HASH_SIZE - 1);
+}
 
-        /* Does this event ID have an event filter table entry? */
-        if (FilterPtr != NULL)
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_FindEventID
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_AppData_t *AppDataPtr)
+{
+    EVS_BinFilter_t *FilterPtr;
+    uint32           Hash;
+    uint32           Probes;
+    uint8            SlotRef;
+
+    /*
+     * Linear probing.  The probe count is bounded so a lookup that races
+     * with a rebuild of the index cannot loop, at worst it misses the filter.
+     */
+    Hash = EVS_FilterHash(EventID);
+    for (Probes = 0; Probes < CFE_EVS_FILTER_HASH_SIZE; ++Probes)
+    {
+        SlotRef = AppDataPtr->FilterHash[Hash];
+        if (SlotRef == 0 || SlotRef > CFE_PLATFORM_EVS_MAX_EVENT_FILTERS)
         {
-            if ((FilterPtr->Mask & FilterPtr->Count) != 0)
-            {
-                /* This iteration of the event ID is filtered */
-                Filtered = true;
-            }
+            break;
+        }
 
-            if (FilterPtr->Count < CFE_EVS_MAX_FILTER_COUNT)
-            {
-                /* Maintain event iteration count */
-                FilterPtr->Count++;
-
-                /* Is it time to lock this filter? */
-                if (FilterPtr->Count == CFE_EVS_MAX_FILTER_COUNT)
-                {
-                    CFE_ES_GetAppName(AppName, EVS_AppDataGetID(AppDataPtr), sizeof(AppName));
-
-                    EVS_SendEvent(CFE_EVS_FILTER_MAX_EID, CFE_EVS_EventType_INFORMATION,
-                                  "Max filter count reached, AppName = %s, EventID = 0x%08x: Filter locked until reset",
-                                  AppName, (unsigned int)EventID);
-                }
-            }
+        FilterPtr = &AppDataPtr->BinFilters[SlotRef - 1];
+        if (FilterPtr->EventID == EventID)
+        {
+            return FilterPtr;
         }
+
+        Hash = (Hash + 1) & (CFE_EVS_FILTER_HASH_SIZE - 1);
     }
 
-    return (Filtered);
+    return ((EVS_BinFilter_t *)NULL);
 }
 
 /*----------------------------------------------------------------
  *
- * Function: EVS_FindEventID
+ * Function: EVS_FindFreeFilter
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray)
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr)
 {
     uint32 i;
 
     for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
     {
-        if (FilterArray[i].EventID == EventID)
+        if (AppDataPtr->BinFilters[i].EventID == (uint16)CFE_EVS_FREE_SLOT)
         {
-            return (&FilterArray[i]);
+            return (&AppDataPtr->BinFilters[i]);
         }
     }
 
     return ((EVS_BinFilter_t *)NULL);
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_RebuildFilterHash
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_RebuildFilterHash(EVS_AppData_t *AppDataPtr)
+{
+    uint8  FilterHash[CFE_EVS_FILTER_HASH_SIZE];
+    uint32 Hash;
+    uint32 i;
+
+    memset(FilterHash, 0, sizeof(FilterHash));
+
+    /*
+     * Insert in array order, so if an event ID appears more than once the
+     * lookup finds the first record, the same as a linear search would.
+     */
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        if (AppDataPtr->BinFilters[i].EventID != (uint16)CFE_EVS_FREE_SLOT)
+        {
+            Hash = EVS_FilterHash(AppDataPtr->BinFilters[i].EventID);
+            while (FilterHash[Hash] != 0)
+            {
+                Hash = (Hash + 1) & (CFE_EVS_FILTER_HASH_SIZE - 1);
+            }
+            FilterHash[Hash] = i + 1;
+        }
+    }
+
+    memcpy(AppDataPtr->FilterHash, FilterHash, sizeof(AppDataPtr->FilterHash));
+}
+
 /*----------------------------------------------------------------
  *
  * Function: EVS_EnableTypes
@@ -356,9 +415,15 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask)
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
 {
-    CFE_EVS_LongEventTlm_t  LongEventTlm;  /* The "long" flavor is always generated, as this is what is logged */
-    CFE_EVS_ShortEventTlm_t ShortEventTlm; /* The "short" flavor is only generated if selected */
-    int                     ExpandedLength;
+    CFE_EVS_LongEventTlm_t LongEventTlm; /* The "long" flavor is always generated, as this is what is logged */
+    int                    ExpandedLength;
+
+    /* Events that cannot be sent in binary format fall back to the long format below */
+    if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_BINARY &&
+        EVS_GenerateBinaryEventTelemetry(AppDataPtr, EventID, EventType, TimeStamp, MsgSpec, ArgPtr))
+    {
+        return;
+    }
 
     /* Initialize EVS event packets */
     CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
@@ -371,38 +436,217 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
     ExpandedLength =
         vsnprintf((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message), MsgSpec, ArgPtr);
 
+    EVS_SendEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, TimeStamp, NULL);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_GenerateBinaryEventTelemetry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_GenerateBinaryEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                                      const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr)
+{
+    CFE_EVS_LongEventTlm_t   LongEventTlm;
+    CFE_EVS_BinaryEventTlm_t BinaryEventTlm;
+    char                     CapturedData[CFE_EVS_DEFERRED_DATA_SIZE];
+    int                      ExpandedLength;
+    bool                     IsPacked;
+    va_list                  ArgCopy;
+
+    /* The caller still needs the arguments if they cannot be packed */
+    va_copy(ArgCopy, ArgPtr);
+    IsPacked = EVS_DeferredCapture(CapturedData, MsgSpec, ArgCopy) &&
+               EVS_PackBinaryEvent(&BinaryEventTlm, MsgSpec, CapturedData);
+    va_end(ArgCopy);
+
+    if (!IsPacked)
+    {
+        return false;
+    }
+
+    CFE_MSG_Init(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_LONG_EVENT_MSG_MID),
+                 sizeof(LongEventTlm));
+    LongEventTlm.Payload.PacketID.EventID   = EventID;
+    LongEventTlm.Payload.PacketID.EventType = EventType;
+
+    /* The text is only expanded on board if it is logged or sent out a port */
+    if (EVS_EventTextNeeded())
+    {
+        ExpandedLength = EVS_DeferredFormat((char *)LongEventTlm.Payload.Message, sizeof(LongEventTlm.Payload.Message),
+                                            CapturedData);
+    }
+    else
+    {
+        LongEventTlm.Payload.Message[0] = 0;
+        ExpandedLength                  = 0;
+    }
+
+    EVS_SendEventTelemetry(AppDataPtr, &LongEventTlm, ExpandedLength, TimeStamp, &BinaryEventTlm);
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_EventTextNeeded
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_EventTextNeeded(void)
+{
+    /*
+     * The log state is read without the mutex, as a hint only.  If it changes
+     * before EVS_AddLog(), one entry is logged without its text.
+     */
+    return (CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort != 0 ||
+            CFE_EVS_Global.EVS_LogPtr->LogFullFlag == false ||
+            CFE_EVS_Global.EVS_LogPtr->LogMode != CFE_EVS_LogMode_DISCARD);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_GetFormatID
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32 EVS_GetFormatID(const char *MsgSpec)
+{
+    EVS_FormatIdCacheEntry_t *EntryPtr;
+    cpuaddr                   Address;
+    uint32                    Generation;
+    uint32                    Sequence;
+    uint32                    FormatID;
+    bool                      IsMatch;
+
+    Address    = (cpuaddr)MsgSpec;
+    EntryPtr   = &CFE_EVS_Global.FormatIdCache[(Address ^ (Address >> 6)) & (CFE_EVS_FORMAT_ID_CACHE_SIZE - 1)];
+    Generation = OS_AtomicLoad32(&CFE_EVS_Global.FormatIdGeneration);
+
+    /* The entry is only used if it was not being written while it was read */
+    Sequence = OS_AtomicLoad32(&EntryPtr->Sequence);
+    IsMatch  = ((Sequence & 1) == 0 && EntryPtr->MsgSpec == MsgSpec && EntryPtr->Generation == Generation);
+    FormatID = EntryPtr->FormatID;
+    OS_AtomicThreadFence();
+    if (IsMatch && OS_AtomicLoad32(&EntryPtr->Sequence) == Sequence)
+    {
+        return FormatID;
+    }
+
+    /* The ground identifies the format string by the same CRC, computed over the build's event format catalog */
+    FormatID = CFE_ES_CalculateCRC(MsgSpec, strlen(MsgSpec), 0, CFE_MISSION_ES_CRC_32);
+
+    /* One writer at a time, a sender that finds the entry busy does not wait for it */
+    if ((Sequence & 1) == 0 && OS_AtomicCompareExchange32(&EntryPtr->Sequence, &Sequence, Sequence + 1))
+    {
+        EntryPtr->MsgSpec    = MsgSpec;
+        EntryPtr->Generation = Generation;
+        EntryPtr->FormatID   = FormatID;
+        OS_AtomicStore32(&EntryPtr->Sequence, Sequence + 2);
+    }
+
+    return FormatID;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_PackBinaryEvent
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+bool EVS_PackBinaryEvent(CFE_EVS_BinaryEventTlm_t *BinaryEventTlmPtr, const char *MsgSpec, const char *CapturedData)
+{
+    int32 ArgLength;
+
+    ArgLength = EVS_DeferredPackArgs(BinaryEventTlmPtr->Payload.Args, sizeof(BinaryEventTlmPtr->Payload.Args),
+                                     CapturedData);
+    if (ArgLength < 0)
+    {
+        return false;
+    }
+
+    BinaryEventTlmPtr->Payload.FormatID  = EVS_GetFormatID(MsgSpec);
+    BinaryEventTlmPtr->Payload.ArgLength = ArgLength;
+    BinaryEventTlmPtr->Payload.Spare     = 0;
+
+    return true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: EVS_SendEventTelemetry
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlmPtr, int ExpandedLength,
+                            const CFE_TIME_SysTime_t *TimeStamp, CFE_EVS_BinaryEventTlm_t *BinaryEventTlmPtr)
+{
+    CFE_EVS_ShortEventTlm_t  ShortEventTlm; /* The "short" flavor is only generated if selected */
+    CFE_EVS_MsgFormat_Enum_t MessageFormatMode;
+
     /*
      * If vsnprintf is bigger than message size, mark with truncation character
      * Note negative returns (error from vsnprintf) will just leave the message as-is
      */
-    if (ExpandedLength >= (int)sizeof(LongEventTlm.Payload.Message))
+    if (ExpandedLength >= (int)sizeof(LongEventTlmPtr->Payload.Message))
     {
         /* Mark character before zero terminator to indicate truncation */
-        LongEventTlm.Payload.Message[sizeof(LongEventTlm.Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
+        LongEventTlmPtr->Payload.Message[sizeof(LongEventTlmPtr->Payload.Message) - 2] = CFE_EVS_MSG_TRUNCATED;
         CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter++;
     }
 
     /* Obtain task and system information */
-    CFE_ES_GetAppName((char *)LongEventTlm.Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
-                      sizeof(LongEventTlm.Payload.PacketID.AppName));
-    LongEventTlm.Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
-    LongEventTlm.Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
+    CFE_ES_GetAppName((char *)LongEventTlmPtr->Payload.PacketID.AppName, EVS_AppDataGetID(AppDataPtr),
+                      sizeof(LongEventTlmPtr->Payload.PacketID.AppName));
+    LongEventTlmPtr->Payload.PacketID.SpacecraftID = CFE_PSP_GetSpacecraftId();
+    LongEventTlmPtr->Payload.PacketID.ProcessorID  = CFE_PSP_GetProcessorId();
 
     /* Set the packet timestamp */
-    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), *TimeStamp);
+    CFE_MSG_SetMsgTime(CFE_MSG_PTR(LongEventTlmPtr->TelemetryHeader), *TimeStamp);
 
     /* Write event to the event log */
-    EVS_AddLog(&LongEventTlm);
+    EVS_AddLog(LongEventTlmPtr);
 
     /* Send event via selected ports */
-    EVS_SendViaPorts(&LongEventTlm);
+    EVS_SendViaPorts(LongEventTlmPtr);
+
+    MessageFormatMode = CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode;
+    if (MessageFormatMode == CFE_EVS_MsgFormat_BINARY && BinaryEventTlmPtr == NULL)
+    {
+        /* The arguments of this event could not be packed, so send it in long format instead */
+        MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+    }
 
-    if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_LONG)
+    if (MessageFormatMode == CFE_EVS_MsgFormat_LONG)
     {
         /* Send long event via SoftwareBus */
-        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlm.TelemetryHeader), true);
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(LongEventTlmPtr->TelemetryHeader), true);
+    }
+    else if (MessageFormatMode == CFE_EVS_MsgFormat_BINARY)
+    {
+        /*
+         * The binary format event message was packed by the caller, the rest
+         * is the same as the long format message.  Only the used part of the
+         * arguments is sent.
+         */
+        CFE_MSG_Init(CFE_MSG_PTR(BinaryEventTlmPtr->TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_BINARY_EVENT_MSG_MID),
+                     offsetof(CFE_EVS_BinaryEventTlm_t, Payload.Args) + BinaryEventTlmPtr->Payload.ArgLength);
+        CFE_MSG_SetMsgTime(CFE_MSG_PTR(BinaryEventTlmPtr->TelemetryHeader), *TimeStamp);
+        BinaryEventTlmPtr->Payload.PacketID = LongEventTlmPtr->Payload.PacketID;
+        CFE_SB_TransmitMsg(CFE_MSG_PTR(BinaryEventTlmPtr->TelemetryHeader), true);
     }
-    else if (CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
+    else if (MessageFormatMode == CFE_EVS_MsgFormat_SHORT)
     {
         /*
          * Initialize the short format event message from data that was already
@@ -413,7 +657,7 @@ void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint1
         CFE_MSG_Init(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), CFE_SB_ValueToMsgId(CFE_EVS_SHORT_EVENT_MSG_MID),
                      sizeof(ShortEventTlm));
         CFE_MSG_SetMsgTime(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), *TimeStamp);
-        ShortEventTlm.Payload.PacketID = LongEventTlm.Payload.PacketID;
+        ShortEventTlm.Payload.PacketID = LongEventTlmPtr->Payload.PacketID;
         CFE_SB_TransmitMsg(CFE_MSG_PTR(ShortEventTlm.TelemetryHeader), true);
     }
 
@@ -182,6 +182,26 @@ int32 EVS_GetApplicationInfo(EVS_AppData_t **AppDataOut, const char *pAppName);
  */
 int32 EVS_NotRegistered(EVS_AppData_t *AppDataPtr, CFE_ES_AppId_t CallerID);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check if an event type is enabled for an app
+ *
+ * This is the inexpensive first stage of EVS_IsFiltered(), it only checks
+ * the app's active flag and the bit for the event type in its type mask.
+ * The event types are numbered from 1 and their mask bits from bit 0, so
+ * the bit for a type is found by a shift rather than a lookup.
+ *
+ * @param[in]   AppDataPtr   pointer to app table entry
+ * @param[in]   EventType    the event type
+ * @returns true if events of this type may be sent, false if they are disabled or invalid
+ */
+static inline bool EVS_IsTypeEnabled(const EVS_AppData_t *AppDataPtr, uint16 EventType)
+{
+    uint16 TypeIndex = EventType - CFE_EVS_EventType_DEBUG;
+
+    return (AppDataPtr->ActiveFlag && TypeIndex < 4 && (AppDataPtr->EventTypesActiveFlag & (1 << TypeIndex)) != 0);
+}
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Check if event is filtered
@@ -196,10 +216,28 @@ bool EVS_IsFiltered(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType)
 /**
  * @brief Find the filter record corresponding to the given event ID
  *
- * This routine searches and returns an index to the given Event ID with the
- * given application filter array.
+ * This routine looks up the given Event ID in the application's filter
+ * hash index and returns the corresponding filter record, or NULL if the
+ * application has no filter for the event.
+ */
+EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an unused filter record
+ *
+ * @returns Pointer to the first free filter record of the application, or NULL if all are in use
+ */
+EVS_BinFilter_t *EVS_FindFreeFilter(EVS_AppData_t *AppDataPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Rebuild the filter hash index of an application
+ *
+ * Must be called whenever the EventID of any filter record changes.
+ * Filter counters and masks may be changed without rebuilding.
  */
-EVS_BinFilter_t *EVS_FindEventID(uint16 EventID, EVS_BinFilter_t *FilterArray);
+void EVS_RebuildFilterHash(EVS_AppData_t *AppDataPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -227,10 +265,89 @@ void EVS_DisableTypes(EVS_AppData_t *AppDataPtr, uint8 BitMask);
  * If configured for long events the same message is sent on the software bus as well.
  * If configured for short events, a separate short message is generated using a subset
  * of the information from the long message.
+ * If configured for binary events, a separate binary message is generated from
+ * the format string ID and the packed arguments.
  */
 void EVS_GenerateEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
                                 const CFE_TIME_SysTime_t *Time, const char *MsgSpec, va_list ArgPtr);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Complete and send an event whose message text is already formatted
+ *
+ * This is the common tail of EVS_GenerateEventTelemetry() and deferred event
+ * processing.  The caller initializes the long event packet and fills in the
+ * event ID, type and message text; this routine marks truncation, fills in the
+ * remaining packet fields, then logs and sends the event per the current
+ * configuration and updates the send counters.
+ *
+ * @param AppDataPtr        the sending application
+ * @param LongEventTlmPtr   the partially filled long event packet
+ * @param ExpandedLength    full length of the formatted message, as returned by vsnprintf()
+ * @param TimeStamp         the event time
+ * @param BinaryEventTlmPtr the binary event packet from EVS_PackBinaryEvent(), or NULL if
+ *                          there is none, in which case binary format sends the long packet
+ */
+void EVS_SendEventTelemetry(EVS_AppData_t *AppDataPtr, CFE_EVS_LongEventTlm_t *LongEventTlmPtr, int ExpandedLength,
+                            const CFE_TIME_SysTime_t *TimeStamp, CFE_EVS_BinaryEventTlm_t *BinaryEventTlmPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Generate and send a binary format event
+ *
+ * Used by EVS_GenerateEventTelemetry() in binary format mode.  Kept separate
+ * so the buffers needed to capture and pack the arguments are only on the
+ * stack when the binary format is selected.
+ *
+ * @return true if the event was sent, false if its arguments cannot be packed,
+ *         in which case ArgPtr has not been consumed
+ */
+bool EVS_GenerateBinaryEventTelemetry(EVS_AppData_t *AppDataPtr, uint16 EventID, uint16 EventType,
+                                      const CFE_TIME_SysTime_t *TimeStamp, const char *MsgSpec, va_list ArgPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Check whether the expanded text of an event is needed on board
+ *
+ * The text is needed if any output port is enabled, or if the local event
+ * log will store the event.  Otherwise a binary format event does not need
+ * to be expanded at all.
+ *
+ * @return true if the text is needed
+ */
+bool EVS_EventTextNeeded(void);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Get the binary format ID of a format string
+ *
+ * The ID is the CRC-32 of the format string.  It is cached by the address of
+ * the format string, so the CRC is normally computed once per call site.
+ * The cache is invalidated when an application is cleaned up, as its format
+ * strings may be unloaded.
+ *
+ * @param MsgSpec format string passed to the event API
+ *
+ * @return the format ID
+ */
+uint32 EVS_GetFormatID(const char *MsgSpec);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * @brief Pack the payload of a binary format event message
+ *
+ * Fills in the format string ID and the packed arguments from a format
+ * string and arguments captured by EVS_DeferredCapture().  The packet
+ * header and ID are filled in by EVS_SendEventTelemetry().
+ *
+ * @param BinaryEventTlmPtr the binary event packet to fill in
+ * @param MsgSpec           format string passed to the event API, identifies the format ID
+ * @param CapturedData      captured format string and arguments
+ *
+ * @return true if packed, false if the arguments do not fit
+ */
+bool EVS_PackBinaryEvent(CFE_EVS_BinaryEventTlm_t *BinaryEventTlmPtr, const char *MsgSpec, const char *CapturedData);
+
 /*---------------------------------------------------------------------------------------*/
 /**
  * @brief Internal function to send an event
@@ -47,15 +47,30 @@
 #error CFE_PLATFORM_EVS_DEFAULT_LOG_MODE can only be 0 (Overwrite) or 1 (Discard)!
 #endif
 
-#if (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_LONG) && \
-    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_SHORT)
-#error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_MsgFormat_LONG or CFE_EVS_MsgFormat_SHORT !
+#if (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_LONG) &&  \
+    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_SHORT) && \
+    (CFE_PLATFORM_EVS_DEFAULT_MSG_FORMAT_MODE != CFE_EVS_MsgFormat_BINARY)
+#error CFE_EVS_DEFAULT_MSG_FORMAT can only be CFE_EVS_MsgFormat_LONG, CFE_EVS_MsgFormat_SHORT or CFE_EVS_MsgFormat_BINARY !
 #endif
 
 #if CFE_PLATFORM_EVS_PORT_DEFAULT > 0x0F
 #error CFE_PLATFORM_EVS_PORT_DEFAULT cannot be greater than 0x0F!
 #endif
 
+#if (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH & (CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH - 1)) != 0
+#error CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH must be zero or a power of two!
+#endif
+
+/* The ring sequence scheme needs at least two slots to tell a full ring from an empty one */
+#if CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH == 1
+#error CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH cannot be 1, use 0 or at least 2!
+#endif
+
+/* The filter hash index stores slot numbers in a uint8 and must be at most half full */
+#if CFE_PLATFORM_EVS_MAX_EVENT_FILTERS > 128
+#error CFE_PLATFORM_EVS_MAX_EVENT_FILTERS cannot be greater than 128!
+#endif
+
 /*
 ** Validate task stack size...
 */
@@ -136,6 +136,11 @@ static const UT_SoftwareBusSnapshot_Entry_t UT_EVS_SHORTFMT_SNAPSHOTDATA = {
     .SnapshotOffset = offsetof(CFE_EVS_ShortEventTlm_t, Payload.PacketID.EventID),
     .SnapshotSize   = sizeof(uint16)};
 
+static const UT_SoftwareBusSnapshot_Entry_t UT_EVS_BINFMT_SNAPSHOTDATA = {
+    .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_BINARY_EVENT_MSG_MID),
+    .SnapshotOffset = offsetof(CFE_EVS_BinaryEventTlm_t, Payload.PacketID.EventID),
+    .SnapshotSize   = sizeof(uint16)};
+
 typedef struct
 {
     uint16 EventID;
@@ -238,6 +243,10 @@ void UtTest_Setup(void)
     UT_ADD_TEST(Test_FilterCmd);
     UT_ADD_TEST(Test_InvalidCmd);
     UT_ADD_TEST(Test_Misc);
+    UT_ADD_TEST(Test_DeferredFormat);
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+    UT_ADD_TEST(Test_Deferred);
+#endif
 }
 
 /*
@@ -558,6 +567,14 @@ void Test_FilterRegistration(void)
 
     CFE_UtAssert_SUCCESS(CFE_EVS_Register(filter, CFE_PLATFORM_EVS_MAX_EVENT_FILTERS + 1, CFE_EVS_EventFilter_BINARY));
 
+    /* Every registered filter is found through the hash index, the excess one is not */
+    for (i = 0; i < CFE_PLATFORM_EVS_MAX_EVENT_FILTERS; i++)
+    {
+        UtAssert_ADDRESS_EQ(EVS_FindEventID(i, AppDataPtr), &AppDataPtr->BinFilters[i]);
+    }
+    UtAssert_NULL(EVS_FindEventID(CFE_PLATFORM_EVS_MAX_EVENT_FILTERS, AppDataPtr));
+    UtAssert_NULL(EVS_FindFreeFilter(AppDataPtr));
+
     CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter = 0;
 
     /* Send 1st information message, should get through */
@@ -574,7 +591,7 @@ void Test_FilterRegistration(void)
 
     /* Send last information message, which should cause filtering to lock */
     UT_InitData();
-    FilterPtr        = EVS_FindEventID(0, (EVS_BinFilter_t *)AppDataPtr->BinFilters);
+    FilterPtr        = EVS_FindEventID(0, AppDataPtr);
     FilterPtr->Count = CFE_EVS_MAX_FILTER_COUNT - 1;
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "OK"));
     UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageSendCounter, 3);
@@ -678,6 +695,8 @@ void Test_Format(void)
     CFE_ES_AppId_t       AppID;
     UT_EVS_MSGInitData_t MsgData;
     CFE_MSG_Message_t *  MsgSend;
+    const char *         FormatIdSpec = "Format ID check %d";
+    uint8                SavedOutputPort;
 
     /* Get a local ref to the "current" AppData table entry */
     EVS_GetCurrentContext(&AppDataPtr, &AppID);
@@ -776,8 +795,59 @@ void Test_Format(void)
      */
     CFE_UtAssert_SUCCESS(CFE_EVS_SendTimedEvent(time, 0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
 
+    /* Test set event format mode command to select binary format, reports implicitly via a binary event */
+    UT_InitData();
+    modecmd.Payload.MsgFormat = CFE_EVS_MsgFormat_BINARY;
+    UT_EVS_DoDispatchCheckEvents_Impl(&modecmd, sizeof(modecmd), UT_TPID_CFE_EVS_CMD_SET_EVENT_FORMAT_MODE_CC,
+                                      &UT_EVS_BINFMT_SNAPSHOTDATA, &UT_EVS_EventBuf);
+    UtAssert_UINT32_EQ(UT_EVS_EventBuf.EventID, CFE_EVS_SETEVTFMTMOD_EID);
+
+    /* Test binary event sent with only the used part of the arguments */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_MSG_Init), UT_EVS_MSGInitHook, &MsgData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Binary format check %d", 1));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(MsgData.MsgId, UT_EVS_BINFMT_SNAPSHOTDATA.MsgId));
+    UtAssert_UINT32_EQ(MsgData.Size, offsetof(CFE_EVS_BinaryEventTlm_t, Payload.Args) + sizeof(int32));
+
+    /* Test that the text of a binary event is not expanded when neither the log nor a port needs it */
+    UT_InitData();
+    SavedOutputPort                               = CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort  = 0;
+    CFE_EVS_Global.EVS_LogPtr->LogFullFlag        = true;
+    CFE_EVS_Global.EVS_LogPtr->LogMode            = CFE_EVS_LogMode_DISCARD;
+    CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter = 0;
+    UtAssert_BOOL_FALSE(EVS_EventTextNeeded());
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "Binary format check %d", 2));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_LogPtr->LogOverflowCounter, 1);
+    CFE_EVS_Global.EVS_LogPtr->LogMode = CFE_EVS_LogMode_OVERWRITE;
+    UtAssert_BOOL_TRUE(EVS_EventTextNeeded());
+    CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort = CFE_EVS_PORT1_BIT;
+    CFE_EVS_Global.EVS_LogPtr->LogMode           = CFE_EVS_LogMode_DISCARD;
+    UtAssert_BOOL_TRUE(EVS_EventTextNeeded());
+    CFE_EVS_Global.EVS_TlmPkt.Payload.OutputPort = SavedOutputPort;
+    CFE_EVS_Global.EVS_LogPtr->LogFullFlag       = false;
+    CFE_EVS_Global.EVS_LogPtr->LogMode           = CFE_EVS_LogMode_OVERWRITE;
+
+    /* Test that the format ID is computed once per format string, until an app is cleaned up */
+    UT_InitData();
+    EVS_GetFormatID(FormatIdSpec);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    ++CFE_EVS_Global.FormatIdGeneration;
+    EVS_GetFormatID(FormatIdSpec);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 2);
+
+    /* Test binary event falls back to long format when the arguments cannot be packed */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_MSG_Init), UT_EVS_MSGInitHook, &MsgData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "%1$d", 1));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+    UtAssert_BOOL_TRUE(CFE_SB_MsgId_Equal(MsgData.MsgId, LongFmtSnapshotData.MsgId));
+
     /* Force an invalid format and send for code coverage */
-    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG + 1;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_BINARY + 1;
     CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(0, CFE_EVS_EventType_INFORMATION, "%s", long_msg));
 }
 
@@ -1957,3 +2027,172 @@ void Test_Misc(void)
     }
     UtAssert_UINT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
 }
+
+/*
+** Test expanding captured event arguments
+*/
+void Test_DeferredFormat(void)
+{
+    char Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    UtPrintf("Begin Test Deferred Format");
+
+    /* Test expanding a message into a buffer that is too small, and an invalid format */
+    UtAssert_INT32_EQ(EVS_DeferredFormat(Message, 4, "abc%%def"), 7);
+    UtAssert_STRINGBUF_EQ(Message, sizeof(Message), "abc", -1);
+    UtAssert_INT32_EQ(EVS_DeferredFormat(Message, sizeof(Message), "bad %q"), -1);
+}
+
+#if CFE_EVS_DEFERRED_QUEUE_SIZE > 0
+/*
+** Test deferred event processing
+*/
+void Test_Deferred(void)
+{
+    EVS_AppData_t *                AppDataPtr;
+    CFE_ES_AppId_t                 AppID;
+    CFE_TIME_SysTime_t             Time = {0, 0};
+    char                           Message[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char                           LongString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH + 10];
+    const char                     Unterminated[3] = {'a', 'b', 'c'};
+    const uint8                    ExpectedArgs[]  = {0x01, 0xFF, 0xFE, 0x01, 0x02, 0x03, 0x04, 'a', 'b', 0};
+    uint8                          BinaryArgs[sizeof(ExpectedArgs)];
+    uint32                         i;
+    UT_SoftwareBusSnapshot_Entry_t MsgSnapshotData = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_LONG_EVENT_MSG_MID),
+                                                      .SnapshotBuffer = Message,
+                                                      .SnapshotOffset = offsetof(CFE_EVS_LongEventTlm_t, Payload.Message),
+                                                      .SnapshotSize   = sizeof(Message)};
+    UT_SoftwareBusSnapshot_Entry_t HK_SnapshotData = {.MsgId = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_HK_TLM_MID)};
+    UT_SoftwareBusSnapshot_Entry_t BinarySnapshotData = {
+        .MsgId          = CFE_SB_MSGID_WRAP_VALUE(CFE_EVS_BINARY_EVENT_MSG_MID),
+        .SnapshotBuffer = BinaryArgs,
+        .SnapshotOffset = offsetof(CFE_EVS_BinaryEventTlm_t, Payload.Args),
+        .SnapshotSize   = sizeof(BinaryArgs)};
+
+    UtPrintf("Begin Test Deferred");
+
+    memset(LongString, 'a', sizeof(LongString) - 1);
+    LongString[sizeof(LongString) - 1] = 0;
+
+    /* Start from a freshly registered app with informational events enabled */
+    UT_InitData();
+    EVS_GetCurrentContext(&AppDataPtr, &AppID);
+    CFE_UtAssert_SUCCESS(CFE_EVS_Register(NULL, 0, CFE_EVS_EventFilter_BINARY));
+    AppDataPtr->EventTypesActiveFlag |= CFE_EVS_INFORMATION_BIT;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+    EVS_DeferredQueueInit();
+
+    /* Test deferred init with resource creation failures */
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(EVS_DeferredInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(OS_MutSemCreate), 1, OS_ERROR);
+    UtAssert_INT32_EQ(EVS_DeferredInit(), CFE_STATUS_EXTERNAL_RESOURCE_FAIL);
+    UT_InitData();
+    UT_SetDeferredRetcode(UT_KEY(CFE_ES_CreateChildTask), 1, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_INT32_EQ(EVS_DeferredInit(), CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_BOOL_FALSE(CFE_EVS_Global.DeferredActive);
+
+    /* Test successful deferred init */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(EVS_DeferredInit());
+    UtAssert_BOOL_TRUE(CFE_EVS_Global.DeferredActive);
+
+    /* Test that events are queued rather than sent, with a single wakeup */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &MsgSnapshotData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(1, CFE_EVS_EventType_INFORMATION, "Deferred %d %s", -1, "one"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendTimedEvent(Time, 2, CFE_EVS_EventType_INFORMATION, "%05.1f|%-4x|%c|%%|%lu|%p",
+                                                2.5, 0xABu, 'z', 123456UL, (void *)NULL));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEventWithAppID(3, CFE_EVS_EventType_INFORMATION, AppID, "%*d|%.*s|%.*d|%.2s", -4,
+                                                    7, 2, "xyz", -1, 9, Unterminated));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Test processing the queued events, in order */
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 3);
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 3);
+    snprintf(LongString, sizeof(LongString), "%*d|%.*s|%.*d|%.2s", -4, 7, 2, "xyz", -1, 9, Unterminated);
+    UtAssert_STRINGBUF_EQ(Message, sizeof(Message), LongString, sizeof(LongString));
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 0);
+
+    /* Test formats that cannot be captured, which are formatted by the sender */
+    UT_InitData();
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &MsgSnapshotData);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "%Lf", (long double)1.5));
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 1);
+    UtAssert_STRINGBUF_EQ(Message, sizeof(Message), "1.500000", -1);
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "%1$d", 5));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "%ls", L"w"));
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(4, CFE_EVS_EventType_INFORMATION, "%s", (const char *)NULL));
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 3);
+
+    /* Test truncation of long messages, whether captured or formatted by the sender */
+    UT_InitData();
+    memset(LongString, 'a', sizeof(LongString) - 1);
+    LongString[sizeof(LongString) - 1]                    = 0;
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter = 0;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "%s", LongString));
+    CFE_UtAssert_SUCCESS(
+        CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "%s%s%s", LongString, LongString, LongString));
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 2);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.MessageTruncCounter, 2);
+
+    /* Test a queued event in binary format, the arguments are packed in big endian order */
+    UT_InitData();
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_BINARY;
+    memset(BinaryArgs, 0xFF, sizeof(BinaryArgs));
+    CFE_UtAssert_SUCCESS(
+        CFE_EVS_SendEvent(5, CFE_EVS_EventType_INFORMATION, "%hhu %hd %d %s", 1, -2, 0x01020304, "ab"));
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &BinarySnapshotData);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), 1);
+    UtAssert_MemCmp(BinaryArgs, ExpectedArgs, sizeof(ExpectedArgs), "Packed binary event arguments");
+    CFE_EVS_Global.EVS_TlmPkt.Payload.MessageFormatMode = CFE_EVS_MsgFormat_LONG;
+
+    /* Test queue overflow, reported and reset via housekeeping */
+    UT_InitData();
+    for (i = 0; i < CFE_EVS_DEFERRED_QUEUE_SIZE; ++i)
+    {
+        CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(6, CFE_EVS_EventType_INFORMATION, "Fill %u", (unsigned int)i));
+    }
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(6, CFE_EVS_EventType_INFORMATION, "Overflow"));
+    UtAssert_UINT32_EQ(CFE_EVS_Global.DeferredOverflowCount, 1);
+    UtAssert_UINT32_EQ(EVS_ProcessDeferredEvents(), CFE_EVS_DEFERRED_QUEUE_SIZE);
+
+    HK_SnapshotData.Count = 0;
+    UT_SetHookFunction(UT_KEY(CFE_SB_TransmitMsg), UT_SoftwareBusSnapshotHook, &HK_SnapshotData);
+    UtAssert_UINT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.DeferredOverflowCounter, 1);
+
+    CFE_EVS_Global.DeferredOverflowCount = CFE_EVS_MAX_EVENT_SEND_COUNT + 1;
+    UtAssert_UINT32_EQ(CFE_EVS_ReportHousekeepingCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.EVS_TlmPkt.Payload.DeferredOverflowCounter, CFE_EVS_MAX_EVENT_SEND_COUNT);
+
+    UtAssert_UINT32_EQ(CFE_EVS_ResetCountersCmd(NULL), CFE_STATUS_NO_COUNTER_INCREMENT);
+    UtAssert_UINT32_EQ(CFE_EVS_Global.DeferredOverflowCount, 0);
+
+    /* Test that the deferred task processes events until its semaphore fails */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(7, CFE_EVS_EventType_INFORMATION, "Task"));
+    UT_SetDeferredRetcode(UT_KEY(OS_BinSemTake), 2, OS_ERROR);
+    UtAssert_VOIDCALL(EVS_DeferredTask());
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+    UtAssert_BOOL_FALSE(CFE_EVS_Global.DeferredActive);
+
+    /* Test that events are sent directly once the task has stopped */
+    UT_InitData();
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(7, CFE_EVS_EventType_INFORMATION, "Direct"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    /* Test that application cleanup flushes queued events */
+    UT_InitData();
+    CFE_EVS_Global.DeferredActive = true;
+    CFE_UtAssert_SUCCESS(CFE_EVS_SendEvent(8, CFE_EVS_EventType_INFORMATION, "Cleanup"));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 0);
+    CFE_UtAssert_SUCCESS(CFE_EVS_CleanUpApp(AppID));
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 1);
+
+    CFE_EVS_Global.DeferredActive = false;
+}
+#endif
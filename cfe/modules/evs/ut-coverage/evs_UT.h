@@ -265,4 +265,36 @@ void Test_InvalidCmd(void);
 ******************************************************************************/
 void Test_Misc(void);
 
+/*****************************************************************************/
+/**
+** \brief Test expanding captured event arguments
+**
+** \par Description
+**        This function tests EVS_DeferredFormat with a short output buffer
+**        and an invalid conversion.  It does not need the deferred queues.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_DeferredFormat(void);
+
+/*****************************************************************************/
+/**
+** \brief Test deferred event processing
+**
+** \par Description
+**        This function tests queuing of events from registered applications
+**        and their later formatting and output by the deferred event task.
+**
+** \par Assumptions, External Events, and Notes:
+**        Only built when CFE_PLATFORM_EVS_DEFERRED_QUEUE_DEPTH is nonzero.
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_Deferred(void);
+
 #endif /* EVS_UT_H */
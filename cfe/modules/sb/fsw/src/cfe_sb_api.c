@@ -358,6 +358,7 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
     size_t                      BufDscSize;
     CFE_SB_RemovePipeCallback_t Args;
     uint16                      PendingEventID;
+    uint32                      i;
 
     Status         = CFE_SUCCESS;
     PendingEventID = 0;
@@ -398,6 +399,20 @@ int32 CFE_SB_DeletePipeFull(CFE_SB_PipeId_t PipeId, CFE_ES_AppId_t AppId)
         SysQueueId = PipeDscPtr->SysQueueId;
         BufDscPtr  = PipeDscPtr->LastBuffer;
 
+        /*
+         * Drop any buffers from CFE_SB_ReceiveBuffers() that the owner did not
+         * release, they are no longer valid once the pipe is deleted.
+         */
+        for (i = 0; i < CFE_SB_MAX_HELD_BUFFERS; ++i)
+        {
+            if (PipeDscPtr->HeldBuffers[i] != NULL)
+            {
+                CFE_SB_DecrBufUseCnt(PipeDscPtr->HeldBuffers[i]);
+                PipeDscPtr->HeldBuffers[i] = NULL;
+            }
+        }
+        PipeDscPtr->HeldBufferCount = 0;
+
         /*
          * Mark entry as "reserved" so other resources can be deleted
          * while the SB global is unlocked.  This prevents other tasks
@@ -1329,33 +1344,28 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount)
 {
-    int32             Status;
-    CFE_MSG_Size_t    Size  = 0;
-    CFE_SB_MsgId_t    MsgId = CFE_SB_INVALID_MSG_ID;
-    CFE_ES_TaskId_t   TskId;
-    char              FullName[(OS_MAX_API_NAME * 2)];
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SBR_RouteId_t RouteId;
-    uint16            PendingEventID;
+    int32                  Status;
+    CFE_SB_TransmitState_t TxState;
 
-    PendingEventID = 0;
-    BufDscPtr      = NULL;
-    RouteId        = CFE_SBR_INVALID_ROUTE_ID;
+    /* Header checks only look at the caller's message, so they do not need the lock */
+    Status = CFE_SB_TransmitMsgValidate(MsgPtr, &TxState);
 
-    Status = CFE_SB_TransmitMsgValidate(MsgPtr, &MsgId, &Size, &RouteId);
+    if (Status == CFE_SUCCESS)
+    {
+        /* get app id for loopback testing - this takes the ES lock, so do it before locking SB */
+        CFE_ES_GetAppID(&TxState.SenderAppId);
+    }
 
+    /*
+     * Everything from here until the unlock is done within a single critical section:
+     * the route lookup, the buffer allocation, and the enqueue to all destinations.
+     * No events are sent while locked - they are recorded in TxState and reported below.
+     */
     CFE_SB_LockSharedData(__func__, __LINE__);
 
-    if (Status == CFE_SUCCESS && CFE_SBR_IsValidRouteId(RouteId))
+    if (Status == CFE_SUCCESS)
     {
-        /* Get buffer - note this pre-initializes the returned buffer with
-         * a use count of 1, which refers to this task as it fills the buffer. */
-        BufDscPtr = CFE_SB_GetBufferFromPool(Size);
-        if (BufDscPtr == NULL)
-        {
-            PendingEventID = CFE_SB_GET_BUF_ERR_EID;
-            Status         = CFE_SB_BUF_ALOC_ERR;
-        }
+        Status = CFE_SB_TransmitMsgLocked(MsgPtr, IncrementSequenceCount, &TxState);
     }
 
     /*
@@ -1371,55 +1381,88 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
 
     CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-    /*
-     * If a buffer was obtained above, then copy the content into it
-     * and broadcast it to all subscribers in the route.
-     *
-     * Note - if there is no route / no subscribers, the "Status" will
-     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
-     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
-     * false.
-     *
-     * But if the descriptor is non-null it means the message is valid and
-     * there is a route to send it to.
-     */
-    if (BufDscPtr != NULL)
-    {
-        /* Copy actual message content into buffer and set its metadata */
-        memcpy(&BufDscPtr->Content, MsgPtr, Size);
-        BufDscPtr->MsgId        = MsgId;
-        BufDscPtr->ContentSize  = Size;
-        BufDscPtr->AutoSequence = IncrementSequenceCount;
-        CFE_MSG_GetType(MsgPtr, &BufDscPtr->ContentType);
+    /* Now actually send any events, after unlocking (do not call EVS with SB locked) */
+    CFE_SB_TransmitReportEvents(MsgPtr, &TxState);
 
-        /*
-         * This routine will use best-effort to send to all subscribers,
-         * increment the buffer use count for every successful delivery,
-         * and send an event/increment counter for any unsuccessful delivery.
-         */
-        CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+    return Status;
+}
 
-        /*
-         * The broadcast function consumes the buffer, so it should not be
-         * accessed in this function anymore
-         */
-        BufDscPtr = NULL;
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgs
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitMsgs(const CFE_MSG_Message_t *const *MsgPtrArray, uint32 Count,
+                                 bool IncrementSequenceCount, CFE_Status_t *StatusArray)
+{
+    CFE_Status_t           Status;
+    int32                  MsgStatus[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_TransmitState_t TxState[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_ES_AppId_t         SenderAppId;
+    uint32                 Start;
+    uint32                 BatchCount;
+    uint32                 i;
+
+    if (MsgPtrArray == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
     }
 
-    if (PendingEventID == CFE_SB_GET_BUF_ERR_EID)
+    Status = CFE_SUCCESS;
+
+    /* get app id for loopback testing - this takes the ES lock, so do it before locking SB */
+    CFE_ES_GetAppID(&SenderAppId);
+
+    for (Start = 0; Start < Count; Start += BatchCount)
     {
-        /* Get task id for events and Sender Info*/
-        CFE_ES_GetTaskID(&TskId);
+        BatchCount = Count - Start;
+        if (BatchCount > CFE_SB_TRANSMIT_BATCH_SIZE)
+        {
+            BatchCount = CFE_SB_TRANSMIT_BATCH_SIZE;
+        }
+
+        /* Header checks only look at the caller's messages, so they do not need the lock */
+        for (i = 0; i < BatchCount; ++i)
+        {
+            MsgStatus[i]           = CFE_SB_TransmitMsgValidate(MsgPtrArray[Start + i], &TxState[i]);
+            TxState[i].SenderAppId = SenderAppId;
+        }
+
+        /* The whole group is sent within a single critical section, see CFE_SB_TransmitMsg() */
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        for (i = 0; i < BatchCount; ++i)
+        {
+            if (MsgStatus[i] == CFE_SUCCESS)
+            {
+                MsgStatus[i] = CFE_SB_TransmitMsgLocked(MsgPtrArray[Start + i], IncrementSequenceCount, &TxState[i]);
+            }
+
+            if (MsgStatus[i] != CFE_SUCCESS)
+            {
+                CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+            }
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
 
-        if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
+        /* Now actually send any events, after unlocking (do not call EVS with SB locked) */
+        for (i = 0; i < BatchCount; ++i)
         {
-            CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                       "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
-                                       (unsigned int)CFE_SB_MsgIdToValue(MsgId), CFE_SB_GetAppTskName(TskId, FullName),
-                                       (int)Size);
+            CFE_SB_TransmitReportEvents(MsgPtrArray[Start + i], &TxState[i]);
 
-            /* clear the bit so the task may send this event again */
-            CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+            if (StatusArray != NULL)
+            {
+                StatusArray[Start + i] = MsgStatus[i];
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                Status = MsgStatus[i];
+            }
         }
     }
 
@@ -1434,223 +1477,383 @@ CFE_Status_t CFE_SB_TransmitMsg(const CFE_MSG_Message_t *MsgPtr, bool IncrementS
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
-                                 CFE_SBR_RouteId_t *RouteIdPtr)
+int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_TransmitState_t *TxState)
 {
-    CFE_ES_TaskId_t TskId;
-    char            FullName[(OS_MAX_API_NAME * 2)];
-    uint16          PendingEventID;
-    int32           Status;
+    int32 Status;
 
-    PendingEventID = 0;
-    Status         = CFE_SUCCESS;
+    memset(TxState, 0, sizeof(*TxState));
+    TxState->MsgId       = CFE_SB_INVALID_MSG_ID;
+    TxState->RouteId     = CFE_SBR_INVALID_ROUTE_ID;
+    TxState->SenderAppId = CFE_ES_APPID_UNDEFINED;
+
+    Status = CFE_SUCCESS;
 
     /* check input parameter */
     if (MsgPtr == NULL)
     {
-        PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
-        Status         = CFE_SB_BAD_ARGUMENT;
+        TxState->PendingEventID = CFE_SB_SEND_BAD_ARG_EID;
+        Status                  = CFE_SB_BAD_ARGUMENT;
     }
 
     if (Status == CFE_SUCCESS)
     {
-        CFE_MSG_GetMsgId(MsgPtr, MsgIdPtr);
+        CFE_MSG_GetMsgId(MsgPtr, &TxState->MsgId);
 
         /* validate the msgid in the message */
-        if (!CFE_SB_IsValidMsgId(*MsgIdPtr))
+        if (!CFE_SB_IsValidMsgId(TxState->MsgId))
         {
-            PendingEventID = CFE_SB_SEND_INV_MSGID_EID;
-            Status         = CFE_SB_BAD_ARGUMENT;
+            TxState->PendingEventID = CFE_SB_SEND_INV_MSGID_EID;
+            Status                  = CFE_SB_BAD_ARGUMENT;
         }
     }
 
     if (Status == CFE_SUCCESS)
     {
-        CFE_MSG_GetSize(MsgPtr, SizePtr);
+        CFE_MSG_GetSize(MsgPtr, &TxState->Size);
 
         /* Verify the size of the pkt is < or = the mission defined max */
-        if (*SizePtr > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+        if (TxState->Size > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
         {
-            PendingEventID = CFE_SB_MSG_TOO_BIG_EID;
-            Status         = CFE_SB_MSG_TOO_BIG;
+            TxState->PendingEventID = CFE_SB_MSG_TOO_BIG_EID;
+            Status                  = CFE_SB_MSG_TOO_BIG;
         } /* end if */
     }
 
     if (Status == CFE_SUCCESS)
     {
-        /* check the route, which should be done while locked */
-        CFE_SB_LockSharedData(__func__, __LINE__);
-
-        /* Get the routing id */
-        *RouteIdPtr = CFE_SBR_GetRouteId(*MsgIdPtr);
-
-        /* if there have been no subscriptions for this pkt, */
-        /* increment the dropped pkt cnt, send event and return success */
-        if (!CFE_SBR_IsValidRouteId(*RouteIdPtr))
-        {
-            CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
-            PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
-        }
-
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
+        CFE_MSG_GetType(MsgPtr, &TxState->MsgType);
     }
 
-    if (PendingEventID != 0)
-    {
-        /* get task id for events */
-        CFE_ES_GetTaskID(&TskId);
-
-        switch (PendingEventID)
-        {
-            case CFE_SB_SEND_BAD_ARG_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Bad input argument,Arg 0x%lx,App %s", (unsigned long)MsgPtr,
-                                               CFE_SB_GetAppTskName(TskId, FullName));
-
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT);
-                }
-                break;
-
-            case CFE_SB_SEND_INV_MSGID_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Invalid MsgId(0x%x)in msg,App %s",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName));
+    return Status;
+}
 
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT);
-                }
-                break;
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitMsgLocked
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_TransmitMsgLocked(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount,
+                               CFE_SB_TransmitState_t *TxState)
+{
+    int32             Status;
+    CFE_SB_BufferD_t *BufDscPtr;
 
-            case CFE_SB_MSG_TOO_BIG_EID:
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                               "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName), (int)*SizePtr,
-                                               CFE_MISSION_SB_MAX_SB_MSG_SIZE);
-
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT);
-                }
-                break;
+    Status    = CFE_SUCCESS;
+    BufDscPtr = NULL;
 
-            case CFE_SB_SEND_NO_SUBS_EID:
-                /* Determine if event can be sent without causing recursive event problem */
-                if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
-                {
-                    CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION,
-                                               CFE_SB_Global.AppId, "No subscribers for MsgId 0x%x,sender %s",
-                                               (unsigned int)CFE_SB_MsgIdToValue(*MsgIdPtr),
-                                               CFE_SB_GetAppTskName(TskId, FullName));
+    CFE_SB_TransmitLookupRoute(TxState);
 
-                    /* clear the bit so the task may send this event again */
-                    CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
-                } /* end if */
-                break;
+    if (CFE_SBR_IsValidRouteId(TxState->RouteId))
+    {
+        /* Get buffer - note this pre-initializes the returned buffer with
+         * a use count of 1, which refers to this task as it fills the buffer. */
+        BufDscPtr = CFE_SB_GetBufferFromPool(TxState->Size);
+        if (BufDscPtr == NULL)
+        {
+            TxState->PendingEventID = CFE_SB_GET_BUF_ERR_EID;
+            Status                  = CFE_SB_BUF_ALOC_ERR;
         }
+    }
 
-    } /* end if */
+    /*
+     * If a buffer was obtained above, then copy the content into it
+     * and broadcast it to all subscribers in the route.
+     *
+     * Note - if there is no route / no subscribers, the "Status" will
+     * be CFE_SUCCESS because CFE_SB_TransmitMsgValidate() succeeded,
+     * but there will be no buffer because CFE_SBR_IsValidRouteId() returned
+     * false.
+     */
+    if (BufDscPtr != NULL)
+    {
+        /* Copy actual message content into buffer and set its metadata */
+        memcpy(&BufDscPtr->Content, MsgPtr, TxState->Size);
+        BufDscPtr->MsgId        = TxState->MsgId;
+        BufDscPtr->ContentSize  = TxState->Size;
+        BufDscPtr->AutoSequence = IncrementSequenceCount;
+        BufDscPtr->ContentType  = TxState->MsgType;
+
+        /*
+         * This routine will use best-effort to send to all subscribers,
+         * increment the buffer use count for every successful delivery,
+         * and record any unsuccessful delivery for reporting after unlock.
+         *
+         * The broadcast function consumes the buffer, so it should not be
+         * accessed in this function anymore
+         */
+        CFE_SB_BroadcastBufferToRoute(BufDscPtr, TxState);
+    }
 
     return Status;
 }
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SB_BroadcastBufferToRoute
+ * Function: CFE_SB_TransmitLookupRoute
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId)
+void CFE_SB_TransmitLookupRoute(CFE_SB_TransmitState_t *TxState)
 {
-    CFE_ES_AppId_t         AppId;
-    CFE_ES_TaskId_t        TskId;
-    CFE_SB_DestinationD_t *DestPtr;
-    CFE_SB_PipeD_t *       PipeDscPtr;
-    CFE_SB_EventBuf_t      SBSndErr;
-    int32                  OsStatus;
-    uint32                 i;
-    char                   FullName[(OS_MAX_API_NAME * 2)];
-    char                   PipeName[OS_MAX_API_NAME];
-
-    SBSndErr.EvtsToSnd = 0;
-
-    /* get app id for loopback testing */
-    CFE_ES_GetAppID(&AppId);
+    /* Get the routing id */
+    TxState->RouteId = CFE_SBR_GetRouteId(TxState->MsgId);
 
-    /* get task id for events and Sender Info*/
-    CFE_ES_GetTaskID(&TskId);
+    /* if there have been no subscriptions for this pkt, */
+    /* increment the dropped pkt cnt and note the event for later */
+    if (!CFE_SBR_IsValidRouteId(TxState->RouteId))
+    {
+        CFE_SB_Global.HKTlmMsg.Payload.NoSubscribersCounter++;
+        TxState->PendingEventID = CFE_SB_SEND_NO_SUBS_EID;
+    }
+}
 
-    /* take semaphore to prevent a task switch during processing */
-    CFE_SB_LockSharedData(__func__, __LINE__);
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitReportEvents
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_TransmitReportEvents(const CFE_MSG_Message_t *MsgPtr, const CFE_SB_TransmitState_t *TxState)
+{
+    CFE_ES_TaskId_t TskId;
+    uint32          i;
+    char            FullName[(OS_MAX_API_NAME * 2)];
+    char            PipeName[OS_MAX_API_NAME];
 
-    /* For an invalid route / no subscribers this whole logic can be skipped */
-    if (CFE_SBR_IsValidRouteId(RouteId))
+    /* Nominal case - nothing to report, so skip even getting the task ID */
+    if (TxState->PendingEventID == 0 && TxState->SendErr.EvtsToSnd == 0)
     {
-        /* Set the seq count if requested (while locked) before actually sending */
-        /* For some reason this is only done for TLM types (historical, TBD) */
-        if (BufDscPtr->AutoSequence && BufDscPtr->ContentType == CFE_MSG_Type_Tlm)
-        {
-            CFE_SBR_IncrementSequenceCounter(RouteId);
+        return;
+    }
 
-            /* Write the sequence into the message header itself (overwrites whatever was there) */
-            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(RouteId));
-        }
+    /* get task id for events */
+    CFE_ES_GetTaskID(&TskId);
 
-        /* Send the packet to all destinations  */
-        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
-        {
-            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
+    switch (TxState->PendingEventID)
+    {
+        case CFE_SB_SEND_BAD_ARG_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT) == CFE_SB_GRANTED)
             {
-                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Bad input argument,Arg 0x%lx,App %s", (unsigned long)MsgPtr,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_BAD_ARG_EID_BIT);
             }
-            else
+            break;
+
+        case CFE_SB_SEND_INV_MSGID_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT) == CFE_SB_GRANTED)
             {
-                PipeDscPtr = NULL;
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_INV_MSGID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Invalid MsgId(0x%x)in msg,App %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_INV_MSGID_EID_BIT);
             }
+            break;
 
-            if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+        case CFE_SB_MSG_TOO_BIG_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT) == CFE_SB_GRANTED)
             {
-                continue;
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSG_TOO_BIG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Msg Too Big MsgId=0x%x,app=%s,size=%d,MaxSz=%d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)TxState->Size,
+                                           CFE_MISSION_SB_MAX_SB_MSG_SIZE);
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSG_TOO_BIG_EID_BIT);
             }
+            break;
 
-            if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) != 0 &&
-                CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, AppId))
+        case CFE_SB_SEND_NO_SUBS_EID:
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT) == CFE_SB_GRANTED)
             {
-                continue;
+                CFE_EVS_SendEventWithAppID(CFE_SB_SEND_NO_SUBS_EID, CFE_EVS_EventType_INFORMATION,
+                                           CFE_SB_Global.AppId, "No subscribers for MsgId 0x%x,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_SEND_NO_SUBS_EID_BIT);
             } /* end if */
+            break;
 
-            /* if Msg limit exceeded, log event, increment counter */
-            /* and go to next destination */
-            if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+        case CFE_SB_GET_BUF_ERR_EID:
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT) == CFE_SB_GRANTED)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
-                SBSndErr.EvtsToSnd++;
-                CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
-                PipeDscPtr->SendErrors++;
+                CFE_EVS_SendEventWithAppID(CFE_SB_GET_BUF_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Send Err:Request for Buffer Failed. MsgId 0x%x,app %s,size %d",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (int)TxState->Size);
 
-                continue;
-            } /* end if */
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_GET_BUF_ERR_EID_BIT);
+            }
+            break;
 
-            /*
-            ** Write the buffer descriptor to the queue of the pipe.  If the write
-            ** failed, log info and increment the pipe's error counter.
-            */
-            OsStatus = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+        default:
+            break;
+    }
 
-            if (OsStatus == OS_SUCCESS)
-            {
-                /* The queue now holds a ref to the buffer, so increment its ref count. */
-                CFE_SB_IncrBufUseCnt(BufDscPtr);
+    /* send an event for each pipe write error that may have occurred */
+    for (i = 0; i < TxState->SendErr.EvtsToSnd; i++)
+    {
+        if (TxState->SendErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
+        {
+
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), TxState->SendErr.EvtBuf[i].PipeId);
+
+                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
+            } /* end if */
+        }
+        else if (TxState->SendErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
+        {
+
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), TxState->SendErr.EvtBuf[i].PipeId);
+
+                CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+                CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT);
+            } /* end if */
+        }
+        else
+        {
+
+            /* Determine if event can be sent without causing recursive event problem */
+            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
+            {
+
+                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), TxState->SendErr.EvtBuf[i].PipeId);
+
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
+                                           (unsigned int)CFE_SB_MsgIdToValue(TxState->MsgId), PipeName,
+                                           CFE_SB_GetAppTskName(TskId, FullName),
+                                           (long)(TxState->SendErr.EvtBuf[i].OsStatus));
+
+                /* clear the bit so the task may send this event again */
+                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
+            } /* end if */
+
+        } /* end if */
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_BroadcastBufferToRoute
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SB_TransmitState_t *TxState)
+{
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_EventBuf_t *    SBSndErrPtr;
+    CFE_SBR_RouteId_t      RouteId;
+    int32                  OsStatus;
+
+    SBSndErrPtr = &TxState->SendErr;
+    RouteId     = TxState->RouteId;
+
+    /* For an invalid route / no subscribers this whole logic can be skipped */
+    if (CFE_SBR_IsValidRouteId(RouteId))
+    {
+        /* Set the seq count if requested (while locked) before actually sending */
+        /* For some reason this is only done for TLM types (historical, TBD) */
+        if (BufDscPtr->AutoSequence && BufDscPtr->ContentType == CFE_MSG_Type_Tlm)
+        {
+            CFE_SBR_IncrementSequenceCounter(RouteId);
+
+            /* Write the sequence into the message header itself (overwrites whatever was there) */
+            CFE_MSG_SetSequenceCount(&BufDscPtr->Content.Msg, CFE_SBR_GetSequenceCounter(RouteId));
+        }
+
+        /* Send the packet to all destinations  */
+        for (DestPtr = CFE_SBR_GetDestListHeadPtr(RouteId); DestPtr != NULL; DestPtr = DestPtr->Next)
+        {
+            if (DestPtr->Active == CFE_SB_ACTIVE) /* destination is active */
+            {
+                PipeDscPtr = CFE_SB_LocatePipeDescByID(DestPtr->PipeId);
+            }
+            else
+            {
+                PipeDscPtr = NULL;
+            }
+
+            if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, DestPtr->PipeId))
+            {
+                continue;
+            }
+
+            if ((PipeDscPtr->Opts & CFE_SB_PIPEOPTS_IGNOREMINE) != 0 &&
+                CFE_RESOURCEID_TEST_EQUAL(PipeDscPtr->AppId, TxState->SenderAppId))
+            {
+                continue;
+            } /* end if */
+
+            /* if Msg limit exceeded, log event, increment counter */
+            /* and go to next destination */
+            if (DestPtr->BuffCount >= DestPtr->MsgId2PipeLim)
+            {
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].EventId = CFE_SB_MSGID_LIM_ERR_EID;
+                SBSndErrPtr->EvtsToSnd++;
+                CFE_SB_Global.HKTlmMsg.Payload.MsgLimitErrorCounter++;
+                PipeDscPtr->SendErrors++;
+
+                continue;
+            } /* end if */
+
+            /*
+            ** Write the buffer descriptor to the queue of the pipe.  If the write
+            ** failed, log info and increment the pipe's error counter.
+            */
+            OsStatus = OS_QueuePut(PipeDscPtr->SysQueueId, &BufDscPtr, sizeof(BufDscPtr), 0);
+
+            if (OsStatus == OS_SUCCESS)
+            {
+                /* The queue now holds a ref to the buffer, so increment its ref count. */
+                CFE_SB_IncrBufUseCnt(BufDscPtr);
 
                 DestPtr->BuffCount++; /* used for checking MsgId2PipeLimit */
                 DestPtr->DestCnt++;   /* used for statistics */
@@ -1662,19 +1865,19 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
             }
             else if (OsStatus == OS_QUEUE_FULL)
             {
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId  = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
-                SBSndErr.EvtsToSnd++;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].PipeId  = DestPtr->PipeId;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].EventId = CFE_SB_Q_FULL_ERR_EID;
+                SBSndErrPtr->EvtsToSnd++;
                 CFE_SB_Global.HKTlmMsg.Payload.PipeOverflowErrorCounter++;
                 PipeDscPtr->SendErrors++;
             }
             else
             {
                 /* Unexpected error while writing to queue. */
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].PipeId   = DestPtr->PipeId;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].EventId  = CFE_SB_Q_WR_ERR_EID;
-                SBSndErr.EvtBuf[SBSndErr.EvtsToSnd].OsStatus = OsStatus;
-                SBSndErr.EvtsToSnd++;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].PipeId   = DestPtr->PipeId;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].EventId  = CFE_SB_Q_WR_ERR_EID;
+                SBSndErrPtr->EvtBuf[SBSndErrPtr->EvtsToSnd].OsStatus = OsStatus;
+                SBSndErrPtr->EvtsToSnd++;
                 CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter++;
                 PipeDscPtr->SendErrors++;
             } /*end if */
@@ -1686,7 +1889,7 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
      * If any specific delivery issues occurred, also increment the
      * general error count before releasing the lock.
      */
-    if (SBSndErr.EvtsToSnd > 0)
+    if (SBSndErrPtr->EvtsToSnd > 0)
     {
         CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
     }
@@ -1714,75 +1917,6 @@ void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_
     ** been disabled via ground command.
     */
     CFE_SB_DecrBufUseCnt(BufDscPtr);
-
-    /* release the semaphore */
-    CFE_SB_UnlockSharedData(__func__, __LINE__);
-
-    /* send an event for each pipe write error that may have occurred */
-    for (i = 0; i < SBSndErr.EvtsToSnd; i++)
-    {
-        if (SBSndErr.EvtBuf[i].EventId == CFE_SB_MSGID_LIM_ERR_EID)
-        {
-
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
-
-                CFE_ES_PerfLogEntry(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-                CFE_ES_PerfLogExit(CFE_MISSION_SB_MSG_LIM_PERF_ID);
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_MSGID_LIM_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Msg Limit Err,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_MSGID_LIM_ERR_EID_BIT);
-            } /* end if */
-        }
-        else if (SBSndErr.EvtBuf[i].EventId == CFE_SB_Q_FULL_ERR_EID)
-        {
-
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
-
-                CFE_ES_PerfLogEntry(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
-                CFE_ES_PerfLogExit(CFE_MISSION_SB_PIPE_OFLOW_PERF_ID);
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_Q_FULL_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Pipe Overflow,MsgId 0x%x,pipe %s,sender %s",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName));
-
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_FULL_ERR_EID_BIT);
-            } /* end if */
-        }
-        else
-        {
-
-            /* Determine if event can be sent without causing recursive event problem */
-            if (CFE_SB_RequestToSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT) == CFE_SB_GRANTED)
-            {
-
-                CFE_SB_GetPipeName(PipeName, sizeof(PipeName), SBSndErr.EvtBuf[i].PipeId);
-
-                CFE_EVS_SendEventWithAppID(CFE_SB_Q_WR_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
-                                           "Pipe Write Err,MsgId 0x%x,pipe %s,sender %s,stat %ld",
-                                           (unsigned int)CFE_SB_MsgIdToValue(BufDscPtr->MsgId), PipeName,
-                                           CFE_SB_GetAppTskName(TskId, FullName), (long)(SBSndErr.EvtBuf[i].OsStatus));
-
-                /* clear the bit so the task may send this event again */
-                CFE_SB_FinishSendEvent(TskId, CFE_SB_Q_WR_ERR_EID_BIT);
-            } /* end if */
-
-        } /* end if */
-    }
 }
 
 /*----------------------------------------------------------------
@@ -2044,51 +2178,400 @@ CFE_Status_t CFE_SB_ReceiveBuffer(CFE_SB_Buffer_t **BufPtr, CFE_SB_PipeId_t Pipe
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SB_AllocateMessageBuffer
+ * Function: CFE_SB_ReceiveBuffers
  *
  * Implemented per public API
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+CFE_Status_t CFE_SB_ReceiveBuffers(CFE_SB_Buffer_t **BufPtrArray, uint32 MaxCount, uint32 *CountPtr,
+                                   CFE_SB_PipeId_t PipeId, int32 TimeOut)
 {
-    CFE_ES_AppId_t    AppId;
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SB_Buffer_t * BufPtr;
+    int32                  Status;
+    int32                  OsStatus;
+    CFE_SB_BufferD_t *     BufDscPtr;
+    size_t                 BufDscSize;
+    CFE_SB_PipeD_t *       PipeDscPtr;
+    CFE_SB_DestinationD_t *DestPtr;
+    CFE_SBR_RouteId_t      RouteId;
+    CFE_ES_TaskId_t        TskId;
+    uint16                 PendingEventID;
+    osal_id_t              SysQueueId;
+    int32                  SysTimeout;
+    uint32                 Count;
+    uint32                 Reserved;
+    uint32                 i;
+    uint32                 Slot;
+    char                   FullName[(OS_MAX_API_NAME * 2)];
 
-    AppId     = CFE_ES_APPID_UNDEFINED;
-    BufDscPtr = NULL;
-    BufPtr    = NULL;
+    PendingEventID = 0;
+    Status         = CFE_SUCCESS;
+    SysTimeout     = OS_PEND;
+    SysQueueId     = OS_OBJECT_ID_UNDEFINED;
+    PipeDscPtr     = NULL;
+    BufDscPtr      = NULL;
+    BufDscSize     = 0;
+    OsStatus       = OS_SUCCESS;
+    Count          = 0;
+    Reserved       = 0;
 
-    if (MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    /*
+     * Check input args and translate the timeout, same as CFE_SB_ReceiveBuffer()
+     */
+    if (BufPtrArray == NULL || CountPtr == NULL || MaxCount == 0)
     {
-        CFE_ES_WriteToSysLog("%s: ZeroCopyGetPtr-Failed, MsgSize is too large\n", __func__);
-        return NULL;
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
+    }
+    else if (TimeOut > 0)
+    {
+        /* time outs greater than 0 can be passed to OSAL directly */
+        SysTimeout = TimeOut;
+    }
+    else if (TimeOut == CFE_SB_POLL)
+    {
+        SysTimeout = OS_CHECK;
+    }
+    else if (TimeOut != CFE_SB_PEND_FOREVER)
+    {
+        /* any other timeout value is invalid */
+        PendingEventID = CFE_SB_RCV_BAD_ARG_EID;
+        Status         = CFE_SB_BAD_ARGUMENT;
     }
 
-    /* get callers AppId */
-    if (CFE_ES_GetAppID(&AppId) == CFE_SUCCESS)
+    /* If OK, then lock and pull relevant info from Pipe Descriptor */
+    if (Status == CFE_SUCCESS)
     {
         CFE_SB_LockSharedData(__func__, __LINE__);
 
-        /*
-         * All this needs to do is get a descriptor from the pool,
-         * and associate that descriptor with this app ID, so it
-         * can be freed if this app is deleted before it uses it.
-         */
-        BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
+        PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
 
-        if (BufDscPtr != NULL)
+        /* If the pipe does not exist or PipeId is out of range... */
+        if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
         {
-            /* Track the buffer as a zero-copy assigned to this app ID */
-            BufDscPtr->AppId = AppId;
-            BufPtr           = &BufDscPtr->Content;
-            CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_BAD_ARGUMENT;
         }
+        else if (PipeDscPtr->HeldBufferCount >= CFE_SB_MAX_HELD_BUFFERS)
+        {
+            /* The caller has not released enough of its previous batches */
+            Status = CFE_SB_BUF_ALOC_ERR;
+        }
+        else
+        {
+            /* Grab the queue ID */
+            SysQueueId = PipeDscPtr->SysQueueId;
+
+            /*
+             * A batch receive also counts as being done with the buffer from a
+             * previous CFE_SB_ReceiveBuffer() on this pipe, see that function.
+             */
+            if (PipeDscPtr->LastBuffer != NULL)
+            {
+                CFE_SB_DecrBufUseCnt(PipeDscPtr->LastBuffer);
+                PipeDscPtr->LastBuffer = NULL;
+            }
+
+            /*
+             * Reserve a held buffer slot for every message this call may return,
+             * so concurrent receivers on the same pipe cannot overrun the table.
+             */
+            Reserved = CFE_SB_MAX_HELD_BUFFERS - PipeDscPtr->HeldBufferCount;
+            if (Reserved > MaxCount)
+            {
+                Reserved = MaxCount;
+            }
+            PipeDscPtr->HeldBufferCount += Reserved;
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
+
+    /*
+     * Read the buffer descriptors from the queue, OUTSIDE the SB lock.
+     * Only the first read may block, the rest only take what is already
+     * on the queue.  The descriptors are held in the caller's array as
+     * content pointers until the pipe has been updated below.
+     */
+    while (Status == CFE_SUCCESS && Count < Reserved)
+    {
+        OsStatus = OS_QueueGet(SysQueueId, &BufDscPtr, sizeof(BufDscPtr), &BufDscSize, SysTimeout);
+
+        if (OsStatus == OS_SUCCESS && BufDscPtr != NULL && BufDscSize == sizeof(BufDscPtr))
+        {
+            BufPtrArray[Count] = &BufDscPtr->Content;
+            ++Count;
+            SysTimeout = OS_CHECK;
+        }
+        else if (Count > 0)
+        {
+            /*
+             * Return what was already received.  If the queue is in error,
+             * the next call will find it again and report it.
+             */
+            break;
+        }
+        else if (OsStatus == OS_QUEUE_EMPTY)
+        {
+            /* normal if using CFE_SB_POLL */
+            Status = CFE_SB_NO_MESSAGE;
+        }
+        else if (OsStatus == OS_QUEUE_TIMEOUT)
+        {
+            /* normal if using a nonzero timeout */
+            Status = CFE_SB_TIME_OUT;
+        }
+        else
+        {
+            /* off-nominal condition, report an error event */
+            PendingEventID = CFE_SB_Q_RD_ERR_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+        }
+    }
+
+    /* Now re-lock once to update the pipe and route for the whole batch */
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /*
+         * NOTE: This uses the same PipeDscPtr that was found earlier,
+         * see the same check in CFE_SB_ReceiveBuffer()
+         */
+        if (CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+        {
+            for (i = 0; i < Count; ++i)
+            {
+                BufDscPtr = CFE_SB_GetBufferDescriptor(BufPtrArray[i]);
+
+                /*
+                 * The reference that was held by the queue is passed on to the
+                 * caller, so the use count is not changed here.  It is decremented
+                 * when the caller calls CFE_SB_ReleaseBuffers().
+                 */
+                RouteId = CFE_SBR_GetRouteId(BufDscPtr->MsgId);
+                DestPtr = CFE_SB_GetDestPtr(RouteId, PipeId);
+
+                /* See CFE_SB_ReceiveBuffer() for the cases where DestPtr or BuffCount are not set */
+                if (DestPtr != NULL && DestPtr->BuffCount > 0)
+                {
+                    DestPtr->BuffCount--;
+                }
+
+                if (PipeDscPtr->CurrentQueueDepth > 0)
+                {
+                    --PipeDscPtr->CurrentQueueDepth;
+                }
+
+                /* Track the buffer on the pipe until CFE_SB_ReleaseBuffers(), a free slot was reserved above */
+                Slot = 0;
+                while (PipeDscPtr->HeldBuffers[Slot] != NULL)
+                {
+                    ++Slot;
+                }
+                PipeDscPtr->HeldBuffers[Slot] = BufDscPtr;
+            }
+        }
+        else
+        {
+            /* should send the bad pipe ID event here too */
+            PendingEventID = CFE_SB_BAD_PIPEID_EID;
+            Status         = CFE_SB_PIPE_RD_ERR;
+
+            /* Drop the references that were in the queue */
+            for (i = 0; i < Count; ++i)
+            {
+                CFE_SB_DecrBufUseCnt(CFE_SB_GetBufferDescriptor(BufPtrArray[i]));
+            }
+        }
+    }
+
+    /* Give back the reserved slots that were not filled, unless the pipe was deleted meanwhile */
+    if (Reserved > Count && CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        PipeDscPtr->HeldBufferCount -= (Reserved - Count);
+    }
+
+    /* Before unlocking, check the PendingEventID and increment relevant error counter */
+    if (Status != CFE_SUCCESS)
+    {
+        if (PendingEventID == CFE_SB_RCV_BAD_ARG_EID || PendingEventID == CFE_SB_BAD_PIPEID_EID ||
+            Status == CFE_SB_BUF_ALOC_ERR)
+        {
+            ++CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter;
+        }
+        else
+        {
+            /* For any other unexpected error (e.g. CFE_SB_Q_RD_ERR_EID) */
+            ++CFE_SB_Global.HKTlmMsg.Payload.InternalErrorCounter;
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Now actually send the event, after unlocking (do not call EVS with SB locked) */
+    if (PendingEventID != 0)
+    {
+        /* get task id for events */
+        CFE_ES_GetTaskID(&TskId);
+
+        switch (PendingEventID)
+        {
+            case CFE_SB_Q_RD_ERR_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_Q_RD_ERR_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Pipe Read Err,pipe %lu,app %s,stat %ld", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName), (long)OsStatus);
+                break;
+            case CFE_SB_RCV_BAD_ARG_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_RCV_BAD_ARG_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:Bad Input Arg:BufPtrArray 0x%lx,max %lu,pipe %lu,t/o %d,app %s",
+                                           (unsigned long)BufPtrArray, (unsigned long)MaxCount,
+                                           CFE_RESOURCEID_TO_ULONG(PipeId), (int)TimeOut,
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+            case CFE_SB_BAD_PIPEID_EID:
+                CFE_EVS_SendEventWithAppID(CFE_SB_BAD_PIPEID_EID, CFE_EVS_EventType_ERROR, CFE_SB_Global.AppId,
+                                           "Rcv Err:PipeId %lu does not exist,app %s", CFE_RESOURCEID_TO_ULONG(PipeId),
+                                           CFE_SB_GetAppTskName(TskId, FullName));
+                break;
+        }
+    }
+
+    /* If not successful, nothing is returned to the caller */
+    if (Status != CFE_SUCCESS)
+    {
+        Count = 0;
+    }
+
+    if (CountPtr != NULL)
+    {
+        *CountPtr = Count;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ReleaseBuffers
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_ReleaseBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, CFE_SB_PipeId_t PipeId)
+{
+    CFE_Status_t      Status;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+    uint32            i;
+    uint32            Slot;
+
+    if (BufPtrArray == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
+    }
+
+    Status    = CFE_SUCCESS;
+    BufDscPtr = NULL;
+
+    CFE_SB_LockSharedData(__func__, __LINE__);
+
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    if (!CFE_SB_PipeDescIsMatch(PipeDscPtr, PipeId))
+    {
+        Status = CFE_SB_BAD_ARGUMENT;
+    }
+    else
+    {
+        for (i = 0; i < Count; ++i)
+        {
+            /*
+             * Only release buffers that this pipe handed out and still holds.  Anything
+             * else (NULL, already released, or from another pipe) is reported, but does
+             * not stop the rest of the array from being released.
+             */
+            Slot = CFE_SB_MAX_HELD_BUFFERS;
+            if (BufPtrArray[i] != NULL)
+            {
+                BufDscPtr = CFE_SB_GetBufferDescriptor(BufPtrArray[i]);
+                for (Slot = 0; Slot < CFE_SB_MAX_HELD_BUFFERS; ++Slot)
+                {
+                    if (PipeDscPtr->HeldBuffers[Slot] == BufDscPtr)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if (Slot < CFE_SB_MAX_HELD_BUFFERS)
+            {
+                PipeDscPtr->HeldBuffers[Slot] = NULL;
+                --PipeDscPtr->HeldBufferCount;
+
+                /* Decrement the Buffer Use Count, which will Free buffer if it becomes 0 */
+                CFE_SB_DecrBufUseCnt(BufDscPtr);
+            }
+            else
+            {
+                Status = CFE_SB_BAD_ARGUMENT;
+            }
+        }
+    }
+
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_AllocateMessageBuffer
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
+{
+    CFE_ES_AppId_t    AppId;
+    CFE_SB_BufferD_t *BufDscPtr;
+    CFE_SB_Buffer_t * BufPtr;
+
+    AppId     = CFE_ES_APPID_UNDEFINED;
+    BufDscPtr = NULL;
+    BufPtr    = NULL;
+
+    if (MsgSize > CFE_MISSION_SB_MAX_SB_MSG_SIZE)
+    {
+        CFE_ES_WriteToSysLog("%s: ZeroCopyGetPtr-Failed, MsgSize is too large\n", __func__);
+        return NULL;
+    }
+
+    /* get callers AppId */
+    if (CFE_ES_GetAppID(&AppId) == CFE_SUCCESS)
+    {
+        CFE_SB_LockSharedData(__func__, __LINE__);
+
+        /*
+         * All this needs to do is get a descriptor from the pool,
+         * and associate that descriptor with this app ID, so it
+         * can be freed if this app is deleted before it uses it.
+         */
+        BufDscPtr = CFE_SB_GetBufferFromPool(MsgSize);
+
+        if (BufDscPtr != NULL)
+        {
+            /* Track the buffer as a zero-copy assigned to this app ID */
+            BufDscPtr->AppId = AppId;
+            BufPtr           = &BufDscPtr->Content;
+            CFE_SB_TrackingListAdd(&CFE_SB_Global.ZeroCopyList, &BufDscPtr->Link);
+        }
+
+        CFE_SB_UnlockSharedData(__func__, __LINE__);
+    }
 
-        CFE_SB_UnlockSharedData(__func__, __LINE__);
-    }
-
     if (BufPtr != NULL)
     {
         /*
@@ -2104,16 +2587,35 @@ CFE_SB_Buffer_t *CFE_SB_AllocateMessageBuffer(size_t MsgSize)
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_SB_ZeroCopyBufferValidate
+ * Function: CFE_SB_GetBufferDescriptor
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+CFE_SB_BufferD_t *CFE_SB_GetBufferDescriptor(CFE_SB_Buffer_t *BufPtr)
 {
     cpuaddr BufDscAddr;
 
+    /*
+     * Calculate descriptor pointer from buffer pointer -
+     * The buffer is just a member (offset) in the descriptor
+     */
+    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
+
+    return (CFE_SB_BufferD_t *)BufDscAddr;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_ZeroCopyBufferValidate
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **BufDscPtr)
+{
     /*
      * Sanity Check that the pointers are not NULL
      */
@@ -2122,12 +2624,7 @@ int32 CFE_SB_ZeroCopyBufferValidate(CFE_SB_Buffer_t *BufPtr, CFE_SB_BufferD_t **
         return CFE_SB_BAD_ARGUMENT;
     }
 
-    /*
-     * Calculate descriptor pointer from buffer pointer -
-     * The buffer is just a member (offset) in the descriptor
-     */
-    BufDscAddr = (cpuaddr)BufPtr - offsetof(CFE_SB_BufferD_t, Content);
-    *BufDscPtr = (CFE_SB_BufferD_t *)BufDscAddr;
+    *BufDscPtr = CFE_SB_GetBufferDescriptor(BufPtr);
 
     /*
      * Check that the descriptor is actually a "zero copy" type,
@@ -2180,49 +2677,187 @@ CFE_Status_t CFE_SB_ReleaseMessageBuffer(CFE_SB_Buffer_t *BufPtr)
  *-----------------------------------------------------------------*/
 CFE_Status_t CFE_SB_TransmitBuffer(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount)
 {
-    int32             Status;
-    CFE_SB_BufferD_t *BufDscPtr;
-    CFE_SBR_RouteId_t RouteId;
+    int32                    Status;
+    CFE_SB_BufferD_t *       BufDscPtr;
+    const CFE_MSG_Message_t *MsgPtr;
+    CFE_SB_TransmitState_t   TxState;
 
-    Status = CFE_SB_ZeroCopyBufferValidate(BufPtr, &BufDscPtr);
+    MsgPtr = NULL;
+    Status = CFE_SB_TransmitBufferValidate(BufPtr, IncrementSequenceCount, &BufDscPtr, &TxState);
+
+    if (Status == CFE_SUCCESS)
+    {
+        MsgPtr = &BufPtr->Msg;
+
+        /* get app id for loopback testing - this takes the ES lock, so do it before locking SB */
+        CFE_ES_GetAppID(&TxState.SenderAppId);
+    }
+
+    /* The route lookup and the broadcast are done within a single critical section */
+    CFE_SB_LockSharedData(__func__, __LINE__);
 
     if (Status == CFE_SUCCESS)
     {
-        /* Validate the content and get the MsgId, store it in the descriptor */
-        Status = CFE_SB_TransmitMsgValidate(&BufPtr->Msg, &BufDscPtr->MsgId, &BufDscPtr->ContentSize, &RouteId);
+        CFE_SB_TransmitLookupRoute(&TxState);
 
         /*
          * Broadcast the message if validation succeeded.
          *
          * Note that for the case of no subscribers, the validation returns CFE_SUCCESS
          * but the actual route ID may be invalid.  This is OK and considered normal-
-         * the validation will increment the NoSubscribers count, but we should NOT
+         * the lookup will increment the NoSubscribers count, but we should NOT
          * increment the MsgSendErrorCounter here - it is not really a sending error to
          * have no subscribers.  CFE_SB_BroadcastBufferToRoute() will not send to
-         * anything if the route is not valid (benign).
+         * anything if the route is not valid (benign), but still consumes the buffer.
          */
-        if (Status == CFE_SUCCESS)
-        {
-            BufDscPtr->AutoSequence = IncrementSequenceCount;
-            CFE_MSG_GetType(&BufPtr->Msg, &BufDscPtr->ContentType);
+        CFE_SB_BroadcastBufferToRoute(BufDscPtr, &TxState);
 
-            /* Now broadcast the message, which consumes the buffer */
-            CFE_SB_BroadcastBufferToRoute(BufDscPtr, RouteId);
+        /*
+         * IMPORTANT - the descriptor might be freed at any time after this,
+         * so the descriptor should not be accessed again after this point.
+         */
+        BufDscPtr = NULL;
+    }
+    else
+    {
+        /* Increment send error counter for validation failure */
+        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+    }
 
-            /*
-             * IMPORTANT - the descriptor might be freed at any time after this,
-             * so the descriptor should not be accessed again after this point.
-             */
-            BufDscPtr = NULL;
-        }
+    CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+    /* Now actually send any events, after unlocking (do not call EVS with SB locked) */
+    CFE_SB_TransmitReportEvents(MsgPtr, &TxState);
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitBuffers
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+CFE_Status_t CFE_SB_TransmitBuffers(CFE_SB_Buffer_t *const *BufPtrArray, uint32 Count, bool IncrementSequenceCount,
+                                    CFE_Status_t *StatusArray)
+{
+    CFE_Status_t           Status;
+    int32                  MsgStatus[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_BufferD_t *     BufDscPtr[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_SB_TransmitState_t TxState[CFE_SB_TRANSMIT_BATCH_SIZE];
+    CFE_ES_AppId_t         SenderAppId;
+    uint32                 Start;
+    uint32                 BatchCount;
+    uint32                 i;
+
+    if (BufPtrArray == NULL)
+    {
+        return CFE_SB_BAD_ARGUMENT;
     }
 
-    if (Status != CFE_SUCCESS)
+    Status = CFE_SUCCESS;
+
+    /* get app id for loopback testing - this takes the ES lock, so do it before locking SB */
+    CFE_ES_GetAppID(&SenderAppId);
+
+    for (Start = 0; Start < Count; Start += BatchCount)
     {
-        /* Increment send error counter for validation failure */
+        BatchCount = Count - Start;
+        if (BatchCount > CFE_SB_TRANSMIT_BATCH_SIZE)
+        {
+            BatchCount = CFE_SB_TRANSMIT_BATCH_SIZE;
+        }
+
+        /* The buffers are still owned by the caller here, so they can be validated without locking */
+        for (i = 0; i < BatchCount; ++i)
+        {
+            MsgStatus[i] =
+                CFE_SB_TransmitBufferValidate(BufPtrArray[Start + i], IncrementSequenceCount, &BufDscPtr[i], &TxState[i]);
+            TxState[i].SenderAppId = SenderAppId;
+        }
+
+        /* The whole group is sent within a single critical section, see CFE_SB_TransmitBuffer() */
         CFE_SB_LockSharedData(__func__, __LINE__);
-        CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+
+        for (i = 0; i < BatchCount; ++i)
+        {
+            if (MsgStatus[i] == CFE_SUCCESS)
+            {
+                CFE_SB_TransmitLookupRoute(&TxState[i]);
+
+                /* This consumes the buffer, it should not be accessed again */
+                CFE_SB_BroadcastBufferToRoute(BufDscPtr[i], &TxState[i]);
+                BufDscPtr[i] = NULL;
+            }
+            else
+            {
+                CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter++;
+            }
+        }
+
         CFE_SB_UnlockSharedData(__func__, __LINE__);
+
+        /*
+         * Now actually send any events, after unlocking (do not call EVS with SB locked)
+         *
+         * Note the message pointer is only used for the text of a bad argument event,
+         * the content is not accessed, so this is OK even if the buffer was consumed.
+         */
+        for (i = 0; i < BatchCount; ++i)
+        {
+            CFE_SB_TransmitReportEvents((const CFE_MSG_Message_t *)BufPtrArray[Start + i], &TxState[i]);
+
+            if (StatusArray != NULL)
+            {
+                StatusArray[Start + i] = MsgStatus[i];
+            }
+
+            if (Status == CFE_SUCCESS)
+            {
+                Status = MsgStatus[i];
+            }
+        }
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_SB_TransmitBufferValidate
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_SB_TransmitBufferValidate(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount, CFE_SB_BufferD_t **BufDscPtr,
+                                    CFE_SB_TransmitState_t *TxState)
+{
+    int32 Status;
+
+    *BufDscPtr = NULL;
+    Status     = CFE_SB_ZeroCopyBufferValidate(BufPtr, BufDscPtr);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* Validate the content and get the MsgId */
+        Status = CFE_SB_TransmitMsgValidate(&BufPtr->Msg, TxState);
+    }
+    else
+    {
+        /* Nothing further to report, the validation error is returned directly */
+        memset(TxState, 0, sizeof(*TxState));
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* The buffer is still owned by the caller here, so the metadata can be set without locking */
+        (*BufDscPtr)->MsgId        = TxState->MsgId;
+        (*BufDscPtr)->ContentSize  = TxState->Size;
+        (*BufDscPtr)->AutoSequence = IncrementSequenceCount;
+        (*BufDscPtr)->ContentType  = TxState->MsgType;
     }
 
     return Status;
@@ -108,9 +108,15 @@ int32 CFE_SB_InitBuffers(void)
 
     int32 Stat = 0;
 
+    /*
+     * The pool is always accessed under the SB global lock, so it does not need
+     * its own mutex.  The task cache keeps recently released buffers without walking
+     * the pool free lists.  Buffers released by a receiving task reach the sending
+     * tasks through the depot shared by all task caches.
+     */
     Stat = CFE_ES_PoolCreateEx(&CFE_SB_Global.Mem.PoolHdl, CFE_SB_Global.Mem.Partition.Data,
                                CFE_PLATFORM_SB_BUF_MEMORY_BYTES, CFE_PLATFORM_ES_POOL_MAX_BUCKETS,
-                               &CFE_SB_MemPoolDefSize[0], CFE_ES_NO_MUTEX);
+                               &CFE_SB_MemPoolDefSize[0], CFE_ES_NO_MUTEX | CFE_ES_POOL_TASK_CACHE);
 
     if (Stat != CFE_SUCCESS)
     {
@@ -84,6 +84,12 @@
 #define CFE_SB_CMD_PIPE_NAME                 "SB_CMD_PIPE"
 #define CFE_SB_MAX_CFG_FILE_EVENTS_TO_FILTER 8
 
+/* Messages sent per hold of the SB lock in batch transmit, also bounds the state kept on the stack */
+#define CFE_SB_TRANSMIT_BATCH_SIZE 8
+
+/* Buffers from CFE_SB_ReceiveBuffers() that may be outstanding on one pipe before they are released */
+#define CFE_SB_MAX_HELD_BUFFERS 32
+
 #define CFE_SB_PIPE_OVERFLOW (-1)
 #define CFE_SB_PIPE_WR_ERR   (-2)
 #define CFE_SB_USECNT_ERR    (-3)
@@ -181,6 +187,13 @@ typedef struct
     uint16            CurrentQueueDepth;
     uint16            PeakQueueDepth;
     CFE_SB_BufferD_t *LastBuffer;
+
+    /*
+     * Buffers returned by CFE_SB_ReceiveBuffers() and not yet released.  The count
+     * also includes slots reserved by a receive that is waiting on the queue.
+     */
+    uint16            HeldBufferCount;
+    CFE_SB_BufferD_t *HeldBuffers[CFE_SB_MAX_HELD_BUFFERS];
 } CFE_SB_PipeD_t;
 
 /******************************************************************************
@@ -290,6 +303,27 @@ typedef struct
     CFE_SB_SendErrEventBuf_t EvtBuf[CFE_PLATFORM_SB_MAX_DEST_PER_PKT];
 } CFE_SB_EventBuf_t;
 
+/******************************************************************************
+**  Typedef:  CFE_SB_TransmitState_t
+**
+**  Purpose:
+**     This structure holds the state of a single message transmit operation.
+**
+**     The route lookup, buffer allocation and delivery to all destinations
+**     are done under a single hold of the SB lock.  Any events resulting from
+**     the transmit are recorded here and reported after the lock is released.
+*/
+typedef struct
+{
+    CFE_SB_MsgId_t    MsgId;          /**< MsgId from the message header */
+    CFE_MSG_Size_t    Size;           /**< Size from the message header */
+    CFE_MSG_Type_t    MsgType;        /**< Type from the message header */
+    CFE_SBR_RouteId_t RouteId;        /**< Route for the MsgId, invalid if no subscribers */
+    CFE_ES_AppId_t    SenderAppId;    /**< App sending the message, for CFE_SB_PIPEOPTS_IGNOREMINE */
+    uint16            PendingEventID; /**< Validation/allocation event to report, 0 if none */
+    CFE_SB_EventBuf_t SendErr;        /**< Per-destination delivery errors to report */
+} CFE_SB_TransmitState_t;
+
 /*
 ** Software Bus Function Prototypes
 */
@@ -429,15 +463,82 @@ int32 CFE_SB_UnsubscribeFull(CFE_SB_MsgId_t MsgId, CFE_SB_PipeId_t PipeId, uint8
 /**
  * \brief Internal routine to validate a transmit message before sending
  *
+ * Initializes the transmit state and checks the message header.  This only
+ * looks at the message itself, so it does not require the SB lock.
+ *
+ * No events are sent from this routine.  If validation fails, the event
+ * to report is stored in the transmit state for CFE_SB_TransmitReportEvents().
+ *
  * \param[in]  MsgPtr     Pointer to the message to validate
- * \param[out] MsgIdPtr   Message Id of message
- * \param[out] SizePtr    Size of message
- * \param[out] RouteIdPtr Route ID of the message (invalid if none)
+ * \param[out] TxState    Transmit state, MsgId, Size and MsgType are set from the message
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_TransmitState_t *TxState);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to validate a zero copy buffer before sending
+ *
+ * Checks the buffer and the message header as CFE_SB_TransmitMsgValidate() does,
+ * and on success fills in the buffer descriptor metadata.  The buffer is still
+ * owned by the caller at this point, so this does not require the SB lock.
+ *
+ * \param[in]  BufPtr                 Pointer to the zero copy buffer to validate
+ * \param[in]  IncrementSequenceCount Whether to apply the sequence count when sent
+ * \param[out] BufDscPtr              Set to the descriptor of the buffer
+ * \param[out] TxState                Transmit state, as for CFE_SB_TransmitMsgValidate()
+ *
+ * \return Execution status, see \ref CFEReturnCodes
+ */
+int32 CFE_SB_TransmitBufferValidate(CFE_SB_Buffer_t *BufPtr, bool IncrementSequenceCount, CFE_SB_BufferD_t **BufDscPtr,
+                                    CFE_SB_TransmitState_t *TxState);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to copy a validated message into a buffer and send it
+ *
+ * Looks up the route and, if there are subscribers, allocates a buffer, copies
+ * the message into it, and broadcasts it to the route.  Any events are recorded
+ * in the transmit state.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]    MsgPtr                 Pointer to the message to send
+ * \param[in]    IncrementSequenceCount Whether to apply the sequence count
+ * \param[inout] TxState                Transmit state from CFE_SB_TransmitMsgValidate()
  *
  * \return Execution status, see \ref CFEReturnCodes
  */
-int32 CFE_SB_TransmitMsgValidate(const CFE_MSG_Message_t *MsgPtr, CFE_SB_MsgId_t *MsgIdPtr, CFE_MSG_Size_t *SizePtr,
-                                 CFE_SBR_RouteId_t *RouteIdPtr);
+int32 CFE_SB_TransmitMsgLocked(const CFE_MSG_Message_t *MsgPtr, bool IncrementSequenceCount,
+                               CFE_SB_TransmitState_t *TxState);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to find the route for a validated transmit message
+ *
+ * Sets the RouteId in the transmit state.  If there are no subscribers, the
+ * route will be invalid, the NoSubscribersCounter is incremented, and the
+ * corresponding event is stored in the transmit state.
+ *
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[inout] TxState    Transmit state from CFE_SB_TransmitMsgValidate()
+ */
+void CFE_SB_TransmitLookupRoute(CFE_SB_TransmitState_t *TxState);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Internal routine to send all events recorded during a transmit
+ *
+ * Events cannot be sent while holding the SB lock, so the transmit routines
+ * record them in the transmit state and call this after unlocking.  This
+ * is a no-op if nothing was recorded.
+ *
+ * \param[in]  MsgPtr     Pointer to the message that was transmitted (for event text only)
+ * \param[in]  TxState    Transmit state containing the events to send
+ */
+void CFE_SB_TransmitReportEvents(const CFE_MSG_Message_t *MsgPtr, const CFE_SB_TransmitState_t *TxState);
 
 /*---------------------------------------------------------------------------------------*/
 /**
@@ -654,7 +755,9 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  * design pattern of the software bus is a "send and forget" model where the sender does
  * not know (or care) what entities are subscribed to the data being generated.
  *
- *  - For any undeliverable destination (limit, OSAL error, etc), a proper event is generated.
+ *  - For any undeliverable destination (limit, OSAL error, etc), the error is recorded
+ *    in the transmit state, and must be reported via CFE_SB_TransmitReportEvents()
+ *    after the lock is released.
  *  - For any successful queueing, the buffer use count is incremented
  *
  * The caller is expected to hold a reference (use count) of the buffer prior to invoking
@@ -668,10 +771,24 @@ void CFE_SB_ReturnBufferToPool(CFE_SB_BufferD_t *bd);
  * it should explicitly increment the use count before calling this, which will prevent
  * deallocation.
  *
- * \param[in] BufDscPtr Pointer to the buffer descriptor to broadcast
- * \param[in] RouteId   Route to send to
+ * @note This must only be invoked while holding the SB global lock
+ *
+ * \param[in]    BufDscPtr Pointer to the buffer descriptor to broadcast
+ * \param[inout] TxState   Transmit state with the route to send to, delivery errors are added
+ */
+void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SB_TransmitState_t *TxState);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+ * \brief Get the buffer descriptor from a pointer to its content
+ *
+ * This does not check that the pointer refers to an actual SB buffer.
+ *
+ * \param[in]  BufPtr pointer to the content buffer
+ *
+ * \returns Pointer to the buffer descriptor which contains the content
  */
-void CFE_SB_BroadcastBufferToRoute(CFE_SB_BufferD_t *BufDscPtr, CFE_SBR_RouteId_t RouteId);
+CFE_SB_BufferD_t *CFE_SB_GetBufferDescriptor(CFE_SB_Buffer_t *BufPtr);
 
 /*---------------------------------------------------------------------------------------*/
 /**
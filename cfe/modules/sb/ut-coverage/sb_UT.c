@@ -2907,6 +2907,8 @@ void Test_TransmitMsg_API(void)
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_GetPoolBufErr);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_IncrementSeqCnt);
     SB_UT_ADD_SUBTEST(Test_TransmitBuffer_NoIncrement);
+    SB_UT_ADD_SUBTEST(Test_TransmitMsgs_Batch);
+    SB_UT_ADD_SUBTEST(Test_TransmitBuffers_Batch);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_ZeroCopyBufferValidate);
     SB_UT_ADD_SUBTEST(Test_TransmitMsg_DisabledDestination);
     SB_UT_ADD_SUBTEST(Test_BroadcastBufferToRoute);
@@ -3429,6 +3431,111 @@ void Test_TransmitBuffer_NoIncrement(void)
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 }
 
+/*
+** Test sending several messages with one call, across more than one lock hold
+*/
+void Test_TransmitMsgs_Batch(void)
+{
+    const CFE_MSG_Message_t *MsgPtrs[CFE_SB_TRANSMIT_BATCH_SIZE + 2];
+    CFE_Status_t             StatusArray[CFE_SB_TRANSMIT_BATCH_SIZE + 2];
+    CFE_SB_MsgId_t           MsgId[CFE_SB_TRANSMIT_BATCH_SIZE + 1];
+    CFE_MSG_Size_t           Size[CFE_SB_TRANSMIT_BATCH_SIZE + 1];
+    CFE_MSG_Type_t           Type[CFE_SB_TRANSMIT_BATCH_SIZE + 1];
+    CFE_SB_PipeId_t          PipeId;
+    SB_UT_Test_Tlm_t         TlmPkt;
+    CFE_SB_PipeD_t *         PipeDscPtr;
+    uint32                   i;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 2 * CFE_SB_TRANSMIT_BATCH_SIZE, "BatchTestPipe"));
+    CFE_UtAssert_SETUP(
+        CFE_SB_SubscribeEx(SB_UT_TLM_MID, PipeId, CFE_SB_DEFAULT_QOS, 2 * CFE_SB_TRANSMIT_BATCH_SIZE));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+
+    /* One NULL entry which fails validation, all others are valid */
+    for (i = 0; i < (CFE_SB_TRANSMIT_BATCH_SIZE + 2); ++i)
+    {
+        MsgPtrs[i] = CFE_MSG_PTR(TlmPkt.TelemetryHeader);
+    }
+    MsgPtrs[3] = NULL;
+
+    /* Each valid message consumes one entry from the stub data buffers */
+    for (i = 0; i < (CFE_SB_TRANSMIT_BATCH_SIZE + 1); ++i)
+    {
+        MsgId[i] = SB_UT_TLM_MID;
+        Size[i]  = sizeof(TlmPkt);
+        Type[i]  = CFE_MSG_Type_Tlm;
+    }
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Type, sizeof(Type), false);
+    CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter = 0;
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgs(MsgPtrs, CFE_SB_TRANSMIT_BATCH_SIZE + 2, true, StatusArray),
+                      CFE_SB_BAD_ARGUMENT);
+
+    for (i = 0; i < (CFE_SB_TRANSMIT_BATCH_SIZE + 2); ++i)
+    {
+        UtAssert_INT32_EQ(StatusArray[i], (i == 3) ? CFE_SB_BAD_ARGUMENT : CFE_SUCCESS);
+    }
+
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, CFE_SB_TRANSMIT_BATCH_SIZE + 1);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgSendErrorCounter, 1);
+    CFE_UtAssert_EVENTSENT(CFE_SB_SEND_BAD_ARG_EID);
+
+    /* Bad array and empty array */
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgs(NULL, 1, true, StatusArray), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgs(MsgPtrs, 0, true, NULL));
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitMsgs_Batch */
+
+/*
+** Test sending several zero copy buffers with one call
+*/
+void Test_TransmitBuffers_Batch(void)
+{
+    CFE_SB_Buffer_t *SendPtrs[3];
+    CFE_SB_Buffer_t *ReceivePtrs[3];
+    CFE_Status_t     StatusArray[3];
+    CFE_SB_MsgId_t   MsgId[2] = {SB_UT_TLM_MID, SB_UT_TLM_MID};
+    CFE_MSG_Size_t   Size[2]  = {sizeof(SB_UT_Test_Tlm_t), sizeof(SB_UT_Test_Tlm_t)};
+    CFE_MSG_Type_t   Type[2]  = {CFE_MSG_Type_Tlm, CFE_MSG_Type_Tlm};
+    CFE_SB_PipeId_t  PipeId;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, 10, "ZeroCpyBatchPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+
+    /* The middle entry is not a zero copy buffer, so it fails validation */
+    SendPtrs[0] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    SendPtrs[1] = NULL;
+    SendPtrs[2] = CFE_SB_AllocateMessageBuffer(sizeof(SB_UT_Test_Tlm_t));
+    UtAssert_NOT_NULL(SendPtrs[0]);
+    UtAssert_NOT_NULL(SendPtrs[2]);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Type, sizeof(Type), false);
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitBuffers(SendPtrs, 3, true, StatusArray), CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(StatusArray[0]);
+    UtAssert_INT32_EQ(StatusArray[1], CFE_SB_BAD_ARGUMENT);
+    CFE_UtAssert_SUCCESS(StatusArray[2]);
+
+    /* Both valid buffers were delivered, in order */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(ReceivePtrs, 3, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_ADDRESS_EQ(ReceivePtrs[0], SendPtrs[0]);
+    UtAssert_ADDRESS_EQ(ReceivePtrs[1], SendPtrs[2]);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(ReceivePtrs, Count, PipeId));
+
+    UtAssert_INT32_EQ(CFE_SB_TransmitBuffers(NULL, 1, true, NULL), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_TransmitBuffers_Batch */
+
 /*
 ** Test releasing a pointer to a buffer for zero copy mode
 */
@@ -3507,13 +3614,14 @@ void Test_TransmitMsg_DisabledDestination(void)
 */
 void Test_BroadcastBufferToRoute(void)
 {
-    CFE_SB_PipeId_t   PipeId;
-    CFE_SB_MsgId_t    MsgId = SB_UT_TLM_MID;
-    CFE_SB_BufferD_t  SBBufD;
-    int32             PipeDepth;
-    CFE_SBR_RouteId_t RouteId;
+    CFE_SB_PipeId_t        PipeId;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    CFE_SB_BufferD_t       SBBufD;
+    int32                  PipeDepth;
+    CFE_SB_TransmitState_t TxState;
 
     memset(&SBBufD, 0, sizeof(SBBufD));
+    memset(&TxState, 0, sizeof(TxState));
     SBBufD.MsgId = MsgId;
     CFE_SB_TrackingListReset(&SBBufD.Link);
 
@@ -3521,16 +3629,23 @@ void Test_BroadcastBufferToRoute(void)
     CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "TestPipe"));
     CFE_UtAssert_SETUP(CFE_SB_Subscribe(MsgId, PipeId));
 
-    RouteId = CFE_SBR_GetRouteId(MsgId);
+    TxState.MsgId   = MsgId;
+    TxState.RouteId = CFE_SBR_GetRouteId(MsgId);
 
-    /* No return from this function - it handles all errors */
-    CFE_SB_BroadcastBufferToRoute(&SBBufD, RouteId);
+    /* No return from this function - delivery errors are recorded in the transmit state */
+    CFE_SB_BroadcastBufferToRoute(&SBBufD, &TxState);
+    UtAssert_UINT32_EQ(TxState.SendErr.EvtsToSnd, 0);
 
     CFE_UtAssert_EVENTCOUNT(2);
     UT_ClearEventHistory();
 
     /* Calling this with invalid route ID is essentially a no-op, called for coverage */
-    CFE_SB_BroadcastBufferToRoute(&SBBufD, CFE_SBR_INVALID_ROUTE_ID);
+    TxState.RouteId = CFE_SBR_INVALID_ROUTE_ID;
+    CFE_SB_BroadcastBufferToRoute(&SBBufD, &TxState);
+
+    /* Nothing was recorded, so reporting is also a no-op */
+    CFE_SB_TransmitReportEvents(&SBBufD.Content.Msg, &TxState);
+    CFE_UtAssert_EVENTCOUNT(0);
 
     CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
 
@@ -3541,20 +3656,22 @@ void Test_BroadcastBufferToRoute(void)
 */
 void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void)
 {
-    CFE_SB_MsgId_t    MsgId = SB_UT_TLM_MID;
-    CFE_SB_MsgId_t    MsgIdRtn;
-    SB_UT_Test_Tlm_t  TlmPkt;
-    CFE_MSG_Size_t    Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
-    CFE_MSG_Size_t    SizeRtn;
-    CFE_SBR_RouteId_t RouteIdRtn;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_MSG_Size_t         Size = CFE_MISSION_SB_MAX_SB_MSG_SIZE + 1;
+    CFE_SB_TransmitState_t TxState;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
-    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &MsgIdRtn, &SizeRtn, &RouteIdRtn),
-                      CFE_SB_MSG_TOO_BIG);
-    CFE_UtAssert_MSGID_EQ(MsgIdRtn, MsgId);
-    UtAssert_INT32_EQ(SizeRtn, Size);
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState), CFE_SB_MSG_TOO_BIG);
+    CFE_UtAssert_MSGID_EQ(TxState.MsgId, MsgId);
+    UtAssert_INT32_EQ(TxState.Size, Size);
+    UtAssert_UINT32_EQ(TxState.PendingEventID, CFE_SB_MSG_TOO_BIG_EID);
+
+    /* Validation itself does not send events, they are deferred until reported */
+    CFE_UtAssert_EVENTCOUNT(0);
+    CFE_SB_TransmitReportEvents(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
@@ -3566,21 +3683,24 @@ void Test_TransmitMsgValidate_MaxMsgSizePlusOne(void)
 */
 void Test_TransmitMsgValidate_NoSubscribers(void)
 {
-    CFE_SB_MsgId_t    MsgId = SB_UT_TLM_MID;
-    CFE_SB_MsgId_t    MsgIdRtn;
-    SB_UT_Test_Tlm_t  TlmPkt;
-    CFE_MSG_Size_t    Size = sizeof(TlmPkt);
-    CFE_MSG_Size_t    SizeRtn;
-    CFE_SBR_RouteId_t RouteIdRtn;
+    CFE_SB_MsgId_t         MsgId = SB_UT_TLM_MID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_MSG_Size_t         Size = sizeof(TlmPkt);
+    CFE_SB_TransmitState_t TxState;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
 
-    CFE_UtAssert_SUCCESS(
-        CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &MsgIdRtn, &SizeRtn, &RouteIdRtn));
-    CFE_UtAssert_MSGID_EQ(MsgIdRtn, MsgId);
-    UtAssert_INT32_EQ(SizeRtn, Size);
-    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(RouteIdRtn));
+    CFE_UtAssert_SUCCESS(CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState));
+    CFE_UtAssert_MSGID_EQ(TxState.MsgId, MsgId);
+    UtAssert_INT32_EQ(TxState.Size, Size);
+    UtAssert_UINT32_EQ(TxState.PendingEventID, 0);
+
+    CFE_SB_TransmitLookupRoute(&TxState);
+    UtAssert_BOOL_FALSE(CFE_SBR_IsValidRouteId(TxState.RouteId));
+    UtAssert_UINT32_EQ(TxState.PendingEventID, CFE_SB_SEND_NO_SUBS_EID);
+
+    CFE_SB_TransmitReportEvents(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState);
 
     CFE_UtAssert_EVENTCOUNT(1);
 
@@ -3592,16 +3712,17 @@ void Test_TransmitMsgValidate_NoSubscribers(void)
 */
 void Test_TransmitMsgValidate_InvalidMsgId(void)
 {
-    CFE_SB_MsgId_t    MsgId = CFE_SB_INVALID_MSG_ID;
-    CFE_SB_MsgId_t    MsgIdRtn;
-    SB_UT_Test_Tlm_t  TlmPkt;
-    CFE_MSG_Size_t    SizeRtn;
-    CFE_SBR_RouteId_t RouteIdRtn;
+    CFE_SB_MsgId_t         MsgId = CFE_SB_INVALID_MSG_ID;
+    SB_UT_Test_Tlm_t       TlmPkt;
+    CFE_SB_TransmitState_t TxState;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
 
-    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &MsgIdRtn, &SizeRtn, &RouteIdRtn),
+    UtAssert_INT32_EQ(CFE_SB_TransmitMsgValidate(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState),
                       CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(TxState.PendingEventID, CFE_SB_SEND_INV_MSGID_EID);
+
+    CFE_SB_TransmitReportEvents(CFE_MSG_PTR(TlmPkt.TelemetryHeader), &TxState);
     CFE_UtAssert_EVENTCOUNT(1);
     CFE_UtAssert_EVENTSENT(CFE_SB_SEND_INV_MSGID_EID);
 }
@@ -3618,6 +3739,9 @@ void Test_ReceiveBuffer_API(void)
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PipeReadError);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_PendForever);
     SB_UT_ADD_SUBTEST(Test_ReceiveBuffer_InvalidBufferPtr);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_InvalidArgs);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_Batch);
+    SB_UT_ADD_SUBTEST(Test_ReceiveBuffers_Tracking);
 } /* end Test_ReceiveBuffer_API */
 
 static void SB_UT_PipeIdModifyHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
@@ -3915,6 +4039,197 @@ void Test_ReceiveBuffer_InvalidBufferPtr(void)
 
 } /* end Test_ReceiveBuffer_InvalidBufferPtr */
 
+/*
+** Test batched receive/release responses to invalid arguments
+*/
+void Test_ReceiveBuffers_InvalidArgs(void)
+{
+    CFE_SB_Buffer_t *BufPtrs[4];
+    CFE_SB_PipeId_t  PipeId;
+    uint32           PipeDepth = 10;
+    uint32           Count;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+
+    Count = 99;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(NULL, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_UINT32_EQ(Count, 0);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, NULL, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 0, &Count, PipeId, CFE_SB_POLL), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, PipeId, -5), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, SB_UT_ALTERNATE_INVALID_PIPEID, CFE_SB_POLL),
+                      CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_EVENTSENT(CFE_SB_RCV_BAD_ARG_EID);
+    CFE_UtAssert_EVENTSENT(CFE_SB_BAD_PIPEID_EID);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 5);
+
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(NULL, 1, PipeId), CFE_SB_BAD_ARGUMENT);
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(BufPtrs, 0, SB_UT_ALTERNATE_INVALID_PIPEID), CFE_SB_BAD_ARGUMENT);
+
+    /* Timeout and empty queue are not errors, and return no buffers */
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_QUEUE_TIMEOUT);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, PipeId, 100), CFE_SB_TIME_OUT);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_QueueGet), 1, OS_ERROR);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, PipeId, CFE_SB_PEND_FOREVER), CFE_SB_PIPE_RD_ERR);
+    CFE_UtAssert_EVENTSENT(CFE_SB_Q_RD_ERR_EID);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffers_InvalidArgs */
+
+/*
+** Test receiving several messages in one batch, and releasing them
+*/
+void Test_ReceiveBuffers_Batch(void)
+{
+    CFE_SB_Buffer_t * BufPtrs[4];
+    CFE_SB_MsgId_t    MsgId[3];
+    CFE_SB_PipeId_t   PipeId;
+    SB_UT_Test_Tlm_t  TlmPkt;
+    uint32            PipeDepth = 10;
+    uint32            Count;
+    uint32            i;
+    CFE_MSG_Type_t    Type[3];
+    CFE_MSG_Size_t    Size[3];
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    /* Each transmit consumes one entry from the stub data buffers */
+    for (i = 0; i < 3; ++i)
+    {
+        MsgId[i] = SB_UT_TLM_MID;
+        Type[i]  = CFE_MSG_Type_Tlm;
+        Size[i]  = sizeof(TlmPkt);
+    }
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 3);
+
+    /* First batch is limited by MaxCount */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(BufPtrs, 2, &Count, PipeId, CFE_SB_PEND_FOREVER));
+    UtAssert_UINT32_EQ(Count, 2);
+    UtAssert_NOT_NULL(BufPtrs[0]);
+    UtAssert_NOT_NULL(BufPtrs[1]);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 1);
+
+    /* Batched buffers do not use the LastBuffer reference */
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+
+    /* Second batch is limited by what is on the queue */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(&BufPtrs[2], 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->CurrentQueueDepth, 0);
+
+    /* Each buffer is still held by the caller until released */
+    BufDscPtr = CFE_SB_GetBufferDescriptor(BufPtrs[2]);
+    UtAssert_UINT32_EQ(BufDscPtr->UseCount, 1);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 0);
+
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldBufferCount, 3);
+
+    /* A NULL entry is rejected, but does not stop the valid entries from being released */
+    BufPtrs[3] = NULL;
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(BufPtrs, 4, PipeId), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldBufferCount, 0);
+
+    /* Buffers that were already released are no longer held by the pipe */
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(BufPtrs, 1, PipeId), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 4, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_UINT32_EQ(Count, 0);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+
+} /* end Test_ReceiveBuffers_Batch */
+
+/*
+** Test that buffers from a batched receive are tracked by the pipe
+*/
+void Test_ReceiveBuffers_Tracking(void)
+{
+    CFE_SB_Buffer_t * BufPtrs[2];
+    CFE_SB_Buffer_t * SBBufPtr;
+    CFE_SB_PipeId_t   PipeId;
+    CFE_SB_PipeId_t   OtherPipeId;
+    SB_UT_Test_Tlm_t  TlmPkt;
+    CFE_SB_MsgId_t    MsgId     = SB_UT_TLM_MID;
+    CFE_MSG_Type_t    Type      = CFE_MSG_Type_Tlm;
+    CFE_MSG_Size_t    Size      = sizeof(TlmPkt);
+    uint32            PipeDepth = 10;
+    uint32            Count;
+    CFE_SB_PipeD_t *  PipeDscPtr;
+    CFE_SB_BufferD_t *BufDscPtr;
+
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&PipeId, PipeDepth, "RcvTestPipe"));
+    CFE_UtAssert_SETUP(CFE_SB_CreatePipe(&OtherPipeId, PipeDepth, "OtherPipe"));
+    PipeDscPtr = CFE_SB_LocatePipeDescByID(PipeId);
+    CFE_UtAssert_SETUP(CFE_SB_Subscribe(SB_UT_TLM_MID, PipeId));
+
+    /* A batch receive releases the buffer from a previous single receive */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffer(&SBBufPtr, PipeId, CFE_SB_POLL));
+    UtAssert_NOT_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_NO_MESSAGE);
+    UtAssert_NULL(PipeDscPtr->LastBuffer);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldBufferCount, 0);
+
+    /* The number of buffers received is limited by the free held buffer slots */
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &Size, sizeof(Size), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetType), &Type, sizeof(Type), false);
+    CFE_UtAssert_SETUP(CFE_SB_TransmitMsg(CFE_MSG_PTR(TlmPkt.TelemetryHeader), true));
+    PipeDscPtr->HeldBufferCount = CFE_SB_MAX_HELD_BUFFERS;
+    UtAssert_INT32_EQ(CFE_SB_ReceiveBuffers(BufPtrs, 2, &Count, PipeId, CFE_SB_POLL), CFE_SB_BUF_ALOC_ERR);
+    UtAssert_UINT32_EQ(Count, 0);
+    UtAssert_UINT32_EQ(CFE_SB_Global.HKTlmMsg.Payload.MsgReceiveErrorCounter, 1);
+    PipeDscPtr->HeldBufferCount = CFE_SB_MAX_HELD_BUFFERS - 1;
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(BufPtrs, 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    UtAssert_UINT32_EQ(PipeDscPtr->HeldBufferCount, CFE_SB_MAX_HELD_BUFFERS);
+    PipeDscPtr->HeldBufferCount = 1;
+
+    /* A buffer cannot be released through a pipe it was not received from */
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(BufPtrs, 1, OtherPipeId), CFE_SB_BAD_ARGUMENT);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    CFE_UtAssert_SUCCESS(CFE_SB_ReleaseBuffers(BufPtrs, 1, PipeId));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 2);
+
+    /* Deleting the pipe releases the buffers the owner did not release */
+    CFE_UtAssert_SUCCESS(CFE_SB_ReceiveBuffers(BufPtrs, 2, &Count, PipeId, CFE_SB_POLL));
+    UtAssert_UINT32_EQ(Count, 1);
+    BufDscPtr = CFE_SB_GetBufferDescriptor(BufPtrs[0]);
+    UtAssert_UINT32_EQ(BufDscPtr->UseCount, 1);
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(PipeId));
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 3);
+    UtAssert_INT32_EQ(CFE_SB_ReleaseBuffers(BufPtrs, 1, PipeId), CFE_SB_BAD_ARGUMENT);
+
+    CFE_UtAssert_TEARDOWN(CFE_SB_DeletePipe(OtherPipeId));
+
+} /* end Test_ReceiveBuffers_Tracking */
+
 /*
 ** Test SB Utility APIs
 */
@@ -4412,7 +4727,7 @@ void Test_SB_TransmitMsgPaths_Nominal(void)
     CFE_UtAssert_EVENTCOUNT(3);
 
     /*
-     * Test Additional paths within CFE_SB_TransmitMsgValidate that skip sending events to avoid a loop
+     * Test Additional paths within CFE_SB_TransmitReportEvents that skip sending events to avoid a loop
      * For all of these they should skip sending the event but still increment the MsgSendErrorCounter
      */
 
@@ -2000,6 +2000,38 @@ void Test_TransmitMsg_ZeroCopyBufferValidate(void);
 ******************************************************************************/
 void Test_TransmitBuffer_NoIncrement(void);
 
+/*****************************************************************************/
+/**
+** \brief Test sending several messages with a single call
+**
+** \par Description
+**        This function tests sending more messages than are handled in one
+**        hold of the SB lock, with one of them failing validation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitMsgs_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test sending several zero copy buffers with a single call
+**
+** \par Description
+**        This function tests sending zero copy buffers in a batch, with one
+**        of them failing validation.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_TransmitBuffers_Batch(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing a pointer to a buffer for zero copy mode
@@ -2224,6 +2256,55 @@ void Test_ReceiveBuffer_PendForever(void);
 ******************************************************************************/
 void Test_ReceiveBuffer_InvalidBufferPtr(void);
 
+/*****************************************************************************/
+/**
+** \brief Test batched receive and release responses to invalid arguments
+**
+** \par Description
+**        This function tests the argument checks of CFE_SB_ReceiveBuffers
+**        and CFE_SB_ReleaseBuffers, and the non-error empty/timeout cases.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_InvalidArgs(void);
+
+/*****************************************************************************/
+/**
+** \brief Test receiving and releasing a batch of messages
+**
+** \par Description
+**        This function tests receiving several messages with a single call
+**        to CFE_SB_ReceiveBuffers and releasing them together.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_Batch(void);
+
+/*****************************************************************************/
+/**
+** \brief Test that batch received buffers are tracked by the pipe
+**
+** \par Description
+**        This function tests the per-pipe tracking of buffers returned by
+**        CFE_SB_ReceiveBuffers: the held buffer limit, release ownership
+**        checks, the LastBuffer release, and cleanup on pipe delete.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \returns
+**        This function does not return a value.
+******************************************************************************/
+void Test_ReceiveBuffers_Tracking(void);
+
 /*****************************************************************************/
 /**
 ** \brief Test releasing zero copy buffers for all pipes owned by a
@@ -328,9 +328,10 @@ CFE_Status_t CFE_TBL_Register(CFE_TBL_Handle_t *TblHandlePtr, const char *Name,
                     /* Initialize the Table Access Descriptor */
                     AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                    AccessDescPtr->AppId    = ThisAppId;
-                    AccessDescPtr->LockFlag = false;
-                    AccessDescPtr->Updated  = false;
+                    AccessDescPtr->AppId           = ThisAppId;
+                    AccessDescPtr->LockFlag        = false;
+                    AccessDescPtr->Updated         = false;
+                    AccessDescPtr->CachedBufferPtr = NULL;
 
                     if ((RegRecPtr->DumpOnly) && (!RegRecPtr->UserDefAddr))
                     {
@@ -554,9 +555,10 @@ CFE_Status_t CFE_TBL_Share(CFE_TBL_Handle_t *TblHandlePtr, const char *TblName)
                 /* Initialize the Table Access Descriptor */
                 AccessDescPtr = &CFE_TBL_Global.Handles[*TblHandlePtr];
 
-                AccessDescPtr->AppId    = ThisAppId;
-                AccessDescPtr->LockFlag = false;
-                AccessDescPtr->Updated  = false;
+                AccessDescPtr->AppId           = ThisAppId;
+                AccessDescPtr->LockFlag        = false;
+                AccessDescPtr->Updated         = false;
+                AccessDescPtr->CachedBufferPtr = NULL;
 
                 /* Check current state of table in order to set Notification flags properly */
                 if (RegRecPtr->TableLoadedOnce)
@@ -735,6 +737,8 @@ CFE_Status_t CFE_TBL_Load(CFE_TBL_Handle_t TblHandle, CFE_TBL_SrcEnum_t SrcType,
         RegRecPtr->Buffers[0].FileCreateTimeSecs    = 0;
         RegRecPtr->Buffers[0].FileCreateTimeSubSecs = 0;
 
+        CFE_TBL_InvalidateCachedAddresses(RegRecPtr);
+
         CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_SUCCESS_INF_EID, CFE_EVS_EventType_DEBUG, CFE_TBL_Global.TableTaskAppId,
                                    "Successfully loaded '%s' from '%s'", RegRecPtr->Name,
                                    RegRecPtr->Buffers[0].DataSource);
@@ -1035,8 +1039,9 @@ CFE_Status_t CFE_TBL_ReleaseAddress(CFE_TBL_Handle_t TblHandle)
 
     if (Status == CFE_SUCCESS)
     {
-        /* Clear the lock flag */
-        CFE_TBL_Global.Handles[TblHandle].LockFlag = false;
+        /* Drop the hold on the buffer, ending its grace period if this was the last reader */
+        CFE_TBL_ReleaseBuffer(&CFE_TBL_Global.Handles[TblHandle],
+                              &CFE_TBL_Global.Registry[CFE_TBL_Global.Handles[TblHandle].RegIndex]);
 
         /* Return any pending warning or info status indicators */
         Status = CFE_TBL_GetNextNotification(TblHandle);
@@ -1577,6 +1582,8 @@ CFE_Status_t CFE_TBL_Modified(CFE_TBL_Handle_t TblHandle)
 
             AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
         }
+
+        CFE_TBL_InvalidateCachedAddresses(RegRecPtr);
     }
     else
     {
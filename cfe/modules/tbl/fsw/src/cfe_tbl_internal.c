@@ -36,6 +36,7 @@
 #include "edslib_datatypedb.h"
 #include "cfe_mission_eds_parameters.h"
 #include "cfe_config.h"
+#include "osapi-atomic.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -206,8 +207,15 @@ int32 CFE_TBL_EarlyInit(void)
  *-----------------------------------------------------------------*/
 void CFE_TBL_InitRegistryRecord(CFE_TBL_RegistryRec_t *RegRecPtr)
 {
+    uint32 Generation;
+
+    /* The generation must never repeat for a reused record, or a stale cached address could be accepted */
+    Generation = OS_AtomicLoad32(&RegRecPtr->Generation);
+
     memset(RegRecPtr, 0, sizeof(*RegRecPtr));
 
+    OS_AtomicStore32(&RegRecPtr->Generation, Generation + 1);
+
     RegRecPtr->OwnerAppId            = CFE_TBL_NOT_OWNED;
     RegRecPtr->NotificationMsgId     = CFE_SB_INVALID_MSG_ID;
     RegRecPtr->HeadOfAccessList      = CFE_TBL_END_OF_LIST;
@@ -344,6 +352,9 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
         }
     }
 
+    /* Drop any buffer still held through this descriptor before returning it to the pool */
+    CFE_TBL_ReleaseBuffer(AccessDescPtr, RegRecPtr);
+
     /* Return the Access Descriptor to the pool */
     AccessDescPtr->UsedFlag = false;
 
@@ -407,6 +418,8 @@ int32 CFE_TBL_RemoveAccessLink(CFE_TBL_Handle_t TblHandle)
 int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_ES_AppId_t ThisAppId)
 {
     int32                       Status;
+    uint32                      Generation;
+    bool                        FastPath;
     CFE_TBL_AccessDescriptor_t *AccessDescPtr;
     CFE_TBL_RegistryRec_t *     RegRecPtr;
 
@@ -436,21 +449,52 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
             }
             else /* Table Registry Entry is valid */
             {
-                /* Lock the table and return the current pointer */
-                AccessDescPtr->LockFlag = true;
+                /* Fast path: nothing has changed since the address was last resolved through */
+                /* this descriptor, so only the buffer hold and a generation check are needed  */
+                FastPath = false;
+                if (AccessDescPtr->CachedBufferPtr != NULL &&
+                    AccessDescPtr->CachedGeneration == OS_AtomicLoad32(&RegRecPtr->Generation))
+                {
+                    CFE_TBL_HoldBuffer(AccessDescPtr, RegRecPtr, AccessDescPtr->BufferIndex);
+
+                    /* Re-check now that the hold is visible, in case a swap completed in between */
+                    FastPath = (AccessDescPtr->CachedGeneration == OS_AtomicLoad32(&RegRecPtr->Generation));
+                }
+
+                if (FastPath)
+                {
+                    *TblPtr = AccessDescPtr->CachedBufferPtr;
+                }
+                else
+                {
+                    /* Hold the active buffer so that no one will modify it until we are done, even */
+                    /* if it becomes inactive while we are using it.  If the generation moved while */
+                    /* taking the hold, a swap may have raced with us so resolve it again.          */
+                    do
+                    {
+                        Generation = OS_AtomicLoad32(&RegRecPtr->Generation);
+                        CFE_TBL_HoldBuffer(AccessDescPtr, RegRecPtr, RegRecPtr->ActiveBufferIndex);
+                    } while (Generation != OS_AtomicLoad32(&RegRecPtr->Generation));
 
-                /* Save the buffer we are using in the access descriptor */
-                /* This is used to ensure that if the buffer becomes inactive while */
-                /* we are using it, no one will modify it until we are done */
-                AccessDescPtr->BufferIndex = RegRecPtr->ActiveBufferIndex;
+                    *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
 
-                *TblPtr = RegRecPtr->Buffers[AccessDescPtr->BufferIndex].BufferPtr;
+                    /* Return any pending warning or info status indicators */
+                    Status = CFE_TBL_GetNextNotification(TblHandle);
 
-                /* Return any pending warning or info status indicators */
-                Status = CFE_TBL_GetNextNotification(TblHandle);
+                    /* Clear Table Updated Notify Bit so that caller only gets it once */
+                    AccessDescPtr->Updated = false;
 
-                /* Clear Table Updated Notify Bit so that caller only gets it once */
-                AccessDescPtr->Updated = false;
+                    /* Only a plain success can be replayed by the fast path on the next call */
+                    if (Status == CFE_SUCCESS)
+                    {
+                        AccessDescPtr->CachedBufferPtr  = *TblPtr;
+                        AccessDescPtr->CachedGeneration = Generation;
+                    }
+                    else
+                    {
+                        AccessDescPtr->CachedBufferPtr = NULL;
+                    }
+                }
             }
         }
         else
@@ -496,6 +540,59 @@ int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle)
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_HoldBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_HoldBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
+                        uint8 BufferIndex)
+{
+    /* Take the new hold before dropping any previous one, so a buffer held twice is never seen as free */
+    OS_AtomicFetchAdd32(&RegRecPtr->Buffers[BufferIndex].ReaderCount, 1);
+
+    if (AccessDescPtr->LockFlag)
+    {
+        OS_AtomicFetchSub32(&RegRecPtr->Buffers[AccessDescPtr->BufferIndex].ReaderCount, 1);
+    }
+
+    AccessDescPtr->BufferIndex = BufferIndex;
+    AccessDescPtr->LockFlag    = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_ReleaseBuffer
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_ReleaseBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    if (AccessDescPtr->LockFlag)
+    {
+        AccessDescPtr->LockFlag = false;
+        OS_AtomicFetchSub32(&RegRecPtr->Buffers[AccessDescPtr->BufferIndex].ReaderCount, 1);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_InvalidateCachedAddresses
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CFE_TBL_InvalidateCachedAddresses(CFE_TBL_RegistryRec_t *RegRecPtr)
+{
+    OS_AtomicFetchAdd32(&RegRecPtr->Generation, 1);
+}
+
 /*----------------------------------------------------------------
  *
  * Function: CFE_TBL_FindTableInRegistry
@@ -680,7 +777,7 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
     int32            OsStatus;
     int32            i;
     int32            InactiveBufferIndex;
-    CFE_TBL_Handle_t AccessIterator;
+    uint32           ReaderCount;
 
     /* Initialize return pointer to NULL */
     *WorkingBufferPtr = NULL;
@@ -723,22 +820,15 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
                 /* Determine the index of the Inactive Buffer Pointer */
                 InactiveBufferIndex = 1 - RegRecPtr->ActiveBufferIndex;
 
-                /* Scan the access descriptor table to determine if anyone is still using the inactive buffer */
-                AccessIterator = RegRecPtr->HeadOfAccessList;
-                while ((AccessIterator != CFE_TBL_END_OF_LIST) && (Status == CFE_SUCCESS))
+                /* The inactive buffer can only be reused once every reader that held it across */
+                /* the last swap has released it, i.e. once its grace period has elapsed        */
+                ReaderCount = OS_AtomicLoad32(&RegRecPtr->Buffers[InactiveBufferIndex].ReaderCount);
+                if (ReaderCount != 0)
                 {
-                    if ((CFE_TBL_Global.Handles[AccessIterator].BufferIndex == InactiveBufferIndex) &&
-                        (CFE_TBL_Global.Handles[AccessIterator].LockFlag))
-                    {
-                        Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
-
-                        CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by AppId=%lu\n", __func__,
-                                             RegRecPtr->Name,
-                                             CFE_RESOURCEID_TO_ULONG(CFE_TBL_Global.Handles[AccessIterator].AppId));
-                    }
+                    Status = CFE_TBL_ERR_NO_BUFFER_AVAIL;
 
-                    /* Move to next access descriptor in linked list */
-                    AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
+                    CFE_ES_WriteToSysLog("%s: Inactive Dbl Buff Locked for '%s' by %lu reader(s)\n", __func__,
+                                         RegRecPtr->Name, (unsigned long)ReaderCount);
                 }
 
                 /* If buffer is free, then return the pointer to it */
@@ -804,23 +894,16 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 
 /*----------------------------------------------------------------
  *
- * Function: CFE_TBL_LoadFromFile
+ * Function: CFE_TBL_ValidateFileHeader
  *
  * Application-scope internal function
  * See description in header file for argument/return detail
  *
  *-----------------------------------------------------------------*/
-int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
-                           const char *Filename)
+int32 CFE_TBL_ValidateFileHeader(const char *AppName, const CFE_TBL_RegistryRec_t *RegRecPtr,
+                                 const CFE_TBL_File_Hdr_t *TblFileHeaderPtr, size_t *PackedSizePtr)
 {
     int32                        Status = CFE_SUCCESS;
-    int32                        OsStatus;
-    CFE_FS_Header_t              StdFileHeader;
-    CFE_TBL_File_Hdr_t           TblFileHeader;
-    osal_id_t                    FileDescriptor;
-    size_t                       FilenameLen = strlen(Filename);
-    uint32                       NumBytes;
-    uint8                        ExtraByte;
     EdsLib_Id_t                  EdsId;
     int32                        EdsStatus;
     EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
@@ -828,6 +911,73 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
 
     const EdsLib_DatabaseObject_t *EDS_DB = CFE_Config_GetObjPointer(CFE_CONFIGID_MISSION_EDS_DB);
 
+    EdsId     = EDSLIB_MAKE_ID(TblFileHeaderPtr->EdsAppId, TblFileHeaderPtr->EdsFormatId);
+    EdsStatus = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &TypeInfo);
+    if (EdsStatus != EDSLIB_SUCCESS)
+    {
+        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
+    }
+
+    EdsPackedTableSize = (TypeInfo.Size.Bits + 7) / 8;
+    *PackedSizePtr     = EdsPackedTableSize;
+
+    if (strcmp(RegRecPtr->Name, TblFileHeaderPtr->TableName) != 0)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TBLNAME_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId, "%s: Table name mismatch (exp=%s, tblfilhdr=%s)",
+                                   AppName, RegRecPtr->Name, TblFileHeaderPtr->TableName);
+
+        return CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
+    }
+
+    if ((TblFileHeaderPtr->Offset + TblFileHeaderPtr->NumBytes) > EdsPackedTableSize)
+    {
+        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                   CFE_TBL_Global.TableTaskAppId,
+                                   "%s: File reports size larger than expected (file=%lu, exp=%lu)", AppName,
+                                   (long unsigned int)(TblFileHeaderPtr->Offset + TblFileHeaderPtr->NumBytes),
+                                   (long unsigned int)EdsPackedTableSize);
+
+        return CFE_TBL_ERR_FILE_TOO_LARGE;
+    }
+
+    /* Any Table load that starts beyond the first byte is a "partial load" */
+    /* But a file that starts with the first byte and ends before filling   */
+    /* the whole table is just considered "short".                          */
+    if (TblFileHeaderPtr->Offset > 0)
+    {
+        Status = CFE_TBL_WARN_PARTIAL_LOAD;
+    }
+    else if (TblFileHeaderPtr->NumBytes < EdsPackedTableSize)
+    {
+        Status = CFE_TBL_WARN_SHORT_FILE;
+    }
+
+    return Status;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_LoadFromFile
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
+                           const char *Filename)
+{
+    int32              Status = CFE_SUCCESS;
+    int32              OsStatus;
+    CFE_FS_Header_t    StdFileHeader;
+    CFE_TBL_File_Hdr_t TblFileHeader;
+    osal_id_t          FileDescriptor;
+    size_t             FilenameLen = strlen(Filename);
+    uint32             NumBytes;
+    uint8              ExtraByte;
+    EdsLib_Id_t        EdsId;
+    size_t             EdsPackedTableSize;
+
     if (FilenameLen > (OS_MAX_PATH_LEN - 1))
     {
         CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_FILENAME_LONG_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -859,48 +1009,17 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
         return Status;
     }
 
-    EdsId     = EDSLIB_MAKE_ID(TblFileHeader.EdsAppId, TblFileHeader.EdsFormatId);
-    EdsStatus = EdsLib_DataTypeDB_GetTypeInfo(EDS_DB, EdsId, &TypeInfo);
-    if (EdsStatus != EDSLIB_SUCCESS)
-    {
-        return CFE_STATUS_EXTERNAL_RESOURCE_FAIL;
-    }
-
-    EdsPackedTableSize = (TypeInfo.Size.Bits + 7) / 8;
-
     /* Verify that the specified file has compatible data for specified table */
-    if (strcmp(RegRecPtr->Name, TblFileHeader.TableName) != 0)
+    Status = CFE_TBL_ValidateFileHeader(AppName, RegRecPtr, &TblFileHeader, &EdsPackedTableSize);
+    if (Status < CFE_SUCCESS)
     {
-        CFE_EVS_SendEventWithAppID(CFE_TBL_LOAD_TBLNAME_MISMATCH_ERR_EID, CFE_EVS_EventType_ERROR,
-                                   CFE_TBL_Global.TableTaskAppId, "%s: Table name mismatch (exp=%s, tblfilhdr=%s)",
-                                   AppName, RegRecPtr->Name, TblFileHeader.TableName);
+        /* CFE_TBL_ValidateFileHeader() generates its own events */
 
         OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_FOR_WRONG_TABLE;
-    }
-
-    if ((TblFileHeader.Offset + TblFileHeader.NumBytes) > EdsPackedTableSize)
-    {
-        CFE_EVS_SendEventWithAppID(
-            CFE_TBL_LOAD_EXCEEDS_SIZE_ERR_EID, CFE_EVS_EventType_ERROR, CFE_TBL_Global.TableTaskAppId,
-            "%s: File reports size larger than expected (file=%lu, exp=%lu)", AppName,
-            (long unsigned int)(TblFileHeader.Offset + TblFileHeader.NumBytes), (long unsigned int)EdsPackedTableSize);
-
-        OS_close(FileDescriptor);
-        return CFE_TBL_ERR_FILE_TOO_LARGE;
+        return Status;
     }
 
-    /* Any Table load that starts beyond the first byte is a "partial load" */
-    /* But a file that starts with the first byte and ends before filling   */
-    /* the whole table is just considered "short".                          */
-    if (TblFileHeader.Offset > 0)
-    {
-        Status = CFE_TBL_WARN_PARTIAL_LOAD;
-    }
-    else if (TblFileHeader.NumBytes < EdsPackedTableSize)
-    {
-        Status = CFE_TBL_WARN_SHORT_FILE;
-    }
+    EdsId = EDSLIB_MAKE_ID(TblFileHeader.EdsAppId, TblFileHeader.EdsFormatId);
 
     OsStatus =
         OS_read(FileDescriptor, ((uint8 *)WorkingBufferPtr->BufferPtr) + TblFileHeader.Offset, TblFileHeader.NumBytes);
@@ -964,6 +1083,116 @@ int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBuffe
     return Status;
 }
 
+/*----------------------------------------------------------------
+ *
+ * Function: CFE_TBL_LoadFromMappedFile
+ *
+ * Application-scope internal function
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 CFE_TBL_LoadFromMappedFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                 CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename)
+{
+    int32              Status;
+    int32              OsStatus;
+    CFE_FS_Header_t    StdFileHeader;
+    CFE_TBL_File_Hdr_t TblFileHeader;
+    osal_id_t          FileDescriptor;
+    const void *       MapAddr;
+    size_t             MapSize;
+    size_t             HeaderSize = 0;
+    size_t             EdsPackedTableSize;
+
+    /*
+     * Anything that prevents the file from being mapped is left for the
+     * regular read path to handle and report, as is a partial or short
+     * load, which must be merged with the current table contents.
+     */
+    OsStatus = OS_OpenCreate(&FileDescriptor, Filename, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (OsStatus != OS_SUCCESS)
+    {
+        return CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    OsStatus = OS_FileMap(FileDescriptor, &MapAddr, &MapSize);
+    if (OsStatus != OS_SUCCESS)
+    {
+        OS_close(FileDescriptor);
+        return CFE_STATUS_NOT_IMPLEMENTED;
+    }
+
+    Status = CFE_TBL_ReadHeaders(FileDescriptor, &StdFileHeader, &TblFileHeader, Filename);
+
+    if (Status == CFE_SUCCESS)
+    {
+        /* The table data immediately follows the headers */
+        OsStatus = OS_lseek(FileDescriptor, 0, OS_SEEK_CUR);
+        if (OsStatus < OS_SUCCESS)
+        {
+            Status = CFE_STATUS_NOT_IMPLEMENTED;
+        }
+        else
+        {
+            HeaderSize = (size_t)OsStatus; /* status code conversion (offset) */
+            Status     = CFE_TBL_ValidateFileHeader(AppName, RegRecPtr, &TblFileHeader, &EdsPackedTableSize);
+        }
+    }
+
+    if (Status == CFE_TBL_WARN_PARTIAL_LOAD || Status == CFE_TBL_WARN_SHORT_FILE)
+    {
+        Status = CFE_STATUS_NOT_IMPLEMENTED;
+    }
+    else if (Status == CFE_SUCCESS)
+    {
+        if (MapSize < (HeaderSize + TblFileHeader.NumBytes))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_INCOMPLETE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId, "%s: File load incomplete (exp=%lu, read=%lu)",
+                                       AppName, (long unsigned int)TblFileHeader.NumBytes,
+                                       (long unsigned int)(MapSize > HeaderSize ? MapSize - HeaderSize : 0));
+
+            Status = CFE_TBL_ERR_LOAD_INCOMPLETE;
+        }
+        else if (MapSize > (HeaderSize + TblFileHeader.NumBytes))
+        {
+            CFE_EVS_SendEventWithAppID(CFE_TBL_FILE_TOO_BIG_ERR_EID, CFE_EVS_EventType_ERROR,
+                                       CFE_TBL_Global.TableTaskAppId, "%s: File load too long (file length > %lu)",
+                                       AppName, (long unsigned int)TblFileHeader.NumBytes);
+
+            Status = CFE_TBL_ERR_FILE_TOO_LARGE;
+        }
+        else
+        {
+            /*
+             * Decode straight from the mapped file into the working buffer,
+             * without staging the packed image in a shared load buffer.  The
+             * CRC of the decoded table is computed as part of the decode,
+             * while the contents are still cache-hot, and is the only CRC
+             * computed on this path.
+             */
+            Status = CFE_TBL_DecodeFromMemory((const uint8 *)MapAddr + HeaderSize,
+                                              EDSLIB_MAKE_ID(TblFileHeader.EdsAppId, TblFileHeader.EdsFormatId),
+                                              WorkingBufferPtr, RegRecPtr);
+        }
+    }
+
+    if (Status == CFE_SUCCESS)
+    {
+        memset(WorkingBufferPtr->DataSource, 0, sizeof(WorkingBufferPtr->DataSource));
+        strncpy(WorkingBufferPtr->DataSource, Filename, sizeof(WorkingBufferPtr->DataSource) - 1);
+
+        /* Save file creation time for later storage into Registry */
+        WorkingBufferPtr->FileCreateTimeSecs    = StdFileHeader.TimeSeconds;
+        WorkingBufferPtr->FileCreateTimeSubSecs = StdFileHeader.TimeSubSeconds;
+    }
+
+    OS_FileUnmap(MapAddr, MapSize);
+    OS_close(FileDescriptor);
+
+    return Status;
+}
+
 CFE_Status_t CFE_TBL_DecodeFromMemory(const void *PackedBuffer, EdsLib_Id_t EdsId, CFE_TBL_LoadBuff_t *NativeBufferPtr,
                                       CFE_TBL_RegistryRec_t *RegRecPtr)
 {
@@ -1054,6 +1283,17 @@ int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *Wor
     uint16              ScratchBuffId;
     int32               Status;
 
+    /*
+     * Where the OS supports it, the table is decoded directly out of a memory
+     * mapping of the file, which needs neither a copy of the file contents nor
+     * a scratch buffer to hold them.  Otherwise fall back to reading the file.
+     */
+    Status = CFE_TBL_LoadFromMappedFile(AppName, WorkingBufferPtr, RegRecPtr, Filename);
+    if (Status != CFE_STATUS_NOT_IMPLEMENTED)
+    {
+        return Status;
+    }
+
     /*
      * EDS INTEGRATION:
      * In order to load from a file we need to first obtain a scratch buffer, which
@@ -1136,9 +1376,7 @@ int32 CFE_TBL_LoadFromFileAndDecode(const char *AppName, CFE_TBL_LoadBuff_t *Wor
 int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *RegRecPtr,
                              CFE_TBL_AccessDescriptor_t *AccessDescPtr)
 {
-    int32            Status = CFE_SUCCESS;
-    CFE_TBL_Handle_t AccessIterator;
-    bool             LockStatus = false;
+    int32 Status = CFE_SUCCESS;
 
     if ((!RegRecPtr->LoadPending) || (RegRecPtr->LoadInProgress == CFE_TBL_NO_LOAD_IN_PROGRESS))
     {
@@ -1171,15 +1409,7 @@ int32 CFE_TBL_UpdateInternal(CFE_TBL_Handle_t TblHandle, CFE_TBL_RegistryRec_t *
         else
         {
             /* Check to see if the Table is locked by anyone */
-            AccessIterator = RegRecPtr->HeadOfAccessList;
-            while (AccessIterator != CFE_TBL_END_OF_LIST)
-            {
-                LockStatus = (LockStatus || CFE_TBL_Global.Handles[AccessIterator].LockFlag);
-
-                AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
-            }
-
-            if (LockStatus)
+            if (OS_AtomicLoad32(&RegRecPtr->Buffers[0].ReaderCount) != 0)
             {
                 Status = CFE_TBL_INFO_TABLE_LOCKED;
 
@@ -1255,6 +1485,9 @@ void CFE_TBL_NotifyTblUsersOfUpdate(CFE_TBL_RegistryRec_t *RegRecPtr)
 
         AccessIterator = CFE_TBL_Global.Handles[AccessIterator].NextLink;
     }
+
+    /* Force every user through the full GetAddress path to pick up the new buffer and notification */
+    CFE_TBL_InvalidateCachedAddresses(RegRecPtr);
 }
 
 /*----------------------------------------------------------------
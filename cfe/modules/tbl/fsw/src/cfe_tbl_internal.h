@@ -192,6 +192,62 @@ int32 CFE_TBL_GetAddressInternal(void **TblPtr, CFE_TBL_Handle_t TblHandle, CFE_
 */
 int32 CFE_TBL_GetNextNotification(CFE_TBL_Handle_t TblHandle);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Holds a table buffer on behalf of an Access Descriptor
+**
+** \par Description
+**        Increments the reader count of the specified buffer and records it
+**        as the buffer in use by the Access Descriptor.  If the descriptor
+**        already held a buffer, that hold is dropped after the new one is taken.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This function assumes the Access Descriptor belongs to the
+**        calling task and does not require the registry to be locked.
+**
+** \param[in, out] AccessDescPtr Pointer to the Access Descriptor taking the hold
+** \param[in, out] RegRecPtr     Pointer to the table's Registry Record
+** \param[in]      BufferIndex   Index of the buffer to hold
+**
+*/
+void CFE_TBL_HoldBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
+                        uint8 BufferIndex);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Releases the table buffer held by an Access Descriptor
+**
+** \par Description
+**        Decrements the reader count of the buffer held by the Access Descriptor,
+**        if any.  A buffer may only be overwritten once its reader count is zero.
+**
+** \par Assumptions, External Events, and Notes:
+**        None
+**
+** \param[in, out] AccessDescPtr Pointer to the Access Descriptor releasing the hold
+** \param[in, out] RegRecPtr     Pointer to the table's Registry Record
+**
+*/
+void CFE_TBL_ReleaseBuffer(CFE_TBL_AccessDescriptor_t *AccessDescPtr, CFE_TBL_RegistryRec_t *RegRecPtr);
+
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Invalidates all table addresses cached by the table's Access Descriptors
+**
+** \par Description
+**        Advances the generation of the Registry Record so that the next call
+**        to #CFE_TBL_GetAddress through any handle resolves the active buffer
+**        and pending notifications again rather than using its cached address.
+**
+** \par Assumptions, External Events, and Notes:
+**        Note: This must be called after the change it publishes (buffer
+**        swap, updated flags, etc.) has been made.
+**
+** \param[in, out] RegRecPtr Pointer to the table's Registry Record
+**
+*/
+void CFE_TBL_InvalidateCachedAddresses(CFE_TBL_RegistryRec_t *RegRecPtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Returns the Registry Index for the specified Table Name
@@ -324,6 +380,36 @@ int32 CFE_TBL_UnlockRegistry(void);
 int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                                bool CalledByApp);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Checks a table file header against the table it is to be loaded into
+**
+** \par Description
+**        Verifies that the table file header names the specified table and
+**        that the data it describes fits within the table.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes parameters have been verified.
+**
+** \param[in]  AppName          The name of the application loading the table.
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for table to be loaded
+**
+** \param[in]  TblFileHeaderPtr Pointer to the table file header read from the file
+**
+** \param[out] PackedSizePtr    Size of the complete table in its packed (file) format
+**
+** \retval #CFE_SUCCESS                       \copydoc CFE_SUCCESS
+** \retval #CFE_TBL_WARN_SHORT_FILE           \copydoc CFE_TBL_WARN_SHORT_FILE
+** \retval #CFE_TBL_WARN_PARTIAL_LOAD         \copydoc CFE_TBL_WARN_PARTIAL_LOAD
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE        \copydoc CFE_TBL_ERR_FILE_TOO_LARGE
+** \retval #CFE_TBL_ERR_FILE_FOR_WRONG_TABLE  \copydoc CFE_TBL_ERR_FILE_FOR_WRONG_TABLE
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \copydoc CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+*/
+int32 CFE_TBL_ValidateFileHeader(const char *AppName, const CFE_TBL_RegistryRec_t *RegRecPtr,
+                                 const CFE_TBL_File_Hdr_t *TblFileHeaderPtr, size_t *PackedSizePtr);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Loads a table buffer with data from a specified file
@@ -367,6 +453,49 @@ int32 CFE_TBL_GetWorkingBuffer(CFE_TBL_LoadBuff_t **WorkingBufferPtr, CFE_TBL_Re
 int32 CFE_TBL_LoadFromFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr, CFE_TBL_RegistryRec_t *RegRecPtr,
                            const char *Filename);
 
+/*---------------------------------------------------------------------------------------*/
+/**
+** \brief Loads and decodes a table buffer directly from a memory mapped file
+**
+** \par Description
+**        Maps the specified table file into memory and decodes the table
+**        image straight from the mapping into the specified working buffer,
+**        computing the CRC of the decoded table as it goes.  No shared load
+**        buffer is needed.
+**
+** \par Assumptions, External Events, and Notes:
+**        -# This function assumes parameters have been verified.
+**        -# Only complete table images are loaded this way.  If the file cannot
+**           be mapped, or holds a partial or short load, nothing is reported and
+**           #CFE_STATUS_NOT_IMPLEMENTED is returned so the caller can fall back
+**           to reading the file.
+**
+** \param[in]  AppName          The name of the application loading the table.
+**
+** \param[in]  WorkingBufferPtr Pointer to a working buffer that is to be loaded
+**                              with the contents of the specified file
+**
+** \param[in]  RegRecPtr        Pointer to Table Registry record for table whose
+**                              buffer is to filled with data from the specified file
+**
+** \param[in]  Filename         Pointer to ASCII string containing full path and filename
+**                              of table image file to be loaded
+**
+** \retval #CFE_SUCCESS                       \copydoc CFE_SUCCESS
+** \retval #CFE_STATUS_NOT_IMPLEMENTED        \copydoc CFE_STATUS_NOT_IMPLEMENTED
+** \retval #CFE_TBL_ERR_LOAD_INCOMPLETE       \copydoc CFE_TBL_ERR_LOAD_INCOMPLETE
+** \retval #CFE_TBL_ERR_FILE_TOO_LARGE        \copydoc CFE_TBL_ERR_FILE_TOO_LARGE
+** \retval #CFE_TBL_ERR_FILE_FOR_WRONG_TABLE  \copydoc CFE_TBL_ERR_FILE_FOR_WRONG_TABLE
+** \retval #CFE_TBL_ERR_NO_STD_HEADER         \copydoc CFE_TBL_ERR_NO_STD_HEADER
+** \retval #CFE_TBL_ERR_NO_TBL_HEADER         \copydoc CFE_TBL_ERR_NO_TBL_HEADER
+** \retval #CFE_TBL_ERR_BAD_CONTENT_ID        \copydoc CFE_TBL_ERR_BAD_CONTENT_ID
+** \retval #CFE_TBL_ERR_BAD_SUBTYPE_ID        \copydoc CFE_TBL_ERR_BAD_SUBTYPE_ID
+** \retval #CFE_STATUS_EXTERNAL_RESOURCE_FAIL \copydoc CFE_STATUS_EXTERNAL_RESOURCE_FAIL
+**
+*/
+int32 CFE_TBL_LoadFromMappedFile(const char *AppName, CFE_TBL_LoadBuff_t *WorkingBufferPtr,
+                                 CFE_TBL_RegistryRec_t *RegRecPtr, const char *Filename);
+
 /*---------------------------------------------------------------------------------------*/
 /**
 ** \brief Updates the active table buffer with contents of inactive buffer
@@ -139,6 +139,7 @@ typedef struct
     uint32      FileCreateTimeSecs;    /**< \brief File creation time from last file loaded into table */
     uint32      FileCreateTimeSubSecs; /**< \brief File creation time from last file loaded into table */
     uint32      Crc;                   /**< \brief Last calculated CRC for this buffer's contents */
+    uint32      ReaderCount;           /**< \brief Number of access descriptors currently holding this buffer */
     bool        Taken;                 /**< \brief Flag indicating whether buffer is in use */
     bool        Validated;             /**< \brief Flag indicating whether the buffer has been successfully validated */
     char        DataSource[OS_MAX_PATH_LEN]; /**< \brief Source of data put into buffer (filename or memory address) */
@@ -155,14 +156,16 @@ typedef struct
 */
 typedef struct
 {
-    CFE_ES_AppId_t   AppId;       /**< \brief Application ID to verify access */
-    int16            RegIndex;    /**< \brief Index into Table Registry (a.k.a. - Global Table #) */
-    CFE_TBL_Handle_t PrevLink;    /**< \brief Index of previous access descriptor in linked list */
-    CFE_TBL_Handle_t NextLink;    /**< \brief Index of next access descriptor in linked list */
-    bool             UsedFlag;    /**< \brief Indicates whether this descriptor is being used or not  */
-    bool             LockFlag;    /**< \brief Indicates whether thread is currently accessing table data */
-    bool             Updated;     /**< \brief Indicates table has been updated since last GetAddress call */
-    uint8            BufferIndex; /**< \brief Index of buffer currently being used */
+    CFE_ES_AppId_t   AppId;            /**< \brief Application ID to verify access */
+    int16            RegIndex;         /**< \brief Index into Table Registry (a.k.a. - Global Table #) */
+    CFE_TBL_Handle_t PrevLink;         /**< \brief Index of previous access descriptor in linked list */
+    CFE_TBL_Handle_t NextLink;         /**< \brief Index of next access descriptor in linked list */
+    bool             UsedFlag;         /**< \brief Indicates whether this descriptor is being used or not  */
+    bool             LockFlag;         /**< \brief Indicates whether thread is currently accessing table data */
+    bool             Updated;          /**< \brief Indicates table has been updated since last GetAddress call */
+    uint8            BufferIndex;      /**< \brief Index of buffer currently being used */
+    void *           CachedBufferPtr;  /**< \brief Buffer address resolved by the last successful GetAddress */
+    uint32           CachedGeneration; /**< \brief Registry generation at which CachedBufferPtr was resolved */
 } CFE_TBL_AccessDescriptor_t;
 
 /*******************************************************************************/
@@ -195,9 +198,10 @@ typedef struct
     bool               UserDefAddr;     /**< \brief Flag indicating Table address was defined by Owner Application */
     bool               NotifyByMsg;     /**< \brief Flag indicating Table Services should notify owning App via message
                                                     when table requires management */
-    uint8 ActiveBufferIndex;            /**< \brief Index identifying which buffer is the active buffer */
-    char  Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
-    char  LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
+    uint8  ActiveBufferIndex;              /**< \brief Index identifying which buffer is the active buffer */
+    uint32 Generation;                     /**< \brief Advanced whenever cached table addresses must be resolved */
+    char   Name[CFE_TBL_MAX_FULL_NAME_LEN]; /**< \brief Processor specific table name */
+    char   LastFileLoaded[OS_MAX_PATH_LEN]; /**< \brief Filename of last file loaded into table */
 } CFE_TBL_RegistryRec_t;
 
 /*******************************************************************************/
@@ -264,14 +264,15 @@ void UT_ResetTableRegistry(void)
     /* Initialize the table access descriptors */
     for (i = 0; i < CFE_PLATFORM_TBL_MAX_NUM_HANDLES; i++)
     {
-        CFE_TBL_Global.Handles[i].AppId       = CFE_TBL_NOT_OWNED;
-        CFE_TBL_Global.Handles[i].RegIndex    = 0;
-        CFE_TBL_Global.Handles[i].PrevLink    = CFE_TBL_END_OF_LIST;
-        CFE_TBL_Global.Handles[i].NextLink    = CFE_TBL_END_OF_LIST;
-        CFE_TBL_Global.Handles[i].UsedFlag    = false;
-        CFE_TBL_Global.Handles[i].LockFlag    = false;
-        CFE_TBL_Global.Handles[i].Updated     = false;
-        CFE_TBL_Global.Handles[i].BufferIndex = 0;
+        CFE_TBL_Global.Handles[i].AppId           = CFE_TBL_NOT_OWNED;
+        CFE_TBL_Global.Handles[i].RegIndex        = 0;
+        CFE_TBL_Global.Handles[i].PrevLink        = CFE_TBL_END_OF_LIST;
+        CFE_TBL_Global.Handles[i].NextLink        = CFE_TBL_END_OF_LIST;
+        CFE_TBL_Global.Handles[i].UsedFlag        = false;
+        CFE_TBL_Global.Handles[i].LockFlag        = false;
+        CFE_TBL_Global.Handles[i].Updated         = false;
+        CFE_TBL_Global.Handles[i].BufferIndex     = 0;
+        CFE_TBL_Global.Handles[i].CachedBufferPtr = NULL;
     }
 
     /* Initialize the table validation results records */
@@ -2313,8 +2314,11 @@ void Test_CFE_TBL_Load(void)
 */
 void Test_CFE_TBL_GetAddress(void)
 {
-    void *App3TblPtr;
-    void *App2TblPtr;
+    void *                      App3TblPtr;
+    void *                      App2TblPtr;
+    void *                      CachedTblPtr;
+    CFE_TBL_AccessDescriptor_t *AccessDescPtr;
+    CFE_TBL_RegistryRec_t *     RegRecPtr;
 
     UtPrintf("Begin Test Get Address");
 
@@ -2341,6 +2345,27 @@ void Test_CFE_TBL_GetAddress(void)
     UtAssert_INT32_EQ(CFE_TBL_GetAddress(&App3TblPtr, CFE_PLATFORM_TBL_MAX_NUM_HANDLES), CFE_TBL_ERR_INVALID_HANDLE);
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Test that a repeated request is served from the cached address while
+     * holding the buffer, and that invalidating the cache is noticed
+     */
+    UT_InitData();
+    UT_SetAppID(UT_TBL_APPID_2);
+    AccessDescPtr = &CFE_TBL_Global.Handles[App2TblHandle1];
+    RegRecPtr     = &CFE_TBL_Global.Registry[AccessDescPtr->RegIndex];
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetAddress(&App2TblPtr, App2TblHandle1));
+    UtAssert_ADDRESS_EQ(AccessDescPtr->CachedBufferPtr, App2TblPtr);
+    CFE_UtAssert_SUCCESS(CFE_TBL_GetAddress(&CachedTblPtr, App2TblHandle1));
+    UtAssert_ADDRESS_EQ(CachedTblPtr, App2TblPtr);
+    UtAssert_UINT32_EQ(RegRecPtr->Buffers[AccessDescPtr->BufferIndex].ReaderCount, 1);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReleaseAddress(App2TblHandle1));
+    UtAssert_UINT32_EQ(RegRecPtr->Buffers[AccessDescPtr->BufferIndex].ReaderCount, 0);
+    AccessDescPtr->Updated = true;
+    CFE_TBL_InvalidateCachedAddresses(RegRecPtr);
+    UtAssert_INT32_EQ(CFE_TBL_GetAddress(&CachedTblPtr, App2TblHandle1), CFE_TBL_INFO_UPDATED);
+    UtAssert_NULL(AccessDescPtr->CachedBufferPtr);
+    CFE_UtAssert_SUCCESS(CFE_TBL_ReleaseAddress(App2TblHandle1));
+    CFE_UtAssert_EVENTCOUNT(0);
+
     /* Attempt to get the address of an unregistered (unowned) table */
     /* a. Test setup */
     UT_InitData();
@@ -2810,13 +2835,15 @@ void Test_CFE_TBL_Manage(void)
     CFE_TBL_Global.Handles[AccessIterator].LockFlag    = true;
 
     /* Attempt to "load" image into inactive buffer for table */
-    RegIndex  = CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2");
-    RegRecPtr = &CFE_TBL_Global.Registry[RegIndex];
+    RegIndex                          = CFE_TBL_FindTableInRegistry("ut_cfe_tbl.UT_Table2");
+    RegRecPtr                         = &CFE_TBL_Global.Registry[RegIndex];
+    RegRecPtr->Buffers[1].ReaderCount = 1;
     UtAssert_INT32_EQ(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false), CFE_TBL_ERR_NO_BUFFER_AVAIL);
 
     /* Reset the table information for subsequent tests */
     CFE_TBL_Global.Handles[AccessIterator].BufferIndex = 1;
     CFE_TBL_Global.Handles[AccessIterator].LockFlag    = false;
+    RegRecPtr->Buffers[1].ReaderCount                  = 0;
 
     /* Successfully "load" image into inactive buffer for table */
     CFE_UtAssert_SUCCESS(CFE_TBL_GetWorkingBuffer(&WorkingBufferPtr, RegRecPtr, false));
@@ -3235,6 +3262,7 @@ void Test_CFE_TBL_Internal(void)
     CFE_TBL_File_Hdr_t          TblFileHeader;
     osal_id_t                   FileDescriptor;
     void *                      TblPtr;
+    uint8                       MapData[sizeof(CFE_FS_Header_t) + sizeof(UT_Table1_t) + 1];
 
     UtPrintf("Begin Test Internal");
 
@@ -3417,6 +3445,95 @@ void Test_CFE_TBL_Internal(void)
     UtAssert_INT32_EQ(CFE_TBL_LoadFromFile("UT", WorkingBufferPtr, RegRecPtr, Filename), CFE_TBL_WARN_SHORT_FILE);
     CFE_UtAssert_EVENTCOUNT(0);
 
+    /* Test CFE_TBL_LoadFromMappedFile decoding a complete table image straight
+     * from the file mapping, without any data reads and with a single CRC
+     */
+    UT_InitData();
+    memset(MapData, 0, sizeof(MapData));
+    StdFileHeader.ContentType = CFE_FS_FILE_CONTENT_ID;
+    StdFileHeader.SubType     = CFE_FS_SubType_TBL_IMG;
+    strncpy(TblFileHeader.TableName, "ut_cfe_tbl.UT_Table2", sizeof(TblFileHeader.TableName) - 1);
+    TblFileHeader.TableName[sizeof(TblFileHeader.TableName) - 1] = '\0';
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_Table1_t));
+
+    UT_TBL_SetupReadHeader(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), MapData, sizeof(CFE_FS_Header_t) + sizeof(UT_Table1_t), false);
+    CFE_UtAssert_SUCCESS(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename));
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+    UtAssert_STUB_COUNT(OS_FileUnmap, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_StrCmp(WorkingBufferPtr->DataSource, Filename, "WorkingBufferPtr->DataSource (%s)",
+                    WorkingBufferPtr->DataSource);
+
+    /* Test CFE_TBL_LoadFromMappedFile response to the file holding more data
+     * than the header claims
+     */
+    UT_InitData();
+    UT_TBL_SetupReadHeader(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), MapData, sizeof(MapData), false);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_TBL_ERR_FILE_TOO_LARGE);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_TOO_BIG_ERR_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+    UtAssert_STUB_COUNT(OS_FileUnmap, 1);
+
+    /* Test CFE_TBL_LoadFromMappedFile response to the file holding less data
+     * than the header claims
+     */
+    UT_InitData();
+    UT_TBL_SetupReadHeader(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), MapData, sizeof(CFE_FS_Header_t) + sizeof(UT_Table1_t) - 1, false);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_TBL_ERR_LOAD_INCOMPLETE);
+    CFE_UtAssert_EVENTSENT(CFE_TBL_FILE_INCOMPLETE_ERR_EID);
+    CFE_UtAssert_EVENTCOUNT(1);
+
+    /* Test CFE_TBL_LoadFromMappedFile response to a failure to find the end of the headers */
+    UT_InitData();
+    UT_TBL_SetupReadHeader(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, OS_ERROR);
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), MapData, sizeof(CFE_FS_Header_t) + sizeof(UT_Table1_t), false);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+    CFE_UtAssert_EVENTCOUNT(0);
+
+    /* Test CFE_TBL_LoadFromMappedFile leaving a short file to the read path */
+    UT_InitData();
+    UT_TBL_SetupHeader(&TblFileHeader, 0, sizeof(UT_Table1_t) - 1);
+    UT_TBL_SetupReadHeader(&TblFileHeader, sizeof(TblFileHeader));
+    UT_SetReadHeader(&StdFileHeader, sizeof(StdFileHeader));
+    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_FileMap), MapData, sizeof(CFE_FS_Header_t) + sizeof(UT_Table1_t) - 1, false);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(OS_FileUnmap, 1);
+
+    /* Test CFE_TBL_LoadFromMappedFile leaving a file that cannot be mapped to the read path */
+    UT_InitData();
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Test CFE_TBL_LoadFromMappedFile leaving a file that cannot be opened to the read path */
+    UT_InitData();
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+    UtAssert_INT32_EQ(CFE_TBL_LoadFromMappedFile("UT", WorkingBufferPtr, RegRecPtr, Filename),
+                      CFE_STATUS_NOT_IMPLEMENTED);
+    CFE_UtAssert_EVENTCOUNT(0);
+    UtAssert_STUB_COUNT(OS_FileMap, 0);
+
     /* Test CFE_TBL_ReadHeaders response to a failure reading the standard cFE
      * file header
      */
@@ -0,0 +1,183 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Shared CRC engine
+ *
+ * This library implements the CRC algorithms used by cFE ES (tables, CDS and
+ * code segment checks), EdsLib error control fields and the table CRC tool,
+ * so that all of these produce identical values from a single implementation.
+ *
+ * The portable implementation uses slicing-by-8 tables.  On x86 processors
+ * built with GCC or Clang the SSE4.2 CRC32 instruction is used for CRC-32C
+ * and carry-less multiplication (PCLMULQDQ) is used for CRC-32, if the
+ * processor supports them.  This is checked once at run time.
+ *
+ * This library has no dependencies on OSAL or cFE and may be used in
+ * host tools as well as flight software.
+ */
+
+#ifndef CRC_ENGINE_H
+#define CRC_ENGINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief The CRC algorithms implemented by the engine
+ */
+typedef enum
+{
+    /**
+     * CRC-16/ARC, as used by CFE_ES_CalculateCRC()
+     *
+     * Polynomial 0x8005, initial value 0x0000, reflected input/output, no final XOR
+     */
+    CRC_ALGORITHM_CRC16_ARC,
+
+    /**
+     * CRC-16/CCITT-FALSE, as used by CCSDS and EdsLib error control fields
+     *
+     * Polynomial 0x1021, initial value 0xFFFF, no reflection, no final XOR
+     */
+    CRC_ALGORITHM_CRC16_CCITT_FALSE,
+
+    /**
+     * CRC-32 (IEEE 802.3, zlib)
+     *
+     * Polynomial 0x04C11DB7, initial value 0xFFFFFFFF, reflected input/output, final XOR 0xFFFFFFFF
+     */
+    CRC_ALGORITHM_CRC32,
+
+    /**
+     * CRC-32C (Castagnoli)
+     *
+     * Polynomial 0x1EDC6F41, initial value 0xFFFFFFFF, reflected input/output, final XOR 0xFFFFFFFF
+     */
+    CRC_ALGORITHM_CRC32C,
+
+    CRC_ALGORITHM_MAX
+} CRC_Algorithm_t;
+
+/**
+ * @brief Running state of an incremental CRC calculation
+ *
+ * The contents should be treated as opaque; use CRC_Init() or CRC_Resume()
+ * to set it up, CRC_Update() to add data and CRC_Final() to get the result.
+ */
+typedef struct
+{
+    CRC_Algorithm_t Algorithm;
+    uint32_t        Register;
+} CRC_State_t;
+
+/**
+ * @brief Initializes the CRC engine
+ *
+ * Computes the lookup tables and selects the fastest implementation of each
+ * algorithm for the processor.  This is done automatically on first use, but
+ * as the tables are global it should be called once during startup, before
+ * any concurrent use of the engine.  Calling it again has no effect.
+ */
+void CRC_Initialize(void);
+
+/**
+ * @brief Enables or disables the processor specific implementations
+ *
+ * When disabled, all algorithms use the portable slicing-by-8 implementation.
+ * This is intended for testing and benchmarking; the result of a CRC does
+ * not depend on the implementation used.
+ *
+ * @param[in] Enable true to use processor specific implementations where available
+ */
+void CRC_EnableAcceleration(bool Enable);
+
+/**
+ * @brief Gets the name of the implementation currently used for an algorithm
+ *
+ * @param[in] Algorithm the CRC algorithm
+ *
+ * @return A short descriptive name, such as "slice8", "sse4.2" or "pclmul"
+ */
+const char *CRC_GetImplementationName(CRC_Algorithm_t Algorithm);
+
+/**
+ * @brief Starts a new incremental CRC calculation
+ *
+ * @param[out] State     the state to initialize
+ * @param[in]  Algorithm the CRC algorithm to use
+ */
+void CRC_Init(CRC_State_t *State, CRC_Algorithm_t Algorithm);
+
+/**
+ * @brief Continues an incremental CRC calculation from a previous result
+ *
+ * This allows a CRC to be computed over non-contiguous blocks, by passing
+ * the result of CRC_Final() or CRC_Compute() for the preceding data.
+ *
+ * @param[out] State       the state to initialize
+ * @param[in]  Algorithm   the CRC algorithm to use
+ * @param[in]  PreviousCrc the CRC of all preceding data
+ */
+void CRC_Resume(CRC_State_t *State, CRC_Algorithm_t Algorithm, uint32_t PreviousCrc);
+
+/**
+ * @brief Adds data to an incremental CRC calculation
+ *
+ * @param[inout] State  the state of the calculation
+ * @param[in]    Data   the data to add
+ * @param[in]    Length the number of bytes of data
+ */
+void CRC_Update(CRC_State_t *State, const void *Data, size_t Length);
+
+/**
+ * @brief Gets the result of an incremental CRC calculation
+ *
+ * The state is not modified, so more data may be added afterward.
+ *
+ * @param[in] State the state of the calculation
+ *
+ * @return The CRC of all data added so far
+ */
+uint32_t CRC_Final(const CRC_State_t *State);
+
+/**
+ * @brief Computes the CRC of a block of data
+ *
+ * This is equivalent to CRC_Resume(), CRC_Update() and CRC_Final().  To
+ * compute the CRC of a single block from the start, pass the CRC of no
+ * data as the previous value, which is 0 for all algorithms except
+ * CRC-16/CCITT-FALSE (0xFFFF); CRC_Init() may be used instead.
+ *
+ * @param[in] Algorithm   the CRC algorithm to use
+ * @param[in] PreviousCrc the CRC of all preceding data
+ * @param[in] Data        the data
+ * @param[in] Length      the number of bytes of data
+ *
+ * @return The CRC of the preceding data followed by this block
+ */
+uint32_t CRC_Compute(CRC_Algorithm_t Algorithm, uint32_t PreviousCrc, const void *Data, size_t Length);
+
+#endif /* CRC_ENGINE_H */
@@ -0,0 +1,609 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Implementation of the shared CRC engine
+ *
+ * All algorithms keep a 32 bit shift register.  Reflected algorithms keep
+ * the CRC in the low bits of the register, and non-reflected algorithms keep
+ * it in the high bits, so that the same slicing-by-8 structure works for
+ * both 16 and 32 bit widths.
+ */
+
+#include <string.h>
+
+#include "crc_engine.h"
+
+/*
+ * Processor specific implementations are only built where the compiler
+ * supports per-function target selection and run time CPU detection.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CRC_ENGINE_HAVE_X86 1
+#include <immintrin.h>
+#endif
+
+typedef uint32_t (*CRC_UpdateFunc_t)(CRC_Algorithm_t Algorithm, uint32_t Register, const uint8_t *Ptr, size_t Length);
+
+/*
+ * Parameters for each algorithm, in the usual notation
+ */
+typedef struct
+{
+    uint32_t Poly;      /**< Polynomial, bit reversed for reflected algorithms */
+    uint32_t Init;      /**< Initial CRC value */
+    uint32_t XorOut;    /**< Value XOR'ed with the register to give the result */
+    uint8_t  Width;     /**< Width of the CRC in bits */
+    bool     Reflected; /**< True if the input and output are bit reflected */
+} CRC_AlgorithmParams_t;
+
+static const CRC_AlgorithmParams_t CRC_ALGORITHM_PARAMS[CRC_ALGORITHM_MAX] = {
+    [CRC_ALGORITHM_CRC16_ARC]         = {.Poly = 0xA001, .Init = 0, .XorOut = 0, .Width = 16, .Reflected = true},
+    [CRC_ALGORITHM_CRC16_CCITT_FALSE] = {.Poly = 0x1021, .Init = 0xFFFF, .XorOut = 0, .Width = 16, .Reflected = false},
+    [CRC_ALGORITHM_CRC32] = {.Poly = 0xEDB88320, .Init = 0xFFFFFFFF, .XorOut = 0xFFFFFFFF, .Width = 32, .Reflected = true},
+    [CRC_ALGORITHM_CRC32C] = {.Poly = 0x82F63B78, .Init = 0xFFFFFFFF, .XorOut = 0xFFFFFFFF, .Width = 32, .Reflected = true},
+};
+
+/*
+ * Global state of the engine
+ */
+typedef struct
+{
+    volatile bool    IsInitialized;
+    bool             AccelerationEnabled;
+    CRC_UpdateFunc_t UpdateFunc[CRC_ALGORITHM_MAX];
+    const char      *ImplName[CRC_ALGORITHM_MAX];
+
+    /*
+     * Slicing-by-8 tables.  Table[0] is the usual byte table, and Table[k]
+     * is the CRC contribution of a byte followed by k zero bytes.
+     */
+    uint32_t Table[CRC_ALGORITHM_MAX][8][256];
+} CRC_Global_t;
+
+static CRC_Global_t CRC_Global = {.AccelerationEnabled = true};
+
+/*----------------------------------------------------------------
+ *
+ * Local helper to read 32 bits in little endian byte order
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32_t CRC_LoadLE32(const uint8_t *Ptr)
+{
+    return (uint32_t)Ptr[0] | ((uint32_t)Ptr[1] << 8) | ((uint32_t)Ptr[2] << 16) | ((uint32_t)Ptr[3] << 24);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper to read 32 bits in big endian byte order
+ *
+ *-----------------------------------------------------------------*/
+static inline uint32_t CRC_LoadBE32(const uint8_t *Ptr)
+{
+    return ((uint32_t)Ptr[0] << 24) | ((uint32_t)Ptr[1] << 16) | ((uint32_t)Ptr[2] << 8) | (uint32_t)Ptr[3];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Portable slicing-by-8 implementation for reflected algorithms
+ *
+ *-----------------------------------------------------------------*/
+static uint32_t CRC_UpdateReflected(CRC_Algorithm_t Algorithm, uint32_t Register, const uint8_t *Ptr, size_t Length)
+{
+    const uint32_t(*Table)[256] = CRC_Global.Table[Algorithm];
+    uint32_t Lo;
+    uint32_t Hi;
+
+    while (Length >= 8)
+    {
+        Lo = Register ^ CRC_LoadLE32(Ptr);
+        Hi = CRC_LoadLE32(Ptr + 4);
+
+        Register = Table[7][Lo & 0xFF] ^ Table[6][(Lo >> 8) & 0xFF] ^ Table[5][(Lo >> 16) & 0xFF] ^
+                   Table[4][Lo >> 24] ^ Table[3][Hi & 0xFF] ^ Table[2][(Hi >> 8) & 0xFF] ^
+                   Table[1][(Hi >> 16) & 0xFF] ^ Table[0][Hi >> 24];
+
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Register = (Register >> 8) ^ Table[0][(Register ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Length;
+    }
+
+    return Register;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Portable slicing-by-8 implementation for non-reflected algorithms
+ *
+ *-----------------------------------------------------------------*/
+static uint32_t CRC_UpdateNormal(CRC_Algorithm_t Algorithm, uint32_t Register, const uint8_t *Ptr, size_t Length)
+{
+    const uint32_t(*Table)[256] = CRC_Global.Table[Algorithm];
+    uint32_t Lo;
+    uint32_t Hi;
+
+    while (Length >= 8)
+    {
+        Hi = Register ^ CRC_LoadBE32(Ptr);
+        Lo = CRC_LoadBE32(Ptr + 4);
+
+        Register = Table[7][Hi >> 24] ^ Table[6][(Hi >> 16) & 0xFF] ^ Table[5][(Hi >> 8) & 0xFF] ^
+                   Table[4][Hi & 0xFF] ^ Table[3][Lo >> 24] ^ Table[2][(Lo >> 16) & 0xFF] ^
+                   Table[1][(Lo >> 8) & 0xFF] ^ Table[0][Lo & 0xFF];
+
+        Ptr += 8;
+        Length -= 8;
+    }
+
+    while (Length > 0)
+    {
+        Register = (Register << 8) ^ Table[0][((Register >> 24) ^ *Ptr) & 0xFF];
+        ++Ptr;
+        --Length;
+    }
+
+    return Register;
+}
+
+#ifdef CRC_ENGINE_HAVE_X86
+
+/*----------------------------------------------------------------
+ *
+ * CRC-32C using the SSE4.2 CRC32 instruction
+ *
+ *-----------------------------------------------------------------*/
+__attribute__((target("sse4.2"))) static uint32_t CRC_UpdateSSE42(CRC_Algorithm_t Algorithm, uint32_t Register,
+                                                                 const uint8_t *Ptr, size_t Length)
+{
+#ifdef __x86_64__
+    uint64_t Register64;
+    uint64_t Value64;
+#else
+    uint32_t Value32;
+#endif
+
+    /* The CRC32 instruction only implements CRC-32C */
+    (void)Algorithm;
+
+#ifdef __x86_64__
+    Register64 = Register;
+    while (Length >= 8)
+    {
+        memcpy(&Value64, Ptr, sizeof(Value64));
+        Register64 = _mm_crc32_u64(Register64, Value64);
+        Ptr += 8;
+        Length -= 8;
+    }
+    Register = (uint32_t)Register64;
+#else
+    while (Length >= 4)
+    {
+        memcpy(&Value32, Ptr, sizeof(Value32));
+        Register = _mm_crc32_u32(Register, Value32);
+        Ptr += 4;
+        Length -= 4;
+    }
+#endif
+
+    while (Length > 0)
+    {
+        Register = _mm_crc32_u8(Register, *Ptr);
+        ++Ptr;
+        --Length;
+    }
+
+    return Register;
+}
+
+/*----------------------------------------------------------------
+ *
+ * CRC-32 by folding with carry-less multiplication
+ *
+ * This follows "Fast CRC Computation for Generic Polynomials Using
+ * PCLMULQDQ Instruction" (Intel, 2009), with the bit reflected constants
+ * for the CRC-32 polynomial given there.  The data is folded 64 bytes at a
+ * time, then reduced to 32 bits with a Barrett reduction.  Buffers shorter
+ * than 64 bytes and any remainder use the table implementation.
+ *
+ *-----------------------------------------------------------------*/
+__attribute__((target("pclmul,sse4.1"))) static uint32_t CRC_UpdatePCLMUL(CRC_Algorithm_t Algorithm, uint32_t Register,
+                                                                        const uint8_t *Ptr, size_t Length)
+{
+    static const uint64_t K1K2[2] = {0x0154442bd4, 0x01c6e41596};
+    static const uint64_t K3K4[2] = {0x01751997d0, 0x00ccaa009e};
+    static const uint64_t K5K0[2] = {0x0163cd6124, 0x0000000000};
+    static const uint64_t POLY[2] = {0x01db710641, 0x01f7011641};
+
+    __m128i X0, X1, X2, X3, X4, X5, X6, X7, X8;
+    size_t  Remainder;
+
+    if (Length < 64)
+    {
+        return CRC_UpdateReflected(Algorithm, Register, Ptr, Length);
+    }
+
+    Remainder = Length & 15;
+    Length -= Remainder;
+
+    X1 = _mm_loadu_si128((const __m128i *)(Ptr + 0x00));
+    X2 = _mm_loadu_si128((const __m128i *)(Ptr + 0x10));
+    X3 = _mm_loadu_si128((const __m128i *)(Ptr + 0x20));
+    X4 = _mm_loadu_si128((const __m128i *)(Ptr + 0x30));
+
+    X1 = _mm_xor_si128(X1, _mm_cvtsi32_si128((int)Register));
+    X0 = _mm_loadu_si128((const __m128i *)K1K2);
+
+    Ptr += 64;
+    Length -= 64;
+
+    /* Fold four 128 bit values in parallel */
+    while (Length >= 64)
+    {
+        X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+        X6 = _mm_clmulepi64_si128(X2, X0, 0x00);
+        X7 = _mm_clmulepi64_si128(X3, X0, 0x00);
+        X8 = _mm_clmulepi64_si128(X4, X0, 0x00);
+
+        X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+        X2 = _mm_clmulepi64_si128(X2, X0, 0x11);
+        X3 = _mm_clmulepi64_si128(X3, X0, 0x11);
+        X4 = _mm_clmulepi64_si128(X4, X0, 0x11);
+
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, X5), _mm_loadu_si128((const __m128i *)(Ptr + 0x00)));
+        X2 = _mm_xor_si128(_mm_xor_si128(X2, X6), _mm_loadu_si128((const __m128i *)(Ptr + 0x10)));
+        X3 = _mm_xor_si128(_mm_xor_si128(X3, X7), _mm_loadu_si128((const __m128i *)(Ptr + 0x20)));
+        X4 = _mm_xor_si128(_mm_xor_si128(X4, X8), _mm_loadu_si128((const __m128i *)(Ptr + 0x30)));
+
+        Ptr += 64;
+        Length -= 64;
+    }
+
+    /* Fold the four values into one */
+    X0 = _mm_loadu_si128((const __m128i *)K3K4);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X2), X5);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X3), X5);
+
+    X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+    X1 = _mm_xor_si128(_mm_xor_si128(X1, X4), X5);
+
+    /* Fold any remaining 16 byte blocks */
+    while (Length >= 16)
+    {
+        X5 = _mm_clmulepi64_si128(X1, X0, 0x00);
+        X1 = _mm_clmulepi64_si128(X1, X0, 0x11);
+        X1 = _mm_xor_si128(_mm_xor_si128(X1, _mm_loadu_si128((const __m128i *)Ptr)), X5);
+
+        Ptr += 16;
+        Length -= 16;
+    }
+
+    /* Reduce 128 bits to 64 bits */
+    X2 = _mm_clmulepi64_si128(X1, X0, 0x10);
+    X3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    X1 = _mm_srli_si128(X1, 8);
+    X1 = _mm_xor_si128(X1, X2);
+
+    X0 = _mm_loadu_si128((const __m128i *)K5K0);
+
+    X2 = _mm_srli_si128(X1, 4);
+    X1 = _mm_and_si128(X1, X3);
+    X1 = _mm_clmulepi64_si128(X1, X0, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    /* Barrett reduction to 32 bits */
+    X0 = _mm_loadu_si128((const __m128i *)POLY);
+
+    X2 = _mm_and_si128(X1, X3);
+    X2 = _mm_clmulepi64_si128(X2, X0, 0x10);
+    X2 = _mm_and_si128(X2, X3);
+    X2 = _mm_clmulepi64_si128(X2, X0, 0x00);
+    X1 = _mm_xor_si128(X1, X2);
+
+    Register = (uint32_t)_mm_extract_epi32(X1, 1);
+
+    return CRC_UpdateReflected(Algorithm, Register, Ptr, Remainder);
+}
+
+#endif /* CRC_ENGINE_HAVE_X86 */
+
+/*----------------------------------------------------------------
+ *
+ * Local helper to compute the slicing tables for one algorithm
+ *
+ *-----------------------------------------------------------------*/
+static void CRC_BuildTables(CRC_Algorithm_t Algorithm)
+{
+    const CRC_AlgorithmParams_t *Params = &CRC_ALGORITHM_PARAMS[Algorithm];
+    uint32_t (*Table)[256]              = CRC_Global.Table[Algorithm];
+    uint32_t Poly;
+    uint32_t Value;
+    uint32_t i;
+    uint32_t k;
+    uint32_t bit;
+
+    for (i = 0; i < 256; ++i)
+    {
+        if (Params->Reflected)
+        {
+            Value = i;
+            for (bit = 0; bit < 8; ++bit)
+            {
+                Value = (Value & 1) ? ((Value >> 1) ^ Params->Poly) : (Value >> 1);
+            }
+        }
+        else
+        {
+            Poly  = Params->Poly << (32 - Params->Width);
+            Value = i << 24;
+            for (bit = 0; bit < 8; ++bit)
+            {
+                Value = (Value & 0x80000000) ? ((Value << 1) ^ Poly) : (Value << 1);
+            }
+        }
+        Table[0][i] = Value;
+    }
+
+    for (k = 1; k < 8; ++k)
+    {
+        for (i = 0; i < 256; ++i)
+        {
+            Value = Table[k - 1][i];
+            if (Params->Reflected)
+            {
+                Table[k][i] = (Value >> 8) ^ Table[0][Value & 0xFF];
+            }
+            else
+            {
+                Table[k][i] = (Value << 8) ^ Table[0][Value >> 24];
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Local helper to select the implementation of each algorithm
+ *
+ *-----------------------------------------------------------------*/
+static void CRC_SelectImplementations(void)
+{
+    CRC_Algorithm_t Algorithm;
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        if (CRC_ALGORITHM_PARAMS[Algorithm].Reflected)
+        {
+            CRC_Global.UpdateFunc[Algorithm] = CRC_UpdateReflected;
+        }
+        else
+        {
+            CRC_Global.UpdateFunc[Algorithm] = CRC_UpdateNormal;
+        }
+        CRC_Global.ImplName[Algorithm] = "slice8";
+    }
+
+#ifdef CRC_ENGINE_HAVE_X86
+    if (CRC_Global.AccelerationEnabled)
+    {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse4.2"))
+        {
+            CRC_Global.UpdateFunc[CRC_ALGORITHM_CRC32C] = CRC_UpdateSSE42;
+            CRC_Global.ImplName[CRC_ALGORITHM_CRC32C]   = "sse4.2";
+        }
+        if (__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1"))
+        {
+            CRC_Global.UpdateFunc[CRC_ALGORITHM_CRC32] = CRC_UpdatePCLMUL;
+            CRC_Global.ImplName[CRC_ALGORITHM_CRC32]   = "pclmul";
+        }
+    }
+#endif
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Initialize
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CRC_Initialize(void)
+{
+    CRC_Algorithm_t Algorithm;
+
+    if (CRC_Global.IsInitialized)
+    {
+        return;
+    }
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        CRC_BuildTables(Algorithm);
+    }
+
+    CRC_SelectImplementations();
+
+    CRC_Global.IsInitialized = true;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_EnableAcceleration
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CRC_EnableAcceleration(bool Enable)
+{
+    CRC_Initialize();
+
+    CRC_Global.AccelerationEnabled = Enable;
+    CRC_SelectImplementations();
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_GetImplementationName
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+const char *CRC_GetImplementationName(CRC_Algorithm_t Algorithm)
+{
+    if ((uint32_t)Algorithm >= CRC_ALGORITHM_MAX)
+    {
+        return "none";
+    }
+
+    CRC_Initialize();
+
+    return CRC_Global.ImplName[Algorithm];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Resume
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CRC_Resume(CRC_State_t *State, CRC_Algorithm_t Algorithm, uint32_t PreviousCrc)
+{
+    const CRC_AlgorithmParams_t *Params;
+
+    if ((uint32_t)Algorithm >= CRC_ALGORITHM_MAX)
+    {
+        Algorithm = CRC_ALGORITHM_CRC32;
+    }
+
+    Params           = &CRC_ALGORITHM_PARAMS[Algorithm];
+    State->Algorithm = Algorithm;
+    State->Register  = PreviousCrc ^ Params->XorOut;
+
+    if (Params->Width < 32)
+    {
+        State->Register &= (1UL << Params->Width) - 1;
+        if (!Params->Reflected)
+        {
+            State->Register <<= (32 - Params->Width);
+        }
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Init
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CRC_Init(CRC_State_t *State, CRC_Algorithm_t Algorithm)
+{
+    if ((uint32_t)Algorithm >= CRC_ALGORITHM_MAX)
+    {
+        Algorithm = CRC_ALGORITHM_CRC32;
+    }
+
+    CRC_Resume(State, Algorithm, CRC_ALGORITHM_PARAMS[Algorithm].Init ^ CRC_ALGORITHM_PARAMS[Algorithm].XorOut);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Update
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void CRC_Update(CRC_State_t *State, const void *Data, size_t Length)
+{
+    if (Data == NULL || Length == 0)
+    {
+        return;
+    }
+
+    if (!CRC_Global.IsInitialized)
+    {
+        CRC_Initialize();
+    }
+
+    State->Register = CRC_Global.UpdateFunc[State->Algorithm](State->Algorithm, State->Register, Data, Length);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Final
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32_t CRC_Final(const CRC_State_t *State)
+{
+    const CRC_AlgorithmParams_t *Params = &CRC_ALGORITHM_PARAMS[State->Algorithm];
+    uint32_t                     Result = State->Register;
+
+    if (!Params->Reflected)
+    {
+        Result >>= (32 - Params->Width);
+    }
+
+    return Result ^ Params->XorOut;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: CRC_Compute
+ *
+ * Implemented per public API
+ * See description in header file for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+uint32_t CRC_Compute(CRC_Algorithm_t Algorithm, uint32_t PreviousCrc, const void *Data, size_t Length)
+{
+    CRC_State_t State;
+
+    CRC_Resume(&State, Algorithm, PreviousCrc);
+    CRC_Update(&State, Data, Length);
+
+    return CRC_Final(&State);
+}
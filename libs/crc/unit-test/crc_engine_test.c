@@ -0,0 +1,235 @@
+/*************************************************************************
+**
+**      GSC-18128-1, "Core Flight Executive Version 6.7"
+**
+**      Copyright (c) 2006-2019 United States Government as represented by
+**      the Administrator of the National Aeronautics and Space Administration.
+**      All Rights Reserved.
+**
+**      Licensed under the Apache License, Version 2.0 (the "License");
+**      you may not use this file except in compliance with the License.
+**      You may obtain a copy of the License at
+**
+**        http://www.apache.org/licenses/LICENSE-2.0
+**
+**      Unless required by applicable law or agreed to in writing, software
+**      distributed under the License is distributed on an "AS IS" BASIS,
+**      WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+**      See the License for the specific language governing permissions and
+**      limitations under the License.
+**
+*************************************************************************/
+
+/**
+ * @file
+ *
+ * Test and benchmark of the CRC engine
+ *
+ * Checks each algorithm against its published check value, checks that
+ * incremental calculation matches a single call, and checks that the
+ * processor specific implementations match the portable one for a range
+ * of lengths and alignments.  The throughput of each implementation is
+ * then reported in bytes per second; these figures are informational only.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "crc_engine.h"
+
+#define CRC_TEST_BUFFER_SIZE 4096
+#define CRC_TEST_BENCH_SIZE  (64 * 1024)
+#define CRC_TEST_BENCH_BYTES (256 * 1024 * 1024)
+
+static const char *const CRC_TEST_ALG_NAMES[CRC_ALGORITHM_MAX] = {
+    [CRC_ALGORITHM_CRC16_ARC]         = "CRC-16/ARC",
+    [CRC_ALGORITHM_CRC16_CCITT_FALSE] = "CRC-16/CCITT-FALSE",
+    [CRC_ALGORITHM_CRC32]             = "CRC-32",
+    [CRC_ALGORITHM_CRC32C]            = "CRC-32C",
+};
+
+/* CRC of the ASCII string "123456789" for each algorithm */
+static const uint32_t CRC_TEST_CHECK_VALUES[CRC_ALGORITHM_MAX] = {
+    [CRC_ALGORITHM_CRC16_ARC]         = 0xBB3D,
+    [CRC_ALGORITHM_CRC16_CCITT_FALSE] = 0x29B1,
+    [CRC_ALGORITHM_CRC32]             = 0xCBF43926,
+    [CRC_ALGORITHM_CRC32C]            = 0xE3069283,
+};
+
+static uint8_t  CRC_TestBuffer[CRC_TEST_BUFFER_SIZE + 16];
+static uint8_t  CRC_BenchBuffer[CRC_TEST_BENCH_SIZE];
+static uint32_t CRC_TestFailures;
+
+static void CRC_TestCheck(int Condition, const char *Description, CRC_Algorithm_t Algorithm, size_t Length,
+                          size_t Offset)
+{
+    if (!Condition)
+    {
+        printf("FAIL: %s: %s length=%lu offset=%lu\n", CRC_TEST_ALG_NAMES[Algorithm], Description,
+               (unsigned long)Length, (unsigned long)Offset);
+        ++CRC_TestFailures;
+    }
+}
+
+static uint32_t CRC_TestInitialValue(CRC_Algorithm_t Algorithm)
+{
+    CRC_State_t State;
+
+    CRC_Init(&State, Algorithm);
+    return CRC_Final(&State);
+}
+
+static void CRC_TestCheckValues(void)
+{
+    static const char CheckString[] = "123456789";
+    CRC_Algorithm_t   Algorithm;
+    CRC_State_t       State;
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        CRC_Init(&State, Algorithm);
+        CRC_Update(&State, CheckString, 9);
+        CRC_TestCheck(CRC_Final(&State) == CRC_TEST_CHECK_VALUES[Algorithm], "check value", Algorithm, 9, 0);
+
+        CRC_TestCheck(CRC_Compute(Algorithm, CRC_TestInitialValue(Algorithm), CheckString, 9) ==
+                          CRC_TEST_CHECK_VALUES[Algorithm],
+                      "check value (compute)", Algorithm, 9, 0);
+
+        /* No data must leave the CRC unchanged */
+        CRC_TestCheck(CRC_Compute(Algorithm, CRC_TEST_CHECK_VALUES[Algorithm], NULL, 0) ==
+                          CRC_TEST_CHECK_VALUES[Algorithm],
+                      "empty update", Algorithm, 0, 0);
+    }
+}
+
+static void CRC_TestIncremental(void)
+{
+    CRC_Algorithm_t Algorithm;
+    size_t          Split;
+    uint32_t        Expected;
+    uint32_t        Partial;
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        Expected = CRC_Compute(Algorithm, CRC_TestInitialValue(Algorithm), CRC_TestBuffer, 1000);
+
+        for (Split = 0; Split <= 1000; Split += 37)
+        {
+            Partial = CRC_Compute(Algorithm, CRC_TestInitialValue(Algorithm), CRC_TestBuffer, Split);
+            Partial = CRC_Compute(Algorithm, Partial, CRC_TestBuffer + Split, 1000 - Split);
+            CRC_TestCheck(Partial == Expected, "resume", Algorithm, 1000, Split);
+        }
+    }
+}
+
+static void CRC_TestAcceleratedParity(void)
+{
+    static const size_t Lengths[] = {0, 1, 7, 8, 15, 16, 17, 63, 64, 65, 79, 127, 128, 129, 255, 1000, 4096};
+    CRC_Algorithm_t     Algorithm;
+    size_t              i;
+    size_t              Offset;
+    uint32_t            Portable;
+    uint32_t            Accelerated;
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        for (i = 0; i < sizeof(Lengths) / sizeof(Lengths[0]); ++i)
+        {
+            for (Offset = 0; Offset < 8; ++Offset)
+            {
+                CRC_EnableAcceleration(false);
+                Portable = CRC_Compute(Algorithm, 0x12345678, CRC_TestBuffer + Offset, Lengths[i]);
+
+                CRC_EnableAcceleration(true);
+                Accelerated = CRC_Compute(Algorithm, 0x12345678, CRC_TestBuffer + Offset, Lengths[i]);
+
+                CRC_TestCheck(Portable == Accelerated, "accelerated parity", Algorithm, Lengths[i], Offset);
+            }
+        }
+    }
+}
+
+static double CRC_TestBenchmark(CRC_Algorithm_t Algorithm)
+{
+    struct timespec Start;
+    struct timespec End;
+    double          Elapsed;
+    uint32_t        Crc;
+    size_t          Total;
+
+    Crc = CRC_TestInitialValue(Algorithm);
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for (Total = 0; Total < CRC_TEST_BENCH_BYTES; Total += CRC_TEST_BENCH_SIZE)
+    {
+        Crc = CRC_Compute(Algorithm, Crc, CRC_BenchBuffer, CRC_TEST_BENCH_SIZE);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    /* Keep the result live so the loop is not optimized away */
+    CRC_BenchBuffer[0] ^= (uint8_t)Crc;
+
+    Elapsed = (double)(End.tv_sec - Start.tv_sec) + ((double)(End.tv_nsec - Start.tv_nsec) / 1e9);
+    if (Elapsed <= 0)
+    {
+        Elapsed = 1e-9;
+    }
+
+    return (double)Total / Elapsed;
+}
+
+static void CRC_TestReportThroughput(void)
+{
+    CRC_Algorithm_t Algorithm;
+    double          Portable;
+    double          Accelerated;
+
+    printf("%-20s %20s %20s\n", "Algorithm", "slice8 bytes/s", "selected bytes/s");
+
+    for (Algorithm = 0; Algorithm < CRC_ALGORITHM_MAX; ++Algorithm)
+    {
+        CRC_EnableAcceleration(false);
+        Portable = CRC_TestBenchmark(Algorithm);
+
+        CRC_EnableAcceleration(true);
+        Accelerated = CRC_TestBenchmark(Algorithm);
+
+        printf("%-20s %20.0f %20.0f (%s)\n", CRC_TEST_ALG_NAMES[Algorithm], Portable, Accelerated,
+               CRC_GetImplementationName(Algorithm));
+    }
+}
+
+int main(void)
+{
+    size_t i;
+
+    srand(1);
+    for (i = 0; i < sizeof(CRC_TestBuffer); ++i)
+    {
+        CRC_TestBuffer[i] = (uint8_t)rand();
+    }
+    for (i = 0; i < sizeof(CRC_BenchBuffer); ++i)
+    {
+        CRC_BenchBuffer[i] = (uint8_t)(i * 31);
+    }
+
+    CRC_Initialize();
+
+    CRC_TestCheckValues();
+    CRC_TestIncremental();
+    CRC_TestAcceleratedParity();
+
+    if (CRC_TestFailures != 0)
+    {
+        printf("%lu failure(s)\n", (unsigned long)CRC_TestFailures);
+        return EXIT_FAILURE;
+    }
+
+    printf("All CRC checks passed\n");
+
+    CRC_TestReportThroughput();
+
+    return EXIT_SUCCESS;
+}
@@ -206,6 +206,66 @@ set(OSAL_CONFIG_CONSOLE_ASYNC                   TRUE
     CACHE BOOL "Controls spawning of a separate utility task for OS_printf"
 )
 
+#
+# OSAL_CONFIG_QUEUE_RING_DEFAULT
+# ----------------------------------
+#
+# Controls whether all message queues use the in-process ring buffer
+# implementation, as if every call to OS_QueueCreate() passed OS_QUEUE_FLAG_RING.
+#
+# If set FALSE (default), only queues created with OS_QUEUE_FLAG_RING use the ring
+# buffer, and all others use the operating system message queue.
+#
+# If set TRUE, every queue uses the ring buffer where the implementation supports it.
+# In the PC-Linux/Posix build, this means the queue depth is not limited by the
+# system /proc/sys/fs/mqueue/msg_max setting, and passing a message does not require
+# a system call unless the receiver has to block on an empty queue.
+#
+set(OSAL_CONFIG_QUEUE_RING_DEFAULT              FALSE
+    CACHE BOOL "Use in-process ring buffers for all message queues"
+)
+
+#
+# OSAL_CONFIG_TIMEBASE_TIMERFD
+# ----------------------------------
+#
+# Controls whether the POSIX implementation uses a Linux timerfd, rather than a
+# POSIX timer and real-time signal, to generate the tick for time bases that do
+# not have an external sync function.
+#
+# If set TRUE (default), each time base waits on its own timerfd, armed with
+# absolute CLOCK_MONOTONIC deadlines.  This does not consume any signal numbers,
+# so the number of time bases is not limited by the range of SIGRTMIN-SIGRTMAX.
+#
+# This only has an effect when building the POSIX implementation for Linux.
+# Other systems always use the POSIX timer implementation.
+#
+set(OSAL_CONFIG_TIMEBASE_TIMERFD                TRUE
+    CACHE BOOL "Use timerfd to generate time base ticks on Linux"
+)
+
+#
+# OSAL_CONFIG_TIMEBASE_TICKLESS
+# ----------------------------------
+#
+# Controls whether simulated time base ticks are only generated when a timer
+# callback is due.  This requires an implementation that supports it, which is
+# currently only the timerfd implementation (see OSAL_CONFIG_TIMEBASE_TIMERFD).
+#
+# If set FALSE (default), the time base wakes up on every tick, whether or not
+# there are any callbacks to do.
+#
+# If set TRUE, the time base sleeps until the tick on which the next timer
+# callback is due.  This saves waking the CPU for empty ticks, which matters for
+# time bases with a fast tick but only low-rate timers.  The tick phase and the
+# timing of the callbacks are the same as in the default mode.  However, the value
+# returned by OS_TimeBaseGetFreeRun() is only brought up to date when a callback is
+# done or the time base is used by the timer API, so it may lag the actual time.
+#
+set(OSAL_CONFIG_TIMEBASE_TICKLESS               FALSE
+    CACHE BOOL "Only wake time bases on ticks where a timer callback is due"
+)
+
 #############################################
 # Resource Limits for the OS API
 #############################################
@@ -270,6 +330,11 @@ set(OSAL_CONFIG_MAX_FILE_SYSTEMS        14
     CACHE STRING "Maximum Number of File Systems to support"
 )
 
+# The maximum number of poll sets to support
+set(OSAL_CONFIG_MAX_POLLSETS            4
+    CACHE STRING "Maximum Number of Poll Sets to support"
+)
+
 # The maximum length for a file name, including any extension
 # (This does not include the directory part)
 set(OSAL_CONFIG_MAX_FILE_NAME           20
@@ -330,6 +395,16 @@ set(OSAL_CONFIG_UTILITYTASK_STACK_SIZE  2048
     CACHE STRING "Stack size for the background utility task"
 )
 
+# CPU affinity mask of the time base helper threads.
+#
+# Bit N set allows the thread to run on processor N.  The default
+# of 0 places no restriction on the threads.  Setting this keeps the
+# time base tick isolated from busy application cores on multicore
+# targets.  Only honored by implementations that support affinity.
+set(OSAL_CONFIG_TIMEBASE_CPUMASK        0
+    CACHE STRING "CPU affinity mask for the time base helper threads"
+)
+
 # The size of a command that can be passed to the underlying OS
 # Only applicable when shell feature is enabled
 set(OSAL_CONFIG_MAX_CMD_LEN             1000
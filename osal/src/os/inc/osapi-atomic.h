@@ -0,0 +1,198 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * Declarations for lock-free atomic operations
+ *
+ * These are thin inline wrappers around the compiler-provided atomic
+ * builtins, so that code which must avoid taking a lock on its fast path
+ * does not depend on a particular compiler or C standard revision.
+ *
+ * All loads have acquire semantics, all stores have release semantics, and
+ * all read-modify-write operations are sequentially consistent.  This is
+ * sufficient for publishing data to lock-free readers, sequence locks, and
+ * reference counting.
+ *
+ * This header is not included by osapi.h, code that requires atomics
+ * should include it explicitly.
+ */
+
+#ifndef OSAPI_ATOMIC_H
+#define OSAPI_ATOMIC_H
+
+#include "common_types.h"
+
+#if !defined(__GNUC__) || !defined(__ATOMIC_SEQ_CST)
+#error "osapi-atomic.h requires a compiler which provides the __atomic builtins"
+#endif
+
+/** @defgroup OSAPIAtomic OSAL Atomic APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically reads a 32 bit value, with acquire semantics
+ *
+ * Memory accesses which follow this load cannot be reordered before it.
+ */
+static inline uint32 OS_AtomicLoad32(const volatile uint32 *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically writes a 32 bit value, with release semantics
+ *
+ * Memory accesses which precede this store cannot be reordered after it.
+ */
+static inline void OS_AtomicStore32(volatile uint32 *Ptr, uint32 Value)
+{
+    __atomic_store_n(Ptr, Value, __ATOMIC_RELEASE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically adds to a 32 bit value
+ *
+ * @returns The value prior to the addition
+ */
+static inline uint32 OS_AtomicFetchAdd32(volatile uint32 *Ptr, uint32 Value)
+{
+    return __atomic_fetch_add(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically subtracts from a 32 bit value
+ *
+ * @returns The value prior to the subtraction
+ */
+static inline uint32 OS_AtomicFetchSub32(volatile uint32 *Ptr, uint32 Value)
+{
+    return __atomic_fetch_sub(Ptr, Value, __ATOMIC_SEQ_CST);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replaces a 32 bit value if it matches the expected value
+ *
+ * @param[inout] Ptr      The value to update
+ * @param[inout] Expected The value expected to be in Ptr, updated with the actual value on failure
+ * @param[in]    Desired  The value to store if Ptr matches the expected value
+ *
+ * @returns true if the value was replaced, false otherwise
+ */
+static inline bool OS_AtomicCompareExchange32(volatile uint32 *Ptr, uint32 *Expected, uint32 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically reads a 16 bit value, with acquire semantics
+ *
+ * For counters embedded in existing structures whose layout cannot change.
+ */
+static inline uint16 OS_AtomicLoad16(const volatile uint16 *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replaces a 16 bit value if it matches the expected value
+ *
+ * @param[inout] Ptr      The value to update
+ * @param[inout] Expected The value expected to be in Ptr, updated with the actual value on failure
+ * @param[in]    Desired  The value to store if Ptr matches the expected value
+ *
+ * @returns true if the value was replaced, false otherwise
+ */
+static inline bool OS_AtomicCompareExchange16(volatile uint16 *Ptr, uint16 *Expected, uint16 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically reads a 64 bit value, with acquire semantics
+ *
+ * @note On some 32 bit architectures the compiler implements 64 bit atomic
+ * operations with a call into libatomic rather than inline instructions.
+ */
+static inline uint64 OS_AtomicLoad64(const volatile uint64 *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically replaces a 64 bit value if it matches the expected value
+ *
+ * @note On some 32 bit architectures the compiler implements 64 bit atomic
+ * operations with a call into libatomic rather than inline instructions.
+ *
+ * @param[inout] Ptr      The value to update
+ * @param[inout] Expected The value expected to be in Ptr, updated with the actual value on failure
+ * @param[in]    Desired  The value to store if Ptr matches the expected value
+ *
+ * @returns true if the value was replaced, false otherwise
+ */
+static inline bool OS_AtomicCompareExchange64(volatile uint64 *Ptr, uint64 *Expected, uint64 Desired)
+{
+    return __atomic_compare_exchange_n(Ptr, Expected, Desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically reads a pointer, with acquire semantics
+ */
+static inline void *OS_AtomicLoadPtr(void *const volatile *Ptr)
+{
+    return __atomic_load_n(Ptr, __ATOMIC_ACQUIRE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Atomically writes a pointer, with release semantics
+ */
+static inline void OS_AtomicStorePtr(void *volatile *Ptr, void *Value)
+{
+    __atomic_store_n(Ptr, Value, __ATOMIC_RELEASE);
+}
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Full memory barrier
+ *
+ * No memory access may be reordered across this point, in either direction.
+ */
+static inline void OS_AtomicThreadFence(void)
+{
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+/**@}*/
+
+#endif /* OSAPI_ATOMIC_H */
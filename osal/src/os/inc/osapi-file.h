@@ -338,6 +338,50 @@ int32 OS_stat(const char *path, os_fstat_t *filestats);
  */
 int32 OS_lseek(osal_id_t filedes, int32 offset, uint32 whence);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Maps the contents of an open file into memory for reading
+ *
+ * Makes the entire contents of a regular file directly addressable, so it can
+ * be consumed without first being copied into a buffer by OS_read().  The
+ * mapping is read-only and reflects the file size at the time of the call.
+ *
+ * The mapping remains valid until it is released with OS_FileUnmap(), which
+ * should be done before the file is closed.
+ *
+ * @note Not all operating systems or file systems support this.  Callers
+ * should fall back to OS_read() if #OS_ERR_NOT_IMPLEMENTED or #OS_ERROR is
+ * returned.
+ *
+ * @param[in]  filedes   The handle ID to operate on
+ * @param[out] addr      Set to the address of the mapped file contents @nonnull
+ * @param[out] size      Set to the size of the mapping in bytes @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr or size is NULL
+ * @retval #OS_ERR_INVALID_ID if the file descriptor passed in is invalid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if memory mapped files are not supported
+ * @retval #OS_ERROR if the file is empty, not a regular file, or the OS call failed @covtest
+ */
+int32 OS_FileMap(osal_id_t filedes, const void **addr, size_t *size);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Releases a mapping obtained from OS_FileMap()
+ *
+ * @param[in]  addr      The address returned by OS_FileMap() @nonnull
+ * @param[in]  size      The size returned by OS_FileMap() @nonzero
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if addr is NULL
+ * @retval #OS_ERR_INVALID_SIZE if size is zero
+ * @retval #OS_ERR_NOT_IMPLEMENTED if memory mapped files are not supported
+ * @retval #OS_ERROR if the OS call failed @covtest
+ */
+int32 OS_FileUnmap(const void *addr, size_t size);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Removes a file from the file system
@@ -0,0 +1,165 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * Declarations and prototypes for poll sets
+ *
+ * A poll set is a persistent alternative to OS_SelectMultiple().  The set of
+ * streams to watch is registered once, and each wait only reports the streams
+ * which are ready, so the cost of a wait does not grow with the number of
+ * streams being watched.
+ */
+
+#ifndef OSAPI_POLLSET_H
+#define OSAPI_POLLSET_H
+
+#include "osconfig.h"
+#include "common_types.h"
+#include "osapi-select.h"
+
+/**
+ * @brief A single ready stream reported by OS_PollSetWait()
+ */
+typedef struct
+{
+    osal_id_t objid;      /**< @brief The stream which is ready */
+    uint32    StateFlags; /**< @brief #OS_STREAM_STATE_READABLE and/or #OS_STREAM_STATE_WRITABLE */
+} OS_PollSetEvent_t;
+
+/** @defgroup OSAPIPollSet OSAL Poll Set APIs
+ * @{
+ */
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a poll set
+ *
+ * Creates an empty poll set.  Streams are then added with OS_PollSetAdd()
+ * and waited on with OS_PollSetWait().
+ *
+ * @param[out]  pollset_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   pollset_name the name of the new resource to create @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if pollset_id or pollset_name are NULL
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NO_FREE_IDS if all of the poll set ids are taken
+ * @retval #OS_ERR_NAME_TAKEN if this is already the name of a poll set
+ * @retval #OS_ERROR if an unspecified implementation error occurs @covtest
+ */
+int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Deletes the specified poll set
+ *
+ * The streams in the set are not affected.
+ *
+ * @param[in] pollset_id The object ID to delete
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poll set
+ * @retval #OS_ERROR if an unspecified implementation error occurs @covtest
+ */
+int32 OS_PollSetDelete(osal_id_t pollset_id);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Adds a stream to a poll set, or changes the states it is watched for
+ *
+ * @param[in] pollset_id The poll set to operate on
+ * @param[in] objid      The file or socket to watch
+ * @param[in] StateFlags #OS_STREAM_STATE_READABLE and/or #OS_STREAM_STATE_WRITABLE
+ *
+ * @note A stream which is closed while in a poll set is no longer reported,
+ * but it should still be removed with OS_PollSetRemove().
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if either id passed in is not valid
+ * @retval #OS_ERR_INVALID_ARGUMENT if StateFlags is zero or contains other states
+ * @retval #OS_ERR_OPERATION_NOT_SUPPORTED if the stream cannot be polled
+ * @retval #OS_ERROR if an unspecified implementation error occurs @covtest
+ */
+int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Removes a stream from a poll set
+ *
+ * @param[in] pollset_id The poll set to operate on
+ * @param[in] objid      The file or socket to stop watching
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the poll set is not valid, or the stream is not a member of it
+ * @retval #OS_ERROR if an unspecified implementation error occurs @covtest
+ */
+int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Wait for streams in a poll set to become ready
+ *
+ * Blocks until at least one stream in the set is in one of the states it
+ * was added with, or the timeout elapses.  Up to max_events ready streams
+ * are reported in the events array.
+ *
+ * @param[in]  pollset_id The poll set to wait on
+ * @param[out] events     Array which receives the ready streams @nonnull
+ * @param[in]  max_events Number of entries in the events array @nonzero
+ * @param[in]  msecs      Timeout in milliseconds, 0 to poll, or #OS_PEND to wait forever
+ *
+ * @note A stream removed from the set by another task while a wait is in
+ * progress may still be reported by that wait.
+ * Waiting on a set with no members may return #OS_ERROR_TIMEOUT without
+ * waiting for the full timeout.
+ *
+ * @return Number of ready streams reported (greater than zero), or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if events is NULL
+ * @retval #OS_ERR_INVALID_SIZE if max_events is not valid
+ * @retval #OS_ERR_INVALID_ID if the id passed in is not a valid poll set
+ * @retval #OS_ERROR_TIMEOUT if no stream became ready within the timeout
+ * @retval #OS_ERROR if an unspecified implementation error occurs @covtest
+ */
+int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *events, uint32 max_events, int32 msecs);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Find an existing poll set ID by name
+ *
+ * @param[out] pollset_id will be set to the ID of the existing resource
+ * @param[in]  pollset_name the name of the existing resource to find @nonnull
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if pollset_id or pollset_name are NULL pointers
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_NAME_NOT_FOUND if the name was not found in the table
+ */
+int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name);
+
+/**@}*/
+
+#endif /* OSAPI_POLLSET_H */
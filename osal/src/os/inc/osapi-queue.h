@@ -37,6 +37,24 @@ typedef struct
     osal_id_t creator;
 } OS_queue_prop_t;
 
+/**
+ * @brief Flags that can be used with creation of a queue (bitmask)
+ */
+typedef enum
+{
+    OS_QUEUE_FLAG_NONE = 0x00,
+
+    /**
+     * Use an in-process ring buffer rather than an operating system message queue.
+     *
+     * Messages are passed between tasks in shared memory, and the receiver only
+     * enters the kernel when it has to block on an empty queue.  The queue
+     * cannot be accessed outside of the process.  This flag is ignored by
+     * implementations which do not provide an in-process queue.
+     */
+    OS_QUEUE_FLAG_RING = 0x01,
+} OS_queue_flag_t;
+
 /** @defgroup OSAPIMsgQueue OSAL Message Queue APIs
  * @{
  */
@@ -54,7 +72,7 @@ typedef struct
  * @param[in]   queue_name the name of the new resource to create @nonnull
  * @param[in]   queue_depth the maximum depth of the queue
  * @param[in]   data_size the size of each entry in the queue @nonzero
- * @param[in]   flags options for the queue (reserved for future use, pass as 0)
+ * @param[in]   flags options for the queue, a bitmask of @ref OS_queue_flag_t values, or 0 for defaults
  *
  * @return Execution status, see @ref OSReturnCodes
  * @retval #OS_SUCCESS @copybrief OS_SUCCESS
@@ -114,6 +114,20 @@ typedef struct
     OS_SockAddrData_t AddrData;     /**< @brief Abstract Address data */
 } OS_SockAddr_t;
 
+/**
+ * @brief Describes one datagram in a multi-message socket transfer
+ *
+ * Used with OS_SocketRecvFromMulti() and OS_SocketSendToMulti() to move
+ * several datagrams with a single call.
+ */
+typedef struct
+{
+    void *         Buffer;       /**< @brief Message data buffer */
+    size_t         BufLen;       /**< @brief Size of the receive buffer, or length of the message to send */
+    size_t         ActualLength; /**< @brief Length of the message actually received or sent */
+    OS_SockAddr_t *RemoteAddr;   /**< @brief Remote network address (may be NULL when receiving) */
+} OS_SockMsg_t;
+
 /**
  * @brief Encapsulates socket properties
  *
@@ -405,6 +419,60 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
  */
 int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, const OS_SockAddr_t *RemoteAddr);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Reads multiple messages from a message-oriented (datagram) socket
+ *
+ * Receives up to "count" datagrams into the buffers described by the "msgs"
+ * array.  If no message is available, this blocks up to the given timeout for
+ * the first one; any further messages that are already queued on the socket
+ * are then received without waiting.  The length of each message received is
+ * stored in the ActualLength member of its descriptor, and the sender address
+ * in RemoteAddr if it is not NULL.
+ *
+ * Where the system supports it, all messages are received in a single system
+ * call.  Otherwise this is equivalent to repeated calls to OS_SocketRecvFrom().
+ * Fewer messages than requested may be returned even if more are queued.
+ *
+ * @param[in]     sock_id  The socket ID, previously bound using OS_SocketBind()
+ * @param[in,out] msgs     Array of message descriptors @nonnull
+ * @param[in]     count    The number of message descriptors in the array @nonzero
+ * @param[in]     timeout  The maximum amount of time to wait, or OS_PEND to wait forever
+ *
+ * @return Count of messages received or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in count or a buffer length is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ * @retval #OS_ERROR_TIMEOUT if no message was received within the timeout
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout);
+
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Sends multiple messages to a message-oriented (datagram) socket
+ *
+ * Sends the "count" datagrams described by the "msgs" array, each to its own
+ * RemoteAddr, in a non-blocking mode.  If the socket is not able to queue all
+ * of the messages, such as if its outbound buffer fills, then only the leading
+ * messages that were queued are counted as sent.  The length of each message
+ * sent is stored in the ActualLength member of its descriptor.
+ *
+ * Where the system supports it, all messages are sent in a single system
+ * call.  Otherwise this is equivalent to repeated calls to OS_SocketSendTo().
+ *
+ * @param[in]     sock_id  The socket ID, which must be of the datagram type
+ * @param[in,out] msgs     Array of message descriptors @nonnull
+ * @param[in]     count    The number of message descriptors in the array @nonzero
+ *
+ * @return Count of messages sent or error status, see @ref OSReturnCodes
+ * @retval #OS_INVALID_POINTER if argument is NULL
+ * @retval #OS_ERR_INVALID_SIZE if passed-in count or a message length is not valid
+ * @retval #OS_ERR_INVALID_ID if the sock_id parameter is not valid
+ * @retval #OS_ERR_INCORRECT_OBJ_TYPE if the handle is not a socket
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Gets an OSAL ID from a given name
@@ -55,6 +55,18 @@ typedef void *osal_stackptr_t;
 #define OSAL_STACKPTR_C(X)       ((osal_stackptr_t) {X})
 #define OSAL_TASK_STACK_ALLOCATE OSAL_STACKPTR_C(NULL)
 
+/**
+ * @brief Type to be used for OSAL task CPU affinity masks.
+ *
+ * Bit N set indicates the task may run on processor N.  A
+ * mask of zero (#OS_TASK_CPUMASK_ANY) places no restriction
+ * on the task and leaves the placement to the OS scheduler.
+ */
+typedef uint32 osal_cpumask_t;
+
+#define OSAL_CPUMASK_C(X)   ((osal_cpumask_t) {X})
+#define OS_TASK_CPUMASK_ANY OSAL_CPUMASK_C(0)
+
 /** @brief OSAL task properties */
 typedef struct
 {
@@ -62,6 +74,7 @@ typedef struct
     osal_id_t       creator;
     size_t          stack_size;
     osal_priority_t priority;
+    osal_cpumask_t  cpu_mask;
 } OS_task_prop_t;
 
 /*
@@ -113,6 +126,41 @@ typedef osal_task((*osal_task_entry)(void)); /**< @brief For task entry point */
 int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
                     osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority, uint32 flags);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Creates a task restricted to a set of processors and starts running it.
+ *
+ * This is identical to OS_TaskCreate() but additionally applies a CPU affinity
+ * mask to the new task before it begins executing.  OS_TaskCreate() is equivalent
+ * to calling this function with #OS_TASK_CPUMASK_ANY.
+ *
+ * On platforms where the underlying OS does not support processor affinity the
+ * mask is recorded (and reported via OS_TaskGetInfo()) but otherwise ignored.
+ *
+ * @param[out]  task_id will be set to the non-zero ID of the newly-created resource @nonnull
+ * @param[in]   task_name the name of the new resource to create @nonnull
+ * @param[in]   function_pointer the entry point of the new task @nonnull
+ * @param[in]   stack_pointer pointer to the stack for the task, or NULL
+ *              to allocate a stack from the system memory heap
+ * @param[in]   stack_size the size of the stack @nonzero
+ * @param[in]   priority initial priority of the new task
+ * @param[in]   flags initial options for the new task
+ * @param[in]   cpu_mask set of processors the task may run on, or #OS_TASK_CPUMASK_ANY
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_INVALID_POINTER if any of the necessary pointers are NULL
+ * @retval #OS_ERR_INVALID_SIZE if the stack_size argument is zero
+ * @retval #OS_ERR_NAME_TOO_LONG name length including null terminator greater than #OS_MAX_API_NAME
+ * @retval #OS_ERR_INVALID_PRIORITY if the priority is bad @covtest
+ * @retval #OS_ERR_NO_FREE_IDS if there can be no more tasks created
+ * @retval #OS_ERR_NAME_TAKEN if the name specified is already used by a task
+ * @retval #OS_ERROR if an unspecified/other error occurs @covtest
+ */
+int32 OS_TaskCreateWithAffinity(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
+                                osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority,
+                                uint32 flags, osal_cpumask_t cpu_mask);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Deletes the specified Task
@@ -183,6 +231,21 @@ int32 OS_TaskDelay(uint32 millisecond);
  */
 int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority);
 
+/*-------------------------------------------------------------------------------------*/
+/**
+ * @brief Restricts the given task to a set of processors
+ *
+ * @param[in] task_id        The object ID to operate on
+ * @param[in] cpu_mask       Set of processors the task may run on, or #OS_TASK_CPUMASK_ANY
+ *
+ * @return Execution status, see @ref OSReturnCodes
+ * @retval #OS_SUCCESS @copybrief OS_SUCCESS
+ * @retval #OS_ERR_INVALID_ID if the ID passed to it is invalid
+ * @retval #OS_ERR_NOT_IMPLEMENTED if the OS does not support processor affinity
+ * @retval #OS_ERROR if the mask could not be applied (e.g. no such processor) @covtest
+ */
+int32 OS_TaskSetAffinity(osal_id_t task_id, osal_cpumask_t cpu_mask);
+
 /*-------------------------------------------------------------------------------------*/
 /**
  * @brief Obtain the task id of the calling task
@@ -215,7 +278,7 @@ int32 OS_TaskGetIdByName(osal_id_t *task_id, const char *task_name);
  * @brief Fill a property object buffer with details regarding the resource
  *
  * This function will pass back a pointer to structure that contains
- * all of the relevant info (creator, stack size, priority, name) about the
+ * all of the relevant info (creator, stack size, priority, CPU mask, name) about the
  * specified task.
  *
  * @param[in]   task_id The object ID to operate on
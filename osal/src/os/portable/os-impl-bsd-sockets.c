@@ -26,6 +26,14 @@
  *      systems which implement the BSD-style socket API.
  */
 
+/*
+ * recvmmsg() and sendmmsg() are Linux extensions, which are only declared
+ * if this is defined before any system header is included.
+ */
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 /****************************************************************************************
                                     INCLUDE FILES
  ***************************************************************************************/
@@ -79,6 +87,14 @@
 #define OS_IMPL_SET_SOCKET_FLAGS(tok) OS_SetSocketDefaultFlags_Impl(tok)
 #endif
 
+/*
+ * The OS layer may define OS_IMPL_SOCKET_MMSG if it provides recvmmsg()/sendmmsg().
+ * This is the largest number of datagrams passed to the kernel in one such call.
+ */
+#ifndef OS_IMPL_SOCKET_MMSG_MAX
+#define OS_IMPL_SOCKET_MMSG_MAX 32
+#endif
+
 typedef union
 {
     char               data[OS_SOCKADDR_MAX_LEN];
@@ -98,6 +114,34 @@ typedef union
  */
 CompileTimeAssert(sizeof(OS_SockAddr_Accessor_t) == OS_SOCKADDR_MAX_LEN, SockAddrSize);
 
+/*
+ * Gets the length of the system address structure held in an abstract address,
+ * according to its address family, or zero if the family is not supported.
+ */
+static socklen_t OS_SocketAddrLength_Impl(const OS_SockAddr_t *Addr)
+{
+    const struct sockaddr *sa;
+    socklen_t              addrlen;
+
+    sa = (const struct sockaddr *)&Addr->AddrData;
+    switch (sa->sa_family)
+    {
+        case AF_INET:
+            addrlen = sizeof(struct sockaddr_in);
+            break;
+#ifdef OS_NETWORK_SUPPORTS_IPV6
+        case AF_INET6:
+            addrlen = sizeof(struct sockaddr_in6);
+            break;
+#endif
+        default:
+            addrlen = 0;
+            break;
+    }
+
+    return addrlen;
+}
+
 /*
  * Default flags implementation: Set the O_NONBLOCK flag via fcntl().
  * An implementation can also elect custom configuration by setting
@@ -580,21 +624,8 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
 
-    sa = (const struct sockaddr *)&RemoteAddr->AddrData;
-    switch (sa->sa_family)
-    {
-        case AF_INET:
-            addrlen = sizeof(struct sockaddr_in);
-            break;
-#ifdef OS_NETWORK_SUPPORTS_IPV6
-        case AF_INET6:
-            addrlen = sizeof(struct sockaddr_in6);
-            break;
-#endif
-        default:
-            addrlen = 0;
-            break;
-    }
+    sa      = (const struct sockaddr *)&RemoteAddr->AddrData;
+    addrlen = OS_SocketAddrLength_Impl(RemoteAddr);
 
     if (addrlen != RemoteAddr->ActualLength)
     {
@@ -611,6 +642,282 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return os_result;
 } /* end OS_SocketSendTo_Impl */
 
+#ifdef OS_IMPL_SOCKET_MMSG
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    int32                           return_code;
+    int                             os_result;
+    uint32                          operation;
+    uint32                          i;
+    struct mmsghdr                  mmsg[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec                    iov[OS_IMPL_SOCKET_MMSG_MAX];
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (count > OS_IMPL_SOCKET_MMSG_MAX)
+    {
+        count = OS_IMPL_SOCKET_MMSG_MAX;
+    }
+
+    memset(mmsg, 0, sizeof(mmsg[0]) * count);
+    for (i = 0; i < count; ++i)
+    {
+        iov[i].iov_base            = msgs[i].Buffer;
+        iov[i].iov_len             = msgs[i].BufLen;
+        mmsg[i].msg_hdr.msg_iov    = &iov[i];
+        mmsg[i].msg_hdr.msg_iovlen = 1;
+
+        if (msgs[i].RemoteAddr != NULL)
+        {
+            mmsg[i].msg_hdr.msg_name    = &msgs[i].RemoteAddr->AddrData;
+            mmsg[i].msg_hdr.msg_namelen = OS_SOCKADDR_MAX_LEN;
+        }
+    }
+
+    /*
+     * First collect whatever is already queued without waiting, so that a
+     * busy socket costs a single system call per batch and no select().
+     */
+    return_code = OS_SUCCESS;
+    os_result   = recvmmsg(impl->fd, mmsg, count, MSG_DONTWAIT, NULL);
+    if (os_result < 0 && (errno == EAGAIN || errno == EWOULDBLOCK) && timeout != 0)
+    {
+        if (impl->selectable)
+        {
+            operation   = OS_STREAM_STATE_READABLE;
+            return_code = OS_SelectSingle_Impl(token, &operation, timeout);
+            if (return_code == OS_SUCCESS && (operation & OS_STREAM_STATE_READABLE) == 0)
+            {
+                return_code = OS_ERROR_TIMEOUT;
+            }
+
+            if (return_code == OS_SUCCESS)
+            {
+                os_result = recvmmsg(impl->fd, mmsg, count, MSG_DONTWAIT, NULL);
+            }
+        }
+        else
+        {
+            /* Block for the first message only; note timeout will not be honored if >0 */
+            os_result = recvmmsg(impl->fd, mmsg, count, MSG_WAITFORONE, NULL);
+        }
+    }
+
+    if (return_code == OS_SUCCESS)
+    {
+        if (os_result < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return_code = OS_ERROR_TIMEOUT;
+            }
+            else
+            {
+                OS_DEBUG("recvmmsg: %s\n", strerror(errno));
+                return_code = OS_ERROR;
+            }
+        }
+        else
+        {
+            for (i = 0; (int)i < os_result; ++i)
+            {
+                msgs[i].ActualLength = mmsg[i].msg_len;
+
+                if (msgs[i].RemoteAddr != NULL)
+                {
+                    msgs[i].RemoteAddr->ActualLength = mmsg[i].msg_hdr.msg_namelen;
+                }
+            }
+
+            return_code = os_result;
+        }
+    }
+
+    return return_code;
+} /* end OS_SocketRecvFromMulti_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count)
+{
+    int32                           return_code;
+    int                             os_result;
+    uint32                          sent;
+    uint32                          batch;
+    uint32                          i;
+    struct mmsghdr                  mmsg[OS_IMPL_SOCKET_MMSG_MAX];
+    struct iovec                    iov[OS_IMPL_SOCKET_MMSG_MAX];
+    OS_SockMsg_t *                  msg;
+    OS_impl_file_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    return_code = OS_SUCCESS;
+    sent        = 0;
+    while (sent < count && return_code == OS_SUCCESS)
+    {
+        batch = count - sent;
+        if (batch > OS_IMPL_SOCKET_MMSG_MAX)
+        {
+            batch = OS_IMPL_SOCKET_MMSG_MAX;
+        }
+
+        memset(mmsg, 0, sizeof(mmsg[0]) * batch);
+        for (i = 0; i < batch; ++i)
+        {
+            msg = &msgs[sent + i];
+
+            mmsg[i].msg_hdr.msg_namelen = OS_SocketAddrLength_Impl(msg->RemoteAddr);
+            if (mmsg[i].msg_hdr.msg_namelen != msg->RemoteAddr->ActualLength)
+            {
+                /* Send the messages before this one, then stop */
+                return_code = OS_ERR_BAD_ADDRESS;
+                batch       = i;
+                break;
+            }
+
+            iov[i].iov_base            = msg->Buffer;
+            iov[i].iov_len             = msg->BufLen;
+            mmsg[i].msg_hdr.msg_name   = &msg->RemoteAddr->AddrData;
+            mmsg[i].msg_hdr.msg_iov    = &iov[i];
+            mmsg[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        if (batch == 0)
+        {
+            break;
+        }
+
+        os_result = sendmmsg(impl->fd, mmsg, batch, MSG_DONTWAIT);
+        if (os_result < 0)
+        {
+            OS_DEBUG("sendmmsg: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+        }
+        else
+        {
+            for (i = 0; (int)i < os_result; ++i)
+            {
+                msgs[sent + i].ActualLength = mmsg[i].msg_len;
+            }
+
+            sent += os_result;
+
+            if ((uint32)os_result < batch)
+            {
+                /* The socket cannot queue any more right now */
+                break;
+            }
+        }
+    }
+
+    if (sent > 0)
+    {
+        return_code = sent;
+    }
+
+    return return_code;
+} /* end OS_SocketSendToMulti_Impl */
+
+#else
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           Without recvmmsg(), each message is received individually
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    int32  return_code;
+    uint32 i;
+
+    i = 0;
+    do
+    {
+        return_code = OS_SocketRecvFrom_Impl(token, msgs[i].Buffer, msgs[i].BufLen, msgs[i].RemoteAddr, timeout);
+        if (return_code < 0)
+        {
+            break;
+        }
+
+        msgs[i].ActualLength = return_code;
+        ++i;
+
+        /* Only wait for the first message */
+        timeout = 0;
+    } while (i < count);
+
+    if (i > 0)
+    {
+        return_code = i;
+    }
+    else if (return_code == OS_QUEUE_EMPTY)
+    {
+        /* Report an empty non-selectable socket the same way as the batched path */
+        return_code = OS_ERROR_TIMEOUT;
+    }
+
+    return return_code;
+} /* end OS_SocketRecvFromMulti_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *           Without sendmmsg(), each message is sent individually
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count)
+{
+    int32  return_code;
+    uint32 i;
+
+    return_code = OS_SUCCESS;
+    for (i = 0; i < count; ++i)
+    {
+        return_code = OS_SocketSendTo_Impl(token, msgs[i].Buffer, msgs[i].BufLen, msgs[i].RemoteAddr);
+        if (return_code < 0)
+        {
+            break;
+        }
+
+        msgs[i].ActualLength = return_code;
+    }
+
+    if (i > 0)
+    {
+        return_code = i;
+    }
+
+    return return_code;
+} /* end OS_SocketSendToMulti_Impl */
+
+#endif /* OS_IMPL_SOCKET_MMSG */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetInfo_Impl
@@ -0,0 +1,183 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file   os-impl-select-pollset.c
+ *
+ * Purpose: This file contains a poll set implementation for systems without
+ *          a persistent readiness interface such as epoll.  The membership
+ *          kept by the shared layer is converted into OS_FdSet structures
+ *          and passed to the select() implementation on each wait.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <string.h>
+
+#include "os-impl-select.h"
+#include "os-shared-select.h"
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                   POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token)
+{
+    /* No OS resources; the set is rebuilt from the shared membership on each wait */
+    return OS_SUCCESS;
+} /* end OS_PollSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    return OS_SUCCESS;
+} /* end OS_PollSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags)
+{
+    OS_impl_file_internal_record_t *stream;
+
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    /* Reject here rather than failing every subsequent wait */
+    if (!stream->selectable || stream->fd >= FD_SETSIZE)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, osal_index_t stream_idx)
+{
+    return OS_SUCCESS;
+} /* end OS_PollSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *events, uint32 max_events,
+                          int32 msecs)
+{
+    OS_pollset_internal_record_t *pollset;
+    OS_FdSet                      ReadSet;
+    OS_FdSet                      WriteSet;
+    osal_index_t                  idx;
+    uint32                        flags;
+    uint32                        count;
+    int32                         return_code;
+
+    pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, *token);
+
+    memset(&ReadSet, 0, sizeof(ReadSet));
+    memset(&WriteSet, 0, sizeof(WriteSet));
+    count = 0;
+
+    /* Members which have since been closed, or whose slot was reused, are skipped */
+    for (idx = 0; idx < OS_MAX_NUM_OPEN_FILES; ++idx)
+    {
+        flags = pollset->member_flags[idx];
+        if (flags != 0 && OS_ObjectIdEqual(OS_global_stream_table[idx].active_id, pollset->member_id[idx]))
+        {
+            if (flags & OS_STREAM_STATE_READABLE)
+            {
+                ReadSet.object_ids[idx >> 3] |= 1 << (idx & 0x7);
+            }
+            if (flags & OS_STREAM_STATE_WRITABLE)
+            {
+                WriteSet.object_ids[idx >> 3] |= 1 << (idx & 0x7);
+            }
+            ++count;
+        }
+    }
+
+    if (count == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    return_code = OS_SelectMultiple_Impl(&ReadSet, &WriteSet, msecs);
+    if (return_code != OS_SUCCESS)
+    {
+        return return_code;
+    }
+
+    count = 0;
+    for (idx = 0; idx < OS_MAX_NUM_OPEN_FILES && count < max_events; ++idx)
+    {
+        flags = 0;
+        if (ReadSet.object_ids[idx >> 3] & (1 << (idx & 0x7)))
+        {
+            flags |= OS_STREAM_STATE_READABLE;
+        }
+        if (WriteSet.object_ids[idx >> 3] & (1 << (idx & 0x7)))
+        {
+            flags |= OS_STREAM_STATE_WRITABLE;
+        }
+        if (flags != 0)
+        {
+            events[count].objid      = pollset->member_id[idx];
+            events[count].StateFlags = flags;
+            ++count;
+        }
+    }
+
+    return (int32)count;
+} /* end OS_PollSetWait_Impl */
@@ -0,0 +1,41 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * \ingroup  posix
+ *
+ */
+
+#ifndef OS_IMPL_POLLSET_H
+#define OS_IMPL_POLLSET_H
+
+#include "osconfig.h"
+
+typedef struct
+{
+    int epoll_fd;
+} OS_impl_pollset_internal_record_t;
+
+/* Tables where the OS object information is stored */
+extern OS_impl_pollset_internal_record_t OS_impl_pollset_table[OS_MAX_POLLSETS];
+
+#endif /* OS_IMPL_POLLSET_H */
@@ -31,10 +31,34 @@
 #include "osconfig.h"
 #include <mqueue.h>
 
+/*
+ * In-process ring buffer queue, see os-impl-queues.c
+ *
+ * The ring has a power of two number of slots, each holding a sequence
+ * number, the message size, and up to max_size bytes of message data.
+ */
+typedef struct
+{
+    volatile uint32 count;       /**< Number of messages in the queue, including those being written */
+    volatile uint32 put_pos;     /**< Next slot to be written */
+    volatile uint32 get_pos;     /**< Next slot to be read */
+    volatile uint32 put_events;  /**< Incremented on every put, used as the futex word for blocking */
+    volatile uint32 num_waiters; /**< Number of tasks blocked in get */
+    uint32          max_depth;   /**< Depth limit of the queue */
+    uint32          slot_mask;   /**< Number of slots minus one */
+    size_t          slot_size;   /**< Size of each slot, including the header */
+    uint8 *         slots;       /**< Slot storage */
+} OS_impl_queue_ring_t;
+
+/* Set in ring_users once a ring buffer queue is being deleted */
+#define OS_QUEUE_RING_CLOSING 0x80000000U
+
 /* queues */
 typedef struct
 {
-    mqd_t id;
+    mqd_t                 id;
+    OS_impl_queue_ring_t *ring;       /**< Set if the queue uses a ring buffer rather than the mqueue */
+    volatile uint32       ring_users; /**< Get and put calls using the ring, plus OS_QUEUE_RING_CLOSING */
 } OS_impl_queue_internal_record_t;
 
 /* Tables where the OS object information is stored */
@@ -49,4 +49,11 @@
  */
 #define OS_IMPL_SOCKET_FLAGS O_NONBLOCK
 
+/*
+ * Linux can move several datagrams in one system call with recvmmsg()/sendmmsg()
+ */
+#ifdef __linux__
+#define OS_IMPL_SOCKET_MMSG
+#endif
+
 #endif /* OS_IMPL_SOCKETS_H */
@@ -33,6 +33,13 @@
 #include "osconfig.h"
 #include <pthread.h>
 
+/*
+ * Linux can restrict threads to a set of processors with pthread_attr_setaffinity_np()
+ */
+#ifdef __linux__
+#define OS_IMPL_TASK_AFFINITY
+#endif
+
 /*tasks */
 typedef struct
 {
@@ -42,7 +49,7 @@ typedef struct
 /* Tables where the OS object information is stored */
 extern OS_impl_task_internal_record_t OS_impl_task_table[OS_MAX_TASKS];
 
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
-                                       PthreadFuncPtr_t entry, void *entry_arg);
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, osal_cpumask_t cpu_mask,
+                                       size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg);
 
 #endif /* OS_IMPL_TASKS_H */
@@ -42,6 +42,14 @@ typedef struct
     sig_atomic_t    reset_flag;
     struct timespec softsleep;
 
+    /*
+     * Used by the timerfd implementation only (see os-impl-timebase-timerfd.c)
+     */
+    int    timer_fd;
+    bool   tickless;
+    uint32 skip_limit;
+    int64  next_tick_nsec;
+
 } OS_impl_timebase_internal_record_t;
 
 /****************************************************************************************
@@ -135,8 +135,9 @@ int32 OS_ConsoleCreate_Impl(const OS_object_token_t *token)
             else
             {
                 local_arg.id = OS_ObjectIdFromToken(token);
-                return_code  = OS_Posix_InternalTaskCreate_Impl(&consoletask, OS_CONSOLE_TASK_PRIORITY, 0,
-                                                               OS_ConsoleTask_Entry, local_arg.opaque_arg);
+                return_code  = OS_Posix_InternalTaskCreate_Impl(&consoletask, OS_CONSOLE_TASK_PRIORITY,
+                                                               OS_TASK_CPUMASK_ANY, 0, OS_ConsoleTask_Entry,
+                                                               local_arg.opaque_arg);
 
                 if (return_code != OS_SUCCESS)
                 {
@@ -31,6 +31,7 @@
 
 #include <fcntl.h>
 #include <dirent.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -38,6 +39,7 @@
 #include "os-posix.h"
 #include "os-impl-files.h"
 #include "os-shared-file.h"
+#include "os-shared-idmap.h"
 
 /****************************************************************************************
                                      GLOBALS
@@ -101,3 +103,63 @@ int32 OS_Posix_StreamAPI_Impl_Init(void)
 
     return OS_SUCCESS;
 } /* end OS_Posix_StreamAPI_Impl_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, const void **addr, size_t *size)
+{
+    OS_impl_file_internal_record_t *impl;
+    struct stat                     st;
+    void *                          map;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *token);
+
+    if (fstat(impl->fd, &st) < 0)
+    {
+        OS_DEBUG("fstat: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    /* mmap() of zero bytes is an error, and only regular files have a meaningful size */
+    if (!S_ISREG(st.st_mode) || st.st_size <= 0)
+    {
+        return OS_ERROR;
+    }
+
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, impl->fd, 0);
+    if (map == MAP_FAILED)
+    {
+        OS_DEBUG("mmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    *addr = map;
+    *size = (size_t)st.st_size;
+
+    return OS_SUCCESS;
+} /* end OS_FileMap_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const void *addr, size_t size)
+{
+    if (munmap((void *)addr, size) < 0)
+    {
+        OS_DEBUG("munmap: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_FileUnmap_Impl */
@@ -0,0 +1,329 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-pollset-epoll.c
+ * \ingroup  posix
+ *
+ * This file contains the OSAL poll set API for Linux, using epoll.
+ *
+ * Unlike select(), the kernel keeps the interest list between calls, so the
+ * cost of a wait is proportional to the number of ready streams rather than
+ * the number of members, and descriptors are not limited to FD_SETSIZE.
+ * The stream table index is stored as the epoll user data so that events can
+ * be mapped back to the OSAL ID recorded in the shared layer.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <sys/epoll.h>
+
+#include "os-posix.h"
+#include "os-impl-io.h"
+#include "os-impl-pollset.h"
+
+#include "os-shared-pollset.h"
+#include "os-shared-idmap.h"
+
+/****************************************************************************************
+                                     GLOBALS
+ ***************************************************************************************/
+
+OS_impl_pollset_internal_record_t OS_impl_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                INTERNAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSet_RemainingMsecs
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the epoll_wait() timeout remaining until the given
+ *           CLOCK_MONOTONIC deadline, never less than zero.
+ *
+ *-----------------------------------------------------------------*/
+static int OS_PollSet_RemainingMsecs(const struct timespec *ts_end)
+{
+    struct timespec ts_now;
+    long            remain;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts_now);
+
+    remain = (long)(ts_end->tv_sec - ts_now.tv_sec) * 1000;
+    remain += (ts_end->tv_nsec - ts_now.tv_nsec) / 1000000;
+    if (remain < 0)
+    {
+        remain = 0;
+    }
+
+    return (int)remain;
+} /* end OS_PollSet_RemainingMsecs */
+
+/****************************************************************************************
+                                   POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    impl->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (impl->epoll_fd < 0)
+    {
+        OS_DEBUG("epoll_create1: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_pollset_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+
+    if (impl->epoll_fd >= 0)
+    {
+        close(impl->epoll_fd);
+        impl->epoll_fd = -1;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_impl_file_internal_record_t *   stream;
+    struct epoll_event                 ev;
+    int                                os_status;
+
+    impl   = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    stream = OS_OBJECT_TABLE_GET(OS_impl_filehandle_table, *stream_token);
+
+    if (!stream->selectable)
+    {
+        return OS_ERR_OPERATION_NOT_SUPPORTED;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.data.u32 = OS_ObjectIndexFromToken(stream_token);
+    if (StateFlags & OS_STREAM_STATE_READABLE)
+    {
+        ev.events |= EPOLLIN;
+    }
+    if (StateFlags & OS_STREAM_STATE_WRITABLE)
+    {
+        ev.events |= EPOLLOUT;
+    }
+
+    /* Adding a stream which is already a member updates the states it is watched for */
+    os_status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_ADD, stream->fd, &ev);
+    if (os_status < 0 && errno == EEXIST)
+    {
+        os_status = epoll_ctl(impl->epoll_fd, EPOLL_CTL_MOD, stream->fd, &ev);
+    }
+
+    if (os_status < 0)
+    {
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetAdd_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, osal_index_t stream_idx)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    struct epoll_event                 ev;
+    int                                fd;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    fd   = OS_impl_filehandle_table[stream_idx].fd;
+    memset(&ev, 0, sizeof(ev));
+
+    /*
+     * The kernel drops a descriptor from the interest list when it is closed,
+     * so if the stream was already closed there is nothing to undo here.
+     * The event argument is ignored but must be non-NULL on older kernels.
+     */
+    if (fd >= 0 && epoll_ctl(impl->epoll_fd, EPOLL_CTL_DEL, fd, &ev) < 0 && errno != ENOENT && errno != EBADF)
+    {
+        OS_DEBUG("epoll_ctl: %s\n", strerror(errno));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_PollSetRemove_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *events, uint32 max_events,
+                          int32 msecs)
+{
+    OS_impl_pollset_internal_record_t *impl;
+    OS_pollset_internal_record_t *     pollset;
+    struct epoll_event                 ep_events[OS_MAX_NUM_OPEN_FILES];
+    struct timespec                    ts_end;
+    osal_index_t                       stream_idx;
+    uint32                             flags;
+    uint32                             count;
+    int                                timeout;
+    int                                os_status;
+    int                                i;
+
+    impl    = OS_OBJECT_TABLE_GET(OS_impl_pollset_table, *token);
+    pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, *token);
+
+    /* A stream can only be reported once per wait, so there are never more events than members */
+    if (max_events > OS_MAX_NUM_OPEN_FILES)
+    {
+        max_events = OS_MAX_NUM_OPEN_FILES;
+    }
+
+    if (msecs > 0)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &ts_end);
+        ts_end.tv_sec += msecs / 1000;
+        ts_end.tv_nsec += 1000000 * (msecs % 1000);
+        if (ts_end.tv_nsec >= 1000000000)
+        {
+            ++ts_end.tv_sec;
+            ts_end.tv_nsec -= 1000000000;
+        }
+    }
+    else
+    {
+        /* Zero for consistency and to avoid possible confusion if not cleared */
+        memset(&ts_end, 0, sizeof(ts_end));
+    }
+
+    count = 0;
+    do
+    {
+        if (msecs > 0)
+        {
+            timeout = OS_PollSet_RemainingMsecs(&ts_end);
+        }
+        else if (msecs < 0)
+        {
+            timeout = -1;
+        }
+        else
+        {
+            timeout = 0;
+        }
+
+        os_status = epoll_wait(impl->epoll_fd, ep_events, (int)max_events, timeout);
+        if (os_status < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            OS_DEBUG("epoll_wait: %s\n", strerror(errno));
+            return OS_ERROR;
+        }
+
+        for (i = 0; i < os_status; ++i)
+        {
+            stream_idx = OSAL_INDEX_C(ep_events[i].data.u32);
+            if (stream_idx >= OS_MAX_NUM_OPEN_FILES)
+            {
+                continue;
+            }
+
+            flags = 0;
+            if (ep_events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                /* hangup and error conditions are reported as readable so the next read returns them */
+                flags |= OS_STREAM_STATE_READABLE;
+            }
+            if (ep_events[i].events & EPOLLOUT)
+            {
+                flags |= OS_STREAM_STATE_WRITABLE;
+            }
+
+            flags &= pollset->member_flags[stream_idx];
+            if (flags != 0)
+            {
+                events[count].objid      = pollset->member_id[stream_idx];
+                events[count].StateFlags = flags;
+                ++count;
+            }
+        }
+
+        /* Only events for streams since removed from the set were seen, so wait again */
+    } while (count == 0 && os_status != 0);
+
+    if (count == 0)
+    {
+        return OS_ERROR_TIMEOUT;
+    }
+
+    return (int32)count;
+} /* end OS_PollSetWait_Impl */
@@ -25,6 +25,15 @@
  *
  */
 
+/*
+ * The ring buffer queue blocks using the Linux futex system call, which is not
+ * part of X/Open.  This must be defined before any system header is included.
+ */
+#ifdef __linux__
+#define _DEFAULT_SOURCE
+#define OS_POSIX_QUEUE_RING_SUPPORTED
+#endif
+
 /****************************************************************************************
                                     INCLUDE FILES
  ***************************************************************************************/
@@ -35,10 +44,484 @@
 #include "os-impl-queues.h"
 #include "os-shared-queue.h"
 #include "os-shared-idmap.h"
+#include "osapi-atomic.h"
+
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#endif
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * Header of each slot in a ring buffer queue, followed by the message data
+ */
+typedef struct
+{
+    volatile uint32 seq;  /**< Equal to the position when writable, position + 1 when readable */
+    uint32          size; /**< Size of the message in this slot */
+} OS_impl_queue_ring_slot_t;
+
+/* Alignment of each slot in a ring buffer queue */
+#define OS_QUEUE_RING_SLOT_ALIGN sizeof(uint64)
+
+/* Longest single futex wait, a blocked reader acts on a cancel request within this time */
+#define OS_QUEUE_RING_CANCEL_CHECK_MSEC 100
+
+/****************************************************************************************
+                                   GLOBAL DATA
+ ***************************************************************************************/
 
 /* Tables where the OS object information is stored */
 OS_impl_queue_internal_record_t OS_impl_queue_table[OS_MAX_QUEUES];
 
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+
+/****************************************************************************************
+                                RING BUFFER QUEUE
+ ***************************************************************************************/
+
+/*
+ * The ring buffer is a bounded multi-producer queue in the style of D. Vyukov,
+ * where each slot carries a sequence number that says whether it is ready to
+ * be written or read at a given position.  Producers and consumers claim a
+ * position with a compare-exchange and then copy the message without holding
+ * any lock.
+ *
+ * The "count" member is reserved by a producer before claiming a slot, which
+ * enforces the exact queue depth even though the number of slots is rounded up
+ * to a power of two.
+ *
+ * A consumer which finds the queue empty sleeps on the "put_events" futex word,
+ * which every producer increments after publishing a message.  The futex wake
+ * system call is only made if a consumer is actually waiting.
+ *
+ * Consumers are counted in "num_waiters" while they block, so producers know
+ * whether a wake is needed.
+ *
+ * Every get and put call is counted in "ring_users" of the queue record for as
+ * long as it uses the ring.  The record itself is never freed.  On delete the
+ * OS_QUEUE_RING_CLOSING bit is added to the same word, so a call either entered
+ * before the delete and is waited for, or sees the bit and never touches the
+ * ring.  Blocked readers are woken and return an error, and the ring is freed
+ * once the last call leaves.
+ *
+ * A raw futex wait is not a cancellation point, and the system call is not
+ * async-cancel-safe, so a blocked reader waits in slices and checks for a
+ * cancel request between them.  A cleanup handler leaves the counts if the
+ * reader is cancelled.
+ */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingSlot
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the slot header for the given position
+ *
+ *-----------------------------------------------------------------*/
+static inline OS_impl_queue_ring_slot_t *OS_Posix_QueueRingSlot(OS_impl_queue_ring_t *ring, uint32 pos)
+{
+    return (OS_impl_queue_ring_slot_t *)(void *)&ring->slots[(pos & ring->slot_mask) * ring->slot_size];
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingCreate
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Allocates and initializes a ring buffer queue
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingCreate(OS_impl_queue_internal_record_t *impl, const OS_queue_internal_record_t *queue)
+{
+    OS_impl_queue_ring_t *ring;
+    uint32                num_slots;
+    uint32                i;
+
+    /* Round up to a power of two so positions can wrap around with a mask */
+    num_slots = 1;
+    while (num_slots < queue->max_depth)
+    {
+        num_slots <<= 1;
+    }
+
+    ring = malloc(sizeof(*ring));
+    if (ring == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->max_depth = queue->max_depth;
+    ring->slot_mask = num_slots - 1;
+    ring->slot_size = sizeof(OS_impl_queue_ring_slot_t) + queue->max_size;
+    ring->slot_size = (ring->slot_size + OS_QUEUE_RING_SLOT_ALIGN - 1) & ~(OS_QUEUE_RING_SLOT_ALIGN - 1);
+    ring->slots     = malloc(num_slots * ring->slot_size);
+    if (ring->slots == NULL)
+    {
+        free(ring);
+        return OS_ERROR;
+    }
+
+    for (i = 0; i < num_slots; ++i)
+    {
+        OS_Posix_QueueRingSlot(ring, i)->seq = i;
+    }
+
+    impl->ring       = ring;
+    impl->ring_users = 0;
+
+    return OS_SUCCESS;
+} /* end OS_Posix_QueueRingCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingEnter
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Starts a get or put call on the ring
+ *
+ *  Returns: The ring, or NULL if the queue is being deleted
+ *
+ *-----------------------------------------------------------------*/
+static OS_impl_queue_ring_t *OS_Posix_QueueRingEnter(OS_impl_queue_internal_record_t *impl)
+{
+    if ((OS_AtomicFetchAdd32(&impl->ring_users, 1) & OS_QUEUE_RING_CLOSING) != 0)
+    {
+        OS_AtomicFetchSub32(&impl->ring_users, 1);
+        return NULL;
+    }
+
+    return impl->ring;
+} /* end OS_Posix_QueueRingEnter */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingLeave
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Ends a get or put call on the ring, the ring must not be used after this
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingLeave(OS_impl_queue_internal_record_t *impl)
+{
+    /* The last call to leave a queue that is being deleted wakes the deleting task */
+    if (OS_AtomicFetchSub32(&impl->ring_users, 1) == (OS_QUEUE_RING_CLOSING | 1))
+    {
+        syscall(SYS_futex, &impl->ring_users, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+} /* end OS_Posix_QueueRingLeave */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingDelete
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Releases any blocked readers and frees a ring buffer queue
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingDelete(OS_impl_queue_internal_record_t *impl)
+{
+    OS_impl_queue_ring_t *ring = impl->ring;
+    uint32                users;
+
+    /*
+     * No call can start using the ring after the closing bit is set.  Then bump
+     * the event count, so a reader that sampled the count before this point does
+     * not sleep, and one that samples it after will see the bit.  Then wake all
+     * readers which are already asleep.
+     */
+    users = OS_AtomicFetchAdd32(&impl->ring_users, OS_QUEUE_RING_CLOSING) + OS_QUEUE_RING_CLOSING;
+    OS_AtomicFetchAdd32(&ring->put_events, 1);
+    syscall(SYS_futex, &ring->put_events, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+
+    /*
+     * Sleep (rather than spin, which could starve a lower priority task) until
+     * the last get or put call leaves, see OS_Posix_QueueRingLeave()
+     */
+    while (users != OS_QUEUE_RING_CLOSING)
+    {
+        syscall(SYS_futex, &impl->ring_users, FUTEX_WAIT_PRIVATE, users, NULL, NULL, 0);
+        users = OS_AtomicLoad32(&impl->ring_users);
+    }
+
+    /*
+     * The pointer is left in place with the closing bit set, so a late call on
+     * the deleted queue still takes the ring path and is rejected there.  Both
+     * are reset when the record is used for a new queue.
+     */
+    free(ring->slots);
+    free(ring);
+} /* end OS_Posix_QueueRingDelete */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingTryGet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads a message from the ring without blocking
+ *
+ *  Returns: OS_SUCCESS, OS_QUEUE_EMPTY, or OS_QUEUE_INVALID_SIZE
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingTryGet(OS_impl_queue_ring_t *ring, void *data, size_t size, size_t *size_copied)
+{
+    OS_impl_queue_ring_slot_t *slot;
+    uint32                     pos;
+    uint32                     seq;
+    int32                      return_code;
+
+    pos = OS_AtomicLoad32(&ring->get_pos);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        seq  = OS_AtomicLoad32(&slot->seq);
+
+        if (seq == pos + 1)
+        {
+            /* slot is readable, claim it */
+            if (OS_AtomicCompareExchange32(&ring->get_pos, &pos, pos + 1))
+            {
+                break;
+            }
+            /* another reader got it, pos is now updated to the current value */
+        }
+        else if ((int32)(seq - (pos + 1)) < 0)
+        {
+            /* slot not yet written, the queue is empty (or a writer is still copying) */
+            return OS_QUEUE_EMPTY;
+        }
+        else
+        {
+            /* another reader advanced past this slot */
+            pos = OS_AtomicLoad32(&ring->get_pos);
+        }
+    }
+
+    if (slot->size > size)
+    {
+        *size_copied = OSAL_SIZE_C(0);
+        return_code  = OS_QUEUE_INVALID_SIZE;
+    }
+    else
+    {
+        memcpy(data, slot + 1, slot->size);
+        *size_copied = OSAL_SIZE_C(slot->size);
+        return_code  = OS_SUCCESS;
+    }
+
+    /* release the slot for the writer one lap ahead */
+    OS_AtomicStore32(&slot->seq, pos + ring->slot_mask + 1);
+    OS_AtomicFetchSub32(&ring->count, 1);
+
+    return return_code;
+} /* end OS_Posix_QueueRingTryGet */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingWaitCleanup
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Cancellation cleanup handler for a reader blocked on the ring,
+ *           also run on normal exit from the wait
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_QueueRingWaitCleanup(void *arg)
+{
+    OS_impl_queue_internal_record_t *impl = arg;
+
+    OS_AtomicFetchSub32(&impl->ring->num_waiters, 1);
+    OS_Posix_QueueRingLeave(impl);
+} /* end OS_Posix_QueueRingWaitCleanup */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingGet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Reads a message from the ring, blocking on the futex as needed
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingGet(OS_impl_queue_internal_record_t *impl, void *data, size_t size,
+                                   size_t *size_copied, int32 timeout)
+{
+    OS_impl_queue_ring_t * ring;
+    int32                  return_code;
+    uint32                 events;
+    struct timespec        ts;
+    struct timespec        slice_ts;
+    const struct timespec *wait_ts;
+    bool                   is_final;
+    long                   result;
+    int                    wait_errno;
+
+    ring = OS_Posix_QueueRingEnter(impl);
+    if (ring == NULL)
+    {
+        *size_copied = OSAL_SIZE_C(0);
+        return OS_ERROR;
+    }
+
+    return_code = OS_Posix_QueueRingTryGet(ring, data, size, size_copied);
+
+    if (return_code != OS_QUEUE_EMPTY || timeout == OS_CHECK)
+    {
+        if (return_code == OS_QUEUE_EMPTY)
+        {
+            *size_copied = OSAL_SIZE_C(0);
+        }
+
+        OS_Posix_QueueRingLeave(impl);
+        return return_code;
+    }
+
+    if (timeout != OS_PEND)
+    {
+        OS_Posix_CompAbsDelayTime(timeout, &ts);
+    }
+
+    OS_AtomicFetchAdd32(&ring->num_waiters, 1);
+    pthread_cleanup_push(OS_Posix_QueueRingWaitCleanup, impl);
+
+    while (true)
+    {
+        /*
+         * Sample the event count before checking the queue again.  If a message is
+         * put after this point, the futex wait below will not sleep.
+         */
+        events      = OS_AtomicLoad32(&ring->put_events);
+        return_code = OS_Posix_QueueRingTryGet(ring, data, size, size_copied);
+        if (return_code != OS_QUEUE_EMPTY)
+        {
+            break;
+        }
+
+        /* The queue is being deleted, do not wait on it any longer */
+        if ((OS_AtomicLoad32(&impl->ring_users) & OS_QUEUE_RING_CLOSING) != 0)
+        {
+            *size_copied = OSAL_SIZE_C(0);
+            return_code  = OS_ERROR;
+            break;
+        }
+
+        /*
+         * Wait no longer than one slice, so that a cancel request from
+         * OS_TaskDelete() is acted on within a bounded time.
+         */
+        pthread_testcancel();
+        OS_Posix_CompAbsDelayTime(OS_QUEUE_RING_CANCEL_CHECK_MSEC, &slice_ts);
+        is_final = (timeout != OS_PEND &&
+                    (ts.tv_sec < slice_ts.tv_sec || (ts.tv_sec == slice_ts.tv_sec && ts.tv_nsec <= slice_ts.tv_nsec)));
+        wait_ts  = is_final ? &ts : &slice_ts;
+
+        result     = syscall(SYS_futex, &ring->put_events, FUTEX_WAIT_BITSET_PRIVATE | FUTEX_CLOCK_REALTIME, events,
+                         wait_ts, NULL, FUTEX_BITSET_MATCH_ANY);
+        wait_errno = errno;
+
+        if (result != 0 && wait_errno == ETIMEDOUT && is_final)
+        {
+            /* one last check, in case a message arrived just as the time expired */
+            return_code = OS_Posix_QueueRingTryGet(ring, data, size, size_copied);
+            if (return_code == OS_QUEUE_EMPTY)
+            {
+                *size_copied = OSAL_SIZE_C(0);
+                return_code  = OS_QUEUE_TIMEOUT;
+            }
+            break;
+        }
+        if (result != 0 && wait_errno != ETIMEDOUT && wait_errno != EAGAIN && wait_errno != EINTR)
+        {
+            OS_DEBUG("futex wait error. errno = %d (%s)\n", wait_errno, strerror(wait_errno));
+            *size_copied = OSAL_SIZE_C(0);
+            return_code  = OS_ERROR;
+            break;
+        }
+    }
+
+    /* Leaves num_waiters and ring_users, the ring must not be touched after this */
+    pthread_cleanup_pop(1);
+
+    return return_code;
+} /* end OS_Posix_QueueRingGet */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_QueueRingPut
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Writes a message into the ring, never blocks
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_Posix_QueueRingPut(OS_impl_queue_internal_record_t *impl, const void *data, size_t size)
+{
+    OS_impl_queue_ring_t *     ring;
+    OS_impl_queue_ring_slot_t *slot;
+    uint32                     pos;
+    uint32                     seq;
+
+    ring = OS_Posix_QueueRingEnter(impl);
+    if (ring == NULL)
+    {
+        return OS_ERROR;
+    }
+
+    /* reserve space first, so the depth limit is exact */
+    if (OS_AtomicFetchAdd32(&ring->count, 1) >= ring->max_depth)
+    {
+        OS_AtomicFetchSub32(&ring->count, 1);
+        OS_Posix_QueueRingLeave(impl);
+        return OS_QUEUE_FULL;
+    }
+
+    /*
+     * Because space was reserved, a slot will become writable as soon as any
+     * reader which is still copying out of it finishes, so this cannot spin
+     * for longer than one message copy.
+     */
+    pos = OS_AtomicLoad32(&ring->put_pos);
+    while (true)
+    {
+        slot = OS_Posix_QueueRingSlot(ring, pos);
+        seq  = OS_AtomicLoad32(&slot->seq);
+
+        if (seq == pos)
+        {
+            /* slot is writable, claim it */
+            if (OS_AtomicCompareExchange32(&ring->put_pos, &pos, pos + 1))
+            {
+                break;
+            }
+        }
+        else if ((int32)(seq - pos) > 0)
+        {
+            /* another writer advanced past this slot */
+            pos = OS_AtomicLoad32(&ring->put_pos);
+        }
+    }
+
+    memcpy(slot + 1, data, size);
+    slot->size = size;
+
+    /* publish the slot to readers */
+    OS_AtomicStore32(&slot->seq, pos + 1);
+
+    /* wake a blocked reader, if there is one */
+    OS_AtomicFetchAdd32(&ring->put_events, 1);
+    if (OS_AtomicLoad32(&ring->num_waiters) != 0)
+    {
+        syscall(SYS_futex, &ring->put_events, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+
+    OS_Posix_QueueRingLeave(impl);
+
+    return OS_SUCCESS;
+} /* end OS_Posix_QueueRingPut */
+
+#endif /* OS_POSIX_QUEUE_RING_SUPPORTED */
+
 /****************************************************************************************
                                 MESSAGE QUEUE API
  ***************************************************************************************/
@@ -93,6 +576,23 @@ int32 OS_QueueCreate_Impl(const OS_object_token_t *token, uint32 flags)
     impl  = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
     queue = OS_OBJECT_TABLE_GET(OS_queue_table, *token);
 
+    impl->ring = NULL;
+
+#ifdef OSAL_CONFIG_QUEUE_RING_DEFAULT
+    flags |= OS_QUEUE_FLAG_RING;
+#endif
+
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+    /*
+     * The ring buffer does not use any kernel resource, so it is not
+     * subject to the mqueue depth limit and is never truncated.
+     */
+    if ((flags & OS_QUEUE_FLAG_RING) != 0)
+    {
+        return OS_Posix_QueueRingCreate(impl, queue);
+    }
+#endif
+
     /* set queue attributes */
     memset(&queueAttr, 0, sizeof(queueAttr));
     queueAttr.mq_maxmsg  = queue->max_depth;
@@ -171,6 +671,14 @@ int32 OS_QueueDelete_Impl(const OS_object_token_t *token)
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+    if (impl->ring != NULL)
+    {
+        OS_Posix_QueueRingDelete(impl);
+        return OS_SUCCESS;
+    }
+#endif
+
     /* Try to delete and unlink the queue */
     if (mq_close(impl->id) != 0)
     {
@@ -202,6 +710,13 @@ int32 OS_QueueGet_Impl(const OS_object_token_t *token, void *data, size_t size,
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingGet(impl, data, size, size_copied, timeout);
+    }
+#endif
+
     /*
      ** Read the message queue for data
      */
@@ -301,6 +816,13 @@ int32 OS_QueuePut_Impl(const OS_object_token_t *token, const void *data, size_t
 
     impl = OS_OBJECT_TABLE_GET(OS_impl_queue_table, *token);
 
+#ifdef OS_POSIX_QUEUE_RING_SUPPORTED
+    if (impl->ring != NULL)
+    {
+        return OS_Posix_QueueRingPut(impl, data, size);
+    }
+#endif
+
     /*
      * NOTE - using a zero timeout here for the same reason that QueueGet does ---
      * checking the attributes and doing the actual send is non-atomic, and if
@@ -25,6 +25,14 @@
  *
  */
 
+/*
+ * pthread_attr_setaffinity_np() and the CPU_SET macros are GNU extensions,
+ * which are only declared if this is defined before any system header is included.
+ */
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
 /****************************************************************************************
                                     INCLUDE FILES
  ***************************************************************************************/
@@ -429,6 +437,30 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
     return OS_SUCCESS;
 } /* end OS_Posix_TaskAPI_Impl_Init */
 
+#ifdef OS_IMPL_TASK_AFFINITY
+/*----------------------------------------------------------------
+ *
+ * Function: OS_Posix_CpuMaskToSet
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Converts an OSAL processor mask into a cpu_set_t
+ *
+ *-----------------------------------------------------------------*/
+static void OS_Posix_CpuMaskToSet(osal_cpumask_t cpu_mask, cpu_set_t *cpuset)
+{
+    uint32 cpu;
+
+    CPU_ZERO(cpuset);
+    for (cpu = 0; cpu < (8 * sizeof(cpu_mask)); ++cpu)
+    {
+        if ((cpu_mask & (1UL << cpu)) != 0)
+        {
+            CPU_SET(cpu, cpuset);
+        }
+    }
+} /* end OS_Posix_CpuMaskToSet */
+#endif
+
 /*----------------------------------------------------------------
  *
  * Function: OS_Posix_InternalTaskCreate_Impl
@@ -436,12 +468,15 @@ int32 OS_Posix_TaskAPI_Impl_Init(void)
  *  Purpose: Local helper routine, not part of OSAL API.
  *
  *-----------------------------------------------------------------*/
-int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, size_t stacksz,
-                                       PthreadFuncPtr_t entry, void *entry_arg)
+int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority, osal_cpumask_t cpu_mask,
+                                       size_t stacksz, PthreadFuncPtr_t entry, void *entry_arg)
 {
     int                return_code = 0;
     pthread_attr_t     custom_attr;
     struct sched_param priority_holder;
+#ifdef OS_IMPL_TASK_AFFINITY
+    cpu_set_t cpuset;
+#endif
 
     /*
      ** Initialize the pthread_attr structure.
@@ -542,6 +577,25 @@ int32 OS_Posix_InternalTaskCreate_Impl(pthread_t *pthr, osal_priority_t priority
 
     } /* End if user is root */
 
+    /*
+    ** Restrict the thread to the requested processors, if any.
+    ** This is set in the attributes so the thread never runs elsewhere.
+    */
+    if (cpu_mask != OS_TASK_CPUMASK_ANY)
+    {
+#ifdef OS_IMPL_TASK_AFFINITY
+        OS_Posix_CpuMaskToSet(cpu_mask, &cpuset);
+        return_code = pthread_attr_setaffinity_np(&custom_attr, sizeof(cpuset), &cpuset);
+        if (return_code != 0)
+        {
+            OS_DEBUG("pthread_attr_setaffinity_np error in OS_TaskCreate: %s\n", strerror(return_code));
+            return (OS_ERROR);
+        }
+#else
+        OS_DEBUG("CPU affinity mask 0x%lx ignored, not supported on this system\n", (unsigned long)cpu_mask);
+#endif
+    }
+
     /*
      ** Create thread
      */
@@ -588,8 +642,8 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
     task = OS_OBJECT_TABLE_GET(OS_task_table, *token);
     impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
 
-    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->stack_size, OS_PthreadTaskEntry,
-                                                   arg.opaque_arg);
+    return_code = OS_Posix_InternalTaskCreate_Impl(&impl->id, task->priority, task->cpu_mask, task->stack_size,
+                                                   OS_PthreadTaskEntry, arg.opaque_arg);
 
     return return_code;
 } /* end OS_TaskCreate_Impl */
@@ -787,6 +841,47 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
     return OS_SUCCESS;
 } /* end OS_TaskSetPriority_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask)
+{
+#ifdef OS_IMPL_TASK_AFFINITY
+    int                             ret;
+    cpu_set_t                       cpuset;
+    OS_impl_task_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    if (cpu_mask == OS_TASK_CPUMASK_ANY)
+    {
+        /* No restriction - allow every processor the system has */
+        memset(&cpuset, 0xFF, sizeof(cpuset));
+    }
+    else
+    {
+        OS_Posix_CpuMaskToSet(cpu_mask, &cpuset);
+    }
+
+    ret = pthread_setaffinity_np(impl->id, sizeof(cpuset), &cpuset);
+    if (ret != 0)
+    {
+        OS_DEBUG("pthread_setaffinity_np: Task ID = %lu, mask = 0x%lx, err = %s\n",
+                 OS_ObjectIdToInteger(OS_ObjectIdFromToken(token)), (unsigned long)cpu_mask, strerror(ret));
+        return (OS_ERROR);
+    }
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+} /* end OS_TaskSetAffinity_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskRegister_Impl
@@ -0,0 +1,680 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     os-impl-timebase-timerfd.c
+ * \ingroup  posix
+ *
+ * This file contains the OSAL Timebase API for Linux, using timerfd.
+ *
+ * This is an alternative to the POSIX timer/RT signal implementation in
+ * os-impl-timebase.c.  Each simulated time base is driven by a timerfd on the
+ * CLOCK_MONOTONIC clock which is armed with absolute deadlines and read
+ * directly by the time base handler thread, so no signal numbers are consumed
+ * and there is no limit on the number of time bases other than OS_MAX_TIMEBASES.
+ *
+ * When OSAL_CONFIG_TIMEBASE_TICKLESS is enabled, the timerfd is only armed for
+ * the tick on which the next application callback is due, rather than for every
+ * tick.  Ticks with nothing to do are accounted for in bulk when the handler
+ * thread next wakes up, or when the time base is locked by another task (for
+ * instance to set a timer).
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+
+#include <sys/timerfd.h>
+
+#include "os-posix.h"
+#include "os-impl-timebase.h"
+#include "os-impl-tasks.h"
+
+#include "os-shared-timebase.h"
+#include "os-shared-idmap.h"
+#include "os-shared-common.h"
+
+/****************************************************************************************
+                                     DEFINES
+ ***************************************************************************************/
+
+/*
+ * The timerfd is always based on the MONOTONIC clock, as it will not get disrupted
+ * by setting the time like the REALTIME clock will.
+ */
+#define OS_TIMEBASE_TIMERFD_CLOCK CLOCK_MONOTONIC
+
+/****************************************************************************************
+                                     GLOBALS
+ ***************************************************************************************/
+
+OS_impl_timebase_internal_record_t OS_impl_timebase_table[OS_MAX_TIMEBASES];
+
+/****************************************************************************************
+                                INTERNAL FUNCTIONS
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseGetNsec
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the current time of the timerfd clock, in nanoseconds
+ *
+ *-----------------------------------------------------------------*/
+static int64 OS_TimeBaseGetNsec(void)
+{
+    struct timespec now;
+
+    clock_gettime(OS_TIMEBASE_TIMERFD_CLOCK, &now);
+
+    return ((int64)now.tv_sec * 1000000000) + now.tv_nsec;
+} /* end OS_TimeBaseGetNsec */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseArmAt
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Arms the timerfd for a single expiry at the given absolute time,
+ *           or disarms it if the time is zero.
+ *
+ *-----------------------------------------------------------------*/
+static int32 OS_TimeBaseArmAt(OS_impl_timebase_internal_record_t *local, int64 abs_nsec, uint32 interval_usec)
+{
+    struct itimerspec timeout;
+
+    memset(&timeout, 0, sizeof(timeout));
+    timeout.it_value.tv_sec     = abs_nsec / 1000000000;
+    timeout.it_value.tv_nsec    = abs_nsec % 1000000000;
+    timeout.it_interval.tv_sec  = interval_usec / 1000000;
+    timeout.it_interval.tv_nsec = (interval_usec % 1000000) * 1000;
+
+    if (timerfd_settime(local->timer_fd, TFD_TIMER_ABSTIME, &timeout, NULL) < 0)
+    {
+        OS_DEBUG("Error in timerfd_settime: %s\n", strerror(errno));
+        return OS_TIMER_ERR_INTERNAL;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_TimeBaseArmAt */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseTicklessActive
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if the time base is in steady-state tickless operation
+ *
+ *-----------------------------------------------------------------*/
+static inline bool OS_TimeBaseTicklessActive(const OS_impl_timebase_internal_record_t *local,
+                                             const OS_timebase_internal_record_t *     timebase)
+{
+    return (local->tickless && local->reset_flag == 0 && timebase->nominal_interval_time > 0);
+} /* end OS_TimeBaseTicklessActive */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseCatchUp
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           In tickless mode, accounts for any ticks that have passed
+ *           while the handler thread was sleeping.  Only the ticks before
+ *           the one the timerfd is armed for are counted here - those
+ *           have no callbacks due, so advancing the free run time is all
+ *           that would have been done for them.  The caller must hold the
+ *           handler mutex.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseCatchUp(OS_impl_timebase_internal_record_t *local, OS_timebase_internal_record_t *timebase)
+{
+    int64  interval_nsec;
+    int64  elapsed_nsec;
+    uint64 ticks;
+
+    if (!OS_TimeBaseTicklessActive(local, timebase) || local->skip_limit == 0)
+    {
+        return;
+    }
+
+    elapsed_nsec = OS_TimeBaseGetNsec() - local->next_tick_nsec;
+    if (elapsed_nsec < 0)
+    {
+        return;
+    }
+
+    interval_nsec = (int64)timebase->nominal_interval_time * 1000;
+    ticks         = 1 + (elapsed_nsec / interval_nsec);
+    if (ticks > local->skip_limit)
+    {
+        ticks = local->skip_limit;
+    }
+
+    /* The free running time wraps, so only the low bits of the product are relevant */
+    timebase->freerun_time += (uint32)(ticks * timebase->nominal_interval_time);
+    local->next_tick_nsec += (int64)ticks * interval_nsec;
+    local->skip_limit -= (uint32)ticks;
+} /* end OS_TimeBaseCatchUp */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseArmNext
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           In tickless mode, arms the timerfd for the first tick at which
+ *           a queued callback is due, or disarms it if nothing is queued.
+ *           The caller must hold the handler mutex.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseArmNext(OS_impl_timebase_internal_record_t *local, OS_timebase_internal_record_t *timebase)
+{
+    uint32 interval_time;
+    int32  wait_time;
+    uint32 ticks;
+
+    if (!OS_TimeBaseTicklessActive(local, timebase))
+    {
+        return;
+    }
+
+    interval_time = timebase->nominal_interval_time;
+
+    if (!OS_TimeBase_GetNextExpiry(timebase, &wait_time))
+    {
+        /* Nothing queued - sleep until a timer is set */
+        local->skip_limit = UINT32_MAX;
+        OS_TimeBaseArmAt(local, 0, 0);
+        return;
+    }
+
+    /*
+     * The free run time corresponds to the tick before next_tick_nsec, so
+     * a callback with a wait time of up to one interval is due on the next tick.
+     */
+    if (wait_time <= (int32)interval_time)
+    {
+        ticks = 1;
+    }
+    else
+    {
+        ticks = ((uint32)wait_time + interval_time - 1) / interval_time;
+    }
+
+    local->skip_limit = ticks - 1;
+    OS_TimeBaseArmAt(local, local->next_tick_nsec + ((int64)(ticks - 1) * interval_time * 1000), 0);
+} /* end OS_TimeBaseArmNext */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseLock_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseLock_Impl(const OS_object_token_t *token)
+{
+    OS_impl_timebase_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+
+    pthread_mutex_lock(&impl->handler_mutex);
+
+    /* Bring the free run time up to date before any callbacks are changed */
+    OS_TimeBaseCatchUp(impl, OS_OBJECT_TABLE_GET(OS_timebase_table, *token));
+} /* end OS_TimeBaseLock_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseUnlock_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBaseUnlock_Impl(const OS_object_token_t *token)
+{
+    OS_impl_timebase_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+
+    /* The callbacks may have changed, so rearm for the next one due */
+    OS_TimeBaseArmNext(impl, OS_OBJECT_TABLE_GET(OS_timebase_table, *token));
+
+    pthread_mutex_unlock(&impl->handler_mutex);
+} /* end OS_TimeBaseUnlock_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_TimerFdWaitImpl
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Waits for the timerfd to expire and returns the elapsed time
+ *
+ *-----------------------------------------------------------------*/
+static uint32 OS_TimeBase_TimerFdWaitImpl(osal_id_t obj_id)
+{
+    OS_object_token_t                   token;
+    OS_impl_timebase_internal_record_t *impl;
+    OS_timebase_internal_record_t *     timebase;
+    uint64                              expirations;
+    int64                               elapsed_nsec;
+    int64                               interval_nsec;
+    uint32                              ticks;
+    uint32                              interval_time;
+    ssize_t                             ret;
+
+    interval_time = 0;
+
+    if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMEBASE, obj_id, &token) == OS_SUCCESS)
+    {
+        impl     = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, token);
+
+        /*
+         * This blocks until the timerfd expires at least once, and is
+         * a cancellation point for when the time base is deleted.
+         */
+        ret = read(impl->timer_fd, &expirations, sizeof(expirations));
+
+        pthread_mutex_lock(&impl->handler_mutex);
+
+        if (ret != sizeof(expirations) || expirations == 0)
+        {
+            /*
+             * the read call failed or was interrupted.
+             * returning 0 will cause the process to repeat.
+             */
+            ticks = 0;
+        }
+        else if (!impl->tickless || timebase->nominal_interval_time == 0)
+        {
+            /* The timerfd is periodic, so every expiration is one tick */
+            ticks = (uint32)expirations;
+        }
+        else
+        {
+            /*
+             * In tickless mode the timerfd was armed for a single expiry, so get
+             * the number of ticks passed from the clock.  All but the last are
+             * accounted here, as none of them had any callbacks due.
+             */
+            interval_nsec = (int64)timebase->nominal_interval_time * 1000;
+            elapsed_nsec  = OS_TimeBaseGetNsec() - impl->next_tick_nsec;
+            if (elapsed_nsec < 0)
+            {
+                /* Woken before the tick, e.g. the time base was set again */
+                ticks = 0;
+            }
+            else
+            {
+                ticks = (uint32)(1 + (elapsed_nsec / interval_nsec));
+                impl->next_tick_nsec += (int64)ticks * interval_nsec;
+                timebase->freerun_time += (ticks - 1) * timebase->nominal_interval_time;
+                ticks = 1;
+            }
+
+            impl->skip_limit = 0;
+        }
+
+        if (ticks == 0)
+        {
+            interval_time = 0;
+        }
+        else if (impl->reset_flag == 0)
+        {
+            /*
+             * Normal steady-state behavior.
+             * interval_time reflects the configured interval time.
+             */
+            interval_time = ticks * timebase->nominal_interval_time;
+        }
+        else
+        {
+            /*
+             * Reset/First interval behavior.
+             * timer_set() was invoked since the previous interval occurred (if any).
+             * interval_time reflects the configured start time.
+             */
+            interval_time    = timebase->nominal_start_time + ((ticks - 1) * timebase->nominal_interval_time);
+            impl->reset_flag = 0;
+        }
+
+        pthread_mutex_unlock(&impl->handler_mutex);
+    }
+
+    return interval_time;
+} /* end OS_TimeBase_TimerFdWaitImpl */
+
+/****************************************************************************************
+                                INITIALIZATION FUNCTION
+ ***************************************************************************************/
+
+/******************************************************************************
+ *  Function:  OS_Posix_TimeBaseAPI_Impl_Init
+ *
+ *  Purpose:  Initialize the timer implementation layer
+ *
+ *  Arguments:
+ *
+ *  Return:
+ */
+int32 OS_Posix_TimeBaseAPI_Impl_Init(void)
+{
+    int                 status;
+    osal_index_t        idx;
+    pthread_mutexattr_t mutex_attr;
+    struct timespec     clock_resolution;
+    int32               return_code;
+
+    return_code = OS_SUCCESS;
+
+    do
+    {
+        /*
+        ** Mark all timers as available
+        */
+        memset(OS_impl_timebase_table, 0, sizeof(OS_impl_timebase_table));
+
+        /*
+        ** get the resolution of the selected clock
+        */
+        status = clock_getres(OS_TIMEBASE_TIMERFD_CLOCK, &clock_resolution);
+        if (status != 0)
+        {
+            OS_DEBUG("failed in clock_getres: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /*
+        ** The resolution MUST be in the sub-second range (see os-impl-timebase.c)
+        */
+        if (clock_resolution.tv_sec > 0)
+        {
+            return_code = OS_TIMER_ERR_INTERNAL;
+            break;
+        }
+
+        POSIX_GlobalVars.ClockAccuracyNsec = (uint32)(clock_resolution.tv_nsec);
+
+        /*
+        ** initialize the attribute with default values
+        */
+        status = pthread_mutexattr_init(&mutex_attr);
+        if (status != 0)
+        {
+            OS_DEBUG("Error: pthread_mutexattr_init failed: %s\n", strerror(status));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /*
+        ** Allow the mutex to use priority inheritance
+        */
+        status = pthread_mutexattr_setprotocol(&mutex_attr, PTHREAD_PRIO_INHERIT);
+        if (status != 0)
+        {
+            OS_DEBUG("Error: pthread_mutexattr_setprotocol failed: %s\n", strerror(status));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        for (idx = 0; idx < OS_MAX_TIMEBASES; ++idx)
+        {
+            OS_impl_timebase_table[idx].timer_fd = -1;
+
+            /*
+            ** create the timebase sync mutex
+            ** This gives a mechanism to synchronize updates to the timer chain with the
+            ** expiration of the timer and processing the chain.
+            */
+            status = pthread_mutex_init(&OS_impl_timebase_table[idx].handler_mutex, &mutex_attr);
+            if (status != 0)
+            {
+                OS_DEBUG("Error: Mutex could not be created: %s\n", strerror(status));
+                return_code = OS_ERROR;
+                break;
+            }
+        }
+
+        /*
+         * Pre-calculate the clock tick to microsecond conversion factor.
+         */
+        OS_SharedGlobalVars.TicksPerSecond = sysconf(_SC_CLK_TCK);
+        if (OS_SharedGlobalVars.TicksPerSecond <= 0)
+        {
+            OS_DEBUG("Error: Unable to determine OS ticks per second: %s\n", strerror(errno));
+            return_code = OS_ERROR;
+            break;
+        }
+
+        /*
+         * Calculate microseconds per tick
+         *  - If the ratio is not an integer, this will round to the nearest integer value
+         *  - This is used internally for reporting accuracy,
+         *  - TicksPerSecond values over 2M will return zero
+         */
+        OS_SharedGlobalVars.MicroSecPerTick =
+            (1000000 + (OS_SharedGlobalVars.TicksPerSecond / 2)) / OS_SharedGlobalVars.TicksPerSecond;
+    } while (0);
+
+    return (return_code);
+} /* end OS_Posix_TimeBaseAPI_Impl_Init */
+
+/****************************************************************************************
+                                   Time Base API
+ ***************************************************************************************/
+
+static void *OS_TimeBasePthreadEntry(void *arg)
+{
+    OS_VoidPtrValueWrapper_t local_arg;
+
+    local_arg.opaque_arg = arg;
+    OS_TimeBase_CallbackThread(local_arg.id);
+    return NULL;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseCreate_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBaseCreate_Impl(const OS_object_token_t *token)
+{
+    int32                               return_code;
+    OS_impl_timebase_internal_record_t *local;
+    OS_timebase_internal_record_t *     timebase;
+    OS_VoidPtrValueWrapper_t            arg;
+
+    local    = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+    timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
+
+    local->timer_fd       = -1;
+    local->tickless       = false;
+    local->reset_flag     = 0;
+    local->skip_limit     = 0;
+    local->next_tick_nsec = 0;
+
+    /*
+     * If an external sync function is used then there is nothing to do here -
+     * we simply call that function and it should synchronize to the time source.
+     *
+     * If no external sync function is provided then this will set up a timerfd
+     * to locally simulate the timer tick using the CPU clock.  This is done
+     * before the handler thread is spawned so the thread always sees a valid fd.
+     */
+    if (timebase->external_sync == NULL)
+    {
+        local->timer_fd = timerfd_create(OS_TIMEBASE_TIMERFD_CLOCK, TFD_CLOEXEC);
+        if (local->timer_fd < 0)
+        {
+            OS_DEBUG("Error in timerfd_create: %s\n", strerror(errno));
+            return OS_TIMER_ERR_UNAVAILABLE;
+        }
+
+#ifdef OSAL_CONFIG_TIMEBASE_TICKLESS
+        local->tickless = true;
+#endif
+
+        timebase->external_sync = OS_TimeBase_TimerFdWaitImpl;
+    }
+
+    /*
+     * Spawn a dedicated time base handler thread
+     *
+     * This alleviates the need to handle expiration in the context of a signal handler -
+     * The handler thread can call a BSP synchronized delay implementation as well as the
+     * application callback function.  It should run with elevated priority to reduce latency.
+     *
+     * Note the thread will not actually start running until this function exits and releases
+     * the global table lock.
+     */
+    arg.opaque_arg = NULL;
+    arg.id         = OS_ObjectIdFromToken(token);
+    return_code    = OS_Posix_InternalTaskCreate_Impl(&local->handler_thread, OSAL_PRIORITY_C(0),
+                                                   OSAL_CPUMASK_C(OS_TIMEBASE_CPUMASK), 0, OS_TimeBasePthreadEntry,
+                                                   arg.opaque_arg);
+    if (return_code != OS_SUCCESS && local->timer_fd >= 0)
+    {
+        close(local->timer_fd);
+        local->timer_fd = -1;
+    }
+
+    return return_code;
+} /* end OS_TimeBaseCreate_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseSet_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBaseSet_Impl(const OS_object_token_t *token, uint32 start_time, uint32 interval_time)
+{
+    OS_impl_timebase_internal_record_t *local;
+    OS_timebase_internal_record_t *     timebase;
+    int32                               return_code;
+    int64                               start_nsec;
+
+    local       = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+    timebase    = OS_OBJECT_TABLE_GET(OS_timebase_table, *token);
+    return_code = OS_SUCCESS;
+
+    /* There is only something to do here if we are generating a simulated tick */
+    if (local->timer_fd >= 0)
+    {
+        /*
+         * A zero start time disarms the timer, same as timer_settime().
+         *
+         * Otherwise the first expiry is always armed as an absolute time.  In
+         * tickless mode it is armed as a one-shot and later expiries are armed
+         * as needed, relative to this one so the tick phase does not drift.
+         */
+        if (start_time == 0)
+        {
+            start_nsec = 0;
+        }
+        else
+        {
+            start_nsec = OS_TimeBaseGetNsec() + ((int64)start_time * 1000);
+        }
+
+        if (local->tickless)
+        {
+            return_code = OS_TimeBaseArmAt(local, start_nsec, 0);
+        }
+        else
+        {
+            return_code = OS_TimeBaseArmAt(local, start_nsec, interval_time);
+        }
+
+        local->next_tick_nsec = start_nsec;
+        local->skip_limit     = 0;
+
+        if (return_code != OS_SUCCESS)
+        {
+            /* nothing else to do */
+        }
+        else if (interval_time > 0)
+        {
+            timebase->accuracy_usec = (uint32)((((interval_time % 1000000) * 1000) + 999) / 1000);
+        }
+        else
+        {
+            timebase->accuracy_usec = (uint32)((((start_time % 1000000) * 1000) + 999) / 1000);
+        }
+    }
+
+    local->reset_flag = (return_code == OS_SUCCESS);
+    return return_code;
+} /* end OS_TimeBaseSet_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseDelete_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBaseDelete_Impl(const OS_object_token_t *token)
+{
+    OS_impl_timebase_internal_record_t *local;
+
+    local = OS_OBJECT_TABLE_GET(OS_impl_timebase_table, *token);
+
+    pthread_cancel(local->handler_thread);
+
+    /*
+    ** Close the timer
+    */
+    if (local->timer_fd >= 0)
+    {
+        if (close(local->timer_fd) < 0)
+        {
+            OS_DEBUG("Error closing timerfd: %s\n", strerror(errno));
+            return (OS_TIMER_ERR_INTERNAL);
+        }
+
+        local->timer_fd = -1;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_TimeBaseDelete_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseGetInfo_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TimeBaseGetInfo_Impl(const OS_object_token_t *token, OS_timebase_prop_t *timer_prop)
+{
+    return OS_SUCCESS;
+
+} /* end OS_TimeBaseGetInfo_Impl */
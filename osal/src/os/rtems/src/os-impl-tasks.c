@@ -132,6 +132,15 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
         return OS_ERROR;
     }
 
+    /*
+    ** Apply the processor affinity before the task first runs.
+    ** This is advisory; on uniprocessor configurations the mask is ignored.
+    */
+    if (task->cpu_mask != OS_TASK_CPUMASK_ANY && OS_TaskSetAffinity_Impl(token, task->cpu_mask) != OS_SUCCESS)
+    {
+        OS_DEBUG("CPU affinity mask 0x%lx not applied to task\n", (unsigned long)task->cpu_mask);
+    }
+
     /* will place the task in 'ready for scheduling' state */
     status = rtems_task_start(impl->id,                        /*rtems task id*/
                               (rtems_task_entry)OS_RtemsEntry, /* task entry point */
@@ -264,6 +273,46 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
 
 } /* end OS_TaskSetPriority_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask)
+{
+#ifdef RTEMS_SMP
+    cpu_set_t                       cpuset;
+    uint32                          cpu;
+    rtems_status_code               status;
+    OS_impl_task_internal_record_t *impl;
+
+    impl = OS_OBJECT_TABLE_GET(OS_impl_task_table, *token);
+
+    CPU_ZERO(&cpuset);
+    for (cpu = 0; cpu < (8 * sizeof(cpu_mask)) && cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (cpu_mask == OS_TASK_CPUMASK_ANY || (cpu_mask & (1UL << cpu)) != 0)
+        {
+            CPU_SET(cpu, &cpuset);
+        }
+    }
+
+    status = rtems_task_set_affinity(impl->id, sizeof(cpuset), &cpuset);
+    if (status != RTEMS_SUCCESSFUL)
+    {
+        OS_DEBUG("Unhandled task_set_affinity error: %s\n", rtems_status_text(status));
+        return OS_ERROR;
+    }
+
+    return OS_SUCCESS;
+#else
+    return OS_ERR_NOT_IMPLEMENTED;
+#endif
+} /* end OS_TaskSetAffinity_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskMatch_Impl
@@ -130,6 +130,24 @@ int32 OS_FileOpen_Impl(const OS_object_token_t *token, const char *local_path, i
  ------------------------------------------------------------------*/
 int32 OS_ShellOutputToFile_Impl(const OS_object_token_t *token, const char *Cmd);
 
+/*----------------------------------------------------------------
+   Function: OS_FileMap_Impl
+
+    Purpose: Map the entire contents of an open file for reading
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, const void **addr, size_t *size);
+
+/*----------------------------------------------------------------
+   Function: OS_FileUnmap_Impl
+
+    Purpose: Release a mapping obtained from OS_FileMap_Impl
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const void *addr, size_t size);
+
 /****************************************************************************************
                              Filename-based Operations
   ***************************************************************************************/
@@ -58,7 +58,8 @@ typedef enum
     OS_MODULE_BASE       = OS_TIMECB_BASE + OS_MAX_TIMERS,
     OS_FILESYS_BASE      = OS_MODULE_BASE + OS_MAX_MODULES,
     OS_CONSOLE_BASE      = OS_FILESYS_BASE + OS_MAX_FILE_SYSTEMS,
-    OS_MAX_TOTAL_RECORDS = OS_CONSOLE_BASE + OS_MAX_CONSOLES
+    OS_POLLSET_BASE      = OS_CONSOLE_BASE + OS_MAX_CONSOLES,
+    OS_MAX_TOTAL_RECORDS = OS_POLLSET_BASE + OS_MAX_POLLSETS
 } OS_ObjectIndex_t;
 
 /*
@@ -155,6 +156,7 @@ extern OS_common_record_t *const OS_global_timecb_table;
 extern OS_common_record_t *const OS_global_module_table;
 extern OS_common_record_t *const OS_global_filesys_table;
 extern OS_common_record_t *const OS_global_console_table;
+extern OS_common_record_t *const OS_global_pollset_table;
 
 /****************************************************************************************
                                 ID MAPPING FUNCTIONS
@@ -441,6 +443,23 @@ int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, cons
  ------------------------------------------------------------------*/
 int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token);
 
+/*----------------------------------------------------------------
+   Function: OS_ObjectIdGetByIdFast
+
+    Purpose: Validate an ID and obtain a token for it, without any locking.
+             This is equivalent to OS_ObjectIdGetById() with OS_LOCK_MODE_NONE,
+             but only performs a single atomic read of the record ID.  The
+             serial number within the ID serves as the generation check, so
+             an ID of a deleted object does not match a re-used record.
+
+             Intended for frequently-called operations on existing objects,
+             such as queue put/get and semaphore give/take.  Create and delete
+             must continue to use OS_ObjectIdGetById().
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_ObjectIdGetByIdFast(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token);
+
 /*----------------------------------------------------------------
    Function: OS_ObjectIdRelease
 
@@ -564,9 +583,14 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
  * These are not normally called outside this unit, but need
  * to be exposed for unit testing.
  */
-bool  OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
-bool  OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
-int32 OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
-int32 OS_ObjectIdFindNextFree(OS_object_token_t *token);
+bool   OS_ObjectFilterActive(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+bool   OS_ObjectNameMatch(void *ref, const OS_object_token_t *token, const OS_common_record_t *obj);
+int32  OS_ObjectIdFindNextMatch(OS_ObjectMatchFunc_t MatchFunc, void *arg, OS_object_token_t *token);
+int32  OS_ObjectIdFindNextFree(OS_object_token_t *token);
+uint32 OS_ObjectIdNameHash(const char *name);
+bool   OS_ObjectIdNameIndexSupported(osal_objtype_t idtype);
+void   OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+void   OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+int32  OS_ObjectIdNameIndexFind(const char *name, OS_object_token_t *token);
 
 #endif /* OS_SHARED_IDMAP_H */
@@ -0,0 +1,120 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ * \ingroup  shared
+ *
+ */
+
+#ifndef OS_SHARED_POLLSET_H
+#define OS_SHARED_POLLSET_H
+
+#include "osapi-pollset.h"
+#include "os-shared-globaldefs.h"
+
+/*
+ * Poll set membership is kept here, indexed by the stream table index, so that
+ * results can be reported by ID and so that implementations without a
+ * persistent kernel interest set can rebuild one on each wait.
+ *
+ * member_flags is zero for streams which are not in the set.
+ */
+typedef struct
+{
+    char      obj_name[OS_MAX_API_NAME];
+    uint8     member_flags[OS_MAX_NUM_OPEN_FILES];
+    osal_id_t member_id[OS_MAX_NUM_OPEN_FILES];
+} OS_pollset_internal_record_t;
+
+/*
+ * These record types have extra information with each entry.  These tables are used
+ * to share extra data between the common layer and the OS-specific implementation.
+ */
+extern OS_pollset_internal_record_t OS_pollset_table[OS_MAX_POLLSETS];
+
+/****************************************************************************************
+                                IMPLEMENTATION FUNCTIONS
+  ***************************************************************************************/
+
+/*---------------------------------------------------------------------------------------
+   Name: OS_PollSetAPI_Init
+
+   Purpose: Initialize the OS-independent layer for poll sets
+
+   returns: OS_SUCCESS on success, or relevant error code
+---------------------------------------------------------------------------------------*/
+int32 OS_PollSetAPI_Init(void);
+
+/*----------------------------------------------------------------
+   Function: OS_PollSetCreate_Impl
+
+    Purpose: Prepare/allocate OS resources for a poll set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+   Function: OS_PollSetDelete_Impl
+
+    Purpose: Free the OS resources associated with a poll set
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token);
+
+/*----------------------------------------------------------------
+   Function: OS_PollSetAdd_Impl
+
+    Purpose: Add a stream to the poll set, or change the states it is watched for.
+             The membership record in OS_pollset_table is updated by the caller
+             after this returns successfully.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+             OS_ERR_OPERATION_NOT_SUPPORTED if the stream cannot be polled
+ ------------------------------------------------------------------*/
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags);
+
+/*----------------------------------------------------------------
+   Function: OS_PollSetRemove_Impl
+
+    Purpose: Remove the stream at the given stream table index from the poll set.
+             The stream itself may already have been closed.
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, osal_index_t stream_idx);
+
+/*----------------------------------------------------------------
+   Function: OS_PollSetWait_Impl
+
+    Purpose: Wait for members of the poll set to become ready.
+             msecs indicates the timeout.  Positive values will wait up to that many milliseconds.
+             Zero will not wait (poll) or negative values will wait forever (pend)
+
+    Returns: Number of entries filled in the events array,
+             OS_ERROR_TIMEOUT if nothing became ready, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *events, uint32 max_events,
+                          int32 msecs);
+
+#endif /* OS_SHARED_POLLSET_H */
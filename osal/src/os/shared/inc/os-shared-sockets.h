@@ -119,6 +119,28 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
 int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, size_t buflen,
                            const OS_SockAddr_t *RemoteAddr);
 
+/*----------------------------------------------------------------
+   Function: OS_SocketRecvFromMulti_Impl
+
+    Purpose: Receives up to "count" datagrams from the specified socket (must be of the DATAGRAM type)
+             into the buffers described by "msgs", storing the length and remote address of each
+             Will wait up to "timeout" milliseconds for the first packet
+             (zero to poll, negative to wait forever), but not for any further packets
+
+    Returns: Number of datagrams received, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count, int32 timeout);
+
+/*----------------------------------------------------------------
+   Function: OS_SocketSendToMulti_Impl
+
+    Purpose: Sends the "count" datagrams described by "msgs" from the specified socket
+             (must be of the DATAGRAM type), each to its own remote address
+
+    Returns: Number of datagrams sent, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count);
+
 /*----------------------------------------------------------------
 
    Function: OS_SocketGetInfo_Impl
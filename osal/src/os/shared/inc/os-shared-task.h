@@ -37,6 +37,7 @@ typedef struct
     char            task_name[OS_MAX_API_NAME];
     size_t          stack_size;
     osal_priority_t priority;
+    osal_cpumask_t  cpu_mask;
     osal_task_entry entry_function_pointer;
     osal_task_entry delete_hook_pointer;
     void *          entry_arg;
@@ -141,6 +142,15 @@ int32 OS_TaskDelay_Impl(uint32 millisecond);
  ------------------------------------------------------------------*/
 int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t new_priority);
 
+/*----------------------------------------------------------------
+   Function: OS_TaskSetAffinity_Impl
+
+    Purpose: Restrict the specified task to the given set of processors
+
+    Returns: OS_SUCCESS on success, or relevant error code
+ ------------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask);
+
 /*----------------------------------------------------------------
    Function: OS_TaskGetId_Impl
 
@@ -47,6 +47,8 @@ typedef struct
     int32             interval_time;
     OS_ArgCallback_t  callback_ptr;
     void *            callback_arg;
+    uint32            deadline;  /**< timebase freerun_time of the next expiry, valid when queued */
+    uint32            queue_pos; /**< 1-based position in the timebase expiry queue, 0 if not queued */
 } OS_timecb_internal_record_t;
 
 /*
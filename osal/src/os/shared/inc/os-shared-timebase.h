@@ -40,6 +40,14 @@ typedef struct
     uint32         freerun_time;
     uint32         nominal_start_time;
     uint32         nominal_interval_time;
+
+    /*
+     * Armed callbacks, as a binary min-heap ordered by deadline, so that
+     * each tick only needs to visit the callbacks that have expired.
+     * Entries are indices into OS_timecb_table.
+     */
+    uint32       queue_depth;
+    osal_index_t expiry_queue[OS_MAX_TIMERS];
 } OS_timebase_internal_record_t;
 
 /*
@@ -131,6 +139,35 @@ int32 OS_TimeBaseGetInfo_Impl(const OS_object_token_t *token, OS_timebase_prop_t
  ------------------------------------------------------------------*/
 void OS_TimeBase_CallbackThread(osal_id_t timebase_id);
 
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_QueueCallback
+
+    Purpose: Queues a timer callback for expiry per its current wait_time
+             and interval_time, or updates its position if already queued.
+             A callback that can never expire again is removed instead.
+             The caller must hold the timebase lock.
+ ------------------------------------------------------------------*/
+void OS_TimeBase_QueueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx);
+
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_DequeueCallback
+
+    Purpose: Removes a timer callback from the expiry queue, if queued.
+             The caller must hold the timebase lock.
+ ------------------------------------------------------------------*/
+void OS_TimeBase_DequeueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx);
+
+/*----------------------------------------------------------------
+   Function: OS_TimeBase_GetNextExpiry
+
+    Purpose: Gets the time remaining, in timebase units, until the first
+             queued callback expires.  Zero or negative means it is due now.
+             The caller must hold the timebase lock.
+
+    Returns: true if any callback is queued, false if the queue is empty
+ ------------------------------------------------------------------*/
+bool OS_TimeBase_GetNextExpiry(const OS_timebase_internal_record_t *timebase, int32 *wait_time);
+
 /*----------------------------------------------------------------
    Function: OS_Milli2Ticks
 
@@ -164,7 +164,7 @@ int32 OS_BinSemGive(osal_id_t sem_id)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_BinSemGive_Impl(&token);
@@ -211,7 +211,7 @@ int32 OS_BinSemTake(osal_id_t sem_id)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_BinSemTake_Impl(&token);
@@ -234,7 +234,7 @@ int32 OS_BinSemTimedWait(osal_id_t sem_id, uint32 msecs)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_BinSemTimedWait_Impl(&token, msecs);
@@ -156,7 +156,7 @@ int32 OS_CountSemGive(osal_id_t sem_id)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_CountSemGive_Impl(&token);
@@ -180,7 +180,7 @@ int32 OS_CountSemTake(osal_id_t sem_id)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_CountSemTake_Impl(&token);
@@ -203,7 +203,7 @@ int32 OS_CountSemTimedWait(osal_id_t sem_id, uint32 msecs)
     int32             return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         return_code = OS_CountSemTimedWait_Impl(&token, msecs);
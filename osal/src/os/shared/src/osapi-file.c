@@ -266,6 +266,50 @@ int32 OS_write(osal_id_t filedes, const void *buffer, size_t nbytes)
     return OS_TimedWrite(filedes, buffer, nbytes, OS_PEND);
 } /* end OS_write */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap(osal_id_t filedes, const void **addr, size_t *size)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+    OS_CHECK_POINTER(size);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, filedes, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_FileMap_Impl(&token, addr, size);
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_FileMap */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap(const void *addr, size_t size)
+{
+    /* Check Parameters */
+    OS_CHECK_POINTER(addr);
+    OS_CHECK_SIZE(size);
+
+    return OS_FileUnmap_Impl(addr, size);
+} /* end OS_FileUnmap */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_chmod
@@ -51,6 +51,7 @@
 #include "os-shared-common.h"
 #include "os-shared-idmap.h"
 #include "os-shared-task.h"
+#include "osapi-atomic.h"
 
 /*
  * A fixed nonzero value to put into the upper 8 bits
@@ -92,6 +93,29 @@ typedef struct
 
 OS_objtype_state_t OS_objtype_state[OS_OBJECT_TYPE_USER];
 
+/*
+ * Name index, used to look up objects by name without scanning the table.
+ *
+ * Each object type has its own set of hash buckets, which uses the same
+ * offset and count as the records of that type in OS_common_table.  All
+ * values are stored as (table index + 1) so that zero means empty and the
+ * whole structure can be cleared with memset().
+ */
+typedef struct
+{
+    /* First record in each bucket */
+    uint32 bucket_head[OS_MAX_TOTAL_RECORDS];
+
+    /* Next record in the same bucket, per record */
+    uint32 next[OS_MAX_TOTAL_RECORDS];
+
+    /* Bucket that the record is currently linked into, per record */
+    uint32 bucket[OS_MAX_TOTAL_RECORDS];
+
+} OS_name_index_t;
+
+static OS_name_index_t OS_name_index;
+
 OS_common_record_t *const OS_global_task_table      = &OS_common_table[OS_TASK_BASE];
 OS_common_record_t *const OS_global_queue_table     = &OS_common_table[OS_QUEUE_BASE];
 OS_common_record_t *const OS_global_bin_sem_table   = &OS_common_table[OS_BINSEM_BASE];
@@ -104,6 +128,7 @@ OS_common_record_t *const OS_global_timecb_table    = &OS_common_table[OS_TIMECB
 OS_common_record_t *const OS_global_module_table    = &OS_common_table[OS_MODULE_BASE];
 OS_common_record_t *const OS_global_filesys_table   = &OS_common_table[OS_FILESYS_BASE];
 OS_common_record_t *const OS_global_console_table   = &OS_common_table[OS_CONSOLE_BASE];
+OS_common_record_t *const OS_global_pollset_table   = &OS_common_table[OS_POLLSET_BASE];
 
 /*
  *********************************************************************************
@@ -123,6 +148,7 @@ int32 OS_ObjectIdInit(void)
 {
     memset(OS_common_table, 0, sizeof(OS_common_table));
     memset(OS_objtype_state, 0, sizeof(OS_objtype_state));
+    memset(&OS_name_index, 0, sizeof(OS_name_index));
     return OS_SUCCESS;
 } /* end OS_ObjectIdInit */
 
@@ -161,6 +187,8 @@ uint32 OS_GetMaxForObjectType(osal_objtype_t idtype)
             return OS_MAX_FILE_SYSTEMS;
         case OS_OBJECT_TYPE_OS_CONSOLE:
             return OS_MAX_CONSOLES;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            return OS_MAX_POLLSETS;
         default:
             return 0;
     }
@@ -201,6 +229,8 @@ uint32 OS_GetBaseForObjectType(osal_objtype_t idtype)
             return OS_FILESYS_BASE;
         case OS_OBJECT_TYPE_OS_CONSOLE:
             return OS_CONSOLE_BASE;
+        case OS_OBJECT_TYPE_OS_POLLSET:
+            return OS_POLLSET_BASE;
         default:
             return 0;
     }
@@ -678,6 +708,180 @@ int32 OS_ObjectIdFindNextFree(OS_object_token_t *token)
     return return_code;
 } /* end OS_ObjectIdFindNextFree */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdNameHash
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Computes the hash value of an object name (FNV-1a)
+ *
+ *-----------------------------------------------------------------*/
+uint32 OS_ObjectIdNameHash(const char *name)
+{
+    uint32 hash;
+    uint32 i;
+
+    hash = 2166136261U;
+    for (i = 0; i < OS_MAX_API_NAME && name[i] != 0; ++i)
+    {
+        hash ^= (uint8)name[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+} /* end OS_ObjectIdNameHash */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdNameIndexSupported
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Checks if name lookups of the given type can use the name index.
+ *
+ *           Streams and directories are excluded, as these are allocated
+ *           without a name and socket names can change after creation.
+ *           Lookups of these types use a linear search of the table.
+ *
+ *  returns: true if the name index can be used, false otherwise
+ *
+ *-----------------------------------------------------------------*/
+bool OS_ObjectIdNameIndexSupported(osal_objtype_t idtype)
+{
+    return (idtype != OS_OBJECT_TYPE_OS_STREAM && idtype != OS_OBJECT_TYPE_OS_DIR &&
+            OS_GetMaxForObjectType(idtype) != 0);
+} /* end OS_ObjectIdNameIndexSupported */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdNameIndexRemove
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Removes the record referred to by the token from the name index,
+ *           if it is currently linked in.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           The global table lock must be held by the calling function.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+    uint32  rec_idx;
+    uint32 *link;
+
+    rec_idx = OS_GetBaseForObjectType(token->obj_type) + token->obj_idx;
+    if (rec_idx >= OS_MAX_TOTAL_RECORDS || OS_name_index.bucket[rec_idx] == 0)
+    {
+        /* not indexed, nothing to do */
+        return;
+    }
+
+    link = &OS_name_index.bucket_head[OS_name_index.bucket[rec_idx] - 1];
+    while (*link != 0 && *link != (rec_idx + 1))
+    {
+        link = &OS_name_index.next[*link - 1];
+    }
+
+    if (*link != 0)
+    {
+        *link = OS_name_index.next[rec_idx];
+    }
+
+    OS_name_index.next[rec_idx]   = 0;
+    OS_name_index.bucket[rec_idx] = 0;
+} /* end OS_ObjectIdNameIndexRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdNameIndexInsert
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Links the record referred to by the token into the name index,
+ *           under the given name.  If the record was already linked in, it
+ *           is removed first.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           The global table lock must be held by the calling function.
+ *
+ *-----------------------------------------------------------------*/
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+    uint32 base_idx;
+    uint32 max_idx;
+    uint32 rec_idx;
+    uint32 bucket_idx;
+
+    base_idx = OS_GetBaseForObjectType(token->obj_type);
+    max_idx  = OS_GetMaxForObjectType(token->obj_type);
+    rec_idx  = base_idx + token->obj_idx;
+
+    if (token->obj_idx >= max_idx)
+    {
+        /* not a valid record of this type */
+        return;
+    }
+
+    OS_ObjectIdNameIndexRemove(token);
+
+    bucket_idx = base_idx + (OS_ObjectIdNameHash(name) % max_idx);
+
+    OS_name_index.next[rec_idx]           = OS_name_index.bucket_head[bucket_idx];
+    OS_name_index.bucket_head[bucket_idx] = rec_idx + 1;
+    OS_name_index.bucket[rec_idx]         = bucket_idx + 1;
+} /* end OS_ObjectIdNameIndexInsert */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdNameIndexFind
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Locate an existing object of the token type with a matching name,
+ *           using the name index.  This has the same outputs as
+ *           OS_ObjectIdFindNextMatch() with OS_ObjectNameMatch(), but only
+ *           examines the records in the bucket for the name.
+ *
+ *           This is an internal function and no table locking is performed here.
+ *           Locking must be done by the calling function.
+ *
+ *  returns: OS_ERR_NAME_NOT_FOUND if not found, OS_SUCCESS if match is found
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdNameIndexFind(const char *name, OS_object_token_t *token)
+{
+    int32               return_code;
+    uint32              base_idx;
+    uint32              max_idx;
+    uint32              entry;
+    OS_common_record_t *record;
+
+    return_code   = OS_ERR_NAME_NOT_FOUND;
+    base_idx      = OS_GetBaseForObjectType(token->obj_type);
+    max_idx       = OS_GetMaxForObjectType(token->obj_type);
+    token->obj_id = OS_OBJECT_ID_UNDEFINED;
+
+    if (max_idx == 0)
+    {
+        return return_code;
+    }
+
+    entry = OS_name_index.bucket_head[base_idx + (OS_ObjectIdNameHash(name) % max_idx)];
+    while (entry != 0)
+    {
+        record = &OS_common_table[entry - 1];
+
+        if (OS_ObjectIdDefined(record->active_id) && OS_ObjectNameMatch((void *)name, token, record))
+        {
+            return_code    = OS_SUCCESS;
+            token->obj_idx = OSAL_INDEX_C(entry - 1 - base_idx);
+            token->obj_id  = record->active_id;
+            break;
+        }
+
+        entry = OS_name_index.next[entry - 1];
+    }
+
+    return return_code;
+} /* end OS_ObjectIdNameIndexFind */
+
 /*
  *********************************************************************************
  *          OSAL INTERNAL FUNCTIONS
@@ -982,7 +1186,27 @@ int32 OS_ObjectIdGetBySearch(OS_lock_mode_t lock_mode, osal_objtype_t idtype, OS
  *-----------------------------------------------------------------*/
 int32 OS_ObjectIdGetByName(OS_lock_mode_t lock_mode, osal_objtype_t idtype, const char *name, OS_object_token_t *token)
 {
-    return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    int32 return_code;
+
+    if (!OS_ObjectIdNameIndexSupported(idtype))
+    {
+        return OS_ObjectIdGetBySearch(lock_mode, idtype, OS_ObjectNameMatch, (void *)name, token);
+    }
+
+    OS_ObjectIdTransactionInit(lock_mode, idtype, token);
+
+    return_code = OS_ObjectIdNameIndexFind(name, token);
+
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdConvertToken(token);
+    }
+    else
+    {
+        OS_ObjectIdTransactionCancel(token);
+    }
+
+    return return_code;
 
 } /* end OS_ObjectIdGetByName */
 
@@ -1072,6 +1296,60 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
     return return_code;
 } /* end OS_ObjectIdGetById */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_ObjectIdGetByIdFast
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Validates the given ID and fills the token, without locking.
+ *
+ *           The result is the same as OS_ObjectIdGetById() using
+ *           OS_LOCK_MODE_NONE, but the token is built directly from the ID
+ *           and the record is only checked with a single atomic read of
+ *           active_id.  This is the validation used by the hot calls such as
+ *           OS_QueuePut(), which are made on objects in steady state.
+ *
+ *           If OSAL is not in the normal running state this defers to
+ *           OS_ObjectIdGetById() so the same error codes are returned.
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_ObjectIdGetByIdFast(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+    uint32              max_id;
+    OS_common_record_t *record;
+
+    if (OS_SharedGlobalVars.GlobalState != OS_INIT_MAGIC_NUMBER)
+    {
+        return OS_ObjectIdGetById(OS_LOCK_MODE_NONE, idtype, id, token);
+    }
+
+    max_id = OS_GetMaxForObjectType(idtype);
+    if (max_id == 0 || OS_ObjectIdToType_Impl(id) != idtype)
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    token->lock_mode = OS_LOCK_MODE_NONE;
+    token->lock_key  = OS_LOCK_KEY_INVALID;
+    token->obj_type  = idtype;
+    token->obj_idx   = OSAL_INDEX_C(OS_ObjectIdToSerialNumber_Impl(id) % max_id);
+    token->obj_id    = id;
+
+    /*
+     * The ID includes the serial number, so this also rejects an old ID
+     * if the record has been deleted and re-used for a different object.
+     * Pairs with the release store in OS_ObjectIdTransactionFinish() so the
+     * record contents are visible once the ID is.
+     */
+    record = &OS_common_table[OS_GetBaseForObjectType(idtype) + token->obj_idx];
+    if (!OS_ObjectIdEqual(OS_AtomicLoad32(&record->active_id), id))
+    {
+        return OS_ERR_INVALID_ID;
+    }
+
+    return OS_SUCCESS;
+} /* end OS_ObjectIdGetByIdFast */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_ObjectIdTransactionFinish
@@ -1119,7 +1397,22 @@ void OS_ObjectIdTransactionFinish(OS_object_token_t *token, const osal_id_t *fin
      */
     if (final_id != NULL)
     {
-        record->active_id = *final_id;
+        OS_AtomicStore32(&record->active_id, *final_id);
+
+        /*
+         * Keep the name index consistent with the record: a deleted record or
+         * a failed create is removed, and a successfully created record is
+         * added if it was allocated without a name and named afterwards.
+         */
+        if (!OS_ObjectIdDefined(*final_id))
+        {
+            OS_ObjectIdNameIndexRemove(token);
+        }
+        else if (record->name_entry != NULL && OS_ObjectIdNameIndexSupported(token->obj_type) &&
+                 OS_name_index.bucket[OS_GetBaseForObjectType(token->obj_type) + token->obj_idx] == 0)
+        {
+            OS_ObjectIdNameIndexInsert(token, record->name_entry);
+        }
     }
     else if (token->lock_mode == OS_LOCK_MODE_EXCLUSIVE)
     {
@@ -1212,13 +1505,17 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
      * Check if an object of the same name already exists.
      * If so, a new object cannot be allocated.
      */
-    if (name != NULL)
+    if (name == NULL)
     {
-        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
+        return_code = OS_ERR_NAME_NOT_FOUND;
+    }
+    else if (OS_ObjectIdNameIndexSupported(idtype))
+    {
+        return_code = OS_ObjectIdNameIndexFind(name, token);
     }
     else
     {
-        return_code = OS_ERR_NAME_NOT_FOUND;
+        return_code = OS_ObjectIdFindNextMatch(OS_ObjectNameMatch, (void *)name, token);
     }
 
     if (return_code == OS_SUCCESS)
@@ -1230,6 +1527,16 @@ int32 OS_ObjectIdAllocateNew(osal_objtype_t idtype, const char *name, OS_object_
         return_code = OS_ObjectIdFindNextFree(token);
     }
 
+    /*
+     * Index the new record under its name now, while the global table
+     * is still locked, so a concurrent create of the same name will
+     * see it as taken.
+     */
+    if (return_code == OS_SUCCESS && name != NULL && OS_ObjectIdNameIndexSupported(idtype))
+    {
+        OS_ObjectIdNameIndexInsert(token, name);
+    }
+
     /* If allocation failed, abort the operation now - no ID was allocated.
      * After this point, if a future step fails, the allocated ID must be
      * released. */
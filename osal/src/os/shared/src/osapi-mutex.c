@@ -163,7 +163,7 @@ int32 OS_MutSemGive(osal_id_t sem_id)
     osal_id_t                   self_task;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         mutex = OS_OBJECT_TABLE_GET(OS_mutex_table, token);
@@ -200,7 +200,7 @@ int32 OS_MutSemTake(osal_id_t sem_id)
     int32                       return_code;
 
     /* Check Parameters */
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, sem_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, sem_id, &token);
     if (return_code == OS_SUCCESS)
     {
         mutex = OS_OBJECT_TABLE_GET(OS_mutex_table, token);
@@ -0,0 +1,285 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     osapi-pollset.c
+ * \ingroup  shared
+ *
+ *         This file  contains some of the OS APIs abstraction layer code
+ *         that is shared/common across all OS-specific implementations.
+ */
+
+/****************************************************************************************
+                                    INCLUDE FILES
+ ***************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * User defined include files
+ */
+#include "os-shared-idmap.h"
+#include "os-shared-pollset.h"
+#include "os-shared-select.h"
+
+/*
+ * Sanity checks on the user-supplied configuration
+ * The relevant OS_MAX limit should be defined and greater than zero
+ */
+#if !defined(OS_MAX_POLLSETS) || (OS_MAX_POLLSETS <= 0)
+#error "osconfig.h must define OS_MAX_POLLSETS to a valid value"
+#endif
+
+/*
+ * Global data for the API
+ */
+enum
+{
+    LOCAL_NUM_OBJECTS = OS_MAX_POLLSETS,
+    LOCAL_OBJID_TYPE  = OS_OBJECT_TYPE_OS_POLLSET
+};
+
+OS_pollset_internal_record_t OS_pollset_table[LOCAL_NUM_OBJECTS];
+
+/****************************************************************************************
+                                  POLL SET API
+ ***************************************************************************************/
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAPI_Init
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Init function for OS-independent layer
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAPI_Init(void)
+{
+    memset(OS_pollset_table, 0, sizeof(OS_pollset_table));
+    return OS_SUCCESS;
+} /* end OS_PollSetAPI_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetCreate
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name)
+{
+    int32                         return_code;
+    OS_object_token_t             token;
+    OS_pollset_internal_record_t *pollset;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pollset_id);
+    OS_CHECK_APINAME(pollset_name);
+
+    /* Note - the common ObjectIdAllocate routine will lock the object type and leave it locked. */
+    return_code = OS_ObjectIdAllocateNew(LOCAL_OBJID_TYPE, pollset_name, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, token);
+
+        /* Reset the table entry and save the name */
+        OS_OBJECT_INIT(token, pollset, obj_name, pollset_name);
+
+        /* Now call the OS-specific implementation.  This reads info from the table. */
+        return_code = OS_PollSetCreate_Impl(&token);
+
+        /* Check result, finalize record, and unlock global table. */
+        return_code = OS_ObjectIdFinalizeNew(return_code, &token, pollset_id);
+    }
+
+    return return_code;
+} /* end OS_PollSetCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetDelete
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetDelete(osal_id_t pollset_id)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_EXCLUSIVE, LOCAL_OBJID_TYPE, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetDelete_Impl(&token);
+
+        /* Complete the operation via the common routine */
+        return_code = OS_ObjectIdFinalizeDelete(return_code, &token);
+    }
+
+    return return_code;
+} /* end OS_PollSetDelete */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetAdd
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags)
+{
+    OS_object_token_t             token;
+    OS_object_token_t             stream_token;
+    OS_pollset_internal_record_t *pollset;
+    osal_index_t                  stream_idx;
+    int32                         return_code;
+
+    /* Check parameters */
+    ARGCHECK(StateFlags != 0 && (StateFlags & ~(OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE)) == 0,
+             OS_ERR_INVALID_ARGUMENT);
+
+    /* The stream is held by refcount so it cannot be closed while being added */
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, OS_OBJECT_TYPE_OS_STREAM, objid, &stream_token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, pollset_id, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, token);
+
+            return_code = OS_PollSetAdd_Impl(&token, &stream_token, StateFlags);
+            if (return_code == OS_SUCCESS)
+            {
+                stream_idx = OS_ObjectIndexFromToken(&stream_token);
+
+                pollset->member_id[stream_idx]    = objid;
+                pollset->member_flags[stream_idx] = StateFlags;
+            }
+
+            OS_ObjectIdRelease(&token);
+        }
+
+        OS_ObjectIdRelease(&stream_token);
+    }
+
+    return return_code;
+} /* end OS_PollSetAdd */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetRemove
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid)
+{
+    OS_object_token_t             token;
+    OS_pollset_internal_record_t *pollset;
+    osal_index_t                  stream_idx;
+    int32                         return_code;
+
+    /*
+     * The stream is not looked up here, as it may have been
+     * closed already.  Membership is checked against the ID.
+     */
+    return_code = OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_STREAM, objid, &stream_idx);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, pollset_id, &token);
+        if (return_code == OS_SUCCESS)
+        {
+            pollset = OS_OBJECT_TABLE_GET(OS_pollset_table, token);
+
+            if (pollset->member_flags[stream_idx] == 0 || !OS_ObjectIdEqual(pollset->member_id[stream_idx], objid))
+            {
+                return_code = OS_ERR_INVALID_ID;
+            }
+            else
+            {
+                return_code = OS_PollSetRemove_Impl(&token, stream_idx);
+            }
+
+            if (return_code == OS_SUCCESS)
+            {
+                pollset->member_id[stream_idx]    = OS_OBJECT_ID_UNDEFINED;
+                pollset->member_flags[stream_idx] = 0;
+            }
+
+            OS_ObjectIdRelease(&token);
+        }
+    }
+
+    return return_code;
+} /* end OS_PollSetRemove */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetWait
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *events, uint32 max_events, int32 msecs)
+{
+    OS_object_token_t token;
+    int32             return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(events);
+    OS_CHECK_SIZE(max_events);
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, pollset_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        return_code = OS_PollSetWait_Impl(&token, events, max_events, msecs);
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_PollSetWait */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_PollSetGetIdByName
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name)
+{
+    int32 return_code;
+
+    /* Check parameters */
+    OS_CHECK_POINTER(pollset_id);
+    OS_CHECK_POINTER(pollset_name);
+
+    return_code = OS_ObjectIdFindByName(LOCAL_OBJID_TYPE, pollset_name, pollset_id);
+
+    return return_code;
+} /* end OS_PollSetGetIdByName */
@@ -168,7 +168,7 @@ int32 OS_QueueGet(osal_id_t queue_id, void *data, size_t size, size_t *size_copi
     OS_CHECK_POINTER(size_copied);
     OS_CHECK_SIZE(size);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
@@ -208,7 +208,7 @@ int32 OS_QueuePut(osal_id_t queue_id, const void *data, size_t size, uint32 flag
     OS_CHECK_POINTER(data);
     OS_CHECK_SIZE(size);
 
-    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_NONE, LOCAL_OBJID_TYPE, queue_id, &token);
+    return_code = OS_ObjectIdGetByIdFast(LOCAL_OBJID_TYPE, queue_id, &token);
     if (return_code == OS_SUCCESS)
     {
         queue = OS_OBJECT_TABLE_GET(OS_queue_table, token);
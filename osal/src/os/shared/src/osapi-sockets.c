@@ -485,6 +485,104 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return return_code;
 } /* end OS_SocketSendTo */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketRecvFromMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+    uint32                       i;
+
+    /*
+     * Check parameters
+     *
+     * Note "RemoteAddr" is not checked, because in certain configurations it can be validly null.
+     */
+    OS_CHECK_POINTER(msgs);
+    OS_CHECK_SIZE(count);
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_POINTER(msgs[i].Buffer);
+        OS_CHECK_SIZE(msgs[i].BufLen);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else if ((stream->stream_state & OS_STREAM_STATE_BOUND) == 0)
+        {
+            /* Socket needs to be bound first */
+            return_code = OS_ERR_INCORRECT_OBJ_STATE;
+        }
+        else
+        {
+            return_code = OS_SocketRecvFromMulti_Impl(&token, msgs, count, timeout);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketRecvFromMulti */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_SocketSendToMulti
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count)
+{
+    OS_stream_internal_record_t *stream;
+    OS_object_token_t            token;
+    int32                        return_code;
+    uint32                       i;
+
+    /* Check Parameters */
+    OS_CHECK_POINTER(msgs);
+    OS_CHECK_SIZE(count);
+    for (i = 0; i < count; ++i)
+    {
+        OS_CHECK_POINTER(msgs[i].Buffer);
+        OS_CHECK_SIZE(msgs[i].BufLen);
+        OS_CHECK_POINTER(msgs[i].RemoteAddr);
+    }
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_REFCOUNT, LOCAL_OBJID_TYPE, sock_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        stream = OS_OBJECT_TABLE_GET(OS_stream_table, token);
+
+        if (stream->socket_type != OS_SocketType_DATAGRAM)
+        {
+            return_code = OS_ERR_INCORRECT_OBJ_TYPE;
+        }
+        else
+        {
+            return_code = OS_SocketSendToMulti_Impl(&token, msgs, count);
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_SocketSendToMulti */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_SocketGetIdByName
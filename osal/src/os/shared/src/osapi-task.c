@@ -173,6 +173,22 @@ int32 OS_TaskAPI_Init(void)
  *-----------------------------------------------------------------*/
 int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
                     osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority, uint32 flags)
+{
+    return OS_TaskCreateWithAffinity(task_id, task_name, function_pointer, stack_pointer, stack_size, priority, flags,
+                                     OS_TASK_CPUMASK_ANY);
+} /* end OS_TaskCreate */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskCreateWithAffinity
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskCreateWithAffinity(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
+                                osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority,
+                                uint32 flags, osal_cpumask_t cpu_mask)
 {
     int32                      return_code;
     OS_object_token_t          token;
@@ -199,6 +215,7 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
 
         task->stack_size             = stack_size;
         task->priority               = priority;
+        task->cpu_mask               = cpu_mask;
         task->entry_function_pointer = function_pointer;
         task->stack_pointer          = stack_pointer;
 
@@ -210,7 +227,7 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
     }
 
     return return_code;
-} /* end OS_TaskCreate */
+} /* end OS_TaskCreateWithAffinity */
 
 /*----------------------------------------------------------------
  *
@@ -329,6 +346,38 @@ int32 OS_TaskSetPriority(osal_id_t task_id, osal_priority_t new_priority)
     return return_code;
 } /* end OS_TaskSetPriority */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity
+ *
+ *  Purpose: Implemented per public OSAL API
+ *           See description in API and header file for detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity(osal_id_t task_id, osal_cpumask_t cpu_mask)
+{
+    int32                      return_code;
+    OS_object_token_t          token;
+    OS_task_internal_record_t *task;
+
+    return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, LOCAL_OBJID_TYPE, task_id, &token);
+    if (return_code == OS_SUCCESS)
+    {
+        task = OS_OBJECT_TABLE_GET(OS_task_table, token);
+
+        return_code = OS_TaskSetAffinity_Impl(&token, cpu_mask);
+
+        if (return_code == OS_SUCCESS)
+        {
+            task->cpu_mask = cpu_mask;
+        }
+
+        OS_ObjectIdRelease(&token);
+    }
+
+    return return_code;
+} /* end OS_TaskSetAffinity */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskGetId
@@ -402,6 +451,7 @@ int32 OS_TaskGetInfo(osal_id_t task_id, OS_task_prop_t *task_prop)
         task_prop->creator    = record->creator;
         task_prop->stack_size = task->stack_size;
         task_prop->priority   = task->priority;
+        task_prop->cpu_mask   = task->cpu_mask;
 
         return_code = OS_TaskGetInfo_Impl(&token, task_prop);
 
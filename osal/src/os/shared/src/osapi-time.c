@@ -305,8 +305,9 @@ int32 OS_TimerCreate(osal_id_t *timer_id, const char *timer_name, uint32 *accura
  *-----------------------------------------------------------------*/
 int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
 {
-    OS_timecb_internal_record_t *timecb;
-    int32                        return_code;
+    OS_timecb_internal_record_t *  timecb;
+    OS_timebase_internal_record_t *timebase;
+    int32                          return_code;
     osal_objtype_t               objtype;
     osal_id_t                    dedicated_timebase_id;
     OS_object_token_t            token;
@@ -330,7 +331,8 @@ int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
     return_code = OS_ObjectIdGetById(OS_LOCK_MODE_GLOBAL, OS_OBJECT_TYPE_OS_TIMECB, timer_id, &token);
     if (return_code == OS_SUCCESS)
     {
-        timecb = OS_OBJECT_TABLE_GET(OS_timecb_table, token);
+        timecb   = OS_OBJECT_TABLE_GET(OS_timecb_table, token);
+        timebase = OS_OBJECT_TABLE_GET(OS_timebase_table, timecb->timebase_token);
 
         OS_TimeBaseLock_Impl(&timecb->timebase_token);
 
@@ -342,6 +344,8 @@ int32 OS_TimerSet(osal_id_t timer_id, uint32 start_time, uint32 interval_time)
         timecb->wait_time     = (int32)start_time;
         timecb->interval_time = (int32)interval_time;
 
+        OS_TimeBase_QueueCallback(timebase, OS_ObjectIndexFromToken(&token));
+
         OS_TimeBaseUnlock_Impl(&timecb->timebase_token);
 
         OS_ObjectIdRelease(&token);
@@ -419,8 +423,10 @@ int32 OS_TimerDelete(osal_id_t timer_id)
         }
 
         /*
-         * Now we need to remove it from the time base callback ring
+         * Now we need to remove it from the expiry queue and the time base callback ring
          */
+        OS_TimeBase_DequeueCallback(timebase, OS_ObjectIndexFromToken(&timecb_token));
+
         if (OS_ObjectIdEqual(timebase->first_cb, OS_ObjectIdFromToken(&timecb_token)))
         {
             if (OS_ObjectIdEqual(OS_ObjectIdFromToken(&timecb_token), timecb->next_cb))
@@ -361,6 +361,183 @@ int32 OS_TimeBaseGetFreeRun(osal_id_t timebase_id, uint32 *freerun_val)
     return return_code;
 } /* end OS_TimeBaseGetFreeRun */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseQueueKey
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Gets the time remaining until a queued callback expires.
+ *
+ *           Deadlines are kept in terms of the free running time so they
+ *           wrap with it; comparing relative to the current time keeps the
+ *           ordering correct across the wrap.
+ *
+ *-----------------------------------------------------------------*/
+static inline int32 OS_TimeBaseQueueKey(const OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    return (int32)(OS_timecb_table[timecb_idx].deadline - timebase->freerun_time);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseQueuePlace
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Stores a callback at a position in the expiry queue
+ *
+ *-----------------------------------------------------------------*/
+static inline void OS_TimeBaseQueuePlace(OS_timebase_internal_record_t *timebase, uint32 pos, osal_index_t timecb_idx)
+{
+    timebase->expiry_queue[pos]          = timecb_idx;
+    OS_timecb_table[timecb_idx].queue_pos = pos + 1;
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBaseQueueSift
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           Restores the heap order after the entry at "pos" was placed or
+ *           had its deadline changed, by moving it toward the root or
+ *           toward the leaves as needed.
+ *
+ *-----------------------------------------------------------------*/
+static void OS_TimeBaseQueueSift(OS_timebase_internal_record_t *timebase, uint32 pos)
+{
+    osal_index_t timecb_idx;
+    int32        key;
+    uint32       parent;
+    uint32       child;
+
+    timecb_idx = timebase->expiry_queue[pos];
+    key        = OS_TimeBaseQueueKey(timebase, timecb_idx);
+
+    while (pos > 0)
+    {
+        parent = (pos - 1) / 2;
+        if (OS_TimeBaseQueueKey(timebase, timebase->expiry_queue[parent]) <= key)
+        {
+            break;
+        }
+        OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[parent]);
+        pos = parent;
+    }
+
+    while (1)
+    {
+        child = (2 * pos) + 1;
+        if (child >= timebase->queue_depth)
+        {
+            break;
+        }
+        if ((child + 1) < timebase->queue_depth &&
+            OS_TimeBaseQueueKey(timebase, timebase->expiry_queue[child + 1]) <
+                OS_TimeBaseQueueKey(timebase, timebase->expiry_queue[child]))
+        {
+            ++child;
+        }
+        if (key <= OS_TimeBaseQueueKey(timebase, timebase->expiry_queue[child]))
+        {
+            break;
+        }
+        OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[child]);
+        pos = child;
+    }
+
+    OS_TimeBaseQueuePlace(timebase, pos, timecb_idx);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_QueueCallback
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_QueueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    OS_timecb_internal_record_t *timecb;
+    uint32                       pos;
+
+    timecb = &OS_timecb_table[timecb_idx];
+
+    /*
+     * A callback with no remaining wait time and no interval will never be
+     * called again (see OS_TimeBase_CallbackThread), so it is not queued.
+     */
+    if (timecb->wait_time <= 0 && timecb->interval_time <= 0)
+    {
+        OS_TimeBase_DequeueCallback(timebase, timecb_idx);
+        return;
+    }
+
+    timecb->deadline = timebase->freerun_time + (uint32)timecb->wait_time;
+
+    if (timecb->queue_pos == 0)
+    {
+        pos = timebase->queue_depth;
+        ++timebase->queue_depth;
+        OS_TimeBaseQueuePlace(timebase, pos, timecb_idx);
+    }
+    else
+    {
+        pos = timecb->queue_pos - 1;
+    }
+
+    OS_TimeBaseQueueSift(timebase, pos);
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_DequeueCallback
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+void OS_TimeBase_DequeueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    OS_timecb_internal_record_t *timecb;
+    uint32                       pos;
+
+    timecb = &OS_timecb_table[timecb_idx];
+    if (timecb->queue_pos == 0)
+    {
+        return;
+    }
+
+    pos               = timecb->queue_pos - 1;
+    timecb->queue_pos = 0;
+
+    --timebase->queue_depth;
+    if (pos < timebase->queue_depth)
+    {
+        /* Move the last entry into the vacated position */
+        OS_TimeBaseQueuePlace(timebase, pos, timebase->expiry_queue[timebase->queue_depth]);
+        OS_TimeBaseQueueSift(timebase, pos);
+    }
+}
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TimeBase_GetNextExpiry
+ *
+ *  Purpose: Local helper routine, not part of OSAL API.
+ *           See description in header file for detail
+ *
+ *-----------------------------------------------------------------*/
+bool OS_TimeBase_GetNextExpiry(const OS_timebase_internal_record_t *timebase, int32 *wait_time)
+{
+    if (timebase->queue_depth == 0)
+    {
+        return false;
+    }
+
+    *wait_time = OS_TimeBaseQueueKey(timebase, timebase->expiry_queue[0]);
+    return true;
+}
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TimeBase_CallbackThread
@@ -387,7 +564,8 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
     OS_timecb_internal_record_t *  timecb;
     OS_common_record_t *           record;
     OS_object_token_t              token;
-    OS_object_token_t              cb_token;
+    osal_index_t                   cb_idx;
+    osal_id_t                      cb_id;
     uint32                         tick_time;
     uint32                         spin_cycles;
     int32                          saved_wait_time;
@@ -476,51 +654,64 @@ void OS_TimeBase_CallbackThread(osal_id_t timebase_id)
         }
 
         timebase->freerun_time += tick_time;
-        if (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timebase->first_cb, &cb_token) == 0)
+
+        /*
+         * Only the callbacks at the head of the expiry queue are due; the
+         * rest of the queue is not visited.  The processing of each expired
+         * callback is the same as if its wait_time had been decremented by
+         * the tick time on every tick.
+         */
+        while (timebase->queue_depth > 0)
         {
-            do
+            cb_idx = timebase->expiry_queue[0];
+            timecb = &OS_timecb_table[cb_idx];
+
+            timecb->wait_time = OS_TimeBaseQueueKey(timebase, cb_idx);
+            if (timecb->wait_time > 0)
             {
-                timecb          = OS_OBJECT_TABLE_GET(OS_timecb_table, cb_token);
-                saved_wait_time = timecb->wait_time;
-                timecb->wait_time -= tick_time;
-                while (timecb->wait_time <= 0)
+                break;
+            }
+
+            saved_wait_time = (int32)(timecb->deadline - (timebase->freerun_time - tick_time));
+            cb_id           = OS_global_timecb_table[cb_idx].active_id;
+
+            while (timecb->wait_time <= 0)
+            {
+                timecb->wait_time += timecb->interval_time;
+
+                /*
+                 * Only allow the "wait_time" underflow to go as far negative as one interval time
+                 * This prevents a cb "interval_time" of less than the timebase interval_time from
+                 * accumulating infinitely
+                 */
+                if (timecb->wait_time < -timecb->interval_time)
                 {
-                    timecb->wait_time += timecb->interval_time;
-
-                    /*
-                     * Only allow the "wait_time" underflow to go as far negative as one interval time
-                     * This prevents a cb "interval_time" of less than the timebase interval_time from
-                     * accumulating infinitely
-                     */
-                    if (timecb->wait_time < -timecb->interval_time)
-                    {
-                        ++timecb->backlog_resets;
-                        timecb->wait_time = -timecb->interval_time;
-                    }
-
-                    /*
-                     * Only give the callback if the wait_time actually transitioned from positive to negative.
-                     * This allows one-shot operation where the API sets the "wait_time" positive but keeps
-                     * the "interval_time" at zero.  With the interval_time at zero the wait time will never
-                     * go positive again unless the API sets it again.
-                     */
-                    if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
-                    {
-                        (*timecb->callback_ptr)(OS_ObjectIdFromToken(&cb_token), timecb->callback_arg);
-                    }
-
-                    /*
-                     * Do not repeat the loop unless interval_time is configured.
-                     */
-                    if (timecb->interval_time <= 0)
-                    {
-                        break;
-                    }
+                    ++timecb->backlog_resets;
+                    timecb->wait_time = -timecb->interval_time;
                 }
 
-            } while (OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, timecb->next_cb, &cb_token) ==
-                         OS_SUCCESS &&
-                     !OS_ObjectIdEqual(OS_ObjectIdFromToken(&cb_token), timebase->first_cb));
+                /*
+                 * Only give the callback if the wait_time actually transitioned from positive to negative.
+                 * This allows one-shot operation where the API sets the "wait_time" positive but keeps
+                 * the "interval_time" at zero.  With the interval_time at zero the wait time will never
+                 * go positive again unless the API sets it again.
+                 */
+                if (saved_wait_time > 0 && timecb->callback_ptr != NULL)
+                {
+                    (*timecb->callback_ptr)(cb_id, timecb->callback_arg);
+                }
+
+                /*
+                 * Do not repeat the loop unless interval_time is configured.
+                 */
+                if (timecb->interval_time <= 0)
+                {
+                    break;
+                }
+            }
+
+            /* Requeue per the new wait time, or remove if this was a one-shot */
+            OS_TimeBase_QueueCallback(timebase, cb_idx);
         }
 
         OS_TimeBaseUnlock_Impl(&token);
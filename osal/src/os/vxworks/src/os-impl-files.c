@@ -63,3 +63,31 @@ int32 OS_VxWorks_StreamAPI_Impl_Init(void)
 
     return OS_SUCCESS;
 } /* end OS_VxWorks_StreamAPI_Impl_Init */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileMap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *  Memory mapped files are not supported on this OS, callers fall back to OS_read()
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileMap_Impl(const OS_object_token_t *token, const void **addr, size_t *size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileMap_Impl */
+
+/*----------------------------------------------------------------
+ *
+ * Function: OS_FileUnmap_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_FileUnmap_Impl(const void *addr, size_t size)
+{
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_FileUnmap_Impl */
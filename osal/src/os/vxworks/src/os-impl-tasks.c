@@ -251,6 +251,15 @@ int32 OS_TaskCreate_Impl(const OS_object_token_t *token, uint32 flags)
 
     lrec->vxid = (TASK_ID)&lrec->tcb;
 
+    /*
+     * Apply the processor affinity before the task first runs.
+     * This is advisory; if it is not supported the mask is ignored.
+     */
+    if (task->cpu_mask != OS_TASK_CPUMASK_ANY && OS_TaskSetAffinity_Impl(token, task->cpu_mask) != OS_SUCCESS)
+    {
+        OS_DEBUG("CPU affinity mask 0x%lx not applied to task\n", (unsigned long)task->cpu_mask);
+    }
+
     taskActivate(lrec->vxid);
 
     return OS_SUCCESS;
@@ -367,6 +376,23 @@ int32 OS_TaskSetPriority_Impl(const OS_object_token_t *token, osal_priority_t ne
 
 } /* end OS_TaskSetPriority_Impl */
 
+/*----------------------------------------------------------------
+ *
+ * Function: OS_TaskSetAffinity_Impl
+ *
+ *  Purpose: Implemented per internal OSAL API
+ *           See prototype for argument/return detail
+ *
+ *-----------------------------------------------------------------*/
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask)
+{
+    /*
+     * taskCpuAffinitySet() is only available in SMP kernel configurations,
+     * which are not supported by this implementation.
+     */
+    return OS_ERR_NOT_IMPLEMENTED;
+} /* end OS_TaskSetAffinity_Impl */
+
 /*----------------------------------------------------------------
  *
  * Function: OS_TaskMatch_Impl
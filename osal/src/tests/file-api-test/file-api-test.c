@@ -35,6 +35,7 @@ void TestCreatRemove(void);
 void TestOpenClose(void);
 void TestChmod(void);
 void TestReadWriteLseek(void);
+void TestFileMap(void);
 void TestMkRmDirFreeBytes(void);
 void TestOpenReadCloseDir(void);
 void TestRename(void);
@@ -81,6 +82,7 @@ void UtTest_Setup(void)
     UtTest_Add(TestOpenClose, NULL, NULL, "TestOpenClose");
     UtTest_Add(TestChmod, NULL, NULL, "TestChmod");
     UtTest_Add(TestReadWriteLseek, NULL, NULL, "TestReadWriteLseek");
+    UtTest_Add(TestFileMap, NULL, NULL, "TestFileMap");
     UtTest_Add(TestMkRmDirFreeBytes, NULL, NULL, "TestMkRmDirFreeBytes");
     UtTest_Add(TestOpenReadCloseDir, NULL, NULL, "TestOpenReadCloseDir");
     UtTest_Add(TestStat, NULL, NULL, "TestStat");
@@ -437,6 +439,44 @@ void TestReadWriteLseek(void)
 /*---------------------------------------------------------------------------------------
  *  Name TestMkRmDir()
 ---------------------------------------------------------------------------------------*/
+void TestFileMap(void)
+{
+    const char  buffer[] = "ValueToMapFromTheFile";
+    const void *addr;
+    size_t      size;
+    int32       status;
+    osal_id_t   fd;
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, "/drive0/MapFile", OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE),
+                      OS_SUCCESS);
+
+    /* an empty file has nothing to map */
+    status = OS_FileMap(fd, &addr, &size);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        UtAssert_NA("OS_FileMap not implemented");
+        UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+        return;
+    }
+    UtAssert_INT32_EQ(status, OS_ERROR);
+
+    UtAssert_INT32_EQ(OS_write(fd, buffer, sizeof(buffer)), sizeof(buffer));
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_OpenCreate(&fd, "/drive0/MapFile", OS_FILE_FLAG_NONE, OS_READ_ONLY), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_FileMap(fd, &addr, &size), OS_SUCCESS);
+    UtAssert_UINT32_EQ(size, sizeof(buffer));
+    UtAssert_True(memcmp(addr, buffer, sizeof(buffer)) == 0, "Mapped contents match written contents");
+    UtAssert_INT32_EQ(OS_FileUnmap(addr, size), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_close(fd), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_FileMap(OS_OBJECT_ID_UNDEFINED, &addr, &size), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_FileMap(fd, NULL, &size), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_FileUnmap(NULL, size), OS_INVALID_POINTER);
+
+    UtAssert_INT32_EQ(OS_remove("/drive0/MapFile"), OS_SUCCESS);
+}
+
 void TestMkRmDirFreeBytes(void)
 {
     int32        status;
@@ -0,0 +1,219 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Hot call speed test
+**
+** Measures the average time of the OSAL calls that applications make
+** most often on existing objects: queue put/get, mutex take/give, and
+** binary/counting semaphore give/take.  Each call is made from a single
+** task without contention, so the result is dominated by the ID
+** validation and the uncontended cost of the underlying OS primitive.
+**
+** Only the public API is used, so the same test can be built against an
+** older OSAL for comparison.  The results are informational only.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+#define HOTCALL_ITERATIONS 200000
+
+OS_time_t hot_call_start;
+uint32    hot_call_errors;
+
+void HotCallStart(void)
+{
+    hot_call_errors = 0;
+    OS_GetLocalTime(&hot_call_start);
+}
+
+/*
+ * Reports the average time per call, for the given number of calls per iteration
+ */
+void HotCallReport(const char *desc, uint32 calls_per_iteration)
+{
+    OS_time_t end_time;
+    int64     elapsed_ns;
+
+    OS_GetLocalTime(&end_time);
+
+    elapsed_ns = OS_TimeGetTotalNanoseconds(OS_TimeSubtract(end_time, hot_call_start));
+
+    UtAssert_True(hot_call_errors == 0, "%s errors = %u", desc, (unsigned int)hot_call_errors);
+    UtPrintf("%s: %lu ns/op", desc,
+             (unsigned long)(elapsed_ns / ((int64)HOTCALL_ITERATIONS * calls_per_iteration)));
+}
+
+void QueueHotCallTest(void)
+{
+    osal_id_t queue_id;
+    uint32    data;
+    uint32    i;
+    size_t    data_size;
+    int32     status;
+
+    /* The ring queue has no kernel calls when uncontended, so it shows the OSAL overhead most clearly */
+    status = OS_QueueCreate(&queue_id, "HotRingQ", OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(sizeof(data)), OS_QUEUE_FLAG_RING);
+    UtAssert_True(status == OS_SUCCESS, "HotRingQ create Rc=%d", (int)status);
+
+    HotCallStart();
+    for (i = 0; i < HOTCALL_ITERATIONS; ++i)
+    {
+        if (OS_QueuePut(queue_id, &i, sizeof(i), 0) != OS_SUCCESS ||
+            OS_QueueGet(queue_id, &data, sizeof(data), &data_size, OS_CHECK) != OS_SUCCESS || data != i)
+        {
+            ++hot_call_errors;
+        }
+    }
+    HotCallReport("OS_QueuePut/OS_QueueGet (ring)", 2);
+
+    status = OS_QueueDelete(queue_id);
+    UtAssert_True(status == OS_SUCCESS, "HotRingQ delete Rc=%d", (int)status);
+
+    /* OS message queue, may be unavailable or depth limited so informational only */
+    status = OS_QueueCreate(&queue_id, "HotQ", OSAL_BLOCKCOUNT_C(4), OSAL_SIZE_C(sizeof(data)), 0);
+    if (status != OS_SUCCESS)
+    {
+        UtPrintf("OS message queue not available, Rc=%d", (int)status);
+        return;
+    }
+
+    HotCallStart();
+    for (i = 0; i < HOTCALL_ITERATIONS; ++i)
+    {
+        if (OS_QueuePut(queue_id, &i, sizeof(i), 0) != OS_SUCCESS ||
+            OS_QueueGet(queue_id, &data, sizeof(data), &data_size, OS_CHECK) != OS_SUCCESS || data != i)
+        {
+            ++hot_call_errors;
+        }
+    }
+    HotCallReport("OS_QueuePut/OS_QueueGet", 2);
+
+    status = OS_QueueDelete(queue_id);
+    UtAssert_True(status == OS_SUCCESS, "HotQ delete Rc=%d", (int)status);
+}
+
+void SemHotCallTest(void)
+{
+    osal_id_t sem_id;
+    uint32    i;
+    int32     status;
+
+    status = OS_MutSemCreate(&sem_id, "HotMut", 0);
+    UtAssert_True(status == OS_SUCCESS, "HotMut create Rc=%d", (int)status);
+
+    HotCallStart();
+    for (i = 0; i < HOTCALL_ITERATIONS; ++i)
+    {
+        if (OS_MutSemTake(sem_id) != OS_SUCCESS || OS_MutSemGive(sem_id) != OS_SUCCESS)
+        {
+            ++hot_call_errors;
+        }
+    }
+    HotCallReport("OS_MutSemTake/OS_MutSemGive", 2);
+
+    status = OS_MutSemDelete(sem_id);
+    UtAssert_True(status == OS_SUCCESS, "HotMut delete Rc=%d", (int)status);
+
+    status = OS_BinSemCreate(&sem_id, "HotBin", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "HotBin create Rc=%d", (int)status);
+
+    HotCallStart();
+    for (i = 0; i < HOTCALL_ITERATIONS; ++i)
+    {
+        if (OS_BinSemGive(sem_id) != OS_SUCCESS || OS_BinSemTake(sem_id) != OS_SUCCESS)
+        {
+            ++hot_call_errors;
+        }
+    }
+    HotCallReport("OS_BinSemGive/OS_BinSemTake", 2);
+
+    status = OS_BinSemDelete(sem_id);
+    UtAssert_True(status == OS_SUCCESS, "HotBin delete Rc=%d", (int)status);
+
+    status = OS_CountSemCreate(&sem_id, "HotCount", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "HotCount create Rc=%d", (int)status);
+
+    HotCallStart();
+    for (i = 0; i < HOTCALL_ITERATIONS; ++i)
+    {
+        if (OS_CountSemGive(sem_id) != OS_SUCCESS || OS_CountSemTake(sem_id) != OS_SUCCESS)
+        {
+            ++hot_call_errors;
+        }
+    }
+    HotCallReport("OS_CountSemGive/OS_CountSemTake", 2);
+
+    status = OS_CountSemDelete(sem_id);
+    UtAssert_True(status == OS_SUCCESS, "HotCount delete Rc=%d", (int)status);
+}
+
+void StaleIdTest(void)
+{
+    osal_id_t old_id;
+    osal_id_t new_id;
+    int32     status;
+
+    /*
+     * An ID of a deleted object must be rejected, even after its
+     * table entry is re-used by a new object.
+     */
+    status = OS_BinSemCreate(&old_id, "HotStale", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "HotStale create Rc=%d", (int)status);
+    status = OS_BinSemDelete(old_id);
+    UtAssert_True(status == OS_SUCCESS, "HotStale delete Rc=%d", (int)status);
+
+    status = OS_BinSemGive(old_id);
+    UtAssert_True(status == OS_ERR_INVALID_ID, "OS_BinSemGive(deleted) Rc=%d", (int)status);
+
+    status = OS_BinSemCreate(&new_id, "HotStale", 0, 0);
+    UtAssert_True(status == OS_SUCCESS, "HotStale re-create Rc=%d", (int)status);
+
+    status = OS_BinSemGive(old_id);
+    UtAssert_True(status == OS_ERR_INVALID_ID, "OS_BinSemGive(stale) Rc=%d", (int)status);
+    status = OS_BinSemGive(new_id);
+    UtAssert_True(status == OS_SUCCESS, "OS_BinSemGive(new) Rc=%d", (int)status);
+
+    status = OS_BinSemDelete(new_id);
+    UtAssert_True(status == OS_SUCCESS, "HotStale delete Rc=%d", (int)status);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(QueueHotCallTest, NULL, NULL, "QueueHotCallTest");
+    UtTest_Add(SemHotCallTest, NULL, NULL, "SemHotCallTest");
+    UtTest_Add(StaleIdTest, NULL, NULL, "StaleIdTest");
+}
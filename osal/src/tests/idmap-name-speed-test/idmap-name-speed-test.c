@@ -0,0 +1,238 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Object name lookup speed test
+**
+** Simulates the startup of a large configuration by creating up to
+** 1000 named objects (queues, semaphores and mutexes, limited by the
+** configured table sizes), then looking every one of them up by name
+** as applications do when they connect to each other.  Every lookup
+** must return the ID that was issued at creation.
+**
+** The creation time and lookup rate are reported for comparison
+** purposes only.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+#define NAMETEST_MAX_OBJECTS   1000
+#define NAMETEST_LOOKUP_ROUNDS 20
+
+typedef struct
+{
+    osal_objtype_t type;
+    osal_id_t      id;
+    char           name[OS_MAX_API_NAME];
+} NameTestObject_t;
+
+NameTestObject_t name_test_objects[NAMETEST_MAX_OBJECTS];
+uint32           name_test_count;
+
+int64 NameTestElapsedUs(OS_time_t start_time)
+{
+    OS_time_t end_time;
+    int64     elapsed_us;
+
+    OS_GetLocalTime(&end_time);
+
+    elapsed_us = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    if (elapsed_us <= 0)
+    {
+        elapsed_us = 1;
+    }
+
+    return elapsed_us;
+}
+
+/*
+ * Creates objects of the given type until either the table is full
+ * or the overall object count is reached.
+ */
+void NameTestCreate(osal_objtype_t type, const char *prefix)
+{
+    NameTestObject_t *obj;
+    int32             status;
+
+    while (name_test_count < NAMETEST_MAX_OBJECTS)
+    {
+        obj       = &name_test_objects[name_test_count];
+        obj->type = type;
+        snprintf(obj->name, sizeof(obj->name), "%s%04u", prefix, (unsigned int)name_test_count);
+
+        switch (type)
+        {
+            case OS_OBJECT_TYPE_OS_QUEUE:
+                status = OS_QueueCreate(&obj->id, obj->name, OSAL_BLOCKCOUNT_C(1), OSAL_SIZE_C(4), 0);
+                break;
+            case OS_OBJECT_TYPE_OS_BINSEM:
+                status = OS_BinSemCreate(&obj->id, obj->name, 0, 0);
+                break;
+            case OS_OBJECT_TYPE_OS_COUNTSEM:
+                status = OS_CountSemCreate(&obj->id, obj->name, 0, 0);
+                break;
+            default:
+                status = OS_MutSemCreate(&obj->id, obj->name, 0);
+                break;
+        }
+
+        if (status != OS_SUCCESS)
+        {
+            /* No more of this type available, or not supported by the OS */
+            break;
+        }
+
+        ++name_test_count;
+    }
+}
+
+int32 NameTestLookup(const NameTestObject_t *obj, osal_id_t *id)
+{
+    int32 status;
+
+    switch (obj->type)
+    {
+        case OS_OBJECT_TYPE_OS_QUEUE:
+            status = OS_QueueGetIdByName(id, obj->name);
+            break;
+        case OS_OBJECT_TYPE_OS_BINSEM:
+            status = OS_BinSemGetIdByName(id, obj->name);
+            break;
+        case OS_OBJECT_TYPE_OS_COUNTSEM:
+            status = OS_CountSemGetIdByName(id, obj->name);
+            break;
+        default:
+            status = OS_MutSemGetIdByName(id, obj->name);
+            break;
+    }
+
+    return status;
+}
+
+void NameLookupSpeedTest(void)
+{
+    NameTestObject_t *obj;
+    OS_time_t         start_time;
+    int64             create_us;
+    int64             lookup_us;
+    int32             status;
+    uint32            errors;
+    uint32            round;
+    uint32            i;
+    osal_id_t         id;
+
+    name_test_count = 0;
+
+    OS_GetLocalTime(&start_time);
+    NameTestCreate(OS_OBJECT_TYPE_OS_QUEUE, "NameQ");
+    NameTestCreate(OS_OBJECT_TYPE_OS_BINSEM, "NameB");
+    NameTestCreate(OS_OBJECT_TYPE_OS_COUNTSEM, "NameC");
+    NameTestCreate(OS_OBJECT_TYPE_OS_MUTEX, "NameM");
+    create_us = NameTestElapsedUs(start_time);
+
+    UtAssert_True(name_test_count > 0, "Created %u objects", (unsigned int)name_test_count);
+
+    errors = 0;
+    OS_GetLocalTime(&start_time);
+    for (round = 0; round < NAMETEST_LOOKUP_ROUNDS; ++round)
+    {
+        for (i = 0; i < name_test_count; ++i)
+        {
+            obj    = &name_test_objects[i];
+            status = NameTestLookup(obj, &id);
+            if (status != OS_SUCCESS || !OS_ObjectIdEqual(id, obj->id))
+            {
+                ++errors;
+            }
+        }
+    }
+    lookup_us = NameTestElapsedUs(start_time);
+
+    UtAssert_True(errors == 0, "Lookup errors = %u", (unsigned int)errors);
+
+    /* A name that does not exist must still be reported as such */
+    status = OS_MutSemGetIdByName(&id, "NameNotFound");
+    UtAssert_True(status == OS_ERR_NAME_NOT_FOUND, "Lookup of missing name Rc=%d", (int)status);
+
+    UtPrintf("%u objects: create %lu us total, lookup %lu names/s", (unsigned int)name_test_count,
+             (unsigned long)create_us,
+             (unsigned long)(((int64)name_test_count * NAMETEST_LOOKUP_ROUNDS * 1000000) / lookup_us));
+
+    errors = 0;
+    for (i = 0; i < name_test_count; ++i)
+    {
+        obj = &name_test_objects[i];
+        switch (obj->type)
+        {
+            case OS_OBJECT_TYPE_OS_QUEUE:
+                status = OS_QueueDelete(obj->id);
+                break;
+            case OS_OBJECT_TYPE_OS_BINSEM:
+                status = OS_BinSemDelete(obj->id);
+                break;
+            case OS_OBJECT_TYPE_OS_COUNTSEM:
+                status = OS_CountSemDelete(obj->id);
+                break;
+            default:
+                status = OS_MutSemDelete(obj->id);
+                break;
+        }
+
+        if (status != OS_SUCCESS)
+        {
+            ++errors;
+        }
+    }
+
+    UtAssert_True(errors == 0, "Delete errors = %u", (unsigned int)errors);
+
+    /* After deletion none of the names may be found */
+    errors = 0;
+    for (i = 0; i < name_test_count; ++i)
+    {
+        if (NameTestLookup(&name_test_objects[i], &id) != OS_ERR_NAME_NOT_FOUND)
+        {
+            ++errors;
+        }
+    }
+
+    UtAssert_True(errors == 0, "Names found after delete = %u", (unsigned int)errors);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(NameLookupSpeedTest, NULL, NULL, "NameLookupSpeedTest");
+}
@@ -239,6 +239,12 @@ void TestDatagramNetworkApi(void)
     uint16           PortNum;
     OS_socket_prop_t prop;
     OS_SockAddr_t    l_addr;
+    OS_SockMsg_t     MultiMsgs[4];
+    uint32           MultiBuf1[3];
+    uint32           MultiBuf2[4];
+    uint32           i;
+    int32            count;
+    int32            actual;
 
     if (!networkImplemented)
     {
@@ -336,6 +342,64 @@ void TestDatagramNetworkApi(void)
     UtAssert_INT32_EQ(OS_SocketGetIdByName(&objid, "127.0.0.1:9999"), OS_SUCCESS);
     UtAssert_True(OS_ObjectIdEqual(objid, p1_socket_id), "objid (%lu) == p1_socket_id", OS_ObjectIdToInteger(objid));
 
+    /*
+     * Send a batch from peer1 to peer2 and verify
+     */
+    memset(MultiMsgs, 0, sizeof(MultiMsgs));
+    for (i = 0; i < 3; ++i)
+    {
+        MultiBuf1[i]              = 10 + i;
+        MultiMsgs[i].Buffer       = &MultiBuf1[i];
+        MultiMsgs[i].BufLen       = sizeof(MultiBuf1[i]);
+        MultiMsgs[i].RemoteAddr   = &p2_addr;
+        MultiMsgs[i].ActualLength = 0;
+    }
+
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, MultiMsgs, 0), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, NULL, 3), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(regular_file_id, MultiMsgs, 3), OS_ERR_INCORRECT_OBJ_TYPE);
+    UtAssert_INT32_EQ(OS_SocketSendToMulti(p1_socket_id, MultiMsgs, 3), 3);
+    UtAssert_UINT32_EQ(MultiMsgs[2].ActualLength, sizeof(MultiBuf1[2]));
+
+    for (i = 0; i < 4; ++i)
+    {
+        MultiBuf2[i]              = 0;
+        MultiMsgs[i].Buffer       = &MultiBuf2[i];
+        MultiMsgs[i].BufLen       = sizeof(MultiBuf2[i]);
+        MultiMsgs[i].RemoteAddr   = NULL;
+        MultiMsgs[i].ActualLength = 0;
+    }
+    MultiMsgs[0].RemoteAddr = &l_addr;
+
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, MultiMsgs, 0, UT_TIMEOUT), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, NULL, 4, UT_TIMEOUT), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(regular_file_id, MultiMsgs, 4, UT_TIMEOUT), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    /* Loopback delivery is immediate, but allow for the batch arriving in pieces */
+    count = 0;
+    while (count < 3)
+    {
+        actual = OS_SocketRecvFromMulti(p2_socket_id, &MultiMsgs[count], 4 - count, UT_TIMEOUT);
+        if (actual <= 0)
+        {
+            break;
+        }
+        count += actual;
+    }
+    UtAssert_INT32_EQ(count, 3);
+    UtAssert_INT32_EQ(MultiBuf2[0], 10);
+    UtAssert_INT32_EQ(MultiBuf2[1], 11);
+    UtAssert_INT32_EQ(MultiBuf2[2], 12);
+    UtAssert_UINT32_EQ(MultiMsgs[1].ActualLength, sizeof(MultiBuf2[1]));
+
+    /* Sender address is reported where requested */
+    UtAssert_INT32_EQ(OS_SocketAddrToString(AddrBuffer4, sizeof(AddrBuffer4), &l_addr), OS_SUCCESS);
+    UtAssert_True(strcmp(AddrBuffer1, AddrBuffer4) == 0, "AddrBuffer1 (%s) == AddrBuffer4 (%s)", AddrBuffer1,
+                  AddrBuffer4);
+
+    /* Nothing left queued */
+    UtAssert_INT32_EQ(OS_SocketRecvFromMulti(p2_socket_id, MultiMsgs, 4, OS_CHECK), OS_ERROR_TIMEOUT);
+
 } /* end TestDatagramNetworkApi */
 
 /*****************************************************************************
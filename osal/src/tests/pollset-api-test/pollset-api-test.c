@@ -0,0 +1,251 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * Filename: pollset-api-test.c
+ *
+ * Purpose: This file contains functional tests for "osapi-pollset"
+ * A set of datagram sockets is bound on the loopback interface and added to
+ * a poll set.  Datagrams are sent to some of them and the poll set is checked
+ * to report exactly those sockets.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#define UT_POLLSET_NUM_SOCKETS 4
+#define UT_POLLSET_BASE_PORT   9980
+#define UT_TIMEOUT             500
+
+osal_id_t     pollset_id;
+osal_id_t     tx_socket_id;
+osal_id_t     rx_socket_id[UT_POLLSET_NUM_SOCKETS];
+OS_SockAddr_t rx_addr[UT_POLLSET_NUM_SOCKETS];
+bool          networkImplemented = true;
+
+/*
+ * Helper to find the socket index of a reported event, or -1 if it is not one of the receivers
+ */
+int32 PollSet_FindSocket(osal_id_t objid)
+{
+    int32 i;
+
+    for (i = 0; i < UT_POLLSET_NUM_SOCKETS; ++i)
+    {
+        if (OS_ObjectIdEqual(objid, rx_socket_id[i]))
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * Helper to read the pending datagram from a receiver so it is no longer ready
+ */
+void PollSet_Drain(uint32 idx)
+{
+    char buf[16];
+
+    UtAssert_INT32_EQ(OS_SocketRecvFrom(rx_socket_id[idx], buf, sizeof(buf), NULL, UT_TIMEOUT), 4);
+}
+
+void Setup_PollSet(void)
+{
+    OS_SockAddr_t addr;
+    int32         status;
+    uint32        i;
+
+    UtAssert_INT32_EQ(OS_PollSetCreate(&pollset_id, "PollSet1"), OS_SUCCESS);
+
+    status = OS_SocketOpen(&tx_socket_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        networkImplemented = false;
+        return;
+    }
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_SocketAddrInit(&addr, OS_SocketDomain_INET), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrSetPort(&addr, UT_POLLSET_BASE_PORT + UT_POLLSET_NUM_SOCKETS), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrFromString(&addr, "127.0.0.1"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketBind(tx_socket_id, &addr), OS_SUCCESS);
+
+    for (i = 0; i < UT_POLLSET_NUM_SOCKETS; ++i)
+    {
+        UtAssert_INT32_EQ(OS_SocketOpen(&rx_socket_id[i], OS_SocketDomain_INET, OS_SocketType_DATAGRAM), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrInit(&rx_addr[i], OS_SocketDomain_INET), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrSetPort(&rx_addr[i], UT_POLLSET_BASE_PORT + i), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketAddrFromString(&rx_addr[i], "127.0.0.1"), OS_SUCCESS);
+        UtAssert_INT32_EQ(OS_SocketBind(rx_socket_id[i], &rx_addr[i]), OS_SUCCESS);
+    }
+}
+
+void Teardown_PollSet(void)
+{
+    uint32 i;
+
+    UtAssert_INT32_EQ(OS_PollSetDelete(pollset_id), OS_SUCCESS);
+
+    if (networkImplemented)
+    {
+        for (i = 0; i < UT_POLLSET_NUM_SOCKETS; ++i)
+        {
+            OS_close(rx_socket_id[i]);
+        }
+        OS_close(tx_socket_id);
+    }
+}
+
+void TestPollSetApi(void)
+{
+    OS_PollSetEvent_t events[UT_POLLSET_NUM_SOCKETS];
+    osal_id_t         objid;
+
+    UtAssert_INT32_EQ(OS_PollSetCreate(NULL, "PollSet2"), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollSetCreate(&objid, NULL), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollSetCreate(&objid, "PollSet1"), OS_ERR_NAME_TAKEN);
+
+    UtAssert_INT32_EQ(OS_PollSetGetIdByName(&objid, "PollSet1"), OS_SUCCESS);
+    UtAssert_True(OS_ObjectIdEqual(objid, pollset_id), "OS_PollSetGetIdByName() matches created ID");
+    UtAssert_INT32_EQ(OS_PollSetGetIdByName(&objid, "NotFound"), OS_ERR_NAME_NOT_FOUND);
+
+    UtAssert_INT32_EQ(OS_PollSetAdd(OS_OBJECT_ID_UNDEFINED, rx_socket_id[0], OS_STREAM_STATE_READABLE),
+                      OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, OS_OBJECT_ID_UNDEFINED, OS_STREAM_STATE_READABLE),
+                      OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, rx_socket_id[0], 0), OS_ERR_INVALID_ARGUMENT);
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, rx_socket_id[0], OS_STREAM_STATE_BOUND), OS_ERR_INVALID_ARGUMENT);
+
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, rx_socket_id[0]), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, NULL, 1, 0), OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, 0, 0), OS_ERR_INVALID_SIZE);
+    UtAssert_INT32_EQ(OS_PollSetWait(OS_OBJECT_ID_UNDEFINED, events, 1, 0), OS_ERR_INVALID_ID);
+
+    UtAssert_INT32_EQ(OS_PollSetDelete(OS_OBJECT_ID_UNDEFINED), OS_ERR_INVALID_ID);
+}
+
+void TestPollSetWait(void)
+{
+    OS_PollSetEvent_t events[UT_POLLSET_NUM_SOCKETS];
+    bool              seen[UT_POLLSET_NUM_SOCKETS];
+    int32             count;
+    int32             i;
+    int32             idx;
+    uint32            n;
+
+    if (!networkImplemented)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    for (n = 0; n < UT_POLLSET_NUM_SOCKETS; ++n)
+    {
+        UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, rx_socket_id[n], OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    }
+
+    /* Nothing has been sent yet */
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, 0), OS_ERROR_TIMEOUT);
+
+    /* Only the two sockets which received a datagram should be reported */
+    UtAssert_INT32_EQ(OS_SocketSendTo(tx_socket_id, "abc", 4, &rx_addr[1]), 4);
+    UtAssert_INT32_EQ(OS_SocketSendTo(tx_socket_id, "abc", 4, &rx_addr[3]), 4);
+
+    memset(seen, 0, sizeof(seen));
+    n = 0;
+    while (n < 2)
+    {
+        count = OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, UT_TIMEOUT);
+        UtAssert_True(count > 0, "OS_PollSetWait() (%ld) > 0", (long)count);
+        if (count <= 0)
+        {
+            break;
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            idx = PollSet_FindSocket(events[i].objid);
+            UtAssert_True(idx == 1 || idx == 3, "Ready socket index (%ld) is 1 or 3", (long)idx);
+            UtAssert_UINT32_EQ(events[i].StateFlags, OS_STREAM_STATE_READABLE);
+            if (idx >= 0 && !seen[idx])
+            {
+                seen[idx] = true;
+                PollSet_Drain(idx);
+                ++n;
+            }
+        }
+    }
+
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, 0), OS_ERROR_TIMEOUT);
+
+    /* A removed socket is no longer reported */
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, rx_socket_id[2]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, rx_socket_id[2]), OS_ERR_INVALID_ID);
+    UtAssert_INT32_EQ(OS_SocketSendTo(tx_socket_id, "abc", 4, &rx_addr[2]), 4);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, 100), OS_ERROR_TIMEOUT);
+    PollSet_Drain(2);
+
+    /* Adding again for write readiness replaces the read interest */
+    UtAssert_INT32_EQ(OS_PollSetAdd(pollset_id, rx_socket_id[0], OS_STREAM_STATE_WRITABLE), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, UT_TIMEOUT), 1);
+    UtAssert_True(PollSet_FindSocket(events[0].objid) == 0, "Writable socket is index 0");
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_WRITABLE);
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, rx_socket_id[0]), OS_SUCCESS);
+
+    /* Events beyond max_events are left for the next wait */
+    UtAssert_INT32_EQ(OS_SocketSendTo(tx_socket_id, "abc", 4, &rx_addr[1]), 4);
+    UtAssert_INT32_EQ(OS_SocketSendTo(tx_socket_id, "abc", 4, &rx_addr[3]), 4);
+    OS_TaskDelay(10);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, 1, UT_TIMEOUT), 1);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, UT_TIMEOUT), 2);
+    PollSet_Drain(1);
+    PollSet_Drain(3);
+
+    /* A member which is closed is not reported, but can still be removed */
+    UtAssert_INT32_EQ(OS_close(rx_socket_id[3]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_PollSetWait(pollset_id, events, UT_POLLSET_NUM_SOCKETS, 0), OS_ERROR_TIMEOUT);
+    UtAssert_INT32_EQ(OS_PollSetRemove(pollset_id, rx_socket_id[3]), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketOpen(&rx_socket_id[3], OS_SocketDomain_INET, OS_SocketType_DATAGRAM), OS_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(TestPollSetApi, Setup_PollSet, NULL, "TestPollSetApi");
+    UtTest_Add(TestPollSetWait, NULL, Teardown_PollSet, "TestPollSetWait");
+}
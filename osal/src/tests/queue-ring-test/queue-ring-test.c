@@ -0,0 +1,383 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Ring buffer queue test
+**
+** Checks the depth limit, empty and timeout behavior of a queue
+** created with OS_QUEUE_FLAG_RING, then runs several producer tasks
+** against a single consumer and verifies that every message arrives
+** exactly once and in order per producer.
+**
+** The producer/consumer run is repeated with an OS message queue
+** (if one can be created) and the rate of both is reported, for
+** comparison purposes only.
+**
+** Finally checks that deleting a queue releases a task which is
+** blocked reading it, that deleting a task which is blocked
+** reading a queue does not stop the queue from being deleted, and
+** that a queue can be deleted while other tasks are writing to it.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "uttest.h"
+#include "utbsp.h"
+
+#define RINGTEST_DEPTH         50
+#define RINGTEST_NUM_PRODUCERS 4
+#define RINGTEST_MSGS_PER_TASK 20000
+#define RINGTEST_TASK_PRIORITY 150
+
+typedef struct
+{
+    uint32 producer;
+    uint32 seq;
+} RingTestMsg_t;
+
+osal_id_t     ring_queue_id;
+osal_id_t     claim_mutex_id;
+uint32        num_claimed;
+uint32        producer_failures;
+uint32        run_number;
+volatile bool producers_go;
+volatile bool reader_done;
+int32         reader_status;
+
+void producer_task(void)
+{
+    RingTestMsg_t msg;
+    int32         status;
+
+    OS_MutSemTake(claim_mutex_id);
+    msg.producer = num_claimed;
+    ++num_claimed;
+    OS_MutSemGive(claim_mutex_id);
+
+    while (!producers_go)
+    {
+        OS_TaskDelay(1);
+    }
+
+    for (msg.seq = 0; msg.seq < RINGTEST_MSGS_PER_TASK; ++msg.seq)
+    {
+        do
+        {
+            status = OS_QueuePut(ring_queue_id, &msg, sizeof(msg), 0);
+            if (status == OS_QUEUE_FULL)
+            {
+                OS_TaskDelay(1);
+            }
+        } while (status == OS_QUEUE_FULL);
+
+        if (status != OS_SUCCESS)
+        {
+            OS_printf("Producer %u: Queue Put error: %d!\n", (unsigned int)msg.producer, (int)status);
+            OS_MutSemTake(claim_mutex_id);
+            ++producer_failures;
+            OS_MutSemGive(claim_mutex_id);
+            break;
+        }
+    }
+
+    OS_TaskExit();
+}
+
+void blocked_reader_task(void)
+{
+    uint32 data;
+    size_t data_size;
+
+    reader_status = OS_QueueGet(ring_queue_id, &data, sizeof(data), &data_size, OS_PEND);
+    reader_done   = true;
+
+    OS_TaskExit();
+}
+
+void RingQueueBasicTest(void)
+{
+    int32  status;
+    uint32 data;
+    uint32 i;
+    size_t data_size;
+
+    status = OS_QueueCreate(&ring_queue_id, "RingQ", OSAL_BLOCKCOUNT_C(RINGTEST_DEPTH), OSAL_SIZE_C(sizeof(data)),
+                            OS_QUEUE_FLAG_RING);
+    UtAssert_True(status == OS_SUCCESS, "RingQ create Id=%lx Rc=%d", OS_ObjectIdToInteger(ring_queue_id), (int)status);
+
+    /* Fill the queue up to the requested depth, which is not a power of two */
+    for (i = 0; i < RINGTEST_DEPTH; ++i)
+    {
+        status = OS_QueuePut(ring_queue_id, &i, sizeof(i), 0);
+        UtAssert_True(status == OS_SUCCESS, "OS_QueuePut(%u) Rc=%d", (unsigned int)i, (int)status);
+    }
+
+    status = OS_QueuePut(ring_queue_id, &i, sizeof(i), 0);
+    UtAssert_True(status == OS_QUEUE_FULL, "OS_QueuePut when full Rc=%d", (int)status);
+
+    for (i = 0; i < RINGTEST_DEPTH; ++i)
+    {
+        data   = 0xFFFFFFFF;
+        status = OS_QueueGet(ring_queue_id, &data, sizeof(data), &data_size, OS_CHECK);
+        UtAssert_True(status == OS_SUCCESS && data == i && data_size == sizeof(data),
+                      "OS_QueueGet Rc=%d data=%u size=%lu", (int)status, (unsigned int)data,
+                      (unsigned long)data_size);
+    }
+
+    status = OS_QueueGet(ring_queue_id, &data, sizeof(data), &data_size, OS_CHECK);
+    UtAssert_True(status == OS_QUEUE_EMPTY, "OS_QueueGet when empty Rc=%d", (int)status);
+
+    status = OS_QueueGet(ring_queue_id, &data, sizeof(data), &data_size, 100);
+    UtAssert_True(status == OS_QUEUE_TIMEOUT, "OS_QueueGet timeout Rc=%d", (int)status);
+
+    status = OS_QueueDelete(ring_queue_id);
+    UtAssert_True(status == OS_SUCCESS, "RingQ delete Rc=%d", (int)status);
+}
+
+/*
+ * Runs the producers against a consumer on a queue created with the given flags.
+ * Returns the number of messages per second, or 0 if the queue could not be created.
+ */
+uint32 RingQueueRun(uint32 flags)
+{
+    int32         status;
+    RingTestMsg_t msg;
+    size_t        msg_size;
+    uint32        expected[RINGTEST_NUM_PRODUCERS];
+    uint32        total;
+    uint32        errors;
+    uint32        i;
+    uint32        num_created;
+    osal_id_t     task_id[RINGTEST_NUM_PRODUCERS];
+    char          task_name[OS_MAX_API_NAME];
+    OS_time_t     start_time;
+    OS_time_t     end_time;
+    int64         elapsed_us;
+
+    status = OS_QueueCreate(&ring_queue_id, "RingQ", OSAL_BLOCKCOUNT_C(RINGTEST_DEPTH), OSAL_SIZE_C(sizeof(msg)),
+                            flags);
+    if (status != OS_SUCCESS)
+    {
+        return 0;
+    }
+
+    memset(expected, 0, sizeof(expected));
+    num_claimed       = 0;
+    producer_failures = 0;
+    producers_go      = false;
+
+    /* The tasks from a previous run may not be cleaned up yet, so use unique names */
+    ++run_number;
+    num_created = 0;
+    for (i = 0; i < RINGTEST_NUM_PRODUCERS; ++i)
+    {
+        snprintf(task_name, sizeof(task_name), "Producer %u.%u", (unsigned int)run_number, (unsigned int)i);
+        status = OS_TaskCreate(&task_id[i], task_name, producer_task, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                               OSAL_PRIORITY_C(RINGTEST_TASK_PRIORITY), 0);
+        UtAssert_True(status == OS_SUCCESS, "%s create Rc=%d", task_name, (int)status);
+        if (status == OS_SUCCESS)
+        {
+            ++num_created;
+        }
+    }
+
+    while (num_claimed < num_created)
+    {
+        OS_TaskDelay(10);
+    }
+
+    OS_GetLocalTime(&start_time);
+    producers_go = true;
+
+    total  = 0;
+    errors = 0;
+    while (total < (num_created * RINGTEST_MSGS_PER_TASK))
+    {
+        status = OS_QueueGet(ring_queue_id, &msg, sizeof(msg), &msg_size, 1000);
+        if (status != OS_SUCCESS)
+        {
+            UtAssert_Failed("OS_QueueGet Rc=%d after %u messages", (int)status, (unsigned int)total);
+            break;
+        }
+
+        if (msg.producer >= RINGTEST_NUM_PRODUCERS || msg.seq != expected[msg.producer])
+        {
+            ++errors;
+        }
+        else
+        {
+            ++expected[msg.producer];
+        }
+
+        ++total;
+    }
+
+    OS_GetLocalTime(&end_time);
+
+    UtAssert_True(errors == 0, "Out of order messages = %u", (unsigned int)errors);
+    UtAssert_True(producer_failures == 0, "Producer failures = %u", (unsigned int)producer_failures);
+
+    status = OS_QueueGet(ring_queue_id, &msg, sizeof(msg), &msg_size, OS_CHECK);
+    UtAssert_True(status == OS_QUEUE_EMPTY, "OS_QueueGet after all received Rc=%d", (int)status);
+
+    status = OS_QueueDelete(ring_queue_id);
+    UtAssert_True(status == OS_SUCCESS, "RingQ delete Rc=%d", (int)status);
+
+    elapsed_us = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, start_time));
+    if (elapsed_us <= 0)
+    {
+        elapsed_us = 1;
+    }
+
+    return (uint32)(((int64)total * 1000000) / elapsed_us);
+}
+
+void RingQueueProducerTest(void)
+{
+    int32  status;
+    uint32 ring_rate;
+    uint32 mq_rate;
+
+    status = OS_MutSemCreate(&claim_mutex_id, "ClaimMutex", 0);
+    UtAssert_True(status == OS_SUCCESS, "Mutex create Rc=%d", (int)status);
+
+    ring_rate = RingQueueRun(OS_QUEUE_FLAG_RING);
+    UtAssert_True(ring_rate != 0, "Ring queue: %u producers, %lu msgs/s", (unsigned int)RINGTEST_NUM_PRODUCERS,
+                  (unsigned long)ring_rate);
+
+    /* OS message queue comparison, informational only as it may be unavailable or depth limited */
+    mq_rate = RingQueueRun(0);
+    if (mq_rate == 0)
+    {
+        UtPrintf("OS message queue not available for comparison");
+    }
+    else
+    {
+        UtPrintf("OS message queue: %u producers, %lu msgs/s", (unsigned int)RINGTEST_NUM_PRODUCERS,
+                 (unsigned long)mq_rate);
+    }
+
+    status = OS_MutSemDelete(claim_mutex_id);
+    UtAssert_True(status == OS_SUCCESS, "Mutex delete Rc=%d", (int)status);
+}
+
+void RingQueueDeleteTest(void)
+{
+    int32     status;
+    uint32    i;
+    osal_id_t task_id;
+    char      task_name[OS_MAX_API_NAME];
+
+    /* Deleting the queue wakes a reader pending on it, which gets an error */
+    status = OS_QueueCreate(&ring_queue_id, "RingQ", OSAL_BLOCKCOUNT_C(RINGTEST_DEPTH), OSAL_SIZE_C(sizeof(uint32)),
+                            OS_QUEUE_FLAG_RING);
+    UtAssert_True(status == OS_SUCCESS, "RingQ create Rc=%d", (int)status);
+
+    reader_done = false;
+    status      = OS_TaskCreate(&task_id, "BlockedReader1", blocked_reader_task, OSAL_TASK_STACK_ALLOCATE,
+                           OSAL_SIZE_C(4096), OSAL_PRIORITY_C(RINGTEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "BlockedReader1 create Rc=%d", (int)status);
+
+    /* give the reader time to block */
+    OS_TaskDelay(100);
+    UtAssert_True(!reader_done, "Reader pending on empty queue");
+
+    status = OS_QueueDelete(ring_queue_id);
+    UtAssert_True(status == OS_SUCCESS, "RingQ delete with pending reader Rc=%d", (int)status);
+
+    for (i = 0; i < 100 && !reader_done; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+    UtAssert_True(reader_done && reader_status != OS_SUCCESS, "Pending reader released Rc=%d", (int)reader_status);
+
+    /* Deleting a reader while it is pending must not leave the queue waiting for it */
+    status = OS_QueueCreate(&ring_queue_id, "RingQ", OSAL_BLOCKCOUNT_C(RINGTEST_DEPTH), OSAL_SIZE_C(sizeof(uint32)),
+                            OS_QUEUE_FLAG_RING);
+    UtAssert_True(status == OS_SUCCESS, "RingQ create Rc=%d", (int)status);
+
+    reader_done = false;
+    status      = OS_TaskCreate(&task_id, "BlockedReader2", blocked_reader_task, OSAL_TASK_STACK_ALLOCATE,
+                           OSAL_SIZE_C(4096), OSAL_PRIORITY_C(RINGTEST_TASK_PRIORITY), 0);
+    UtAssert_True(status == OS_SUCCESS, "BlockedReader2 create Rc=%d", (int)status);
+
+    OS_TaskDelay(100);
+    status = OS_TaskDelete(task_id);
+    UtAssert_True(status == OS_SUCCESS, "BlockedReader2 delete Rc=%d", (int)status);
+    UtAssert_True(!reader_done, "Deleted reader did not return");
+
+    status = OS_QueueDelete(ring_queue_id);
+    UtAssert_True(status == OS_SUCCESS, "RingQ delete after reader deleted Rc=%d", (int)status);
+
+    /* Deleting the queue while producers are writing to it stops each of them with an error */
+    status = OS_MutSemCreate(&claim_mutex_id, "ClaimMutex", 0);
+    UtAssert_True(status == OS_SUCCESS, "Mutex create Rc=%d", (int)status);
+    status = OS_QueueCreate(&ring_queue_id, "RingQ", OSAL_BLOCKCOUNT_C(RINGTEST_DEPTH),
+                            OSAL_SIZE_C(sizeof(RingTestMsg_t)), OS_QUEUE_FLAG_RING);
+    UtAssert_True(status == OS_SUCCESS, "RingQ create Rc=%d", (int)status);
+
+    num_claimed       = 0;
+    producer_failures = 0;
+    producers_go      = false;
+    for (i = 0; i < RINGTEST_NUM_PRODUCERS; ++i)
+    {
+        snprintf(task_name, sizeof(task_name), "DelProducer%u", (unsigned int)i);
+        status = OS_TaskCreate(&task_id, task_name, producer_task, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(4096),
+                               OSAL_PRIORITY_C(RINGTEST_TASK_PRIORITY), 0);
+        UtAssert_True(status == OS_SUCCESS, "Producer %u create Rc=%d", (unsigned int)i, (int)status);
+    }
+
+    /* the queue is never read, so it fills up and the producers keep retrying */
+    producers_go = true;
+    OS_TaskDelay(100);
+
+    status = OS_QueueDelete(ring_queue_id);
+    UtAssert_True(status == OS_SUCCESS, "RingQ delete with active producers Rc=%d", (int)status);
+
+    for (i = 0; i < 100 && producer_failures < RINGTEST_NUM_PRODUCERS; ++i)
+    {
+        OS_TaskDelay(10);
+    }
+    UtAssert_True(producer_failures == RINGTEST_NUM_PRODUCERS, "Producers stopped by delete = %u",
+                  (unsigned int)producer_failures);
+
+    status = OS_MutSemDelete(claim_mutex_id);
+    UtAssert_True(status == OS_SUCCESS, "Mutex delete Rc=%d", (int)status);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(RingQueueBasicTest, NULL, NULL, "RingQueueBasicTest");
+    UtTest_Add(RingQueueProducerTest, NULL, NULL, "RingQueueProducerTest");
+    UtTest_Add(RingQueueDeleteTest, NULL, NULL, "RingQueueDeleteTest");
+}
@@ -0,0 +1,225 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Socket batch speed test
+**
+** Measures datagram throughput over the loopback interface, comparing
+** one OS_SocketSendTo/OS_SocketRecvFrom call per packet against the
+** batched OS_SocketSendToMulti/OS_SocketRecvFromMulti calls.  Each round
+** sends a burst of packets and then drains it, which is the pattern used
+** by the CI_LAB/TO_LAB style apps.
+**
+** The results are informational only.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+#define SOCKBATCH_ROUNDS      2000
+#define SOCKBATCH_BURST       16
+#define SOCKBATCH_PACKET_SIZE 128
+#define SOCKBATCH_TIMEOUT     1000
+
+osal_id_t     sock_batch_tx_id;
+osal_id_t     sock_batch_rx_id;
+OS_SockAddr_t sock_batch_rx_addr;
+bool          sock_batch_available;
+
+uint8        sock_batch_data[SOCKBATCH_BURST][SOCKBATCH_PACKET_SIZE];
+OS_SockMsg_t sock_batch_msgs[SOCKBATCH_BURST];
+
+OS_time_t sock_batch_start;
+uint32    sock_batch_packets;
+
+void SocketBatchStart(void)
+{
+    sock_batch_packets = 0;
+    OS_GetLocalTime(&sock_batch_start);
+}
+
+/*
+ * Reports the rate at which packets made the round trip through the socket
+ */
+void SocketBatchReport(const char *desc)
+{
+    OS_time_t end_time;
+    int64     elapsed_us;
+
+    OS_GetLocalTime(&end_time);
+
+    elapsed_us = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(end_time, sock_batch_start));
+    if (elapsed_us <= 0)
+    {
+        elapsed_us = 1;
+    }
+
+    UtAssert_True(sock_batch_packets == (SOCKBATCH_ROUNDS * SOCKBATCH_BURST), "%s packets = %lu", desc,
+                  (unsigned long)sock_batch_packets);
+    UtPrintf("%s: %lu packets/s", desc, (unsigned long)(((int64)sock_batch_packets * 1000000) / elapsed_us));
+}
+
+void SocketBatchSetup(void)
+{
+    OS_SockAddr_t addr;
+    int32         status;
+
+    status = OS_SocketOpen(&sock_batch_rx_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM);
+    if (status == OS_ERR_NOT_IMPLEMENTED)
+    {
+        sock_batch_available = false;
+        return;
+    }
+
+    UtAssert_INT32_EQ(status, OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketOpen(&sock_batch_tx_id, OS_SocketDomain_INET, OS_SocketType_DATAGRAM), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_SocketAddrInit(&sock_batch_rx_addr, OS_SocketDomain_INET), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrSetPort(&sock_batch_rx_addr, 9990), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrFromString(&sock_batch_rx_addr, "127.0.0.1"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketBind(sock_batch_rx_id, &sock_batch_rx_addr), OS_SUCCESS);
+
+    UtAssert_INT32_EQ(OS_SocketAddrInit(&addr, OS_SocketDomain_INET), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrSetPort(&addr, 9991), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketAddrFromString(&addr, "127.0.0.1"), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_SocketBind(sock_batch_tx_id, &addr), OS_SUCCESS);
+
+    memset(sock_batch_data, 0xA5, sizeof(sock_batch_data));
+    sock_batch_available = true;
+}
+
+void SocketBatchTeardown(void)
+{
+    if (sock_batch_available)
+    {
+        OS_close(sock_batch_tx_id);
+        OS_close(sock_batch_rx_id);
+    }
+}
+
+void SocketSinglePacketTest(void)
+{
+    uint32 round;
+    uint32 i;
+
+    if (!sock_batch_available)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    SocketBatchStart();
+    for (round = 0; round < SOCKBATCH_ROUNDS; ++round)
+    {
+        for (i = 0; i < SOCKBATCH_BURST; ++i)
+        {
+            if (OS_SocketSendTo(sock_batch_tx_id, sock_batch_data[i], SOCKBATCH_PACKET_SIZE, &sock_batch_rx_addr) !=
+                SOCKBATCH_PACKET_SIZE)
+            {
+                break;
+            }
+        }
+
+        for (i = 0; i < SOCKBATCH_BURST; ++i)
+        {
+            if (OS_SocketRecvFrom(sock_batch_rx_id, sock_batch_data[i], SOCKBATCH_PACKET_SIZE, NULL,
+                                  SOCKBATCH_TIMEOUT) != SOCKBATCH_PACKET_SIZE)
+            {
+                break;
+            }
+
+            ++sock_batch_packets;
+        }
+    }
+    SocketBatchReport("OS_SocketSendTo/OS_SocketRecvFrom");
+}
+
+void SocketMultiPacketTest(void)
+{
+    uint32 round;
+    uint32 i;
+    uint32 count;
+    int32  status;
+
+    if (!sock_batch_available)
+    {
+        UtAssert_NA("Network API not implemented");
+        return;
+    }
+
+    SocketBatchStart();
+    for (round = 0; round < SOCKBATCH_ROUNDS; ++round)
+    {
+        for (i = 0; i < SOCKBATCH_BURST; ++i)
+        {
+            sock_batch_msgs[i].Buffer     = sock_batch_data[i];
+            sock_batch_msgs[i].BufLen     = SOCKBATCH_PACKET_SIZE;
+            sock_batch_msgs[i].RemoteAddr = &sock_batch_rx_addr;
+        }
+
+        status = OS_SocketSendToMulti(sock_batch_tx_id, sock_batch_msgs, SOCKBATCH_BURST);
+        if (status != SOCKBATCH_BURST)
+        {
+            continue;
+        }
+
+        for (i = 0; i < SOCKBATCH_BURST; ++i)
+        {
+            sock_batch_msgs[i].RemoteAddr = NULL;
+        }
+
+        count = 0;
+        while (count < SOCKBATCH_BURST)
+        {
+            status = OS_SocketRecvFromMulti(sock_batch_rx_id, &sock_batch_msgs[count], SOCKBATCH_BURST - count,
+                                            SOCKBATCH_TIMEOUT);
+            if (status <= 0)
+            {
+                break;
+            }
+
+            count += status;
+        }
+
+        sock_batch_packets += count;
+    }
+    SocketBatchReport("OS_SocketSendToMulti/OS_SocketRecvFromMulti");
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(SocketSinglePacketTest, SocketBatchSetup, NULL, "SocketSinglePacketTest");
+    UtTest_Add(SocketMultiPacketTest, NULL, SocketBatchTeardown, "SocketMultiPacketTest");
+}
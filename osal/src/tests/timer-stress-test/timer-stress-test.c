@@ -0,0 +1,206 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+** Timer callback stress test
+**
+** Measures the time the timebase thread spends processing each tick as
+** the number of timers registered on the timebase grows.  The timebase
+** uses an external sync function so that the test controls exactly when
+** each tick occurs, and the time from the sync function returning until
+** it is called again is the processing overhead of that tick.
+**
+** All but one of the timers are set far in the future, so only a single
+** callback is due on each tick.  With the expiry queue the overhead should
+** stay roughly constant rather than grow with the number of timers.
+** The number of timers is limited by OS_MAX_TIMERS.
+**
+** The overhead figures are reported for comparison purposes only.
+*/
+#include <stdio.h>
+#include <string.h>
+#include "common_types.h"
+#include "osapi.h"
+#include "utassert.h"
+#include "utbsp.h"
+#include "uttest.h"
+
+#define STRESS_TICKS_PER_RUN 2000
+#define STRESS_TICK_USEC     1000
+#define STRESS_IDLE_USEC     100000000
+
+typedef struct
+{
+    osal_id_t       tick_sem;
+    osal_id_t       done_sem;
+    volatile bool   running;
+    volatile bool   measuring;
+    volatile uint32 sync_count;
+    volatile uint32 callback_count;
+    OS_time_t       return_time;
+    int64           processing_ns;
+    osal_id_t       timebase_id;
+    osal_id_t       timer_id[OS_MAX_TIMERS];
+} StressTestState_t;
+
+StressTestState_t stress_test;
+
+static uint32 StressTestSync(osal_id_t timebase_id)
+{
+    OS_time_t enter_time;
+
+    OS_GetLocalTime(&enter_time);
+
+    if (stress_test.measuring)
+    {
+        stress_test.processing_ns +=
+            OS_TimeGetTotalNanoseconds(OS_TimeSubtract(enter_time, stress_test.return_time));
+    }
+
+    ++stress_test.sync_count;
+
+    if (!stress_test.running)
+    {
+        /* Not under test; just provide a slow tick so the thread can be cleaned up */
+        OS_TaskDelay(1);
+        return STRESS_TICK_USEC;
+    }
+
+    OS_BinSemGive(stress_test.done_sem);
+    OS_BinSemTake(stress_test.tick_sem);
+
+    OS_GetLocalTime(&stress_test.return_time);
+
+    return STRESS_TICK_USEC;
+}
+
+static void StressTestCallback(osal_id_t timer_id, void *arg)
+{
+    ++stress_test.callback_count;
+}
+
+/*
+ * Runs a number of ticks and returns the average processing time per tick, in ns
+ */
+static int64 StressTestRun(void)
+{
+    uint32 i;
+
+    stress_test.processing_ns  = 0;
+    stress_test.callback_count = 0;
+
+    /* The timebase thread is waiting in the sync function at this point */
+    for (i = 0; i < STRESS_TICKS_PER_RUN; ++i)
+    {
+        stress_test.measuring = (i > 0);
+        OS_BinSemGive(stress_test.tick_sem);
+        OS_BinSemTake(stress_test.done_sem);
+    }
+
+    stress_test.measuring = false;
+
+    return stress_test.processing_ns / (STRESS_TICKS_PER_RUN - 1);
+}
+
+void TimerStressTest(void)
+{
+    char   name[OS_MAX_API_NAME];
+    uint32 num_timers;
+    uint32 next_report;
+    int64  per_tick_ns;
+    int64  baseline_ns;
+    uint32 i;
+
+    memset(&stress_test, 0, sizeof(stress_test));
+    stress_test.running = true;
+
+    UtAssert_INT32_EQ(OS_BinSemCreate(&stress_test.tick_sem, "StressTick", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_BinSemCreate(&stress_test.done_sem, "StressDone", 0, 0), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimeBaseCreate(&stress_test.timebase_id, "StressTB", StressTestSync), OS_SUCCESS);
+
+    /* Wait for the timebase thread to reach the sync function */
+    OS_BinSemTake(stress_test.done_sem);
+
+    /* The first timer expires on every tick, to confirm callbacks are still delivered */
+    UtAssert_INT32_EQ(
+        OS_TimerAdd(&stress_test.timer_id[0], "StressT0", stress_test.timebase_id, StressTestCallback, NULL),
+        OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_TimerSet(stress_test.timer_id[0], STRESS_TICK_USEC, STRESS_TICK_USEC), OS_SUCCESS);
+    num_timers = 1;
+
+    baseline_ns = StressTestRun();
+    UtAssert_True(stress_test.callback_count >= (STRESS_TICKS_PER_RUN - 1), "Callbacks (%lu) >= %lu",
+                  (unsigned long)stress_test.callback_count, (unsigned long)(STRESS_TICKS_PER_RUN - 1));
+    UtPrintf("%4lu timer(s): %6ld ns per tick", (unsigned long)num_timers, (long)baseline_ns);
+
+    next_report = 2;
+    while (num_timers < OS_MAX_TIMERS)
+    {
+        /* Add idle timers, which do not expire during the test */
+        snprintf(name, sizeof(name), "StressT%lu", (unsigned long)num_timers);
+        if (OS_TimerAdd(&stress_test.timer_id[num_timers], name, stress_test.timebase_id, StressTestCallback, NULL) !=
+            OS_SUCCESS)
+        {
+            break;
+        }
+        UtAssert_INT32_EQ(
+            OS_TimerSet(stress_test.timer_id[num_timers], STRESS_IDLE_USEC + num_timers, STRESS_IDLE_USEC),
+            OS_SUCCESS);
+        ++num_timers;
+
+        if (num_timers == next_report || num_timers == OS_MAX_TIMERS)
+        {
+            per_tick_ns = StressTestRun();
+            UtAssert_True(stress_test.callback_count >= (STRESS_TICKS_PER_RUN - 1), "Callbacks (%lu) >= %lu",
+                          (unsigned long)stress_test.callback_count, (unsigned long)(STRESS_TICKS_PER_RUN - 1));
+            UtPrintf("%4lu timer(s): %6ld ns per tick", (unsigned long)num_timers, (long)per_tick_ns);
+            next_report *= 2;
+        }
+    }
+
+    /* Let the timebase thread run freely so it can be deleted */
+    stress_test.running = false;
+    OS_BinSemGive(stress_test.tick_sem);
+
+    for (i = 0; i < num_timers; ++i)
+    {
+        UtAssert_INT32_EQ(OS_TimerDelete(stress_test.timer_id[i]), OS_SUCCESS);
+    }
+
+    UtAssert_INT32_EQ(OS_TimeBaseDelete(stress_test.timebase_id), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_BinSemDelete(stress_test.tick_sem), OS_SUCCESS);
+    UtAssert_INT32_EQ(OS_BinSemDelete(stress_test.done_sem), OS_SUCCESS);
+}
+
+void UtTest_Setup(void)
+{
+    if (OS_API_Init() != OS_SUCCESS)
+    {
+        UtAssert_Abort("OS_API_Init() failed");
+    }
+
+    /* the test should call OS_API_Teardown() before exiting */
+    UtTest_AddTeardown(OS_API_Teardown, "Cleanup");
+
+    /*
+     * Register the test setup and check routines in UT assert
+     */
+    UtTest_Add(TimerStressTest, NULL, NULL, "TimerStressTest");
+}
@@ -340,6 +340,79 @@ void Test_OS_SocketSendTo_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo_Impl, (&token, buffer, sizeof(buffer), &addr), OS_SUCCESS);
 }
 
+void Test_OS_SocketRecvFromMulti_Impl(void)
+{
+    OS_object_token_t token = {0};
+    uint8             buffer[2][UT_BUFFER_SIZE];
+    OS_SockMsg_t      msgs[2];
+
+    /* Set up token */
+    token.obj_idx = UT_INDEX_0;
+
+    memset(msgs, 0, sizeof(msgs));
+    msgs[0].Buffer = buffer[0];
+    msgs[0].BufLen = sizeof(buffer[0]);
+    msgs[1].Buffer = buffer[1];
+    msgs[1].BufLen = sizeof(buffer[1]);
+
+    /* Nothing queued on a non-selectable socket */
+    OS_impl_filehandle_table[0].selectable = false;
+    OCS_errno                              = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 2, 0), OS_ERROR_TIMEOUT);
+
+    /* Other error on the first message */
+    OCS_errno = 0;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 2, 0), OS_ERROR);
+
+    /* Only the first message is available */
+    OCS_errno = OCS_EAGAIN;
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, 4);
+    UT_SetDeferredRetcode(UT_KEY(OCS_recvfrom), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 2, 0), 1);
+    UtAssert_UINT32_EQ(msgs[0].ActualLength, 4);
+
+    /* Both messages received */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti_Impl, (&token, msgs, 2, 0), 2);
+}
+
+void Test_OS_SocketSendToMulti_Impl(void)
+{
+    OS_object_token_t    token = {0};
+    uint8                buffer[2][UT_BUFFER_SIZE];
+    OS_SockMsg_t         msgs[2];
+    OS_SockAddr_t        addr = {0};
+    struct OCS_sockaddr *sa   = (struct OCS_sockaddr *)&addr.AddrData;
+
+    /* Set up token */
+    token.obj_idx = UT_INDEX_0;
+
+    sa->sa_family     = OCS_AF_INET;
+    addr.ActualLength = sizeof(struct OCS_sockaddr_in);
+
+    memset(msgs, 0, sizeof(msgs));
+    msgs[0].Buffer     = buffer[0];
+    msgs[0].BufLen     = sizeof(buffer[0]);
+    msgs[0].RemoteAddr = &addr;
+    msgs[1].Buffer     = buffer[1];
+    msgs[1].BufLen     = sizeof(buffer[1]);
+    msgs[1].RemoteAddr = &addr;
+
+    /* Failure on the first message */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), OS_ERROR);
+
+    /* Failure on the second message reports the first as sent */
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, 4);
+    UT_SetDeferredRetcode(UT_KEY(OCS_sendto), 1, -1);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), 1);
+    UtAssert_UINT32_EQ(msgs[0].ActualLength, 4);
+
+    /* Both messages sent */
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti_Impl, (&token, msgs, 2), 2);
+}
+
 void Test_OS_SocketGetInfo_Impl(void)
 {
     OSAPI_TEST_FUNCTION_RC(OS_SocketGetInfo_Impl, (NULL, NULL), OS_SUCCESS);
@@ -490,6 +563,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketAccept_Impl);
     ADD_TEST(OS_SocketRecvFrom_Impl);
     ADD_TEST(OS_SocketSendTo_Impl);
+    ADD_TEST(OS_SocketRecvFromMulti_Impl);
+    ADD_TEST(OS_SocketSendToMulti_Impl);
     ADD_TEST(OS_SocketGetInfo_Impl);
     ADD_TEST(OS_SocketAddrInit_Impl);
     ADD_TEST(OS_SocketAddrToString_Impl);
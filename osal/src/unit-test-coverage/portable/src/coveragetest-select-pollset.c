@@ -0,0 +1,172 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     coveragetest-select-pollset.c
+ *
+ */
+#include "os-portable-coveragetest.h"
+#include "ut-adaptor-portable-posix-io.h"
+#include "os-shared-pollset.h"
+#include "os-shared-select.h"
+#include "os-shared-idmap.h"
+
+#include "OCS_sys_select.h"
+
+void Test_OS_PollSetCreate_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollSetCreate_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate_Impl, (&token), OS_SUCCESS);
+}
+
+void Test_OS_PollSetDelete_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete_Impl, (&token), OS_SUCCESS);
+}
+
+void Test_OS_PollSetAdd_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token,
+     *                          uint32 StateFlags)
+     */
+    OS_object_token_t token;
+    OS_object_token_t stream_token;
+
+    memset(&token, 0, sizeof(token));
+    memset(&stream_token, 0, sizeof(stream_token));
+    stream_token.obj_idx = UT_INDEX_1;
+
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_1, 0);
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_1, false);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+
+    UT_PortablePosixIOTest_Set_Selectable(UT_INDEX_1, true);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+
+    /* Test case where the FD exceeds FD_SETSIZE */
+    UT_PortablePosixIOTest_Set_FD(UT_INDEX_1, OCS_FD_SETSIZE);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd_Impl, (&token, &stream_token, OS_STREAM_STATE_READABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+}
+
+void Test_OS_PollSetRemove_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, osal_index_t stream_idx)
+     */
+    OS_object_token_t token;
+
+    memset(&token, 0, sizeof(token));
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove_Impl, (&token, UT_INDEX_1), OS_SUCCESS);
+}
+
+void Test_OS_PollSetWait_Impl(void)
+{
+    /* Test Case For:
+     * int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *events, uint32 max_events,
+     *                           int32 msecs)
+     */
+    OS_object_token_t token;
+    OS_PollSetEvent_t events[3];
+    osal_id_t         id1 = OS_ObjectIdFromInteger(0x10001);
+    osal_id_t         id2 = OS_ObjectIdFromInteger(0x10002);
+
+    memset(&token, 0, sizeof(token));
+
+    /* No members at all */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&token, events, 3, 0), OS_ERROR_TIMEOUT);
+    UtAssert_STUB_COUNT(OS_SelectMultiple_Impl, 0);
+
+    /*
+     * Stream 1 is watched for read, stream 2 for write, and stream 3 was
+     * closed and its slot reused by a different stream so it is skipped.
+     * The select stub leaves the sets untouched, so every stream passed in is ready.
+     */
+    OS_pollset_table[0].member_flags[1] = OS_STREAM_STATE_READABLE;
+    OS_pollset_table[0].member_id[1]    = id1;
+    OS_global_stream_table[1].active_id = id1;
+    OS_pollset_table[0].member_flags[2] = OS_STREAM_STATE_WRITABLE;
+    OS_pollset_table[0].member_id[2]    = id2;
+    OS_global_stream_table[2].active_id = id2;
+    OS_pollset_table[0].member_flags[3] = OS_STREAM_STATE_READABLE | OS_STREAM_STATE_WRITABLE;
+    OS_pollset_table[0].member_id[3]    = id1;
+    OS_global_stream_table[3].active_id = id2;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&token, events, 3, 0), 2);
+    UtAssert_True(OS_ObjectIdEqual(events[0].objid, id1), "events[0].objid == id1");
+    UtAssert_UINT32_EQ(events[0].StateFlags, OS_STREAM_STATE_READABLE);
+    UtAssert_True(OS_ObjectIdEqual(events[1].objid, id2), "events[1].objid == id2");
+    UtAssert_UINT32_EQ(events[1].StateFlags, OS_STREAM_STATE_WRITABLE);
+
+    /* Truncated to the size of the events array */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&token, events, 1, 0), 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SelectMultiple_Impl), OS_ERROR_TIMEOUT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait_Impl, (&token, events, 3, 0), OS_ERROR_TIMEOUT);
+}
+
+/* ------------------- End of test cases --------------------------------------*/
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_pollset_table, 0, sizeof(OS_pollset_table));
+    memset(OS_global_stream_table, 0, sizeof(OS_common_record_t) * OS_MAX_NUM_OPEN_FILES);
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/* UtTest_Setup
+ *
+ * Purpose:
+ *   Registers the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollSetCreate_Impl);
+    ADD_TEST(OS_PollSetDelete_Impl);
+    ADD_TEST(OS_PollSetAdd_Impl);
+    ADD_TEST(OS_PollSetRemove_Impl);
+    ADD_TEST(OS_PollSetWait_Impl);
+}
@@ -85,7 +85,7 @@ void Test_OS_BinSemGive(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_BinSemGive(UT_OBJID_1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_BinSemGive(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
@@ -97,7 +97,7 @@ void Test_OS_BinSemTake(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_BinSemTake(UT_OBJID_1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_BinSemTake(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
@@ -121,7 +121,7 @@ void Test_OS_BinSemTimedWait(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_BinSemTimedWait(UT_OBJID_1, 1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_BinSemTimedWait(UT_OBJID_1, 1), OS_ERR_INVALID_ID);
 }
 
@@ -85,7 +85,7 @@ void Test_OS_CountSemGive(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_CountSemGive(UT_OBJID_1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_CountSemGive(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
@@ -97,7 +97,7 @@ void Test_OS_CountSemTake(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_CountSemTake(UT_OBJID_1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_CountSemTake(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
@@ -109,7 +109,7 @@ void Test_OS_CountSemTimedWait(void)
      */
     OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWait(UT_OBJID_1, 1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_CountSemTimedWait(UT_OBJID_1, 1), OS_ERR_INVALID_ID);
 }
 
@@ -221,6 +221,41 @@ void Test_OS_lseek(void)
     OSAPI_TEST_FUNCTION_RC(OS_lseek(UT_OBJID_1, 0, 0), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_FileMap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap(osal_id_t filedes, const void **addr, size_t *size)
+     */
+    const void *addr;
+    size_t      size;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, &addr, &size), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, NULL, &size), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, &addr, NULL), OS_INVALID_POINTER);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap(UT_OBJID_1, &addr, &size), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_FileUnmap(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileUnmap(const void *addr, size_t size)
+     */
+    char buffer[8] = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(buffer, sizeof(buffer)), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(NULL, sizeof(buffer)), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(buffer, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_FileUnmap_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap(buffer, sizeof(buffer)), OS_ERROR);
+}
+
 void Test_OS_remove(void)
 {
     /*
@@ -410,6 +445,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_chmod);
     ADD_TEST(OS_stat);
     ADD_TEST(OS_lseek);
+    ADD_TEST(OS_FileMap);
+    ADD_TEST(OS_FileUnmap);
     ADD_TEST(OS_remove);
     ADD_TEST(OS_rename);
     ADD_TEST(OS_cp);
@@ -459,10 +459,11 @@ void Test_OS_ObjectIdFindByName(void)
      * Nominal case (with no additional setup) should return OS_ERR_NAME_NOT_FOUND
      * Setting up a special matching entry should yield OS_SUCCESS
      */
-    char      TaskName[] = "UT_find";
-    osal_id_t objid;
-    int32     expected = OS_ERR_NAME_NOT_FOUND;
-    int32     actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
+    char              TaskName[] = "UT_find";
+    osal_id_t         objid;
+    OS_object_token_t token;
+    int32             expected = OS_ERR_NAME_NOT_FOUND;
+    int32             actual   = OS_ObjectIdFindByName(OS_OBJECT_TYPE_UNDEFINED, NULL, &objid);
     UtAssert_True(actual == expected, "OS_ObjectFindIdByName(%s) (%ld) == OS_ERR_NAME_NOT_FOUND", "NULL", (long)actual);
 
     /*
@@ -488,10 +489,14 @@ void Test_OS_ObjectIdFindByName(void)
     /*
      * Set up for the ObjectIdSearch function to return success
      */
+    memset(&token, 0, sizeof(token));
+    token.obj_type                     = OS_OBJECT_TYPE_OS_TASK;
     OS_global_task_table[0].active_id  = UT_OBJID_OTHER;
     OS_global_task_table[0].name_entry = TaskName;
+    OS_ObjectIdNameIndexInsert(&token, TaskName);
     actual                             = OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid);
     expected                           = OS_SUCCESS;
+    OS_ObjectIdNameIndexRemove(&token);
     OS_global_task_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
     OS_global_task_table[0].name_entry = NULL;
 
@@ -569,6 +574,54 @@ void Test_OS_ObjectIdGetById(void)
     memset(&OS_global_task_table[local_idx], 0, sizeof(OS_global_task_table[local_idx]));
 }
 
+void Test_OS_ObjectIdGetByIdFast(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_ObjectIdGetByIdFast(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token);
+     */
+    osal_id_t           refobjid;
+    osal_id_t           staleobjid;
+    osal_index_t        local_idx;
+    OS_common_record_t *rptr;
+    OS_object_token_t   token;
+
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000, &refobjid);
+    OS_ObjectIdToArrayIndex(OS_OBJECT_TYPE_OS_TASK, refobjid, &local_idx);
+    rptr            = &OS_global_task_table[local_idx];
+    rptr->active_id = refobjid;
+
+    /* Nominal, same result as OS_LOCK_MODE_NONE with no change to the record */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(OS_OBJECT_TYPE_OS_TASK, refobjid, &token), OS_SUCCESS);
+    UtAssert_UINT32_EQ(token.lock_mode, OS_LOCK_MODE_NONE);
+    UtAssert_UINT32_EQ(token.obj_type, OS_OBJECT_TYPE_OS_TASK);
+    UtAssert_UINT32_EQ(token.obj_idx, local_idx);
+    OSAPI_TEST_OBJID(token.obj_id, ==, refobjid);
+    UtAssert_UINT32_EQ(rptr->refcount, 0);
+
+    /* An ID for the same record but a different serial number (i.e. a previous object) must fail */
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1000 - OS_MAX_TASKS, &staleobjid);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(OS_OBJECT_TYPE_OS_TASK, staleobjid, &token), OS_ERR_INVALID_ID);
+
+    /* Wrong type of ID, and type with no objects */
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(OS_OBJECT_TYPE_OS_QUEUE, refobjid, &token), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(0xFFFF, refobjid, &token), OS_ERR_INVALID_ID);
+
+    /* Record being created or deleted */
+    rptr->active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(OS_OBJECT_TYPE_OS_TASK, refobjid, &token), OS_ERR_INVALID_ID);
+    rptr->active_id = refobjid;
+
+    /* Outside the normal running state, the regular path gives the error code */
+    OS_SharedGlobalVars.GlobalState = OS_SHUTDOWN_MAGIC_NUMBER;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdGetByIdFast(OS_OBJECT_TYPE_OS_TASK, refobjid, &token),
+                           OS_ERR_INCORRECT_OBJ_STATE);
+    OS_SharedGlobalVars.GlobalState = OS_INIT_MAGIC_NUMBER;
+
+    /* clear out state entry */
+    memset(rptr, 0, sizeof(*rptr));
+}
+
 void Test_OS_ObjectIdFindNextFree(void)
 {
     /*
@@ -722,6 +775,111 @@ void Test_OS_ObjectIdFindNextFree(void)
     OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindNextFree(&token2), OS_ERR_NOT_IMPLEMENTED);
 }
 
+void Test_OS_ObjectIdNameIndex(void)
+{
+    /*
+     * Test Case For:
+     * void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name);
+     * void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token);
+     * int32 OS_ObjectIdNameIndexFind(const char *name, OS_object_token_t *token);
+     * bool OS_ObjectIdNameIndexSupported(osal_objtype_t idtype);
+     */
+    char              TaskName[] = "UT_index";
+    OS_object_token_t token0;
+    OS_object_token_t token1;
+    OS_object_token_t search;
+    osal_id_t         objid;
+    osal_id_t         task_id;
+
+    UtAssert_BOOL_TRUE(OS_ObjectIdNameIndexSupported(OS_OBJECT_TYPE_OS_TASK));
+    UtAssert_BOOL_FALSE(OS_ObjectIdNameIndexSupported(OS_OBJECT_TYPE_OS_STREAM));
+    UtAssert_BOOL_FALSE(OS_ObjectIdNameIndexSupported(OS_OBJECT_TYPE_OS_DIR));
+    UtAssert_BOOL_FALSE(OS_ObjectIdNameIndexSupported(OS_OBJECT_TYPE_UNDEFINED));
+
+    /* Same string must always give the same hash */
+    UtAssert_UINT32_EQ(OS_ObjectIdNameHash(TaskName), OS_ObjectIdNameHash("UT_index"));
+
+    memset(&token0, 0, sizeof(token0));
+    token0.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    token0.obj_idx  = UT_INDEX_0;
+    token1          = token0;
+    token1.obj_idx  = UT_INDEX_1;
+
+    /* Two records with the same name, so both are in the same bucket */
+    OS_global_task_table[0].active_id  = UT_OBJID_1;
+    OS_global_task_table[0].name_entry = TaskName;
+    OS_global_task_table[1].active_id  = UT_OBJID_2;
+    OS_global_task_table[1].name_entry = TaskName;
+    OS_ObjectIdNameIndexInsert(&token0, TaskName);
+    OS_ObjectIdNameIndexInsert(&token1, TaskName);
+
+    /* The most recently inserted record is found first */
+    memset(&search, 0, sizeof(search));
+    search.obj_type = OS_OBJECT_TYPE_OS_TASK;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind(TaskName, &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, UT_INDEX_1);
+    OSAPI_TEST_OBJID(search.obj_id, ==, UT_OBJID_2);
+
+    /* Records that are not active are skipped */
+    OS_global_task_table[1].active_id = OS_OBJECT_ID_UNDEFINED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind(TaskName, &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, UT_INDEX_0);
+    OSAPI_TEST_OBJID(search.obj_id, ==, UT_OBJID_1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind("UT_notfound", &search), OS_ERR_NAME_NOT_FOUND);
+    OSAPI_TEST_OBJID(search.obj_id, ==, OS_OBJECT_ID_UNDEFINED);
+
+    /* Remove a record from the middle of the chain, then the head */
+    OS_global_task_table[1].active_id = UT_OBJID_2;
+    OS_ObjectIdNameIndexRemove(&token0);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind(TaskName, &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, UT_INDEX_1);
+    OS_ObjectIdNameIndexRemove(&token1);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind(TaskName, &search), OS_ERR_NAME_NOT_FOUND);
+
+    /* Removing a record that is not indexed is a no-op */
+    OS_ObjectIdNameIndexRemove(&token1);
+
+    /* Re-inserting a record under a new name unlinks it from the old name */
+    OS_ObjectIdNameIndexInsert(&token0, TaskName);
+    OS_global_task_table[0].name_entry = "UT_renamed";
+    OS_ObjectIdNameIndexInsert(&token0, "UT_renamed");
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind("UT_renamed", &search), OS_SUCCESS);
+    UtAssert_UINT32_EQ(search.obj_idx, UT_INDEX_0);
+    OS_ObjectIdNameIndexRemove(&token0);
+
+    /* Out of range index and unsupported type */
+    token0.obj_idx = OSAL_INDEX_C(OS_MAX_TASKS);
+    OS_ObjectIdNameIndexInsert(&token0, TaskName);
+    OS_ObjectIdNameIndexRemove(&token0);
+    search.obj_type = OS_OBJECT_TYPE_UNDEFINED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdNameIndexFind(TaskName, &search), OS_ERR_NAME_NOT_FOUND);
+
+    /*
+     * A record which is named after allocation is indexed when it is finalized,
+     * and is removed from the index when it is deleted.
+     */
+    OS_ObjectIdCompose_Impl(OS_OBJECT_TYPE_OS_TASK, 1, &task_id);
+    token1.obj_id                      = task_id;
+    token1.lock_mode                   = OS_LOCK_MODE_EXCLUSIVE;
+    OS_global_task_table[1].active_id  = OS_OBJECT_ID_RESERVED;
+    OS_global_task_table[1].name_entry = TaskName;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeNew(OS_SUCCESS, &token1, &objid), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, ==, task_id);
+
+    token1.lock_mode                  = OS_LOCK_MODE_EXCLUSIVE;
+    OS_global_task_table[1].active_id = OS_OBJECT_ID_RESERVED;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFinalizeDelete(OS_SUCCESS, &token1), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_TASK, TaskName, &objid), OS_ERR_NAME_NOT_FOUND);
+
+    /* Types which are not indexed use a linear search */
+    OS_global_stream_table[0].active_id  = UT_OBJID_OTHER;
+    OS_global_stream_table[0].name_entry = TaskName;
+    OSAPI_TEST_FUNCTION_RC(OS_ObjectIdFindByName(OS_OBJECT_TYPE_OS_STREAM, TaskName, &objid), OS_SUCCESS);
+    OS_global_stream_table[0].active_id  = OS_OBJECT_ID_UNDEFINED;
+    OS_global_stream_table[0].name_entry = NULL;
+}
+
 void Test_OS_ObjectIdAllocateNew(void)
 {
     /*
@@ -1037,7 +1195,8 @@ void Test_OS_ForEachObject(void)
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObject() TaskCount (%lu) == 1", (unsigned long)Count.TaskCount);
     UtAssert_True(Count.QueueCount == 1, "OS_ForEachObject() QueueCount (%lu) == 1", (unsigned long)Count.QueueCount);
     UtAssert_True(Count.MutexCount == 1, "OS_ForEachObject() MutexCount (%lu) == 1", (unsigned long)Count.MutexCount);
-    UtAssert_True(Count.OtherCount == 9, "OS_ForEachObject() OtherCount (%lu) == 9", (unsigned long)Count.OtherCount);
+    UtAssert_True(Count.OtherCount == 10, "OS_ForEachObject() OtherCount (%lu) == 10",
+                  (unsigned long)Count.OtherCount);
 
     OS_ForEachObjectOfType(OS_OBJECT_TYPE_OS_QUEUE, self_id.id, ObjTypeCounter, &Count);
     UtAssert_True(Count.TaskCount == 1, "OS_ForEachObjectOfType(), creator %08lx TaskCount (%lu) == 1",
@@ -1245,7 +1404,9 @@ void UtTest_Setup(void)
     ADD_TEST(OS_ObjectIdFindNextFree);
     ADD_TEST(OS_ObjectIdToArrayIndex);
     ADD_TEST(OS_ObjectIdFindByName);
+    ADD_TEST(OS_ObjectIdNameIndex);
     ADD_TEST(OS_ObjectIdGetById);
+    ADD_TEST(OS_ObjectIdGetByIdFast);
     ADD_TEST(OS_ObjectIdTransaction);
     ADD_TEST(OS_ObjectIdAllocateNew);
     ADD_TEST(OS_ObjectIdFinalize);
@@ -98,7 +98,7 @@ void Test_OS_MutSemGive(void)
      * but should generate a debug message */
     OSAPI_TEST_FUNCTION_RC(OS_MutSemGive(UT_OBJID_1), OS_SUCCESS);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_MutSemGive(UT_OBJID_1), OS_ERROR);
 }
 
@@ -124,7 +124,7 @@ void Test_OS_MutSemTake(void)
     UT_SetDefaultReturnValue(UT_KEY(OS_MutSemTake_Impl), OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_ERROR);
 
-    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetByIdFast), OS_ERR_INVALID_ID);
     OSAPI_TEST_FUNCTION_RC(OS_MutSemTake(UT_OBJID_1), OS_ERR_INVALID_ID);
 }
 
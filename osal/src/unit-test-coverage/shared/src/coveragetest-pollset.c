@@ -0,0 +1,207 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file     coveragetest-pollset.c
+ * \ingroup  shared
+ *
+ */
+#include "os-shared-coveragetest.h"
+#include "os-shared-pollset.h"
+
+#include "OCS_string.h"
+
+/*
+**********************************************************************************
+**          PUBLIC API FUNCTIONS
+**********************************************************************************
+*/
+
+void Test_OS_PollSetAPI_Init(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAPI_Init(void)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAPI_Init(), OS_SUCCESS);
+}
+
+void Test_OS_PollSetCreate(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name)
+     */
+    osal_id_t objid;
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT"), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, NULL), OS_INVALID_POINTER);
+    UT_SetDeferredRetcode(UT_KEY(OCS_memchr), 1, OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT"), OS_ERR_NAME_TOO_LONG);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdAllocateNew), OS_ERR_NO_FREE_IDS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetCreate(&objid, "UT"), OS_ERR_NO_FREE_IDS);
+}
+
+void Test_OS_PollSetDelete(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetDelete(osal_id_t pollset_id)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(UT_OBJID_1), OS_SUCCESS);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetDelete(UT_OBJID_1), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetAdd(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags)
+     */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_pollset_table[1].member_flags[2], OS_STREAM_STATE_READABLE);
+    OSAPI_TEST_OBJID(OS_pollset_table[1].member_id[2], ==, UT_OBJID_2);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, 0), OS_ERR_INVALID_ARGUMENT);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, 0x100), OS_ERR_INVALID_ARGUMENT);
+
+    /* An implementation failure must not record membership */
+    memset(OS_pollset_table, 0, sizeof(OS_pollset_table));
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetAdd_Impl), OS_ERR_OPERATION_NOT_SUPPORTED);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_WRITABLE),
+                           OS_ERR_OPERATION_NOT_SUPPORTED);
+    UtAssert_ZERO(OS_pollset_table[1].member_flags[2]);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_PollSetAdd_Impl));
+
+    /* Fail the stream lookup, then the poll set lookup */
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetAdd(UT_OBJID_1, UT_OBJID_2, OS_STREAM_STATE_READABLE), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetRemove(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid)
+     */
+
+    /* Not a member */
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    /* Slot in use by a different stream */
+    OS_pollset_table[1].member_flags[2] = OS_STREAM_STATE_READABLE;
+    OS_pollset_table[1].member_id[2]    = UT_OBJID_OTHER;
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+
+    OS_pollset_table[1].member_id[2] = UT_OBJID_2;
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetRemove_Impl), OS_ERROR);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERROR);
+    UtAssert_UINT32_EQ(OS_pollset_table[1].member_flags[2], OS_STREAM_STATE_READABLE);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_PollSetRemove_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_SUCCESS);
+    UtAssert_ZERO(OS_pollset_table[1].member_flags[2]);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdToArrayIndex));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetRemove(UT_OBJID_1, UT_OBJID_2), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetWait(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *events, uint32 max_events, int32 msecs)
+     */
+    OS_PollSetEvent_t events[2];
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_PollSetWait_Impl), 2);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, events, 2, 0), 2);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_PollSetWait_Impl));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, NULL, 2, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, events, 0, 0), OS_ERR_INVALID_SIZE);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdGetById), OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetWait(UT_OBJID_1, events, 2, 0), OS_ERR_INVALID_ID);
+}
+
+void Test_OS_PollSetGetIdByName(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name)
+     */
+    osal_id_t objid;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName), OS_SUCCESS);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, "UT"), OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UT_ClearDefaultReturnValue(UT_KEY(OS_ObjectIdFindByName));
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, "NF"), OS_ERR_NAME_NOT_FOUND);
+
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(NULL, "UT"), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_PollSetGetIdByName(&objid, NULL), OS_INVALID_POINTER);
+}
+
+/* Osapi_Test_Setup
+ *
+ * Purpose:
+ *   Called by the unit test tool to set up the app prior to each test
+ */
+void Osapi_Test_Setup(void)
+{
+    UT_ResetState(0);
+    memset(OS_pollset_table, 0, sizeof(OS_pollset_table));
+}
+
+/*
+ * Osapi_Test_Teardown
+ *
+ * Purpose:
+ *   Called by the unit test tool to tear down the app after each test
+ */
+void Osapi_Test_Teardown(void) {}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    ADD_TEST(OS_PollSetAPI_Init);
+    ADD_TEST(OS_PollSetCreate);
+    ADD_TEST(OS_PollSetDelete);
+    ADD_TEST(OS_PollSetAdd);
+    ADD_TEST(OS_PollSetRemove);
+    ADD_TEST(OS_PollSetWait);
+    ADD_TEST(OS_PollSetGetIdByName);
+}
@@ -409,6 +409,116 @@ void Test_OS_SocketSendTo(void)
     OSAPI_TEST_FUNCTION_RC(OS_SocketSendTo(UT_OBJID_1, &Buf, sizeof(Buf), &Addr), OS_ERR_INVALID_ID);
 }
 
+/*****************************************************************************
+ *
+ * Test case for OS_SocketRecvFromMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketRecvFromMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+     */
+    char          Buf[2];
+    OS_SockMsg_t  Msgs[2];
+    osal_index_t  idbuf;
+
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].Buffer = &Buf[0];
+    Msgs[0].BufLen = 1;
+    Msgs[1].Buffer = &Buf[1];
+    Msgs[1].BufLen = 1;
+
+    idbuf = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, NULL, 2, 0), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 0, 0), OS_ERR_INVALID_SIZE);
+
+    Msgs[1].Buffer = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_INVALID_POINTER);
+    Msgs[1].Buffer = &Buf[1];
+    Msgs[1].BufLen = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INVALID_SIZE);
+    Msgs[1].BufLen = 1;
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    /*
+     * Should fail if not bound
+     */
+    OS_stream_table[1].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[1].stream_state = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INCORRECT_OBJ_STATE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketRecvFromMulti(UT_OBJID_1, Msgs, 2, 0), OS_ERR_INVALID_ID);
+}
+
+/*****************************************************************************
+ *
+ * Test case for OS_SocketSendToMulti()
+ *
+ *****************************************************************************/
+void Test_OS_SocketSendToMulti(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count)
+     */
+    char          Buf[2] = {'A', 'B'};
+    OS_SockMsg_t  Msgs[2];
+    OS_SockAddr_t Addr;
+    osal_index_t  idbuf;
+
+    memset(&Addr, 0, sizeof(Addr));
+    memset(Msgs, 0, sizeof(Msgs));
+    Msgs[0].Buffer     = &Buf[0];
+    Msgs[0].BufLen     = 1;
+    Msgs[0].RemoteAddr = &Addr;
+    Msgs[1].Buffer     = &Buf[1];
+    Msgs[1].BufLen     = 1;
+    Msgs[1].RemoteAddr = &Addr;
+
+    idbuf = UT_INDEX_1;
+    OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_STREAM, idbuf);
+    OS_stream_table[idbuf].socket_type  = OS_SocketType_DATAGRAM;
+    OS_stream_table[idbuf].stream_state = OS_STREAM_STATE_BOUND;
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_SUCCESS);
+
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, NULL, 2), OS_INVALID_POINTER);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 0), OS_ERR_INVALID_SIZE);
+
+    Msgs[1].RemoteAddr = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_INVALID_POINTER);
+    Msgs[1].RemoteAddr = &Addr;
+    Msgs[1].Buffer     = NULL;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_INVALID_POINTER);
+    Msgs[1].Buffer = &Buf[1];
+    Msgs[1].BufLen = 0;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_ERR_INVALID_SIZE);
+    Msgs[1].BufLen = 1;
+
+    /*
+     * Should fail if not a datagram socket
+     */
+    OS_stream_table[1].socket_type = OS_SocketType_INVALID;
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_ERR_INCORRECT_OBJ_TYPE);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_SocketSendToMulti(UT_OBJID_1, Msgs, 2), OS_ERR_INVALID_ID);
+}
+
 /*****************************************************************************
  *
  * Test case for OS_SocketGetIdByName()
@@ -525,6 +635,8 @@ void UtTest_Setup(void)
     ADD_TEST(OS_SocketConnect);
     ADD_TEST(OS_SocketRecvFrom);
     ADD_TEST(OS_SocketSendTo);
+    ADD_TEST(OS_SocketRecvFromMulti);
+    ADD_TEST(OS_SocketSendToMulti);
     ADD_TEST(OS_SocketShutdown);
     ADD_TEST(OS_SocketGetIdByName);
     ADD_TEST(OS_SocketGetInfo);
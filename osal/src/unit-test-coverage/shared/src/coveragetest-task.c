@@ -132,6 +132,30 @@ void Test_OS_TaskCreate(void)
         OS_ERR_NO_FREE_IDS);
 }
 
+void Test_OS_TaskCreateWithAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskCreateWithAffinity(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
+     *                                 osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority,
+     *                                 uint32 flags, osal_cpumask_t cpu_mask)
+     */
+    osal_id_t objid;
+
+    memset(OS_task_table, 0, sizeof(OS_task_table));
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreateWithAffinity(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE,
+                                                     OSAL_SIZE_C(128), OSAL_PRIORITY_C(0), 0, OSAL_CPUMASK_C(0x6)),
+                           OS_SUCCESS);
+    OSAPI_TEST_OBJID(objid, !=, OS_OBJECT_ID_UNDEFINED);
+    UtAssert_UINT32_EQ(OS_task_table[1].cpu_mask, 0x6);
+
+    /* The plain create does not restrict the task */
+    OSAPI_TEST_FUNCTION_RC(
+        OS_TaskCreate(&objid, "UT", UT_TestHook, OSAL_TASK_STACK_ALLOCATE, OSAL_SIZE_C(128), OSAL_PRIORITY_C(0), 0),
+        OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_task_table[2].cpu_mask, OS_TASK_CPUMASK_ANY);
+}
+
 void Test_OS_TaskDelete(void)
 {
     /*
@@ -196,6 +220,24 @@ void Test_OS_TaskSetPriority(void)
     UT_SetDeferredRetcode(UT_KEY(OS_TaskSetPriority_Impl), 1, OS_ERROR);
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority(UT_OBJID_1, OSAL_PRIORITY_C(1)), OS_ERROR);
 }
+void Test_OS_TaskSetAffinity(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity(osal_id_t task_id, osal_cpumask_t cpu_mask)
+     */
+    memset(OS_task_table, 0, sizeof(OS_task_table));
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, OSAL_CPUMASK_C(0x2)), OS_SUCCESS);
+    UtAssert_UINT32_EQ(OS_task_table[1].cpu_mask, 0x2);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERR_INVALID_ID);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, OSAL_CPUMASK_C(0x4)), OS_ERR_INVALID_ID);
+
+    /* A failed change must not update the recorded mask */
+    UT_SetDeferredRetcode(UT_KEY(OS_TaskSetAffinity_Impl), 1, OS_ERR_NOT_IMPLEMENTED);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity(UT_OBJID_1, OSAL_CPUMASK_C(0x4)), OS_ERR_NOT_IMPLEMENTED);
+    UtAssert_UINT32_EQ(OS_task_table[1].cpu_mask, 0x2);
+}
 void Test_OS_TaskGetId(void)
 {
     /*
@@ -240,6 +282,7 @@ void Test_OS_TaskGetInfo(void)
     OS_UT_SetupBasicInfoTest(OS_OBJECT_TYPE_OS_TASK, UT_INDEX_1, "ABC", UT_OBJID_OTHER);
     OS_task_table[1].stack_size = OSAL_SIZE_C(222);
     OS_task_table[1].priority   = OSAL_PRIORITY_C(133);
+    OS_task_table[1].cpu_mask   = OSAL_CPUMASK_C(0x5);
 
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, &task_prop), OS_SUCCESS);
     OSAPI_TEST_OBJID(task_prop.creator, ==, UT_OBJID_OTHER);
@@ -247,6 +290,7 @@ void Test_OS_TaskGetInfo(void)
     UtAssert_True(task_prop.stack_size == 222, "task_prop.stack_size (%lu) == 222",
                   (unsigned long)task_prop.stack_size);
     UtAssert_True(task_prop.priority == 133, "task_prop.priority (%lu) == 133", (unsigned long)task_prop.priority);
+    UtAssert_UINT32_EQ(task_prop.cpu_mask, 0x5);
 
     /* Null name entry path */
     task_prop.name[0]                  = 0;
@@ -256,6 +300,7 @@ void Test_OS_TaskGetInfo(void)
 
     OS_task_table[1].stack_size = OSAL_SIZE_C(0);
     OS_task_table[1].priority   = OSAL_PRIORITY_C(0);
+    OS_task_table[1].cpu_mask   = OS_TASK_CPUMASK_ANY;
 
     OSAPI_TEST_FUNCTION_RC(OS_TaskGetInfo(UT_OBJID_1, NULL), OS_INVALID_POINTER);
 
@@ -341,10 +386,12 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskAPI_Init);
     ADD_TEST(OS_TaskEntryPoint);
     ADD_TEST(OS_TaskCreate);
+    ADD_TEST(OS_TaskCreateWithAffinity);
     ADD_TEST(OS_TaskDelete);
     ADD_TEST(OS_TaskExit);
     ADD_TEST(OS_TaskDelay);
     ADD_TEST(OS_TaskSetPriority);
+    ADD_TEST(OS_TaskSetAffinity);
     ADD_TEST(OS_TaskGetId);
     ADD_TEST(OS_TaskGetIdByName);
     ADD_TEST(OS_TaskGetInfo);
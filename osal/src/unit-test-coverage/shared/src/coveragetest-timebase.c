@@ -216,37 +216,119 @@ void Test_OS_TimeBaseGetFreeRun(void)
     OSAPI_TEST_FUNCTION_RC(OS_TimeBaseGetFreeRun(UT_OBJID_1, &freerun), OS_ERR_INVALID_ID);
 }
 
+void Test_OS_TimeBase_QueueCallback(void)
+{
+    /*
+     * Test Case For:
+     * void OS_TimeBase_QueueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+     * void OS_TimeBase_DequeueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+     * bool OS_TimeBase_GetNextExpiry(const OS_timebase_internal_record_t *timebase, int32 *wait_time)
+     */
+    static const int32             WaitTimes[] = {500, 100, 300, 0, 200, 400};
+    OS_timebase_internal_record_t *timebase;
+    osal_index_t                   i;
+    osal_index_t                   top;
+    int32                          prev_key;
+    int32                          key;
+
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
+    timebase = &OS_timebase_table[1];
+
+    /* Start close to the wrap of the free running time, so deadlines wrap */
+    timebase->freerun_time = 0xFFFFFF00;
+
+    key = -1;
+    UtAssert_BOOL_FALSE(OS_TimeBase_GetNextExpiry(timebase, &key));
+    UtAssert_INT32_EQ(key, -1);
+
+    for (i = 0; i < (sizeof(WaitTimes) / sizeof(WaitTimes[0])); ++i)
+    {
+        OS_timecb_table[i].wait_time     = WaitTimes[i];
+        OS_timecb_table[i].interval_time = 50;
+        OS_TimeBase_QueueCallback(timebase, i);
+    }
+
+    UtAssert_UINT32_EQ(timebase->queue_depth, 6);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 3);
+    UtAssert_UINT32_EQ(OS_timecb_table[3].deadline, 0xFFFFFF00);
+    UtAssert_UINT32_EQ(OS_timecb_table[0].deadline, 0x000001F4 - 0x100);
+
+    /* Removing the head makes the next earliest the head */
+    OS_TimeBase_DequeueCallback(timebase, 3);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 5);
+    UtAssert_UINT32_EQ(OS_timecb_table[3].queue_pos, 0);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 1);
+    UtAssert_BOOL_TRUE(OS_TimeBase_GetNextExpiry(timebase, &key));
+    UtAssert_INT32_EQ(key, 100);
+
+    /* Removing an entry that is not queued has no effect */
+    OS_TimeBase_DequeueCallback(timebase, 3);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 5);
+
+    /* Changing the wait time of a queued entry moves it */
+    OS_timecb_table[5].wait_time = 50;
+    OS_TimeBase_QueueCallback(timebase, 5);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 5);
+    UtAssert_UINT32_EQ(timebase->expiry_queue[0], 5);
+
+    /* A stopped timer is not queued, and is removed if it was */
+    OS_timecb_table[3].wait_time     = 0;
+    OS_timecb_table[3].interval_time = 0;
+    OS_TimeBase_QueueCallback(timebase, 3);
+    UtAssert_UINT32_EQ(OS_timecb_table[3].queue_pos, 0);
+    OS_timecb_table[2].wait_time     = 0;
+    OS_timecb_table[2].interval_time = 0;
+    OS_TimeBase_QueueCallback(timebase, 2);
+    UtAssert_UINT32_EQ(OS_timecb_table[2].queue_pos, 0);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 4);
+
+    /* Remaining entries come off the head in deadline order */
+    prev_key = INT32_MIN;
+    while (timebase->queue_depth > 0)
+    {
+        top = timebase->expiry_queue[0];
+        UtAssert_UINT32_EQ(OS_timecb_table[top].queue_pos, 1);
+        key = (int32)(OS_timecb_table[top].deadline - timebase->freerun_time);
+        UtAssert_True(key >= prev_key, "Deadline order: %ld >= %ld", (long)key, (long)prev_key);
+        prev_key = key;
+        OS_TimeBase_DequeueCallback(timebase, top);
+    }
+}
+
 void Test_OS_TimeBase_CallbackThread(void)
 {
     /*
      * Test Case For:
      * void OS_TimeBase_CallbackThread(uint32 timebase_id)
      */
-    OS_common_record_t *recptr;
-    OS_object_token_t   timecb_token;
-    OS_object_token_t   timecb_token2;
+    OS_common_record_t *           recptr;
+    OS_timebase_internal_record_t *timebase;
+
+    memset(OS_timebase_table, 0, sizeof(OS_timebase_table));
+    memset(OS_timecb_table, 0, sizeof(OS_timecb_table));
 
     recptr = &OS_global_timebase_table[2];
     memset(recptr, 0, sizeof(*recptr));
     recptr->active_id = UT_OBJID_2;
 
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_1, &timecb_token);
-    OS_timebase_table[2].external_sync = UT_TimerSync;
-    OS_timebase_table[2].first_cb      = timecb_token.obj_id;
-    OS_timecb_table[1].prev_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].next_cb         = timecb_token.obj_id;
-    OS_timecb_table[1].wait_time       = 2000;
-    OS_timecb_table[1].callback_ptr    = UT_TimeCB;
-    TimerSyncCount                     = 0;
-    TimerSyncRetVal                    = 0;
-    TimeCB                             = 0;
+    timebase                        = &OS_timebase_table[2];
+    timebase->external_sync         = UT_TimerSync;
+    OS_timecb_table[1].wait_time    = 2000;
+    OS_timecb_table[1].callback_ptr = UT_TimeCB;
+    OS_TimeBase_QueueCallback(timebase, 1);
+
+    TimerSyncCount  = 0;
+    TimerSyncRetVal = 0;
+    TimeCB          = 0;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
     UtAssert_True(TimerSyncCount == 11, "TimerSyncCount (%lu) == 11", (unsigned long)TimerSyncCount);
+    UtAssert_UINT32_EQ(TimeCB, 0);
 
-    /* No spin path, first timebase->first_cb token get will error */
+    /* No spin path, the one-shot timer expires once and is removed from the queue */
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
     TimerSyncCount    = 0;
     TimerSyncRetVal   = 1000;
@@ -256,27 +338,38 @@ void Test_OS_TimeBase_CallbackThread(void)
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
     /* Check that the TimeCB function was called */
-    UtAssert_True(TimeCB > 0, "TimeCB (%lu) > 0", (unsigned long)TimeCB);
+    UtAssert_UINT32_EQ(TimeCB, 1);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 0);
 
     /* Error on call to get timebase token */
     UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
 
-    /* Other paths for cb logic */
-    OS_ObjectIdGetById(OS_LOCK_MODE_NONE, OS_OBJECT_TYPE_OS_TIMECB, UT_OBJID_2, &timecb_token2);
-    OS_timecb_table[1].next_cb = timecb_token2.obj_id;
-    OS_timecb_table[2].next_cb = timecb_token.obj_id;
+    /*
+     * Periodic timers:
+     * Timer 1 has an interval shorter than the tick, so it hits the backlog limit every tick.
+     * Timer 2 starts with no wait time, so the first expiry does not give a callback, and
+     * after that it expires twice per tick.
+     */
+    OS_timecb_table[1].wait_time     = 1;
+    OS_timecb_table[1].interval_time = 1;
+    OS_timecb_table[1].callback_ptr  = NULL;
+    OS_TimeBase_QueueCallback(timebase, 1);
+    OS_timecb_table[2].wait_time     = 0;
+    OS_timecb_table[2].interval_time = 500;
+    OS_timecb_table[2].callback_ptr  = UT_TimeCB;
+    OS_TimeBase_QueueCallback(timebase, 2);
+
+    TimeCB = 0;
     UT_ResetState(UT_KEY(OS_TimeBaseLock_Impl));
     recptr->active_id = UT_OBJID_2;
     OS_UT_SetupTestTargetIndex(OS_OBJECT_TYPE_OS_TIMEBASE, UT_INDEX_2);
     UT_SetHookFunction(UT_KEY(OS_TimeBaseLock_Impl), ClearObjectsHook, recptr);
-    OS_timecb_table[1].interval_time = 1;
-    OS_timecb_table[1].callback_ptr  = NULL;
-
-    /* OS_UT_SetupTestTargetIndex sets the first OS_ObjectIdGetById return, so this sets the second and fourth */
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 1, OS_ERROR);
-    UT_SetDeferredRetcode(UT_KEY(OS_ObjectIdGetById), 2, OS_ERROR);
     OS_TimeBase_CallbackThread(UT_OBJID_2);
+
+    UtAssert_UINT32_EQ(OS_timecb_table[1].backlog_resets, 10);
+    UtAssert_UINT32_EQ(TimeCB, 18);
+    UtAssert_UINT32_EQ(timebase->queue_depth, 2);
 }
 
 void Test_OS_Milli2Ticks(void)
@@ -341,6 +434,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TimeBaseGetIdByName);
     ADD_TEST(OS_TimeBaseGetInfo);
     ADD_TEST(OS_TimeBaseGetFreeRun);
+    ADD_TEST(OS_TimeBase_QueueCallback);
     ADD_TEST(OS_TimeBase_CallbackThread);
     ADD_TEST(OS_Milli2Ticks);
 }
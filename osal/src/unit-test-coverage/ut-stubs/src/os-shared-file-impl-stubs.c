@@ -47,6 +47,24 @@ int32 OS_FileChmod_Impl(const char *local_path, uint32 access_mode)
     return UT_GenStub_GetReturnValue(OS_FileChmod_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap_Impl(const OS_object_token_t *token, const void **addr, size_t *size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileMap_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_FileMap_Impl, const void **, addr);
+    UT_GenStub_AddParam(OS_FileMap_Impl, size_t *, size);
+
+    UT_GenStub_Execute(OS_FileMap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpen_Impl()
@@ -116,6 +134,23 @@ int32 OS_FileStat_Impl(const char *local_path, os_fstat_t *filestat)
     return UT_GenStub_GetReturnValue(OS_FileStat_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap_Impl(const void *addr, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap_Impl, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, const void *, addr);
+    UT_GenStub_AddParam(OS_FileUnmap_Impl, size_t, size);
+
+    UT_GenStub_Execute(OS_FileUnmap_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_GenericClose_Impl()
@@ -304,6 +304,27 @@ void UT_DefaultHandler_OS_ObjectIdGetById(void *UserObj, UT_EntryKey_t FuncKey,
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_ObjectIdGetByIdFast' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_ObjectIdGetByIdFast(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_objtype_t     idtype = UT_Hook_GetArgValueByName(Context, "idtype", osal_objtype_t);
+    osal_id_t          id     = UT_Hook_GetArgValueByName(Context, "id", osal_id_t);
+    OS_object_token_t *token  = UT_Hook_GetArgValueByName(Context, "token", OS_object_token_t *);
+    int32              Status;
+
+    UT_Stub_GetInt32StatusCode(Context, &Status);
+
+    if (Status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_ObjectIdGetByIdFast), token, sizeof(*token)) < sizeof(*token))
+    {
+        UT_TokenCompose(OS_LOCK_MODE_NONE, OS_ObjectIdToInteger(id) & 0xFFFF, idtype, token);
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_ObjectIdTransferToken' stub
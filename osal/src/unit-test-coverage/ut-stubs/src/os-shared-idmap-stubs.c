@@ -34,6 +34,7 @@ extern void UT_DefaultHandler_OS_ObjectIdFinalizeDelete(void *, UT_EntryKey_t, c
 extern void UT_DefaultHandler_OS_ObjectIdFinalizeNew(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_ObjectIdFindByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_ObjectIdGetById(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_ObjectIdGetByIdFast(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_ObjectIdGetByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_ObjectIdGetBySearch(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_ObjectIdGlobalFromToken(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -245,6 +246,24 @@ int32 OS_ObjectIdGetById(OS_lock_mode_t lock_mode, osal_objtype_t idtype, osal_i
     return UT_GenStub_GetReturnValue(OS_ObjectIdGetById, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdGetByIdFast()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdGetByIdFast(osal_objtype_t idtype, osal_id_t id, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdGetByIdFast, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdFast, osal_objtype_t, idtype);
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdFast, osal_id_t, id);
+    UT_GenStub_AddParam(OS_ObjectIdGetByIdFast, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdGetByIdFast, Basic, UT_DefaultHandler_OS_ObjectIdGetByIdFast);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdGetByIdFast, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdGetByName()
@@ -397,6 +416,80 @@ int32 OS_ObjectIdIteratorProcessEntry(OS_object_iter_t *iter, OS_ObjectIdIterato
     return UT_GenStub_GetReturnValue(OS_ObjectIdIteratorProcessEntry, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameHash()
+ * ----------------------------------------------------
+ */
+uint32 OS_ObjectIdNameHash(const char *name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdNameHash, uint32);
+
+    UT_GenStub_AddParam(OS_ObjectIdNameHash, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdNameHash, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdNameHash, uint32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexFind()
+ * ----------------------------------------------------
+ */
+int32 OS_ObjectIdNameIndexFind(const char *name, OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdNameIndexFind, int32);
+
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexFind, const char *, name);
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexFind, OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexFind, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdNameIndexFind, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexInsert()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexInsert(const OS_object_token_t *token, const char *name)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexInsert, const char *, name);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexInsert, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexRemove()
+ * ----------------------------------------------------
+ */
+void OS_ObjectIdNameIndexRemove(const OS_object_token_t *token)
+{
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexRemove, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexRemove, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_ObjectIdNameIndexSupported()
+ * ----------------------------------------------------
+ */
+bool OS_ObjectIdNameIndexSupported(osal_objtype_t idtype)
+{
+    UT_GenStub_SetupReturnBuffer(OS_ObjectIdNameIndexSupported, bool);
+
+    UT_GenStub_AddParam(OS_ObjectIdNameIndexSupported, osal_objtype_t, idtype);
+
+    UT_GenStub_Execute(OS_ObjectIdNameIndexSupported, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_ObjectIdNameIndexSupported, bool);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_ObjectIdRelease()
@@ -0,0 +1,114 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in os-shared-pollset header
+ */
+
+#include "os-shared-pollset.h"
+#include "utgenstub.h"
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetAdd_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetAdd_Impl(const OS_object_token_t *token, const OS_object_token_t *stream_token, uint32 StateFlags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetAdd_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollSetAdd_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollSetAdd_Impl, const OS_object_token_t *, stream_token);
+    UT_GenStub_AddParam(OS_PollSetAdd_Impl, uint32, StateFlags);
+
+    UT_GenStub_Execute(OS_PollSetAdd_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetAdd_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetCreate_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetCreate_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetCreate_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollSetCreate_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_PollSetCreate_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetCreate_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetDelete_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetDelete_Impl(const OS_object_token_t *token)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetDelete_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollSetDelete_Impl, const OS_object_token_t *, token);
+
+    UT_GenStub_Execute(OS_PollSetDelete_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetDelete_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetRemove_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetRemove_Impl(const OS_object_token_t *token, osal_index_t stream_idx)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetRemove_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollSetRemove_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollSetRemove_Impl, osal_index_t, stream_idx);
+
+    UT_GenStub_Execute(OS_PollSetRemove_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetRemove_Impl, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetWait_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetWait_Impl(const OS_object_token_t *token, OS_PollSetEvent_t *events, uint32 max_events, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetWait_Impl, int32);
+
+    UT_GenStub_AddParam(OS_PollSetWait_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_PollSetWait_Impl, OS_PollSetEvent_t *, events);
+    UT_GenStub_AddParam(OS_PollSetWait_Impl, uint32, max_events);
+    UT_GenStub_AddParam(OS_PollSetWait_Impl, int32, msecs);
+
+    UT_GenStub_Execute(OS_PollSetWait_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetWait_Impl, int32);
+}
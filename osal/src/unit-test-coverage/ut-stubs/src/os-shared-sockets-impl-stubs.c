@@ -234,6 +234,25 @@ int32 OS_SocketRecvFrom_Impl(const OS_object_token_t *token, void *buffer, size_
     return UT_GenStub_GetReturnValue(OS_SocketRecvFrom_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, uint32, count);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti_Impl, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo_Impl()
@@ -254,6 +273,24 @@ int32 OS_SocketSendTo_Impl(const OS_object_token_t *token, const void *buffer, s
     return UT_GenStub_GetReturnValue(OS_SocketSendTo_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToMulti_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToMulti_Impl(const OS_object_token_t *token, OS_SockMsg_t *msgs, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToMulti_Impl, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketSendToMulti_Impl, uint32, count);
+
+    UT_GenStub_Execute(OS_SocketSendToMulti_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToMulti_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketShutdown_Impl()
@@ -184,6 +184,23 @@ int32 OS_TaskRegister_Impl(osal_id_t global_task_id)
     return UT_GenStub_GetReturnValue(OS_TaskRegister_Impl, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskSetAffinity_Impl()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskSetAffinity_Impl, int32);
+
+    UT_GenStub_AddParam(OS_TaskSetAffinity_Impl, const OS_object_token_t *, token);
+    UT_GenStub_AddParam(OS_TaskSetAffinity_Impl, osal_cpumask_t, cpu_mask);
+
+    UT_GenStub_Execute(OS_TaskSetAffinity_Impl, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskSetAffinity_Impl, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskSetPriority_Impl()
@@ -44,6 +44,49 @@ int32 OS_Milli2Ticks(uint32 milli_seconds, int *ticks)
     return UT_GenStub_GetReturnValue(OS_Milli2Ticks, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBase_DequeueCallback()
+ * ----------------------------------------------------
+ */
+void OS_TimeBase_DequeueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    UT_GenStub_AddParam(OS_TimeBase_DequeueCallback, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBase_DequeueCallback, osal_index_t, timecb_idx);
+
+    UT_GenStub_Execute(OS_TimeBase_DequeueCallback, Basic, NULL);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBase_GetNextExpiry()
+ * ----------------------------------------------------
+ */
+bool OS_TimeBase_GetNextExpiry(const OS_timebase_internal_record_t *timebase, int32 *wait_time)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TimeBase_GetNextExpiry, bool);
+
+    UT_GenStub_AddParam(OS_TimeBase_GetNextExpiry, const OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBase_GetNextExpiry, int32 *, wait_time);
+
+    UT_GenStub_Execute(OS_TimeBase_GetNextExpiry, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TimeBase_GetNextExpiry, bool);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TimeBase_QueueCallback()
+ * ----------------------------------------------------
+ */
+void OS_TimeBase_QueueCallback(OS_timebase_internal_record_t *timebase, osal_index_t timecb_idx)
+{
+    UT_GenStub_AddParam(OS_TimeBase_QueueCallback, OS_timebase_internal_record_t *, timebase);
+    UT_GenStub_AddParam(OS_TimeBase_QueueCallback, osal_index_t, timecb_idx);
+
+    UT_GenStub_Execute(OS_TimeBase_QueueCallback, Basic, NULL);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TimeBase_CallbackThread()
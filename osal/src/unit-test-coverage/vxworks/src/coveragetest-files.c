@@ -44,6 +44,30 @@ void Test_OS_VxWorks_StreamAPI_Impl_Init(void)
     OSAPI_TEST_FUNCTION_RC(UT_Call_OS_VxWorks_StreamAPI_Impl_Init(), OS_SUCCESS);
 }
 
+void Test_OS_FileMap_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileMap_Impl(const OS_object_token_t *token, const void **addr, size_t *size)
+     */
+    OS_object_token_t token = UT_TOKEN_0;
+    const void *      addr;
+    size_t            size;
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileMap_Impl(&token, &addr, &size), OS_ERR_NOT_IMPLEMENTED);
+}
+
+void Test_OS_FileUnmap_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_FileUnmap_Impl(const void *addr, size_t size)
+     */
+    char buffer[8] = {0};
+
+    OSAPI_TEST_FUNCTION_RC(OS_FileUnmap_Impl(buffer, sizeof(buffer)), OS_ERR_NOT_IMPLEMENTED);
+}
+
 /* ------------------- End of test cases --------------------------------------*/
 
 /* Osapi_Test_Setup
@@ -72,4 +96,6 @@ void Osapi_Test_Teardown(void) {}
 void UtTest_Setup(void)
 {
     ADD_TEST(OS_VxWorks_StreamAPI_Impl_Init);
+    ADD_TEST(OS_FileMap_Impl);
+    ADD_TEST(OS_FileUnmap_Impl);
 }
@@ -105,6 +105,12 @@ void Test_OS_TaskCreate_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskCreate_Impl(&token, OS_FP_ENABLED), OS_SUCCESS);
     UtAssert_True(UT_GetStubCount(UT_KEY(OCS_malloc)) == 3, "malloc() not called");
 
+    /* affinity is advisory - the task is still created if it cannot be applied */
+    OS_task_table[0].cpu_mask = OSAL_CPUMASK_C(0x1);
+    OSAPI_TEST_FUNCTION_RC(OS_TaskCreate_Impl(&token, OS_FP_ENABLED), OS_SUCCESS);
+    UtAssert_True(UT_GetStubCount(UT_KEY(OCS_taskActivate)) == 5, "taskActivate() called");
+    OS_task_table[0].cpu_mask = OS_TASK_CPUMASK_ANY;
+
     /* other failure modes */
     UT_SetDefaultReturnValue(UT_KEY(OCS_taskInit), -1);
     OSAPI_TEST_FUNCTION_RC(OS_TaskCreate_Impl(&token, 0), OS_ERROR);
@@ -190,6 +196,17 @@ void Test_OS_TaskSetPriority_Impl(void)
     OSAPI_TEST_FUNCTION_RC(OS_TaskSetPriority_Impl(&token, OSAL_PRIORITY_C(100)), OS_ERROR);
 }
 
+void Test_OS_TaskSetAffinity_Impl(void)
+{
+    /*
+     * Test Case For:
+     * int32 OS_TaskSetAffinity_Impl(const OS_object_token_t *token, osal_cpumask_t cpu_mask)
+     */
+    OS_object_token_t token = UT_TOKEN_0;
+
+    OSAPI_TEST_FUNCTION_RC(OS_TaskSetAffinity_Impl(&token, OSAL_CPUMASK_C(0x1)), OS_ERR_NOT_IMPLEMENTED);
+}
+
 void Test_OS_TaskRegister_Impl(void)
 {
     /*
@@ -316,6 +333,7 @@ void UtTest_Setup(void)
     ADD_TEST(OS_TaskExit_Impl);
     ADD_TEST(OS_TaskDelay_Impl);
     ADD_TEST(OS_TaskSetPriority_Impl);
+    ADD_TEST(OS_TaskSetAffinity_Impl);
     ADD_TEST(OS_TaskRegister_Impl);
     ADD_TEST(OS_TaskGetId_Impl);
     ADD_TEST(OS_TaskGetInfo_Impl);
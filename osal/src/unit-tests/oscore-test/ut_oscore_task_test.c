@@ -458,6 +458,41 @@ void UT_os_task_set_priority_test()
     }
 }
 
+/*--------------------------------------------------------------------------------*
+** Syntax: OS_TaskCreateWithAffinity, OS_TaskSetAffinity
+** Purpose: Creates a task restricted to a set of processors and changes the set
+** Parameters: To-be-filled-in
+** Returns: OS_ERR_INVALID_ID if the id passed in is not a valid task id
+**          OS_ERR_NOT_IMPLEMENTED if the OS does not support processor affinity
+**          OS_SUCCESS if succeeded
+**--------------------------------------------------------------------------------*/
+void UT_os_task_set_affinity_test()
+{
+    OS_task_prop_t task_prop;
+
+    /*-----------------------------------------------------*/
+    /* #1 Invalid-ID-arg */
+
+    UT_RETVAL(OS_TaskSetAffinity(UT_OBJID_INCORRECT, OSAL_CPUMASK_C(0x1)), OS_ERR_INVALID_ID);
+    UT_RETVAL(OS_TaskSetAffinity(OS_OBJECT_ID_UNDEFINED, OSAL_CPUMASK_C(0x1)), OS_ERR_INVALID_ID);
+
+    /*-----------------------------------------------------*/
+    /* #2 Nominal - processor 0 always exists */
+
+    if (UT_SETUP(OS_TaskCreateWithAffinity(&g_task_ids[2], g_task_names[2], generic_test_task,
+                                           OSAL_STACKPTR_C(&g_task_stacks[2]), sizeof(g_task_stacks[2]),
+                                           OSAL_PRIORITY_C(UT_TASK_PRIORITY), 0, OSAL_CPUMASK_C(0x1))))
+    {
+        UT_NOMINAL(OS_TaskGetInfo(g_task_ids[2], &task_prop));
+        UtAssert_UINT32_EQ(task_prop.cpu_mask, 0x1);
+
+        UT_NOMINAL_OR_NOTIMPL(OS_TaskSetAffinity(g_task_ids[2], OS_TASK_CPUMASK_ANY));
+
+        /* Reset test environment */
+        UT_TEARDOWN(OS_TaskDelete(g_task_ids[2]));
+    }
+}
+
 /*--------------------------------------------------------------------------------*/
 
 void getid_test_task(void)
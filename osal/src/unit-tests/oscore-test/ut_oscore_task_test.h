@@ -61,6 +61,7 @@ void UT_os_task_delete_test(void);
 void UT_os_task_install_delete_handler_test(void);
 void UT_os_task_exit_test(void);
 void UT_os_task_set_priority_test(void);
+void UT_os_task_set_affinity_test(void);
 void UT_os_task_register_test(void);
 void UT_os_task_get_id(void);
 void UT_os_task_get_id_by_name_test(void);
@@ -184,6 +184,42 @@ void UT_DefaultHandler_OS_TimedWrite(void *UserObj, UT_EntryKey_t FuncKey, const
     UT_GenericWriteStub(FuncKey, Context);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_FileMap' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_FileMap(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    const void **addr = UT_Hook_GetArgValueByName(Context, "addr", const void **);
+    size_t *     size = UT_Hook_GetArgValueByName(Context, "size", size_t *);
+    void *       DataBuffer;
+    size_t       DataSize;
+    int32        status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        /*
+         * The test case supplies the file contents as the data buffer.
+         * Without one, report the call as unsupported so that callers
+         * take their OS_read() fallback path.
+         */
+        UT_GetDataBuffer(FuncKey, &DataBuffer, &DataSize, NULL);
+        if (DataBuffer != NULL && DataSize > 0)
+        {
+            *addr = DataBuffer;
+            *size = DataSize;
+        }
+        else
+        {
+            status = OS_ERR_NOT_IMPLEMENTED;
+            UT_Stub_SetReturnValue(FuncKey, status);
+        }
+    }
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_stat' stub
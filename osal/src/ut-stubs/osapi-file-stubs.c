@@ -28,6 +28,7 @@
 #include "utgenstub.h"
 
 extern void UT_DefaultHandler_OS_FDGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_FileMap(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_OpenCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_TimedRead(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_TimedWrite(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -84,6 +85,24 @@ int32 OS_FDGetInfo(osal_id_t filedes, OS_file_prop_t *fd_prop)
     return UT_GenStub_GetReturnValue(OS_FDGetInfo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileMap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileMap(osal_id_t filedes, const void **addr, size_t *size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileMap, int32);
+
+    UT_GenStub_AddParam(OS_FileMap, osal_id_t, filedes);
+    UT_GenStub_AddParam(OS_FileMap, const void **, addr);
+    UT_GenStub_AddParam(OS_FileMap, size_t *, size);
+
+    UT_GenStub_Execute(OS_FileMap, Basic, UT_DefaultHandler_OS_FileMap);
+
+    return UT_GenStub_GetReturnValue(OS_FileMap, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_FileOpenCheck()
@@ -100,6 +119,23 @@ int32 OS_FileOpenCheck(const char *Filename)
     return UT_GenStub_GetReturnValue(OS_FileOpenCheck, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_FileUnmap()
+ * ----------------------------------------------------
+ */
+int32 OS_FileUnmap(const void *addr, size_t size)
+{
+    UT_GenStub_SetupReturnBuffer(OS_FileUnmap, int32);
+
+    UT_GenStub_AddParam(OS_FileUnmap, const void *, addr);
+    UT_GenStub_AddParam(OS_FileUnmap, size_t, size);
+
+    UT_GenStub_Execute(OS_FileUnmap, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_FileUnmap, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_OpenCreate()
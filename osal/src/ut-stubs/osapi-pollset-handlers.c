@@ -0,0 +1,120 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * \file
+ *
+ *
+ * Stub implementations for the functions defined in the OSAL API
+ *
+ * The stub implementation can be used for unit testing applications built
+ * on top of OSAL.  The stubs do not do any real function, but allow
+ * the return code to be crafted such that error paths in the application
+ * can be executed.
+ */
+
+#include "osapi-pollset.h" /* OSAL public API for this subsystem */
+#include "utstub-helpers.h"
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetCreate' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetCreate(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        *pollset_id = UT_AllocStubObjId(OS_OBJECT_TYPE_OS_POLLSET);
+    }
+    else
+    {
+        *pollset_id = UT_STUB_FAKE_OBJECT_ID;
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetDelete' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetDelete(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t);
+    int32     status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS)
+    {
+        UT_DeleteStubObjId(OS_OBJECT_TYPE_OS_POLLSET, pollset_id);
+    }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetWait' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetWait(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_PollSetEvent_t *events     = UT_Hook_GetArgValueByName(Context, "events", OS_PollSetEvent_t *);
+    uint32             max_events = UT_Hook_GetArgValueByName(Context, "max_events", uint32);
+    int32              status;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /*
+         * The user may supply specific events to return, otherwise
+         * nothing becomes ready and the wait times out.
+         */
+        status = UT_Stub_CopyToLocal(FuncKey, events, sizeof(*events) * max_events) / sizeof(*events);
+        if (status == 0)
+        {
+            status = OS_ERROR_TIMEOUT;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_PollSetGetIdByName' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_PollSetGetIdByName(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    osal_id_t *pollset_id = UT_Hook_GetArgValueByName(Context, "pollset_id", osal_id_t *);
+    int32      status;
+
+    UT_Stub_GetInt32StatusCode(Context, &status);
+
+    if (status == OS_SUCCESS &&
+        UT_Stub_CopyToLocal(UT_KEY(OS_PollSetGetIdByName), pollset_id, sizeof(*pollset_id)) < sizeof(*pollset_id))
+    {
+        UT_ObjIdCompose(1, OS_OBJECT_TYPE_OS_POLLSET, pollset_id);
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ *  NASA Docket No. GSC-18,370-1, and identified as "Operating System Abstraction Layer"
+ *
+ *  Copyright (c) 2019 United States Government as represented by
+ *  the Administrator of the National Aeronautics and Space Administration.
+ *  All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/**
+ * @file
+ *
+ * Auto-Generated stub implementations for functions defined in osapi-pollset header
+ */
+
+#include "osapi-pollset.h"
+#include "utgenstub.h"
+
+extern void UT_DefaultHandler_OS_PollSetCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_PollSetDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_PollSetGetIdByName(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_PollSetWait(void *, UT_EntryKey_t, const UT_StubContext_t *);
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetAdd()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetAdd(osal_id_t pollset_id, osal_id_t objid, uint32 StateFlags)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetAdd, int32);
+
+    UT_GenStub_AddParam(OS_PollSetAdd, osal_id_t, pollset_id);
+    UT_GenStub_AddParam(OS_PollSetAdd, osal_id_t, objid);
+    UT_GenStub_AddParam(OS_PollSetAdd, uint32, StateFlags);
+
+    UT_GenStub_Execute(OS_PollSetAdd, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetAdd, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetCreate()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetCreate(osal_id_t *pollset_id, const char *pollset_name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetCreate, int32);
+
+    UT_GenStub_AddParam(OS_PollSetCreate, osal_id_t *, pollset_id);
+    UT_GenStub_AddParam(OS_PollSetCreate, const char *, pollset_name);
+
+    UT_GenStub_Execute(OS_PollSetCreate, Basic, UT_DefaultHandler_OS_PollSetCreate);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetCreate, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetDelete()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetDelete(osal_id_t pollset_id)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetDelete, int32);
+
+    UT_GenStub_AddParam(OS_PollSetDelete, osal_id_t, pollset_id);
+
+    UT_GenStub_Execute(OS_PollSetDelete, Basic, UT_DefaultHandler_OS_PollSetDelete);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetDelete, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetGetIdByName()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetGetIdByName(osal_id_t *pollset_id, const char *pollset_name)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetGetIdByName, int32);
+
+    UT_GenStub_AddParam(OS_PollSetGetIdByName, osal_id_t *, pollset_id);
+    UT_GenStub_AddParam(OS_PollSetGetIdByName, const char *, pollset_name);
+
+    UT_GenStub_Execute(OS_PollSetGetIdByName, Basic, UT_DefaultHandler_OS_PollSetGetIdByName);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetGetIdByName, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetRemove()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetRemove(osal_id_t pollset_id, osal_id_t objid)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetRemove, int32);
+
+    UT_GenStub_AddParam(OS_PollSetRemove, osal_id_t, pollset_id);
+    UT_GenStub_AddParam(OS_PollSetRemove, osal_id_t, objid);
+
+    UT_GenStub_Execute(OS_PollSetRemove, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetRemove, int32);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_PollSetWait()
+ * ----------------------------------------------------
+ */
+int32 OS_PollSetWait(osal_id_t pollset_id, OS_PollSetEvent_t *events, uint32 max_events, int32 msecs)
+{
+    UT_GenStub_SetupReturnBuffer(OS_PollSetWait, int32);
+
+    UT_GenStub_AddParam(OS_PollSetWait, osal_id_t, pollset_id);
+    UT_GenStub_AddParam(OS_PollSetWait, OS_PollSetEvent_t *, events);
+    UT_GenStub_AddParam(OS_PollSetWait, uint32, max_events);
+    UT_GenStub_AddParam(OS_PollSetWait, int32, msecs);
+
+    UT_GenStub_Execute(OS_PollSetWait, Basic, UT_DefaultHandler_OS_PollSetWait);
+
+    return UT_GenStub_GetReturnValue(OS_PollSetWait, int32);
+}
@@ -120,6 +120,72 @@ void UT_DefaultHandler_OS_SocketSendTo(void *UserObj, UT_EntryKey_t FuncKey, con
     UT_Stub_SetReturnValue(FuncKey, status);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketRecvFromMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketRecvFromMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_SockMsg_t *msgs  = UT_Hook_GetArgValueByName(Context, "msgs", OS_SockMsg_t *);
+    uint32        count = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    int32         status;
+    uint32        i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* By default deliver a single message, using the data buffer if one was supplied */
+        msgs[0].ActualLength = UT_Stub_CopyToLocal(UT_KEY(OS_SocketRecvFromMulti), msgs[0].Buffer, msgs[0].BufLen);
+        if (msgs[0].ActualLength == 0)
+        {
+            memset(msgs[0].Buffer, 0, msgs[0].BufLen);
+            msgs[0].ActualLength = msgs[0].BufLen;
+        }
+        status = 1;
+    }
+    else if (status > 0)
+    {
+        /* generate fill data for requested number of messages */
+        if (status > (int32)count)
+        {
+            status = count;
+        }
+        for (i = 0; (int32)i < status; ++i)
+        {
+            memset(msgs[i].Buffer, 0, msgs[i].BufLen);
+            msgs[i].ActualLength = msgs[i].BufLen;
+        }
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_SocketSendToMulti' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_SocketSendToMulti(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context)
+{
+    OS_SockMsg_t *msgs  = UT_Hook_GetArgValueByName(Context, "msgs", OS_SockMsg_t *);
+    uint32        count = UT_Hook_GetArgValueByName(Context, "count", uint32);
+    int32         status;
+    uint32        i;
+
+    if (!UT_Stub_GetInt32StatusCode(Context, &status))
+    {
+        /* pretend every message was written */
+        status = count;
+    }
+
+    for (i = 0; i < count && (int32)i < status; ++i)
+    {
+        msgs[i].ActualLength = msgs[i].BufLen;
+    }
+
+    UT_Stub_SetReturnValue(FuncKey, status);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_SocketGetIdByName' stub
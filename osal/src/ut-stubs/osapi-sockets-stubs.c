@@ -35,7 +35,9 @@ extern void UT_DefaultHandler_OS_SocketGetIdByName(void *, UT_EntryKey_t, const
 extern void UT_DefaultHandler_OS_SocketGetInfo(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketOpen(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketRecvFrom(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_SocketRecvFromMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_SocketSendTo(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_SocketSendToMulti(void *, UT_EntryKey_t, const UT_StubContext_t *);
 
 /*
  * ----------------------------------------------------
@@ -249,6 +251,25 @@ int32 OS_SocketRecvFrom(osal_id_t sock_id, void *buffer, size_t buflen, OS_SockA
     return UT_GenStub_GetReturnValue(OS_SocketRecvFrom, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketRecvFromMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketRecvFromMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count, int32 timeout)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketRecvFromMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, uint32, count);
+    UT_GenStub_AddParam(OS_SocketRecvFromMulti, int32, timeout);
+
+    UT_GenStub_Execute(OS_SocketRecvFromMulti, Basic, UT_DefaultHandler_OS_SocketRecvFromMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketRecvFromMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketSendTo()
@@ -268,6 +289,24 @@ int32 OS_SocketSendTo(osal_id_t sock_id, const void *buffer, size_t buflen, cons
     return UT_GenStub_GetReturnValue(OS_SocketSendTo, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_SocketSendToMulti()
+ * ----------------------------------------------------
+ */
+int32 OS_SocketSendToMulti(osal_id_t sock_id, OS_SockMsg_t *msgs, uint32 count)
+{
+    UT_GenStub_SetupReturnBuffer(OS_SocketSendToMulti, int32);
+
+    UT_GenStub_AddParam(OS_SocketSendToMulti, osal_id_t, sock_id);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, OS_SockMsg_t *, msgs);
+    UT_GenStub_AddParam(OS_SocketSendToMulti, uint32, count);
+
+    UT_GenStub_Execute(OS_SocketSendToMulti, Basic, UT_DefaultHandler_OS_SocketSendToMulti);
+
+    return UT_GenStub_GetReturnValue(OS_SocketSendToMulti, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_SocketShutdown()
@@ -55,6 +55,17 @@ void UT_DefaultHandler_OS_TaskCreate(void *UserObj, UT_EntryKey_t FuncKey, const
     }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Default handler implementation for 'OS_TaskCreateWithAffinity' stub
+ * -----------------------------------------------------------------
+ */
+void UT_DefaultHandler_OS_TaskCreateWithAffinity(void *UserObj, UT_EntryKey_t FuncKey,
+                                                 const UT_StubContext_t *Context)
+{
+    UT_DefaultHandler_OS_TaskCreate(UserObj, FuncKey, Context);
+}
+
 /*
  * -----------------------------------------------------------------
  * Default handler implementation for 'OS_TaskDelete' stub
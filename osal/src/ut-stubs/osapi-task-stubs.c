@@ -28,6 +28,7 @@
 #include "utgenstub.h"
 
 extern void UT_DefaultHandler_OS_TaskCreate(void *, UT_EntryKey_t, const UT_StubContext_t *);
+extern void UT_DefaultHandler_OS_TaskCreateWithAffinity(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_TaskDelete(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_TaskFindIdBySystemData(void *, UT_EntryKey_t, const UT_StubContext_t *);
 extern void UT_DefaultHandler_OS_TaskGetId(void *, UT_EntryKey_t, const UT_StubContext_t *);
@@ -57,6 +58,31 @@ int32 OS_TaskCreate(osal_id_t *task_id, const char *task_name, osal_task_entry f
     return UT_GenStub_GetReturnValue(OS_TaskCreate, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskCreateWithAffinity()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskCreateWithAffinity(osal_id_t *task_id, const char *task_name, osal_task_entry function_pointer,
+                                osal_stackptr_t stack_pointer, size_t stack_size, osal_priority_t priority,
+                                uint32 flags, osal_cpumask_t cpu_mask)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskCreateWithAffinity, int32);
+
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, osal_id_t *, task_id);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, const char *, task_name);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, osal_task_entry, function_pointer);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, osal_stackptr_t, stack_pointer);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, size_t, stack_size);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, osal_priority_t, priority);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, uint32, flags);
+    UT_GenStub_AddParam(OS_TaskCreateWithAffinity, osal_cpumask_t, cpu_mask);
+
+    UT_GenStub_Execute(OS_TaskCreateWithAffinity, Basic, UT_DefaultHandler_OS_TaskCreateWithAffinity);
+
+    return UT_GenStub_GetReturnValue(OS_TaskCreateWithAffinity, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskDelay()
@@ -182,6 +208,23 @@ int32 OS_TaskInstallDeleteHandler(osal_task_entry function_pointer)
     return UT_GenStub_GetReturnValue(OS_TaskInstallDeleteHandler, int32);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for OS_TaskSetAffinity()
+ * ----------------------------------------------------
+ */
+int32 OS_TaskSetAffinity(osal_id_t task_id, osal_cpumask_t cpu_mask)
+{
+    UT_GenStub_SetupReturnBuffer(OS_TaskSetAffinity, int32);
+
+    UT_GenStub_AddParam(OS_TaskSetAffinity, osal_id_t, task_id);
+    UT_GenStub_AddParam(OS_TaskSetAffinity, osal_cpumask_t, cpu_mask);
+
+    UT_GenStub_Execute(OS_TaskSetAffinity, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(OS_TaskSetAffinity, int32);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for OS_TaskSetPriority()
@@ -44,7 +44,8 @@ const uint32 UT_MAXOBJS[OS_OBJECT_TYPE_USER] = {[OS_OBJECT_TYPE_OS_TASK]     = O
                                                 [OS_OBJECT_TYPE_OS_STREAM]   = OS_MAX_NUM_OPEN_FILES,
                                                 [OS_OBJECT_TYPE_OS_TIMEBASE] = OS_MAX_TIMEBASES,
                                                 [OS_OBJECT_TYPE_OS_FILESYS]  = OS_MAX_FILE_SYSTEMS,
-                                                [OS_OBJECT_TYPE_OS_DIR]      = OS_MAX_NUM_OPEN_DIRS};
+                                                [OS_OBJECT_TYPE_OS_DIR]      = OS_MAX_NUM_OPEN_DIRS,
+                                                [OS_OBJECT_TYPE_OS_POLLSET]  = OS_MAX_POLLSETS};
 
 static UT_ObjTypeState_t UT_ObjState[OS_OBJECT_TYPE_USER];
 
@@ -0,0 +1,121 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_evs_format.h
+ * \ingroup  fsw
+ *
+ * Ground-side expansion of CFE EVS binary format event messages.
+ *
+ * In binary format mode, CFE EVS does not send the event message text.
+ * Instead it sends the CRC-32 of the format string (the format ID) and the
+ * arguments packed as described for the CFE_EVS/BinaryEventTlm_Payload
+ * type.  The build generates a catalog of all event format strings found
+ * in the mission source code, and this API uses it to rebuild the text.
+ *
+ * The catalog is a text file with one entry per line: the format ID as
+ * 8 hexadecimal digits, a tab, and the format string with C escapes for
+ * backslashes and non-printable characters.  Lines starting with '#' are
+ * comments.
+ */
+
+#ifndef _CFE_MISSIONLIB_EVS_FORMAT_H_
+#define _CFE_MISSIONLIB_EVS_FORMAT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/******************************
+ * TYPEDEFS
+ ******************************/
+
+typedef struct CFE_MissionLib_EventCatalog CFE_MissionLib_EventCatalog_t;
+
+/******************************
+ * API CALLS
+ ******************************/
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * Loads an event format catalog file
+     *
+     * @param CatalogOut set to the loaded catalog on success, which must be freed
+     *                   by CFE_MissionLib_EventCatalog_Free()
+     * @param Filename   the catalog file
+     * @returns CFE_MISSIONLIB_SUCCESS, or CFE_MISSIONLIB_FAILURE if the file cannot be read
+     */
+    int32_t CFE_MissionLib_EventCatalog_Load(CFE_MissionLib_EventCatalog_t **CatalogOut, const char *Filename);
+
+    /**
+     * Frees a catalog returned by CFE_MissionLib_EventCatalog_Load()
+     */
+    void CFE_MissionLib_EventCatalog_Free(CFE_MissionLib_EventCatalog_t *Catalog);
+
+    /**
+     * Gets the number of formats in the catalog
+     */
+    uint32_t CFE_MissionLib_EventCatalog_GetCount(const CFE_MissionLib_EventCatalog_t *Catalog);
+
+    /**
+     * Gets a catalog entry by index, in ascending format ID order
+     *
+     * @returns the format string, or NULL if the index is out of range
+     */
+    const char *CFE_MissionLib_EventCatalog_GetEntry(const CFE_MissionLib_EventCatalog_t *Catalog, uint32_t Index,
+                                                     uint32_t *FormatIdOut);
+
+    /**
+     * Finds the format string for a format ID
+     *
+     * @returns the format string, or NULL if the ID is not in the catalog
+     */
+    const char *CFE_MissionLib_EventCatalog_Lookup(const CFE_MissionLib_EventCatalog_t *Catalog, uint32_t FormatId);
+
+    /**
+     * Computes the format ID of a format string, as CFE EVS does
+     */
+    uint32_t CFE_MissionLib_EventFormatId(const char *Format);
+
+    /**
+     * Expands a binary format event message
+     *
+     * Behaves like snprintf(): the output is always terminated and the return
+     * value is the full length of the expanded message.
+     *
+     * @param Buffer    output buffer
+     * @param BufSize   size of the output buffer
+     * @param Format    the event format string
+     * @param Args      the packed arguments from the event message
+     * @param ArgLength number of bytes in Args
+     * @returns the full length of the expanded message, or negative if the arguments
+     *          do not match the format string
+     */
+    int CFE_MissionLib_FormatBinaryEvent(char *Buffer, size_t BufSize, const char *Format, const void *Args,
+                                         size_t ArgLength);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* _CFE_MISSIONLIB_EVS_FORMAT_H_ */
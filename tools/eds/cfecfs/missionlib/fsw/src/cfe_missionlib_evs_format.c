@@ -0,0 +1,656 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * \file     cfe_missionlib_evs_format.c
+ * \ingroup  fsw
+ *
+ * Ground-side expansion of CFE EVS binary format event messages.
+ *
+ * The packed arguments carry no type information, the layout of each one
+ * follows from the conversion specification it belongs to, so this walks
+ * the format string the same way CFE EVS did when packing.  Each conversion
+ * is then printed with snprintf(), using the widest host type of the same
+ * class so the result does not depend on the host integer sizes.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+
+#include "cfe_missionlib_api.h"
+#include "cfe_missionlib_evs_format.h"
+#include "crc_engine.h"
+
+/*
+ * Longest conversion specification CFE EVS packs, and the size of the
+ * buffer used to rebuild one for the host.
+ */
+#define CFE_MISSIONLIB_EVS_MAX_CONV_LENGTH 24
+#define CFE_MISSIONLIB_EVS_SUBSPEC_SIZE    64
+
+typedef enum
+{
+    CFE_MISSIONLIB_EVS_ARG_INVALID = 0,
+    CFE_MISSIONLIB_EVS_ARG_PERCENT,
+    CFE_MISSIONLIB_EVS_ARG_SIGNED,
+    CFE_MISSIONLIB_EVS_ARG_UNSIGNED,
+    CFE_MISSIONLIB_EVS_ARG_DOUBLE,
+    CFE_MISSIONLIB_EVS_ARG_STRING,
+    CFE_MISSIONLIB_EVS_ARG_POINTER
+} CFE_MissionLib_EvsArgClass_t;
+
+typedef struct
+{
+    CFE_MissionLib_EvsArgClass_t ArgClass;
+    size_t                       IntSize;     /* packed size of an integer argument */
+    int                          StarWidth;
+    int                          StarPrecision;
+    size_t                       FlagsEnd;     /* offsets from the '%', as in CFE EVS */
+    size_t                       WidthEnd;
+    size_t                       PrecisionEnd;
+    size_t                       SpecLength;
+} CFE_MissionLib_EvsConv_t;
+
+typedef struct
+{
+    uint32_t FormatId;
+    char *   Format;
+} CFE_MissionLib_EventCatalogEntry_t;
+
+struct CFE_MissionLib_EventCatalog
+{
+    uint32_t                            NumEntries;
+    CFE_MissionLib_EventCatalogEntry_t *Entries;
+};
+
+/*
+ * ***********************************************************************
+ *  HELPER FUNCTIONS (static, internal only)
+ * ***********************************************************************
+ */
+
+/*
+ * Parses the conversion specification starting at the '%' character at Spec.
+ * This must accept exactly what CFE EVS accepts when packing arguments.
+ */
+static void CFE_MissionLib_EvsParseConv(const char *Spec, CFE_MissionLib_EvsConv_t *Conv)
+{
+    size_t Pos = 1;
+    char   Length[3];
+
+    memset(Conv, 0, sizeof(*Conv));
+    memset(Length, 0, sizeof(Length));
+
+    while (Spec[Pos] != 0 && strchr("-+ #0'", Spec[Pos]) != NULL)
+    {
+        ++Pos;
+    }
+    Conv->FlagsEnd = Pos;
+
+    if (Spec[Pos] == '*')
+    {
+        Conv->StarWidth = 1;
+        ++Pos;
+    }
+    else
+    {
+        while (isdigit((unsigned char)Spec[Pos]))
+        {
+            ++Pos;
+        }
+
+        if (Spec[Pos] == '$')
+        {
+            return;
+        }
+    }
+    Conv->WidthEnd = Pos;
+
+    if (Spec[Pos] == '.')
+    {
+        ++Pos;
+        if (Spec[Pos] == '*')
+        {
+            Conv->StarPrecision = 1;
+            ++Pos;
+        }
+        else
+        {
+            while (isdigit((unsigned char)Spec[Pos]))
+            {
+                ++Pos;
+            }
+        }
+    }
+    Conv->PrecisionEnd = Pos;
+
+    if (strchr("hljzt", Spec[Pos]) != NULL && Spec[Pos] != 0)
+    {
+        Length[0] = Spec[Pos];
+        ++Pos;
+        if ((Length[0] == 'h' || Length[0] == 'l') && Spec[Pos] == Length[0])
+        {
+            Length[1] = Spec[Pos];
+            ++Pos;
+        }
+    }
+
+    /* Integers are packed at the width the conversion prints */
+    if (Length[0] == 0)
+    {
+        Conv->IntSize = 4;
+    }
+    else if (Length[0] == 'h')
+    {
+        Conv->IntSize = (Length[1] == 'h') ? 1 : 2;
+    }
+    else
+    {
+        Conv->IntSize = 8;
+    }
+
+    switch (Spec[Pos])
+    {
+        case 'd':
+        case 'i':
+            Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_SIGNED;
+            break;
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+            Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_UNSIGNED;
+            break;
+        case 'c':
+            if (Length[0] == 0)
+            {
+                Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_SIGNED;
+            }
+            break;
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (Length[0] == 0 || (Length[0] == 'l' && Length[1] == 0))
+            {
+                Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_DOUBLE;
+            }
+            break;
+        case 's':
+            if (Length[0] == 0)
+            {
+                Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_STRING;
+            }
+            break;
+        case 'p':
+            if (Length[0] == 0)
+            {
+                Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_POINTER;
+            }
+            break;
+        case '%':
+            if (Pos == 1)
+            {
+                Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_PERCENT;
+            }
+            break;
+        default:
+            break;
+    }
+
+    Conv->SpecLength = Pos + 1;
+    if (Conv->SpecLength > CFE_MISSIONLIB_EVS_MAX_CONV_LENGTH)
+    {
+        Conv->ArgClass = CFE_MISSIONLIB_EVS_ARG_INVALID;
+    }
+}
+
+/*
+ * Reads the next big endian value from the packed arguments
+ */
+static int CFE_MissionLib_EvsGetValue(const uint8_t *Args, size_t ArgLength, size_t *Pos, size_t Size,
+                                      uint64_t *Value)
+{
+    if (Size > (ArgLength - *Pos))
+    {
+        return 0;
+    }
+
+    *Value = 0;
+    while (Size > 0)
+    {
+        *Value = (*Value << 8) | Args[*Pos];
+        ++(*Pos);
+        --Size;
+    }
+
+    return 1;
+}
+
+/*
+ * Formats one conversion, reading its arguments from the packed data
+ */
+static int CFE_MissionLib_EvsFormatConv(char *Buffer, size_t BufSize, const char *Spec,
+                                        const CFE_MissionLib_EvsConv_t *Conv, const uint8_t *Args, size_t ArgLength,
+                                        size_t *ArgPos)
+{
+    char     SubSpec[CFE_MISSIONLIB_EVS_SUBSPEC_SIZE];
+    size_t   SubLength;
+    uint64_t Value;
+    int64_t  SignedValue;
+    double   DoubleValue;
+    char     ConvChar;
+    const uint8_t *StrEnd;
+
+    if (Conv->ArgClass == CFE_MISSIONLIB_EVS_ARG_PERCENT)
+    {
+        return snprintf(Buffer, BufSize, "%%");
+    }
+
+    /* Rebuild the specification with any '*' values filled in and the length modifier replaced */
+    memcpy(SubSpec, Spec, Conv->FlagsEnd);
+    SubLength = Conv->FlagsEnd;
+
+    if (Conv->StarWidth)
+    {
+        if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, 4, &Value))
+        {
+            return -1;
+        }
+        SubLength += snprintf(&SubSpec[SubLength], sizeof(SubSpec) - SubLength, "%d", (int)(int32_t)Value);
+    }
+    else
+    {
+        memcpy(&SubSpec[SubLength], &Spec[Conv->FlagsEnd], Conv->WidthEnd - Conv->FlagsEnd);
+        SubLength += Conv->WidthEnd - Conv->FlagsEnd;
+    }
+
+    if (Conv->StarPrecision)
+    {
+        if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, 4, &Value))
+        {
+            return -1;
+        }
+        if ((int32_t)Value >= 0)
+        {
+            SubLength += snprintf(&SubSpec[SubLength], sizeof(SubSpec) - SubLength, ".%d", (int)(int32_t)Value);
+        }
+    }
+    else
+    {
+        memcpy(&SubSpec[SubLength], &Spec[Conv->WidthEnd], Conv->PrecisionEnd - Conv->WidthEnd);
+        SubLength += Conv->PrecisionEnd - Conv->WidthEnd;
+    }
+
+    ConvChar = Spec[Conv->SpecLength - 1];
+    if (Conv->ArgClass == CFE_MISSIONLIB_EVS_ARG_SIGNED || Conv->ArgClass == CFE_MISSIONLIB_EVS_ARG_UNSIGNED)
+    {
+        if (ConvChar != 'c')
+        {
+            SubSpec[SubLength++] = 'l';
+            SubSpec[SubLength++] = 'l';
+        }
+    }
+    SubSpec[SubLength++] = ConvChar;
+    SubSpec[SubLength]   = 0;
+
+    switch (Conv->ArgClass)
+    {
+        case CFE_MISSIONLIB_EVS_ARG_SIGNED:
+            if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, Conv->IntSize, &Value))
+            {
+                return -1;
+            }
+
+            /* Sign extend from the packed width */
+            if (Conv->IntSize < 8 && (Value & ((uint64_t)1 << (8 * Conv->IntSize - 1))) != 0)
+            {
+                Value |= ~(uint64_t)0 << (8 * Conv->IntSize);
+            }
+            SignedValue = (int64_t)Value;
+
+            if (ConvChar == 'c')
+            {
+                return snprintf(Buffer, BufSize, SubSpec, (int)SignedValue);
+            }
+            return snprintf(Buffer, BufSize, SubSpec, (long long)SignedValue);
+
+        case CFE_MISSIONLIB_EVS_ARG_UNSIGNED:
+            if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, Conv->IntSize, &Value))
+            {
+                return -1;
+            }
+            return snprintf(Buffer, BufSize, SubSpec, (unsigned long long)Value);
+
+        case CFE_MISSIONLIB_EVS_ARG_DOUBLE:
+            if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, 8, &Value))
+            {
+                return -1;
+            }
+            memcpy(&DoubleValue, &Value, sizeof(DoubleValue));
+            return snprintf(Buffer, BufSize, SubSpec, DoubleValue);
+
+        case CFE_MISSIONLIB_EVS_ARG_POINTER:
+            if (!CFE_MissionLib_EvsGetValue(Args, ArgLength, ArgPos, 8, &Value))
+            {
+                return -1;
+            }
+            return snprintf(Buffer, BufSize, SubSpec, (void *)(uintptr_t)Value);
+
+        case CFE_MISSIONLIB_EVS_ARG_STRING:
+            StrEnd = memchr(&Args[*ArgPos], 0, ArgLength - *ArgPos);
+            if (StrEnd == NULL)
+            {
+                return -1;
+            }
+            Value   = *ArgPos;
+            *ArgPos = (StrEnd - Args) + 1;
+            return snprintf(Buffer, BufSize, SubSpec, (const char *)&Args[Value]);
+
+        default:
+            return -1;
+    }
+}
+
+/*
+ * Decodes the C escapes written into the catalog by the generator, in place
+ */
+static void CFE_MissionLib_EvsUnescape(char *Str)
+{
+    char *   Out = Str;
+    unsigned Value;
+    int      Digits;
+
+    while (*Str != 0)
+    {
+        if (*Str != '\\' || Str[1] == 0)
+        {
+            *Out++ = *Str++;
+            continue;
+        }
+
+        ++Str;
+        switch (*Str)
+        {
+            case 'n':
+                *Out++ = '\n';
+                ++Str;
+                break;
+            case 't':
+                *Out++ = '\t';
+                ++Str;
+                break;
+            case 'r':
+                *Out++ = '\r';
+                ++Str;
+                break;
+            case 'x':
+                ++Str;
+                Value  = 0;
+                Digits = 0;
+                while (Digits < 2 && isxdigit((unsigned char)*Str))
+                {
+                    Value <<= 4;
+                    if (isdigit((unsigned char)*Str))
+                    {
+                        Value |= (unsigned)(*Str - '0');
+                    }
+                    else
+                    {
+                        Value |= (unsigned)(tolower((unsigned char)*Str) - 'a' + 10);
+                    }
+                    ++Str;
+                    ++Digits;
+                }
+                *Out++ = (char)Value;
+                break;
+            default:
+                /* backslash and quotes */
+                *Out++ = *Str++;
+                break;
+        }
+    }
+
+    *Out = 0;
+}
+
+static int CFE_MissionLib_EvsCompareEntry(const void *A, const void *B)
+{
+    const CFE_MissionLib_EventCatalogEntry_t *EntryA = A;
+    const CFE_MissionLib_EventCatalogEntry_t *EntryB = B;
+
+    if (EntryA->FormatId < EntryB->FormatId)
+    {
+        return -1;
+    }
+    return (EntryA->FormatId > EntryB->FormatId);
+}
+
+/*
+ * ***********************************************************************
+ *  PUBLIC API FUNCTIONS
+ * ***********************************************************************
+ */
+
+int32_t CFE_MissionLib_EventCatalog_Load(CFE_MissionLib_EventCatalog_t **CatalogOut, const char *Filename)
+{
+    CFE_MissionLib_EventCatalog_t *     Catalog;
+    CFE_MissionLib_EventCatalogEntry_t *NewEntries;
+    CFE_MissionLib_EventCatalogEntry_t *Entry;
+    FILE *                              fp;
+    char                                Line[1024];
+    char *                              Tab;
+    char *                              EndPtr;
+    uint32_t                            Capacity;
+    size_t                              Len;
+
+    *CatalogOut = NULL;
+
+    fp = fopen(Filename, "r");
+    if (fp == NULL)
+    {
+        return CFE_MISSIONLIB_FAILURE;
+    }
+
+    Catalog = calloc(1, sizeof(*Catalog));
+    if (Catalog == NULL)
+    {
+        fclose(fp);
+        return CFE_MISSIONLIB_FAILURE;
+    }
+
+    Capacity = 0;
+    while (fgets(Line, sizeof(Line), fp) != NULL)
+    {
+        Len = strlen(Line);
+        while (Len > 0 && (Line[Len - 1] == '\n' || Line[Len - 1] == '\r'))
+        {
+            Line[--Len] = 0;
+        }
+
+        Tab = strchr(Line, '\t');
+        if (Line[0] == '#' || Tab == NULL)
+        {
+            continue;
+        }
+
+        if (Catalog->NumEntries == Capacity)
+        {
+            Capacity   = (Capacity == 0) ? 64 : (2 * Capacity);
+            NewEntries = realloc(Catalog->Entries, Capacity * sizeof(*NewEntries));
+            if (NewEntries == NULL)
+            {
+                break;
+            }
+            Catalog->Entries = NewEntries;
+        }
+
+        *Tab = 0;
+        CFE_MissionLib_EvsUnescape(Tab + 1);
+        Entry           = &Catalog->Entries[Catalog->NumEntries];
+        Entry->FormatId = (uint32_t)strtoul(Line, &EndPtr, 16);
+        if (*EndPtr != 0)
+        {
+            continue;
+        }
+
+        Len           = strlen(Tab + 1) + 1;
+        Entry->Format = malloc(Len);
+        if (Entry->Format == NULL)
+        {
+            break;
+        }
+        memcpy(Entry->Format, Tab + 1, Len);
+        ++Catalog->NumEntries;
+    }
+
+    fclose(fp);
+
+    qsort(Catalog->Entries, Catalog->NumEntries, sizeof(*Catalog->Entries), CFE_MissionLib_EvsCompareEntry);
+
+    *CatalogOut = Catalog;
+    return CFE_MISSIONLIB_SUCCESS;
+}
+
+void CFE_MissionLib_EventCatalog_Free(CFE_MissionLib_EventCatalog_t *Catalog)
+{
+    uint32_t i;
+
+    if (Catalog != NULL)
+    {
+        for (i = 0; i < Catalog->NumEntries; ++i)
+        {
+            free(Catalog->Entries[i].Format);
+        }
+        free(Catalog->Entries);
+        free(Catalog);
+    }
+}
+
+uint32_t CFE_MissionLib_EventCatalog_GetCount(const CFE_MissionLib_EventCatalog_t *Catalog)
+{
+    return Catalog->NumEntries;
+}
+
+const char *CFE_MissionLib_EventCatalog_GetEntry(const CFE_MissionLib_EventCatalog_t *Catalog, uint32_t Index,
+                                                 uint32_t *FormatIdOut)
+{
+    if (Index >= Catalog->NumEntries)
+    {
+        return NULL;
+    }
+
+    if (FormatIdOut != NULL)
+    {
+        *FormatIdOut = Catalog->Entries[Index].FormatId;
+    }
+
+    return Catalog->Entries[Index].Format;
+}
+
+const char *CFE_MissionLib_EventCatalog_Lookup(const CFE_MissionLib_EventCatalog_t *Catalog, uint32_t FormatId)
+{
+    CFE_MissionLib_EventCatalogEntry_t        Key;
+    const CFE_MissionLib_EventCatalogEntry_t *Entry;
+
+    Key.FormatId = FormatId;
+    Entry = bsearch(&Key, Catalog->Entries, Catalog->NumEntries, sizeof(Key), CFE_MissionLib_EvsCompareEntry);
+    if (Entry == NULL)
+    {
+        return NULL;
+    }
+
+    return Entry->Format;
+}
+
+uint32_t CFE_MissionLib_EventFormatId(const char *Format)
+{
+    return CRC_Compute(CRC_ALGORITHM_CRC32, 0, Format, strlen(Format));
+}
+
+int CFE_MissionLib_FormatBinaryEvent(char *Buffer, size_t BufSize, const char *Format, const void *Args,
+                                     size_t ArgLength)
+{
+    CFE_MissionLib_EvsConv_t Conv;
+    size_t                   Pos;
+    size_t                   ArgPos;
+    int                      Result;
+
+    Pos    = 0;
+    ArgPos = 0;
+    Result = 0;
+
+    while (*Format != 0)
+    {
+        if (*Format != '%')
+        {
+            if ((Pos + 1) < BufSize)
+            {
+                Buffer[Pos] = *Format;
+            }
+            ++Pos;
+            ++Format;
+            continue;
+        }
+
+        CFE_MissionLib_EvsParseConv(Format, &Conv);
+        if (Conv.ArgClass == CFE_MISSIONLIB_EVS_ARG_INVALID)
+        {
+            Result = -1;
+            break;
+        }
+
+        if (Pos < BufSize)
+        {
+            Result = CFE_MissionLib_EvsFormatConv(&Buffer[Pos], BufSize - Pos, Format, &Conv, Args, ArgLength, &ArgPos);
+        }
+        else
+        {
+            Result = CFE_MissionLib_EvsFormatConv(NULL, 0, Format, &Conv, Args, ArgLength, &ArgPos);
+        }
+
+        if (Result < 0)
+        {
+            break;
+        }
+
+        Pos += Result;
+        Format += Conv.SpecLength;
+    }
+
+    if (BufSize > 0)
+    {
+        Buffer[(Pos < BufSize) ? Pos : (BufSize - 1)] = 0;
+    }
+
+    if (Result < 0 || ArgPos != ArgLength)
+    {
+        return -1;
+    }
+
+    return (int)Pos;
+}
@@ -0,0 +1,117 @@
+/*
+ * LEW-20211-1, Python Bindings for the Core Flight Executive Mission Library
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/******************************************************************************
+** File:  cfe_missionlib_python_event.c
+**
+** Purpose:
+**   Implement module functions to expand binary format EVS event messages
+**
+**   LoadEventCatalog() reads the event format catalog generated by the build
+**   into a dictionary of format ID to format string, and FormatEvent()
+**   expands the packed arguments of an event message using a format string.
+**
+******************************************************************************/
+
+#include "cfe_missionlib_python_internal.h"
+#include "cfe_missionlib_evs_format.h"
+
+static PyObject *CFE_MissionLib_Python_LoadEventCatalog(PyObject *obj, PyObject *args);
+static PyObject *CFE_MissionLib_Python_FormatEvent(PyObject *obj, PyObject *args);
+
+PyMethodDef CFE_MissionLib_Python_EventMethods[] =
+{
+        {"LoadEventCatalog",  CFE_MissionLib_Python_LoadEventCatalog, METH_VARARGS, "Load an event format catalog as a dictionary of format ID to format string."},
+        {"FormatEvent",  CFE_MissionLib_Python_FormatEvent, METH_VARARGS, "Expand the packed arguments of a binary format event message."},
+        {NULL}  /* Sentinel */
+};
+
+static PyObject *CFE_MissionLib_Python_LoadEventCatalog(PyObject *obj, PyObject *args)
+{
+    const char *Filename;
+    CFE_MissionLib_EventCatalog_t *Catalog;
+    PyObject *result;
+    PyObject *key;
+    PyObject *value;
+    const char *Format;
+    uint32_t FormatId;
+    uint32_t i;
+
+    if (!PyArg_ParseTuple(args, "s:LoadEventCatalog", &Filename))
+    {
+        return NULL;
+    }
+
+    if (CFE_MissionLib_EventCatalog_Load(&Catalog, Filename) != CFE_MISSIONLIB_SUCCESS)
+    {
+        PyErr_Format(PyExc_IOError, "Cannot read event format catalog %s", Filename);
+        return NULL;
+    }
+
+    result = PyDict_New();
+    for (i = 0; result != NULL && i < CFE_MissionLib_EventCatalog_GetCount(Catalog); ++i)
+    {
+        Format = CFE_MissionLib_EventCatalog_GetEntry(Catalog, i, &FormatId);
+        key = PyLong_FromUnsignedLong(FormatId);
+        value = PyUnicode_FromString(Format);
+        if (key == NULL || value == NULL || PyDict_SetItem(result, key, value) != 0)
+        {
+            Py_CLEAR(result);
+        }
+        Py_XDECREF(key);
+        Py_XDECREF(value);
+    }
+
+    CFE_MissionLib_EventCatalog_Free(Catalog);
+
+    return result;
+}
+
+static PyObject *CFE_MissionLib_Python_FormatEvent(PyObject *obj, PyObject *args)
+{
+    const char *Format;
+    PyObject *ArgsObj;
+    char *ArgBuffer;
+    Py_ssize_t ArgSize;
+    char OutputBuffer[512];
+    int Length;
+
+    if (!PyArg_ParseTuple(args, "sO:FormatEvent", &Format, &ArgsObj))
+    {
+        return NULL;
+    }
+
+    if (!PyBytes_Check(ArgsObj))
+    {
+        PyErr_SetString(PyExc_TypeError, "Event arguments must be a bytes object");
+        return NULL;
+    }
+
+    PyBytes_AsStringAndSize(ArgsObj, &ArgBuffer, &ArgSize);
+
+    Length = CFE_MissionLib_FormatBinaryEvent(OutputBuffer, sizeof(OutputBuffer), Format, ArgBuffer, ArgSize);
+    if (Length < 0)
+    {
+        PyErr_Format(PyExc_ValueError, "Event arguments do not match format \"%s\"", Format);
+        return NULL;
+    }
+
+    return PyUnicode_FromString(OutputBuffer);
+}
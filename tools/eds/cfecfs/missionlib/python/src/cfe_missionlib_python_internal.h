@@ -133,4 +133,6 @@ extern PyTypeObject CFE_MissionLib_Python_DatabaseType;
 extern PyTypeObject CFE_MissionLib_Python_InterfaceType;
 extern PyTypeObject CFE_MissionLib_Python_TopicType;
 
+extern PyMethodDef CFE_MissionLib_Python_EventMethods[];
+
 #endif /* _CFE_MISSIONLIB_PYTHON_INTERNAL_H_ */
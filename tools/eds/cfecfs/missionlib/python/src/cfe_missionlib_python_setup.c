@@ -45,7 +45,8 @@ static PyModuleDef CFE_MissionLib_Python_ModuleDef =
     PyModuleDef_HEAD_INIT,
     CFE_MISSIONLIB_PYTHON_MODULE_NAME,
     PyDoc_STR(CFE_MISSIONLIB_PYTHON_DOC),
-    -1
+    -1,
+    CFE_MissionLib_Python_EventMethods
 };
 
 static inline PyObject* CFE_MissionLib_Python_InstantiateModule(void)
@@ -59,7 +60,7 @@ static inline PyObject* CFE_MissionLib_Python_InstantiateModule(void)
 static inline PyObject* CFE_MissionLib_Python_InstantiateModule(void)
 {
     /* python2 uses Py_InitModule3() API */
-    return Py_InitModule3(CFE_MISSIONLIB_PYTHON_MODULE_NAME, NULL, CFE_MISSIONLIB_PYTHON_DOC);
+    return Py_InitModule3(CFE_MISSIONLIB_PYTHON_MODULE_NAME, CFE_MissionLib_Python_EventMethods, CFE_MISSIONLIB_PYTHON_DOC);
 }
 
 #endif
@@ -0,0 +1,538 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ *
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     evs_catalog.c
+ * \ingroup  cfecfs
+ *
+ * Generates the event format catalog used to expand binary format EVS
+ * messages on the ground.
+ *
+ * Scans C source files for calls to the EVS send event APIs and records
+ * every format string that is written as a string literal (or adjacent
+ * string literals).  Formats built from macros, such as the PRI* macros
+ * from inttypes.h, cannot be found this way and are not in the catalog.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <getopt.h>
+
+#include "cfe_missionlib_evs_format.h"
+
+#define EVS_CATALOG_MAX_FORMAT_LENGTH 1024
+
+typedef struct
+{
+    const char *FunctionName;
+    int         FormatArgIndex;
+} EvsCatalog_SendFunction_t;
+
+typedef struct
+{
+    uint32_t FormatId;
+    char *   Format;
+} EvsCatalog_Entry_t;
+
+/*
+** The functions taking an event format, and the zero-based position of the format argument
+*/
+static const EvsCatalog_SendFunction_t SEND_FUNCTIONS[] = {
+    { "CFE_EVS_SendEvent",          2 },
+    { "CFE_EVS_SendEventWithAppID", 3 },
+    { "CFE_EVS_SendTimedEvent",     3 },
+    { "EVS_SendEvent",              2 },
+    { NULL,                         0 }
+};
+
+static EvsCatalog_Entry_t *Entries;
+static size_t              NumEntries;
+static size_t              MaxEntries;
+
+static const char *optString = "o:?";
+
+/*
+** getopts_long long form argument table
+*/
+static struct option longOpts[] = {
+    { "output",    required_argument, NULL, 'o' },
+    { "help",      no_argument,       NULL, '?' },
+    { NULL,        no_argument,       NULL, 0   }
+};
+
+/*
+** Skips whitespace and comments, returns the position of the next token
+*/
+static const char *SkipSpace(const char *Ptr)
+{
+    while (*Ptr != 0)
+    {
+        if (isspace((unsigned char)*Ptr))
+        {
+            ++Ptr;
+        }
+        else if (Ptr[0] == '/' && Ptr[1] == '/')
+        {
+            while (*Ptr != 0 && *Ptr != '\n')
+            {
+                ++Ptr;
+            }
+        }
+        else if (Ptr[0] == '/' && Ptr[1] == '*')
+        {
+            Ptr += 2;
+            while (*Ptr != 0 && !(Ptr[0] == '*' && Ptr[1] == '/'))
+            {
+                ++Ptr;
+            }
+            if (*Ptr != 0)
+            {
+                Ptr += 2;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return Ptr;
+}
+
+/*
+** Skips a string or character literal starting at the opening quote
+*/
+static const char *SkipQuoted(const char *Ptr)
+{
+    char Quote = *Ptr;
+
+    ++Ptr;
+    while (*Ptr != 0 && *Ptr != Quote && *Ptr != '\n')
+    {
+        if (*Ptr == '\\' && Ptr[1] != 0)
+        {
+            ++Ptr;
+        }
+        ++Ptr;
+    }
+
+    if (*Ptr == Quote)
+    {
+        ++Ptr;
+    }
+
+    return Ptr;
+}
+
+/*
+** Decodes a string literal starting at the opening quote and appends it to Buffer
+** Returns the position after the closing quote, or NULL if it does not fit
+*/
+static const char *DecodeString(const char *Ptr, char *Buffer, size_t *Length)
+{
+    unsigned Value;
+    int      Digits;
+
+    ++Ptr;
+    while (*Ptr != '"')
+    {
+        if (*Ptr == 0 || *Ptr == '\n' || *Length >= (EVS_CATALOG_MAX_FORMAT_LENGTH - 1))
+        {
+            return NULL;
+        }
+
+        Value = (unsigned char)*Ptr;
+        ++Ptr;
+        if (Value == '\\')
+        {
+            Value = (unsigned char)*Ptr;
+            ++Ptr;
+            switch (Value)
+            {
+                case 'n':
+                    Value = '\n';
+                    break;
+                case 't':
+                    Value = '\t';
+                    break;
+                case 'r':
+                    Value = '\r';
+                    break;
+                case 'a':
+                    Value = '\a';
+                    break;
+                case 'b':
+                    Value = '\b';
+                    break;
+                case 'f':
+                    Value = '\f';
+                    break;
+                case 'v':
+                    Value = '\v';
+                    break;
+                case 'x':
+                    Value = 0;
+                    while (isxdigit((unsigned char)*Ptr))
+                    {
+                        Value = (Value << 4) | (unsigned)(isdigit((unsigned char)*Ptr)
+                                                              ? (*Ptr - '0')
+                                                              : (tolower((unsigned char)*Ptr) - 'a' + 10));
+                        ++Ptr;
+                    }
+                    break;
+                case '\n':
+                case 0:
+                    return NULL;
+                default:
+                    if (Value >= '0' && Value <= '7')
+                    {
+                        Value -= '0';
+                        Digits = 1;
+                        while (Digits < 3 && *Ptr >= '0' && *Ptr <= '7')
+                        {
+                            Value = (Value << 3) | (unsigned)(*Ptr - '0');
+                            ++Ptr;
+                            ++Digits;
+                        }
+                    }
+                    break;
+            }
+        }
+
+        Buffer[*Length] = (char)Value;
+        ++(*Length);
+    }
+
+    Buffer[*Length] = 0;
+    return Ptr + 1;
+}
+
+static void AddFormat(const char *Format, const char *Filename)
+{
+    EvsCatalog_Entry_t *NewEntries;
+    uint32_t            FormatId;
+    size_t              i;
+
+    FormatId = CFE_MissionLib_EventFormatId(Format);
+    for (i = 0; i < NumEntries; ++i)
+    {
+        if (Entries[i].FormatId == FormatId)
+        {
+            if (strcmp(Entries[i].Format, Format) != 0)
+            {
+                fprintf(stderr, "%s: WARNING: format ID %08lx collides with another format, not cataloged: \"%s\"\n",
+                        Filename, (unsigned long)FormatId, Format);
+            }
+            return;
+        }
+    }
+
+    if (NumEntries == MaxEntries)
+    {
+        MaxEntries = (MaxEntries == 0) ? 256 : (2 * MaxEntries);
+        NewEntries = realloc(Entries, MaxEntries * sizeof(*NewEntries));
+        if (NewEntries == NULL)
+        {
+            fprintf(stderr, "Out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        Entries = NewEntries;
+    }
+
+    Entries[NumEntries].FormatId = FormatId;
+    Entries[NumEntries].Format   = malloc(strlen(Format) + 1);
+    if (Entries[NumEntries].Format == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    strcpy(Entries[NumEntries].Format, Format);
+    ++NumEntries;
+}
+
+/*
+** Parses the argument list of a send event call, starting at the opening parenthesis
+** Adds the format argument if it is made only of string literals
+*/
+static const char *ScanCall(const char *Ptr, int FormatArgIndex, const char *Filename)
+{
+    char   Format[EVS_CATALOG_MAX_FORMAT_LENGTH];
+    size_t Length;
+    int    ArgIndex;
+    int    Depth;
+    int    IsLiteral;
+
+    ArgIndex  = 0;
+    Depth     = 0;
+    Length    = 0;
+    IsLiteral = 1;
+
+    ++Ptr;
+    while (*Ptr != 0)
+    {
+        Ptr = SkipSpace(Ptr);
+        if (*Ptr == 0)
+        {
+            break;
+        }
+
+        if (Depth == 0 && (*Ptr == ',' || *Ptr == ')'))
+        {
+            if (ArgIndex == FormatArgIndex)
+            {
+                if (IsLiteral && Length > 0)
+                {
+                    AddFormat(Format, Filename);
+                }
+                break;
+            }
+            if (*Ptr == ')')
+            {
+                break;
+            }
+            ++ArgIndex;
+            ++Ptr;
+            continue;
+        }
+
+        if (ArgIndex == FormatArgIndex)
+        {
+            if (*Ptr == '"' && IsLiteral)
+            {
+                Ptr = DecodeString(Ptr, Format, &Length);
+                if (Ptr == NULL)
+                {
+                    return NULL;
+                }
+                continue;
+            }
+            IsLiteral = 0;
+        }
+
+        if (*Ptr == '"' || *Ptr == '\'')
+        {
+            Ptr = SkipQuoted(Ptr);
+        }
+        else
+        {
+            if (*Ptr == '(' || *Ptr == '[' || *Ptr == '{')
+            {
+                ++Depth;
+            }
+            else if (*Ptr == ')' || *Ptr == ']' || *Ptr == '}')
+            {
+                --Depth;
+            }
+            ++Ptr;
+        }
+    }
+
+    return Ptr;
+}
+
+static int ScanFile(const char *Filename)
+{
+    FILE *                           fp;
+    char *                           Content;
+    const char *                     Ptr;
+    const char *                     Start;
+    const EvsCatalog_SendFunction_t *Func;
+    long                             FileSize;
+
+    fp = fopen(Filename, "rb");
+    if (fp == NULL)
+    {
+        perror(Filename);
+        return -1;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    FileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    Content = malloc(FileSize + 1);
+    if (Content == NULL || fread(Content, 1, FileSize, fp) != (size_t)FileSize)
+    {
+        fprintf(stderr, "%s: cannot read file\n", Filename);
+        free(Content);
+        fclose(fp);
+        return -1;
+    }
+    Content[FileSize] = 0;
+    fclose(fp);
+
+    Ptr = Content;
+    while (*Ptr != 0)
+    {
+        Ptr = SkipSpace(Ptr);
+        if (*Ptr == '"' || *Ptr == '\'')
+        {
+            Ptr = SkipQuoted(Ptr);
+        }
+        else if (isalpha((unsigned char)*Ptr) || *Ptr == '_')
+        {
+            Start = Ptr;
+            while (isalnum((unsigned char)*Ptr) || *Ptr == '_')
+            {
+                ++Ptr;
+            }
+
+            for (Func = SEND_FUNCTIONS; Func->FunctionName != NULL; ++Func)
+            {
+                if (strlen(Func->FunctionName) == (size_t)(Ptr - Start) &&
+                    memcmp(Func->FunctionName, Start, Ptr - Start) == 0)
+                {
+                    Ptr = SkipSpace(Ptr);
+                    if (*Ptr == '(')
+                    {
+                        Ptr = ScanCall(Ptr, Func->FormatArgIndex, Filename);
+                        if (Ptr == NULL)
+                        {
+                            fprintf(stderr, "%s: WARNING: cannot decode format string\n", Filename);
+                            Ptr = Start + strlen(Func->FunctionName);
+                        }
+                    }
+                    break;
+                }
+            }
+        }
+        else if (*Ptr != 0)
+        {
+            ++Ptr;
+        }
+    }
+
+    free(Content);
+    return 0;
+}
+
+static int CompareEntry(const void *A, const void *B)
+{
+    const EvsCatalog_Entry_t *EntryA = A;
+    const EvsCatalog_Entry_t *EntryB = B;
+
+    if (EntryA->FormatId < EntryB->FormatId)
+    {
+        return -1;
+    }
+    return (EntryA->FormatId > EntryB->FormatId);
+}
+
+static void WriteCatalog(FILE *fp)
+{
+    const unsigned char *Ptr;
+    size_t               i;
+
+    fprintf(fp, "# CFE EVS event format catalog\n");
+    fprintf(fp, "# Generated by evs_catalog - do not edit\n");
+
+    for (i = 0; i < NumEntries; ++i)
+    {
+        fprintf(fp, "%08lx\t", (unsigned long)Entries[i].FormatId);
+        for (Ptr = (const unsigned char *)Entries[i].Format; *Ptr != 0; ++Ptr)
+        {
+            switch (*Ptr)
+            {
+                case '\\':
+                    fputs("\\\\", fp);
+                    break;
+                case '\n':
+                    fputs("\\n", fp);
+                    break;
+                case '\t':
+                    fputs("\\t", fp);
+                    break;
+                case '\r':
+                    fputs("\\r", fp);
+                    break;
+                default:
+                    if (isprint(*Ptr))
+                    {
+                        fputc(*Ptr, fp);
+                    }
+                    else
+                    {
+                        fprintf(fp, "\\x%02x", (unsigned int)*Ptr);
+                    }
+                    break;
+            }
+        }
+        fputc('\n', fp);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *OutputFile = NULL;
+    FILE *      fp;
+    int         opt;
+    int         longIndex = 0;
+    int         Status    = EXIT_SUCCESS;
+
+    opt = getopt_long(argc, argv, optString, longOpts, &longIndex);
+    while (opt != -1)
+    {
+        switch (opt)
+        {
+            case 'o':
+                OutputFile = optarg;
+                break;
+
+            default:
+                fprintf(stderr, "Usage: %s [-o output] source.c ...\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+
+        opt = getopt_long(argc, argv, optString, longOpts, &longIndex);
+    }
+
+    while (optind < argc)
+    {
+        if (ScanFile(argv[optind]) != 0)
+        {
+            Status = EXIT_FAILURE;
+        }
+        ++optind;
+    }
+
+    qsort(Entries, NumEntries, sizeof(*Entries), CompareEntry);
+
+    if (OutputFile == NULL)
+    {
+        WriteCatalog(stdout);
+    }
+    else
+    {
+        fp = fopen(OutputFile, "w");
+        if (fp == NULL)
+        {
+            perror(OutputFile);
+            return EXIT_FAILURE;
+        }
+        WriteCatalog(fp);
+        fclose(fp);
+    }
+
+    return Status;
+}
@@ -41,11 +41,13 @@
 #include <cfe_mission_cfg.h>
 #include "cfe_sb_eds_typedefs.h"
 #include "cfe_hdr_eds_typedefs.h"
+#include "cfe_evs_eds_typedefs.h"
 #include "cfe_mission_eds_parameters.h"
 #include "cfe_mission_eds_interface_parameters.h"
 #include "edslib_displaydb.h"
 #include "cfe_missionlib_runtime.h"
 #include "cfe_missionlib_api.h"
+#include "cfe_missionlib_evs_format.h"
 
 
 #define BASE_SERVER_PORT 1235
@@ -53,13 +55,14 @@
 CFE_HDR_TelemetryHeader_Buffer_t       LocalBuffer;
 CFE_HDR_TelemetryHeader_PackedBuffer_t NetworkBuffer;
 
-static const char *optString = "c:?";
+static const char *optString = "c:e:?";
 
 /*
 ** getopts_long long form argument table
 */
 static struct option longOpts[] = {
     { "cpu",       required_argument, NULL, 'c' },
+    { "catalog",   required_argument, NULL, 'e' },
     { "help",      no_argument,       NULL, '?' },
     { NULL,        no_argument,       NULL, 0   }
 };
@@ -78,6 +81,34 @@ void TlmUtilDisplay(void *Arg, const EdsLib_EntityDescriptor_t *Param)
            Param->EntityInfo.Offset.Bits, Param->FullName, OutputBuffer);
 }
 
+/*
+** Expands a binary format event message using the event format catalog
+*/
+void TlmUtilDisplayBinaryEvent(const CFE_MissionLib_EventCatalog_t *Catalog, const CFE_EVS_BinaryEventTlm_t *EventTlm)
+{
+   const char *Format;
+   char OutputBuffer[512];
+   size_t ArgLength;
+
+   Format = CFE_MissionLib_EventCatalog_Lookup(Catalog, EventTlm->Payload.FormatID);
+   if (Format == NULL)
+   {
+       printf("Event Message: unknown format ID %08lx\n", (unsigned long)EventTlm->Payload.FormatID);
+       return;
+   }
+
+   ArgLength = EventTlm->Payload.ArgLength;
+   if (ArgLength > sizeof(EventTlm->Payload.Args) ||
+           CFE_MissionLib_FormatBinaryEvent(OutputBuffer, sizeof(OutputBuffer), Format,
+                   EventTlm->Payload.Args, ArgLength) < 0)
+   {
+       printf("Event Message: arguments do not match format \"%s\"\n", Format);
+       return;
+   }
+
+   printf("Event Message: %s\n", OutputBuffer);
+}
+
 int main(int argc, char *argv[])
 {
   int   opt = 0;
@@ -91,6 +122,7 @@ int main(int argc, char *argv[])
   CFE_SB_Publisher_Component_t PublisherParams;
   char TempBuffer[64];
   int32_t Status;
+  CFE_MissionLib_EventCatalog_t *Catalog = NULL;
 
   Port = BASE_SERVER_PORT;
   opt = getopt_long( argc, argv, optString, longOpts, &longIndex );
@@ -102,6 +134,14 @@ int main(int argc, char *argv[])
           Port += atoi(optarg) - 1;
           break;
 
+      case 'e':
+          if (CFE_MissionLib_EventCatalog_Load(&Catalog, optarg) != CFE_MISSIONLIB_SUCCESS)
+          {
+              printf("%s: cannot read event format catalog %s\n", argv[0], optarg);
+              exit(1);
+          }
+          break;
+
       case '?':
           break;
 
@@ -213,6 +253,11 @@ int main(int argc, char *argv[])
     }
 
     EdsLib_DisplayDB_IterateAllEntities(&EDS_DATABASE, EdsId, TlmUtilDisplay, LocalBuffer.Byte);
+
+    if (Catalog != NULL && EdsId == EDSLIB_MAKE_ID(EDS_INDEX(CFE_EVS), CFE_EVS_BinaryEventTlm_DATADICTIONARY))
+    {
+        TlmUtilDisplayBinaryEvent(Catalog, (const CFE_EVS_BinaryEventTlm_t *)LocalBuffer.Byte);
+    }
     printf("\n");
 
   }/* end of server infinite loop */
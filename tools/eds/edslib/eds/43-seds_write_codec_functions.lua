@@ -0,0 +1,473 @@
+--
+-- LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+--
+-- Copyright (c) 2020 United States Government as represented by
+-- the Administrator of the National Aeronautics and Space Administration.
+-- All Rights Reserved.
+--
+-- Licensed under the Apache License, Version 2.0 (the "License");
+-- you may not use this file except in compliance with the License.
+-- You may obtain a copy of the License at
+--
+--    http://www.apache.org/licenses/LICENSE-2.0
+--
+-- Unless required by applicable law or agreed to in writing, software
+-- distributed under the License is distributed on an "AS IS" BASIS,
+-- WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+-- See the License for the specific language governing permissions and
+-- limitations under the License.
+--
+
+-- -------------------------------------------------------------------------
+-- Lua implementation of "write codec functions" EdsLib processing step
+--
+-- This creates C source files containing a specialized pack and unpack
+-- function for each container type where every member can be encoded
+-- with a constant offset.  The functions are referenced from the data type
+-- DB entry (see the "Codec" field written by the next stage) and are
+-- used by the EdsLib runtime instead of interpreting the database.
+--
+-- Any type that uses a feature not handled here (e.g. variable sized
+-- base types, unusual number encodings, or little endian fields that are
+-- not byte aligned) does not get a codec, and will be processed by the
+-- interpreter as before.  The runtime database remains the authority on
+-- the encoding; these functions only implement the common cases faster.
+-- -------------------------------------------------------------------------
+SEDS.info ("SEDS write codec functions START")
+
+-- -----------------------------------------------------------------------------------------
+--                              Helper functions
+-- -----------------------------------------------------------------------------------------
+
+-- -----------------------------------------------------------------------
+-- Source for the bit access helpers, written at the top of each file
+-- Big endian fields are numbered from the MSB of the first byte,
+-- matching the EdsLib bitwise pack/unpack implementation.
+-- -----------------------------------------------------------------------
+local codec_helper_source = {
+  "static inline void EdsCodec_PutBE(uint8_t *Dst, uint32_t BitOffset, uint32_t Bits, uint64_t Value)",
+  "{",
+  "    uint8_t *Ptr = Dst + (BitOffset >> 3);",
+  "    uint32_t Shift = BitOffset & 7;",
+  "    uint32_t Avail;",
+  "    uint32_t Take;",
+  "",
+  "    while (Bits > 0)",
+  "    {",
+  "        Avail = 8 - Shift;",
+  "        Take = (Bits < Avail) ? Bits : Avail;",
+  "        Bits -= Take;",
+  "        *Ptr |= (uint8_t)(((Value >> Bits) & ((1U << Take) - 1)) << (Avail - Take));",
+  "        Shift = 0;",
+  "        ++Ptr;",
+  "    }",
+  "}",
+  "",
+  "static inline uint64_t EdsCodec_GetBE(const uint8_t *Src, uint32_t BitOffset, uint32_t Bits)",
+  "{",
+  "    const uint8_t *Ptr = Src + (BitOffset >> 3);",
+  "    uint32_t Shift = BitOffset & 7;",
+  "    uint32_t Avail;",
+  "    uint32_t Take;",
+  "    uint64_t Value = 0;",
+  "",
+  "    while (Bits > 0)",
+  "    {",
+  "        Avail = 8 - Shift;",
+  "        Take = (Bits < Avail) ? Bits : Avail;",
+  "        Bits -= Take;",
+  "        Value = (Value << Take) | ((*Ptr >> (Avail - Take)) & ((1U << Take) - 1));",
+  "        Shift = 0;",
+  "        ++Ptr;",
+  "    }",
+  "",
+  "    return Value;",
+  "}",
+  "",
+  "static inline void EdsCodec_PutLE(uint8_t *Dst, uint32_t ByteOffset, uint32_t Bytes, uint64_t Value)",
+  "{",
+  "    Dst += ByteOffset;",
+  "    while (Bytes > 0)",
+  "    {",
+  "        *Dst = (uint8_t)Value;",
+  "        Value >>= 8;",
+  "        ++Dst;",
+  "        --Bytes;",
+  "    }",
+  "}",
+  "",
+  "static inline uint64_t EdsCodec_GetLE(const uint8_t *Src, uint32_t ByteOffset, uint32_t Bytes)",
+  "{",
+  "    uint64_t Value = 0;",
+  "",
+  "    Src += ByteOffset;",
+  "    while (Bytes > 0)",
+  "    {",
+  "        --Bytes;",
+  "        Value = (Value << 8) | Src[Bytes];",
+  "    }",
+  "",
+  "    return Value;",
+  "}",
+  "",
+  "static inline int64_t EdsCodec_SignExtend(uint64_t Value, uint32_t Bits)",
+  "{",
+  "    uint64_t SignBit = (uint64_t)1 << (Bits - 1);",
+  "    return (int64_t)((Value ^ SignBit) - SignBit);",
+  "}",
+  "",
+  "static inline uint64_t EdsCodec_FromFloat(float Value)",
+  "{",
+  "    uint32_t Bits;",
+  "    memcpy(&Bits, &Value, sizeof(Bits));",
+  "    return Bits;",
+  "}",
+  "",
+  "static inline uint64_t EdsCodec_FromDouble(double Value)",
+  "{",
+  "    uint64_t Bits;",
+  "    memcpy(&Bits, &Value, sizeof(Bits));",
+  "    return Bits;",
+  "}",
+  "",
+  "static inline float EdsCodec_ToFloat(uint64_t Value)",
+  "{",
+  "    uint32_t Bits = (uint32_t)Value;",
+  "    float Result;",
+  "    memcpy(&Result, &Bits, sizeof(Result));",
+  "    return Result;",
+  "}",
+  "",
+  "static inline double EdsCodec_ToDouble(uint64_t Value)",
+  "{",
+  "    double Result;",
+  "    memcpy(&Result, &Value, sizeof(Result));",
+  "    return Result;",
+  "}"
+}
+
+-- Entry types which are computed when finalizing a packed object, and therefore not packed
+local finalized_entry_types =
+{
+  LENGTH_ENTRY = true,
+  FIXED_VALUE_ENTRY = true,
+  ERROR_CONTROL_ENTRY = true
+}
+
+-- -----------------------------------------------------------------------
+-- Determine how a scalar type is encoded, or nil if not supported here
+-- -----------------------------------------------------------------------
+local function get_scalar_encoding(node)
+  local bits = node.resolved_size and node.resolved_size.bits
+  local encnode
+  local byteorder
+
+  if (not bits or bits == 0 or bits > 64) then
+    return nil
+  end
+
+  if (node.entity_type == "INTEGER_DATATYPE" or node.entity_type == "ENUMERATION_DATATYPE") then
+    encnode = node:find_first({"INTEGER_DATA_ENCODING"})
+    if (not encnode or (encnode.encoding ~= "unsigned" and encnode.encoding ~= "twoscomplement")) then
+      return nil
+    end
+    byteorder = encnode.byteorder
+    if (byteorder ~= "bigendian" and byteorder ~= "littleendian") then
+      return nil
+    end
+    return { kind = "INT", bits = bits, byteorder = byteorder, is_signed = node.is_signed }
+  elseif (node.entity_type == "FLOAT_DATATYPE") then
+    encnode = node:find_first({"FLOAT_DATA_ENCODING"})
+    byteorder = encnode and encnode.byteorder
+    if (byteorder ~= "bigendian" and byteorder ~= "littleendian") then
+      return nil
+    end
+    if (encnode.encodingandprecision == "ieee754_2008_single" and bits == 32) then
+      return { kind = "FLOAT", bits = bits, byteorder = byteorder, conv = "Float" }
+    elseif (encnode.encodingandprecision == "ieee754_2008_double" and bits == 64) then
+      return { kind = "FLOAT", bits = bits, byteorder = byteorder, conv = "Double" }
+    end
+  elseif (node.entity_type == "BOOLEAN_DATATYPE") then
+    -- Only plain single bit flags; an inverted or wider encoding is left to the interpreter
+    encnode = node:find_first({"BOOLEAN_DATA_ENCODING"})
+    if (bits == 1 and not (encnode and encnode.falsevalue == "nonzeroisfalse")) then
+      return { kind = "BOOL", bits = bits, byteorder = "bigendian" }
+    end
+  elseif (node.entity_type == "STRING_DATATYPE" or node.entity_type == "BINARY_DATATYPE") then
+    if ((bits % 8) == 0) then
+      return { kind = "BYTES", bits = bits }
+    end
+  end
+
+  return nil
+end
+
+-- -----------------------------------------------------------------------
+-- Bit offset expressions
+-- An offset is a constant plus a list of loop index terms (for arrays)
+-- -----------------------------------------------------------------------
+local function offset_add(offset, bits, term)
+  local result = { base = offset.base + bits, terms = {}, aligned = offset.aligned }
+  for _,t in ipairs(offset.terms) do
+    result.terms[1 + #result.terms] = t
+  end
+  if (term) then
+    result.terms[1 + #result.terms] = string.format("(%s * %dU)", term.var, term.stride)
+    result.aligned = result.aligned and (term.stride % 8) == 0
+  end
+  return result
+end
+
+local function offset_is_byte_aligned(offset)
+  return offset.aligned and (offset.base % 8) == 0
+end
+
+local function offset_to_string(offset, divisor)
+  local str = tostring(divisor and math.floor(offset.base / divisor) or offset.base) .. "U"
+  for _,t in ipairs(offset.terms) do
+    if (divisor) then
+      t = string.format("(%s / %d)", t, divisor)
+    end
+    str = str .. " + " .. t
+  end
+  return str
+end
+
+-- -----------------------------------------------------------------------
+-- Add a line of generated code to the function body
+-- -----------------------------------------------------------------------
+local function emit(state, kind, text)
+  state.code[1 + #state.code] = { kind = kind, text = text }
+end
+
+-- -----------------------------------------------------------------------
+-- Generate the statements for one scalar value
+-- Returns false if the value cannot be handled
+-- -----------------------------------------------------------------------
+local function emit_scalar(state, node, path, offset)
+  local enc = get_scalar_encoding(node)
+  local ctype = node.header_data and node.header_data.typedef_name
+  local getexpr
+
+  if (not enc or not ctype) then
+    return false
+  end
+
+  if (enc.kind == "BYTES") then
+    if (not offset_is_byte_aligned(offset)) then
+      return false
+    end
+    if (state.mode == "PACK") then
+      emit(state, "write", string.format("memcpy(&Dst[%s], %s, %d);", offset_to_string(offset, 8), path, math.floor(enc.bits / 8)))
+    else
+      emit(state, "write", string.format("memcpy(%s, &Src[%s], %d);", path, offset_to_string(offset, 8), math.floor(enc.bits / 8)))
+    end
+    return true
+  end
+
+  if (enc.byteorder == "littleendian" and (enc.bits % 8 ~= 0 or not offset_is_byte_aligned(offset))) then
+    return false
+  end
+
+  if (state.mode == "PACK") then
+    local valexpr
+    if (enc.kind == "FLOAT") then
+      valexpr = string.format("EdsCodec_From%s(%s)", enc.conv, path)
+    elseif (enc.kind == "BOOL") then
+      valexpr = string.format("(%s ? 1 : 0)", path)
+    else
+      valexpr = string.format("(uint64_t)%s", path)
+    end
+    if (enc.byteorder == "littleendian") then
+      emit(state, "write", string.format("EdsCodec_PutLE(Dst, %s, %d, %s);", offset_to_string(offset, 8), math.floor(enc.bits / 8), valexpr))
+    else
+      emit(state, "write", string.format("EdsCodec_PutBE(Dst, %s, %d, %s);", offset_to_string(offset), enc.bits, valexpr))
+    end
+  else
+    if (enc.byteorder == "littleendian") then
+      getexpr = string.format("EdsCodec_GetLE(Src, %s, %d)", offset_to_string(offset, 8), math.floor(enc.bits / 8))
+    else
+      getexpr = string.format("EdsCodec_GetBE(Src, %s, %d)", offset_to_string(offset), enc.bits)
+    end
+    if (enc.kind == "FLOAT") then
+      emit(state, "write", string.format("%s = EdsCodec_To%s(%s);", path, enc.conv, getexpr))
+    elseif (enc.kind == "BOOL") then
+      emit(state, "write", string.format("%s = (%s != 0);", path, getexpr))
+    elseif (enc.is_signed) then
+      emit(state, "write", string.format("%s = (%s)EdsCodec_SignExtend(%s, %d);", path, ctype, getexpr, enc.bits))
+    else
+      emit(state, "write", string.format("%s = (%s)%s;", path, ctype, getexpr))
+    end
+  end
+
+  return true
+end
+
+local emit_type
+
+-- -----------------------------------------------------------------------
+-- Generate the statements for all members of a container
+-- -----------------------------------------------------------------------
+local function emit_container(state, node, path, offset)
+  if (not node.decode_sequence or #node.decode_sequence == 0) then
+    return false
+  end
+
+  for _,ref in ipairs(node.decode_sequence) do
+    local entry_type = ref.entry and ref.entry.entity_type
+    local member_path
+
+    -- The native struct uses a buffer for base types which are extended, and
+    -- list entries are variable; neither has a constant layout.
+    if (entry_type == "CONTAINER_LIST_ENTRY" or
+        (ref.name and ref.type.max_size and ref.type.max_size.bits > ref.type.resolved_size.bits)) then
+      return false
+    end
+
+    if (state.mode == "UNPACK" or not finalized_entry_types[entry_type]) then
+      member_path = path .. (string.sub(path, -2) == "->" and "" or ".") .. (ref.name or ref.type.name)
+      if (not emit_type(state, ref.type, member_path, offset_add(offset, ref.bit))) then
+        return false
+      end
+    end
+  end
+
+  return true
+end
+
+-- -----------------------------------------------------------------------
+-- Generate the statements for an array, as a loop over the elements
+-- -----------------------------------------------------------------------
+local function emit_array(state, node, path, offset)
+  local elem = node.datatyperef
+  local numdims = 0
+  local indexvar
+  local result
+
+  for dim in node:iterate_subtree("DIMENSION") do
+    if (dim.total_elements) then
+      numdims = numdims + 1
+    end
+  end
+
+  if (numdims > 1 or not node.total_elements or not elem or elem.max_size or
+      not elem.resolved_size or elem.resolved_size.bits == 0) then
+    return false
+  end
+
+  state.depth = state.depth + 1
+  if (state.depth > state.maxdepth) then
+    state.maxdepth = state.depth
+  end
+  indexvar = string.format("i%d", state.depth - 1)
+
+  emit(state, "write", string.format("for (%s = 0; %s < %d; ++%s)", indexvar, indexvar, node.total_elements, indexvar))
+  emit(state, "start_group", "{")
+  result = emit_type(state, elem, string.format("%s[%s]", path, indexvar),
+    offset_add(offset, 0, { var = indexvar, stride = elem.resolved_size.bits }))
+  emit(state, "end_group", "}")
+
+  state.depth = state.depth - 1
+  return result
+end
+
+emit_type = function(state, node, path, offset)
+  if (not node or not node.resolved_size) then
+    return false
+  end
+  if (node.entity_type == "ARRAY_DATATYPE") then
+    return emit_array(state, node, path, offset)
+  elseif (node.decode_sequence) then
+    return emit_container(state, node, path, offset)
+  end
+  return emit_scalar(state, node, path, offset)
+end
+
+-- -----------------------------------------------------------------------
+-- Build the body of a pack or unpack function, or nil if not possible
+-- -----------------------------------------------------------------------
+local function build_codec_body(node, mode)
+  local state = { mode = mode, code = {}, depth = 0, maxdepth = 0 }
+  if (not emit_container(state, node, "Obj->", { base = 0, terms = {}, aligned = true })) then
+    return nil
+  end
+  return state
+end
+
+-- -----------------------------------------------------------------------
+-- Write a complete pack or unpack function
+-- -----------------------------------------------------------------------
+local function write_codec_function(output, node, funcname, state)
+  local typedef_name = node.header_data.typedef_name
+
+  output:write(string.format("static void %s(void *DestBuffer, const void *SourceBuffer)", funcname))
+  output:start_group("{")
+  if (state.mode == "PACK") then
+    output:write("uint8_t *Dst = DestBuffer;")
+    output:write(string.format("const %s *Obj = SourceBuffer;", typedef_name))
+  else
+    output:write(string.format("%s *Obj = DestBuffer;", typedef_name))
+    output:write("const uint8_t *Src = SourceBuffer;")
+  end
+  for i = 1, state.maxdepth do
+    output:write(string.format("uint32_t i%d;", i - 1))
+  end
+  output:add_whitespace(1)
+  if (state.mode == "PACK") then
+    output:write(string.format("memset(Dst, 0, %d);", math.floor((node.resolved_size.bits + 7) / 8)))
+  else
+    output:write("memset(Obj, 0, sizeof(*Obj));")
+  end
+  for _,line in ipairs(state.code) do
+    output[line.kind](output, line.text)
+  end
+  output:end_group("}")
+  output:add_whitespace(1)
+end
+
+-- -----------------------------------------------------------------------------------------
+--                              Main output routine begins
+-- -----------------------------------------------------------------------------------------
+
+for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
+
+  local output = SEDS.output_open(SEDS.to_filename("codec_impl.c", ds.name), ds.xml_filename)
+
+  output:write("#include <string.h>")
+  output:write(string.format("#include \"edslib_database_types.h\""))
+  output:write(string.format("#include \"%s\"", SEDS.to_filename("typedefs.h", ds.name)))
+
+  output:section_marker("Bit Access Helpers")
+  for _,line in ipairs(codec_helper_source) do
+    output:write(line)
+  end
+
+  output:section_marker("Codec Functions")
+  for node in ds:iterate_subtree() do
+    if (node.edslib_refobj_local_index and node.header_data and node.decode_sequence and
+        node.resolved_size and node.resolved_size.bits > 0) then
+      local pack_state = build_codec_body(node, "PACK")
+      local unpack_state = pack_state and build_codec_body(node, "UNPACK")
+      if (unpack_state) then
+        local basename = node:get_flattened_name()
+        node.edslib_codec_name = basename .. "_CODEC"
+
+        output:add_documentation(string.format("Generated codec for %s \'%s\'", node.entity_type, node:get_qualified_name()),
+          "Data definition signature " .. node.resolved_size.checksum)
+        write_codec_function(output, node, basename .. "_CODEC_PACK", pack_state)
+        write_codec_function(output, node, basename .. "_CODEC_UNPACK", unpack_state)
+        output:write(string.format("const EdsLib_CodecDescriptor_t %s =", node.edslib_codec_name))
+        output:start_group("{")
+        output:write(string.format(".Pack = %s_CODEC_PACK,", basename))
+        output:write(string.format(".Unpack = %s_CODEC_UNPACK", basename))
+        output:end_group("};")
+        output:add_whitespace(1)
+      end
+    end
+  end
+
+  SEDS.output_close(output)
+
+end
+
+SEDS.info ("SEDS write codec functions END")
@@ -880,6 +880,12 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
     if (node.edslib_refobj_local_index and node.header_data) then
       datasheet_objs[1 + #datasheet_objs] = do_get_fields(datatype_output_handlers,nil,output,node)
       refnames[#datasheet_objs] = node:get_qualified_name()
+      -- generated codec functions are in a separate source file (see write codec functions step)
+      if (node.edslib_codec_name) then
+        output:write(string.format("extern const EdsLib_CodecDescriptor_t %s;", node.edslib_codec_name))
+        output:add_whitespace(1)
+        datasheet_objs[#datasheet_objs].Codec = "&" .. node.edslib_codec_name
+      end
     end
   end
 
@@ -891,7 +897,7 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   for idx,dsobj in ipairs(datasheet_objs) do
     output:append_previous(",")
     output:start_group(string.format("{ /* %s */", refnames[idx] or "(none)"))
-    for _,key in ipairs({ "Checksum", "BasicType", "Flags", "NumSubElements", "SizeInfo", "Detail.Array", "Detail.Container", "Detail.Number", "Detail.String" }) do
+    for _,key in ipairs({ "Checksum", "BasicType", "Flags", "NumSubElements", "SizeInfo", "Detail.Array", "Detail.Container", "Detail.Number", "Detail.String", "Codec" }) do
       if (dsobj[key]) then
         output:append_previous(",")
         output:write(string.format(".%s = %s", key, dsobj[key]))
@@ -33,6 +33,7 @@ local objdir = SEDS.get_define("OBJDIR") or "obj"
 local makefilename = SEDS.to_filename("db_objects.mk")
 local libtypes = { ".a", ".so", ".obj" }
 local dbobjects = { "_datatypedb_impl.o", "_displaydb_impl.o" }
+local dsobjects = { "_datatypedb_impl.o", "_displaydb_impl.o", "_codec_impl.o" }
 local global_sym_prefix = SEDS.get_define("MISSION_NAME")
 global_sym_prefix = global_sym_prefix and string.upper(global_sym_prefix) or "EDS"
 
@@ -128,7 +129,7 @@ for ds in SEDS.root:iterate_children(SEDS.basenode_filter) do
   output:write(string.format("# Targets from %s",ds.xml_filename))
   write_rule(output,
     get_objnames("$(O)", libtypes, "", ds.name) .. get_objnames("$(O)", libtypes, "db"),
-    get_objnames("$(O)", dbobjects, "", ds.name)
+    get_objnames("$(O)", dsobjects, "", ds.name)
   )
   output:add_whitespace(1)
 end
@@ -268,6 +268,22 @@ typedef union EdsLib_ObjectDetailDescriptor EdsLib_ObjectDetailDescriptor_t;
 #define EDSLIB_DATATYPE_FLAG_PACKED_LE      0x02
 #define EDSLIB_DATATYPE_FLAG_PACKED_MASK    0x03
 
+/*
+ * Generated codec function.  These are emitted by the EDS tool for container
+ * types where the encoding can be done with constant offsets, and convert
+ * between the complete native object and the complete packed object of
+ * a single type (derived types are not identified).
+ */
+typedef void (*EdsLib_CodecFunc_t)(void *DestBuffer, const void *SourceBuffer);
+
+struct EdsLib_CodecDescriptor
+{
+    EdsLib_CodecFunc_t Pack;
+    EdsLib_CodecFunc_t Unpack;
+};
+
+typedef struct EdsLib_CodecDescriptor EdsLib_CodecDescriptor_t;
+
 struct EdsLib_DataTypeDB_Entry
 {
     uint64_t Checksum;
@@ -276,6 +292,7 @@ struct EdsLib_DataTypeDB_Entry
     uint16_t NumSubElements;
     EdsLib_SizeInfo_t SizeInfo;
     EdsLib_ObjectDetailDescriptor_t Detail;
+    const EdsLib_CodecDescriptor_t *Codec;      /**< Generated codec, or NULL to use the interpreter */
 };
 
 typedef struct EdsLib_DataTypeDB_Entry EdsLib_DataTypeDB_Entry_t;
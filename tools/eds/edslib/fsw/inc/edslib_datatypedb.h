@@ -65,6 +65,17 @@
  */
 #define EDSLIB_VALUEBUFFER_MAX_BINARY_SIZE      32
 
+/**
+ * Maximum number of operations in a single codec plan
+ *
+ * Adjacent byte-aligned fields that do not need byte swapping are merged into
+ * a single operation, so this limits the number of fields that need to be
+ * swapped or bit-shifted, rather than the total number of fields.  Objects which
+ * need more than this cannot be compiled into a plan and must be handled via the
+ * regular pack/unpack API calls.
+ */
+#define EDSLIB_CODECPLAN_MAX_OPS                64
+
 
 
 /******************************
@@ -257,6 +268,48 @@ struct EdsLib_DataTypeDB_EntityInfo
 
 typedef struct EdsLib_DataTypeDB_EntityInfo EdsLib_DataTypeDB_EntityInfo_t;
 
+/**
+ * A single step within a codec plan
+ *
+ * The contents of this structure are internal to EdsLib and should not be
+ * used directly by application code.
+ */
+struct EdsLib_DataTypeDB_CodecOp
+{
+    uint8_t OpCode;                                     /**< Operation to perform */
+    uint8_t AlignBits;                                  /**< Bit offset within the first packed byte */
+    uint32_t SrcOffset;                                 /**< Byte offset within the source buffer */
+    uint32_t DstOffset;                                 /**< Byte offset within the destination buffer */
+    uint32_t Length;                                    /**< Number of bytes, for byte copy operations */
+    const struct EdsLib_DataTypeDB_Entry *DataDictPtr;  /**< Field type, for bitwise operations */
+};
+
+typedef struct EdsLib_DataTypeDB_CodecOp EdsLib_DataTypeDB_CodecOp_t;
+
+/**
+ * A precompiled pack or unpack operation for a single EDS data type
+ *
+ * Compiling walks the data type once and records a flat list of the copy,
+ * byte swap, and bitwise operations that packing or unpacking that type
+ * requires.  Executing the plan then only needs to run through this list,
+ * without consulting the database again.
+ *
+ * The plan refers to entries within the database, and so it remains valid only
+ * as long as the database object it was compiled from.  It is intended to be
+ * compiled once per message type and kept by the application for reuse.
+ */
+struct EdsLib_DataTypeDB_CodecPlan
+{
+    EdsLib_Id_t EdsId;                                  /**< The data type the plan was compiled for */
+    uint8_t OperMode;                                   /**< Whether the plan packs or unpacks */
+    bool ClearDest;                                     /**< Whether destination needs to be cleared first */
+    uint16_t NumOps;                                    /**< Number of valid entries in Ops */
+    EdsLib_SizeInfo_t Size;                             /**< Size of the data type */
+    EdsLib_DataTypeDB_CodecOp_t Ops[EDSLIB_CODECPLAN_MAX_OPS];
+};
+
+typedef struct EdsLib_DataTypeDB_CodecPlan EdsLib_DataTypeDB_CodecPlan_t;
+
 /**
  * The callback function assocated with EdsLib_DataTypeDB_ConstraintIterator()
  *
@@ -670,6 +723,74 @@ int32_t EdsLib_DataTypeDB_VerifyUnpackedObject(const EdsLib_DatabaseObject_t *GD
  */
 int32_t EdsLib_DataTypeDB_InitializeNativeObject(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, void *UnpackedObj);
 
+/**
+ * Compile a plan for packing objects of the given type.
+ *
+ * The plan performs the same operation as EdsLib_DataTypeDB_PackPartialObject()
+ * with a starting bit of 0, but it does not identify derived types.  The EdsId
+ * should therefore refer to the actual (most derived) type of the objects which
+ * will be packed.  As with the partial API, the EdsLib_DataTypeDB_FinalizePackedObject()
+ * API should be called on the result to compute any error control or length fields.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the data type to compile
+ * @param Plan Buffer to store the compiled plan
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful.
+ *      EDSLIB_INSUFFICIENT_MEMORY indicates the type requires more than
+ *      EDSLIB_CODECPLAN_MAX_OPS operations and must be packed via the regular API.
+ *
+ * \sa EdsLib_DataTypeDB_PackWithPlan()
+ */
+int32_t EdsLib_DataTypeDB_CompilePackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_CodecPlan_t *Plan);
+
+/**
+ * Compile a plan for unpacking objects of the given type.
+ *
+ * The plan performs the same operation as EdsLib_DataTypeDB_UnpackPartialObject()
+ * with a starting byte of 0, but it does not identify derived types.  The EdsId
+ * should therefore refer to the actual (most derived) type of the objects which
+ * will be unpacked.  As with the partial API, the EdsLib_DataTypeDB_VerifyUnpackedObject()
+ * API should be called on the result to check any error control or length fields.
+ *
+ * @param GD the runtime database object
+ * @param EdsId The identifier of the data type to compile
+ * @param Plan Buffer to store the compiled plan
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful.
+ *      EDSLIB_INSUFFICIENT_MEMORY indicates the type requires more than
+ *      EDSLIB_CODECPLAN_MAX_OPS operations and must be unpacked via the regular API.
+ *
+ * \sa EdsLib_DataTypeDB_UnpackWithPlan()
+ */
+int32_t EdsLib_DataTypeDB_CompileUnpackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_CodecPlan_t *Plan);
+
+/**
+ * Pack a native object using a plan from EdsLib_DataTypeDB_CompilePackPlan()
+ *
+ * @param Plan The compiled pack plan
+ * @param DestBuffer Pointer to the encoded/packed output buffer
+ * @param SourceBuffer Pointer to the decoded/unpacked input buffer
+ * @param MaxPackedBitSize Maximum size of destination buffer, in bits
+ * @param SourceByteSize Size of the source buffer, in bytes
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_PackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t MaxPackedBitSize, uint32_t SourceByteSize);
+
+/**
+ * Unpack a packed object using a plan from EdsLib_DataTypeDB_CompileUnpackPlan()
+ *
+ * @param Plan The compiled unpack plan
+ * @param DestBuffer Pointer to the decoded/unpacked output buffer
+ * @param SourceBuffer Pointer to the encoded/packed input buffer
+ * @param MaxNativeByteSize Maximum size of destination buffer, in bytes
+ * @param SourceBitSize Size of the source buffer, in bits
+ * @return EDSLIB_SUCCESS if successful, error code if unsuccessful
+ */
+int32_t EdsLib_DataTypeDB_UnpackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t MaxNativeByteSize, uint32_t SourceBitSize);
+
 /**
  * Given an unpacked/native buffer, extract a value using EDS-specified semantics.
  *
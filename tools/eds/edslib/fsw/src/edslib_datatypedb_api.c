@@ -640,6 +640,68 @@ int32_t EdsLib_DataTypeDB_UnpackCompleteObject(const EdsLib_DatabaseObject_t *GD
     return Status;
 }
 
+int32_t EdsLib_DataTypeDB_CompilePackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_CodecPlan_t *Plan)
+{
+    EdsLib_DatabaseRef_t RefObj;
+
+    memset(Plan, 0, sizeof(*Plan));
+    Plan->EdsId = EdsId;
+    Plan->OperMode = EDSLIB_BITPACK_OPERMODE_PACK;
+    EdsLib_Decode_StructId(&RefObj, EdsId);
+
+    return EdsLib_CodecPlanCompile_Impl(GD, &RefObj, Plan);
+}
+
+int32_t EdsLib_DataTypeDB_CompileUnpackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+        EdsLib_DataTypeDB_CodecPlan_t *Plan)
+{
+    EdsLib_DatabaseRef_t RefObj;
+
+    memset(Plan, 0, sizeof(*Plan));
+    Plan->EdsId = EdsId;
+    Plan->OperMode = EDSLIB_BITPACK_OPERMODE_UNPACK;
+    EdsLib_Decode_StructId(&RefObj, EdsId);
+
+    return EdsLib_CodecPlanCompile_Impl(GD, &RefObj, Plan);
+}
+
+int32_t EdsLib_DataTypeDB_PackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t MaxPackedBitSize, uint32_t SourceByteSize)
+{
+    if (Plan->OperMode != EDSLIB_BITPACK_OPERMODE_PACK || Plan->Size.Bits == 0)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    if (MaxPackedBitSize < Plan->Size.Bits || SourceByteSize < Plan->Size.Bytes)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    EdsLib_CodecPlanExecute_Impl(Plan, DestBuffer, SourceBuffer);
+
+    return EDSLIB_SUCCESS;
+}
+
+int32_t EdsLib_DataTypeDB_UnpackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan,
+        void *DestBuffer, const void *SourceBuffer, uint32_t MaxNativeByteSize, uint32_t SourceBitSize)
+{
+    if (Plan->OperMode != EDSLIB_BITPACK_OPERMODE_UNPACK || Plan->Size.Bytes == 0)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    if (MaxNativeByteSize < Plan->Size.Bytes || SourceBitSize < Plan->Size.Bits)
+    {
+        return EDSLIB_BUFFER_SIZE_ERROR;
+    }
+
+    EdsLib_CodecPlanExecute_Impl(Plan, DestBuffer, SourceBuffer);
+
+    return EDSLIB_SUCCESS;
+}
+
 int32_t EdsLib_DataTypeDB_LoadValue(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId, EdsLib_GenericValueBuffer_t *DestBuffer, const void *SrcPtr)
 {
     EdsLib_DatabaseRef_t TempRef;
@@ -35,6 +35,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include "edslib_internal.h"
+#include "crc_engine.h"
 
 /*
  * CRC Algorithm: CRC-16/CCITT-FALSE
@@ -64,6 +65,7 @@ static uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM_LONGITUDINAL(const void *
 static uintmax_t EdsLib_ErrorControlAlgorithm_CRC16_CCITT(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 static uintmax_t EdsLib_ErrorControlAlgorithm_CRC8(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 static uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
+static uintmax_t EdsLib_ErrorControlAlgorithm_CRC32(const void *Base, uint32_t Size, uint32_t ErrCtlBitPos);
 
 
 static const EdsLib_ErrorControlImpl_t EDSLIB_ERRCTL_DISPATCH[EdsLib_ErrorControlType_MAX] =
@@ -73,7 +75,7 @@ static const EdsLib_ErrorControlImpl_t EDSLIB_ERRCTL_DISPATCH[EdsLib_ErrorContro
         [EdsLib_ErrorControlType_CHECKSUM_LONGITUDINAL] = EdsLib_ErrorControlAlgorithm_CHECKSUM_LONGITUDINAL,
         [EdsLib_ErrorControlType_CRC8] = EdsLib_ErrorControlAlgorithm_CRC8,
         [EdsLib_ErrorControlType_CRC16_CCITT] = EdsLib_ErrorControlAlgorithm_CRC16_CCITT,
-        [EdsLib_ErrorControlType_CRC32] = EdsLib_ErrorControlAlgorithm_ZERO /* placeholder; not implemented yet */
+        [EdsLib_ErrorControlType_CRC32] = EdsLib_ErrorControlAlgorithm_CRC32
 };
 
 
@@ -97,6 +99,9 @@ void EdsLib_ErrorControl_Initialize(void)
     uint32_t crc16_shiftreg;
     uint32_t crc8_shiftreg;
 
+    /* The byte-aligned CRC cases use the shared CRC engine */
+    CRC_Initialize();
+
     for (i = 0; i < 256; ++i)
     {
         crc16_shiftreg = i << 8;
@@ -142,6 +147,42 @@ uintmax_t EdsLib_ErrorControlAlgorithm_ZERO(const void *Base, uint32_t TotalBitS
     return 0;
 }
 
+/*
+ * Computes a CRC using the shared CRC engine, for the common case where both the
+ * error control field and the total size are a whole number of bytes.  The bytes
+ * of the error control field itself (ErrCtlBits wide) are excluded.
+ */
+static uint32_t EdsLib_ErrorControl_ByteAlignedCRC(CRC_Algorithm_t Algorithm, const void *Base, uint32_t TotalBitSize,
+        uint32_t ErrCtlBitPos, uint32_t ErrCtlBits)
+{
+    const uint8_t *SrcPtr;
+    CRC_State_t State;
+    uint32_t TotalBytes;
+    uint32_t ErrCtlByte;
+    uint32_t ResumeByte;
+
+    SrcPtr = Base;
+    TotalBytes = TotalBitSize >> 3;
+    ErrCtlByte = ErrCtlBitPos >> 3;
+    ResumeByte = (ErrCtlBitPos + ErrCtlBits) >> 3;
+
+    CRC_Init(&State, Algorithm);
+    if (ErrCtlByte >= TotalBytes)
+    {
+        CRC_Update(&State, SrcPtr, TotalBytes);
+    }
+    else
+    {
+        CRC_Update(&State, SrcPtr, ErrCtlByte);
+        if (ResumeByte < TotalBytes)
+        {
+            CRC_Update(&State, &SrcPtr[ResumeByte], TotalBytes - ResumeByte);
+        }
+    }
+
+    return CRC_Final(&State);
+}
+
 
 uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM_LONGITUDINAL(const void *Base, uint32_t TotalBitSize, uint32_t ErrCtlBitPos)
 {
@@ -192,6 +233,11 @@ uintmax_t EdsLib_ErrorControlAlgorithm_CRC16_CCITT(const void *Base, uint32_t To
     uint16_t crc;
     uint8_t byte;
 
+    if (((TotalBitSize | ErrCtlBitPos) & 0x7) == 0)
+    {
+        return EdsLib_ErrorControl_ByteAlignedCRC(CRC_ALGORITHM_CRC16_CCITT_FALSE, Base, TotalBitSize, ErrCtlBitPos, 16);
+    }
+
     crc = 0xFFFF;
     SrcPtr = Base;
     CurrBitPos = 0;
@@ -358,6 +404,21 @@ uintmax_t EdsLib_ErrorControlAlgorithm_CHECKSUM(const void *Base, uint32_t Total
 }
 
 
+uintmax_t EdsLib_ErrorControlAlgorithm_CRC32(const void *Base, uint32_t TotalBitSize, uint32_t ErrCtlBitPos)
+{
+    /*
+     * Only byte-aligned containers are supported for CRC-32; this
+     * covers all practical uses.  Otherwise return 0 as before.
+     */
+    if (((TotalBitSize | ErrCtlBitPos) & 0x7) != 0)
+    {
+        return 0;
+    }
+
+    return EdsLib_ErrorControl_ByteAlignedCRC(CRC_ALGORITHM_CRC32, Base, TotalBitSize, ErrCtlBitPos, 32);
+}
+
+
 /*******************************************************
  * MAIN ERROR CONTROL IMPLEMENTATION FUNCTION
  *******************************************************/
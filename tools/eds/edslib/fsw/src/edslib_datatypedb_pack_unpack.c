@@ -1478,96 +1478,26 @@ static void EdsLib_Internal_DoBitwiseUnpack(uint8_t *DstPtr, const uint8_t *SrcP
     }
 }
 
-static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_DatabaseObject_t *GD,
-        EdsLib_Iterator_CbType_t CbType,
-        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
-        void *OpaqueArg)
+/*
+ * Determine how a single member should be handled when packing or unpacking.
+ *
+ * This is shared between the interpretive pack/unpack callback and the codec
+ * plan compiler, so both always make the same decision for a given field.
+ */
+static EdsLib_PackAction_t EdsLib_DataTypePackUnpack_GetAction(EdsLib_BitPack_OperMode_t OperMode,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo)
 {
-    EdsLib_DataTypePackUnpack_ControlBlock_t *Base = (EdsLib_DataTypePackUnpack_ControlBlock_t *)OpaqueArg;
-    const uint8_t *SrcPtr;
-    uint8_t *DstPtr;
     EdsLib_PackAction_t PackAction;
     uint32_t AlignBits;
     bool IsByteOrderMatch;
     bool IsPacked;
 
     /*
-     * Generally we do not care about START/END callbacks -
-     * however on the START callback it is a useful chance to
-     * verify that we have enough buffer space to store the object,
-     * and to clear the destination memory before writing into it.
-     *
-     * Note this is only done on the first top-level START callback where
-     * the refobj matches the controlblock refobj.  This reflects the largest
-     * object being handled, all other START callbacks will be for sub-objects
-     * inside this.
-     */
-    if (CbType == EDSLIB_ITERATOR_CBTYPE_START &&
-            Base->RefObj.AppIndex == CbInfo->Details.RefObj.AppIndex &&
-            Base->RefObj.TypeIndex == CbInfo->Details.RefObj.TypeIndex)
-    {
-        if (Base->MaxSize.Bytes < CbInfo->DataDictPtr->SizeInfo.Bytes ||
-                Base->MaxSize.Bits < CbInfo->DataDictPtr->SizeInfo.Bits)
-        {
-            Base->Status = EDSLIB_BUFFER_SIZE_ERROR;
-            return EDSLIB_ITERATOR_RC_STOP;
-        }
-
-        /*
-         * Clear out the target buffer before writing new data into it.
-         *
-         * In certain circumstances the data needs to be packed/unpacked in
-         * multiple passes, for instance when the data needs to be identified externally
-         * before continuing the operation.
-         *
-         * In these cases the clearing must only be done on the area that has not
-         * already been processed, to avoid clobbering data that was already packed.
-         *
-         * When packing, use the "bits" value, and when unpacking use the "bytes" value
-         * as the reference for where to begin clearing
-         */
-        uint32_t StartOffset;
-        uint32_t EndOffset;
-        switch(Base->OperMode)
-        {
-        case EDSLIB_BITPACK_OPERMODE_PACK:
-        {
-            StartOffset = (Base->ProcessedSize.Bits + 7) / 8;
-            EndOffset = (CbInfo->EndOffset.Bits + 7) / 8;
-            break;
-        }
-        case EDSLIB_BITPACK_OPERMODE_UNPACK:
-        {
-            StartOffset = Base->ProcessedSize.Bytes;
-            EndOffset = CbInfo->EndOffset.Bytes;
-            break;
-        }
-        default:
-        {
-            StartOffset = 0;
-            EndOffset = 0;
-            break;
-        }
-        }
-
-        if (StartOffset < EndOffset)
-        {
-            DstPtr = Base->DestBasePtr;
-            DstPtr += StartOffset;
-            memset(DstPtr, 0, EndOffset - StartOffset);
-        }
-
-        return EDSLIB_ITERATOR_RC_CONTINUE;
-    }
-
-    /*
-     * Any other callback types other than member, just continue on.
-     * Also padding entries are irrelevant here, just skip them.
+     * Padding entries are irrelevant here, just skip them.
      */
-    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER ||
-            CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_PADDING_ENTRY)
+    if (CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_PADDING_ENTRY)
     {
-        return EDSLIB_ITERATOR_RC_CONTINUE;
+        return EDSLIB_PACKACTION_NONE;
     }
 
     /*
@@ -1583,25 +1513,12 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
      * for instance in the case of error control fields the data should be set to all zero as
      * a prerequisite to calculating the value.
      */
-    if (Base->OperMode == EDSLIB_BITPACK_OPERMODE_PACK &&
+    if (OperMode == EDSLIB_BITPACK_OPERMODE_PACK &&
             (CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_ERROR_CONTROL_ENTRY ||
              CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_LENGTH_ENTRY ||
              CbInfo->Details.EntryType == EDSLIB_ENTRYTYPE_CONTAINER_FIXED_VALUE_ENTRY))
     {
-        return EDSLIB_ITERATOR_RC_CONTINUE;
-    }
-
-    /*
-     * In certain circumstances the data needs to be packed/unpacked in
-     * multiple passes, for instance when the data needs to be identified externally
-     * before continuing the operation.
-     *
-     * This means that the field has already been packed and it should be skipped entirely.
-     */
-    if (CbInfo->EndOffset.Bits <= Base->ProcessedSize.Bits ||
-            CbInfo->EndOffset.Bytes <= Base->ProcessedSize.Bytes)
-    {
-        return EDSLIB_ITERATOR_RC_CONTINUE;
+        return EDSLIB_PACKACTION_NONE;
     }
 
     /*
@@ -1690,6 +1607,113 @@ static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_Data
     }
     }
 
+    return PackAction;
+}
+
+static EdsLib_Iterator_Rc_t EdsLib_DataTypePackUnpack_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_DataTypePackUnpack_ControlBlock_t *Base = (EdsLib_DataTypePackUnpack_ControlBlock_t *)OpaqueArg;
+    const uint8_t *SrcPtr;
+    uint8_t *DstPtr;
+    EdsLib_PackAction_t PackAction;
+    uint32_t AlignBits;
+
+    /*
+     * Generally we do not care about START/END callbacks -
+     * however on the START callback it is a useful chance to
+     * verify that we have enough buffer space to store the object,
+     * and to clear the destination memory before writing into it.
+     *
+     * Note this is only done on the first top-level START callback where
+     * the refobj matches the controlblock refobj.  This reflects the largest
+     * object being handled, all other START callbacks will be for sub-objects
+     * inside this.
+     */
+    if (CbType == EDSLIB_ITERATOR_CBTYPE_START &&
+            Base->RefObj.AppIndex == CbInfo->Details.RefObj.AppIndex &&
+            Base->RefObj.TypeIndex == CbInfo->Details.RefObj.TypeIndex)
+    {
+        if (Base->MaxSize.Bytes < CbInfo->DataDictPtr->SizeInfo.Bytes ||
+                Base->MaxSize.Bits < CbInfo->DataDictPtr->SizeInfo.Bits)
+        {
+            Base->Status = EDSLIB_BUFFER_SIZE_ERROR;
+            return EDSLIB_ITERATOR_RC_STOP;
+        }
+
+        /*
+         * Clear out the target buffer before writing new data into it.
+         *
+         * In certain circumstances the data needs to be packed/unpacked in
+         * multiple passes, for instance when the data needs to be identified externally
+         * before continuing the operation.
+         *
+         * In these cases the clearing must only be done on the area that has not
+         * already been processed, to avoid clobbering data that was already packed.
+         *
+         * When packing, use the "bits" value, and when unpacking use the "bytes" value
+         * as the reference for where to begin clearing
+         */
+        uint32_t StartOffset;
+        uint32_t EndOffset;
+        switch(Base->OperMode)
+        {
+        case EDSLIB_BITPACK_OPERMODE_PACK:
+        {
+            StartOffset = (Base->ProcessedSize.Bits + 7) / 8;
+            EndOffset = (CbInfo->EndOffset.Bits + 7) / 8;
+            break;
+        }
+        case EDSLIB_BITPACK_OPERMODE_UNPACK:
+        {
+            StartOffset = Base->ProcessedSize.Bytes;
+            EndOffset = CbInfo->EndOffset.Bytes;
+            break;
+        }
+        default:
+        {
+            StartOffset = 0;
+            EndOffset = 0;
+            break;
+        }
+        }
+
+        if (StartOffset < EndOffset)
+        {
+            DstPtr = Base->DestBasePtr;
+            DstPtr += StartOffset;
+            memset(DstPtr, 0, EndOffset - StartOffset);
+        }
+
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    /*
+     * Any other callback types other than member, just continue on.
+     */
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    /*
+     * In certain circumstances the data needs to be packed/unpacked in
+     * multiple passes, for instance when the data needs to be identified externally
+     * before continuing the operation.
+     *
+     * This means that the field has already been packed and it should be skipped entirely.
+     */
+    if (CbInfo->EndOffset.Bits <= Base->ProcessedSize.Bits ||
+            CbInfo->EndOffset.Bytes <= Base->ProcessedSize.Bytes)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    PackAction = EdsLib_DataTypePackUnpack_GetAction(Base->OperMode, CbInfo);
+    AlignBits = CbInfo->StartOffset.Bits & 0x07;
+
     if (PackAction == EDSLIB_PACKACTION_NONE)
     {
         /*
@@ -1775,6 +1799,7 @@ void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_Da
     const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
     const void *NativeBuffer;
     EdsLib_DatabaseRef_t NextBaseObj;
+    bool UseCodec;
     int32_t Status;
 
     EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
@@ -1784,6 +1809,12 @@ void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_Da
 
     Status = EDSLIB_SUCCESS;
 
+    /*
+     * Generated codecs always process the complete object, so they
+     * can only be used if nothing was processed before this call.
+     */
+    UseCodec = (PackState->ProcessedSize.Bits == 0 && PackState->ProcessedSize.Bytes == 0);
+
     if (PackState->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
     {
         NativeBuffer = PackState->SourceBasePtr;
@@ -1809,17 +1840,31 @@ void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_Da
             break;
         }
 
-        EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, NextBaseObj);
-        Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
-        if (PackState->Status != EDSLIB_SUCCESS)
+        if (UseCodec && DataDictPtr->Codec != NULL)
         {
-            break;
+            if (PackState->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+            {
+                DataDictPtr->Codec->Pack(PackState->DestBasePtr, PackState->SourceBasePtr);
+            }
+            else
+            {
+                DataDictPtr->Codec->Unpack(PackState->DestBasePtr, PackState->SourceBasePtr);
+            }
         }
-
-        if (Status != EDSLIB_SUCCESS)
+        else
         {
-            PackState->Status = Status;
-            break;
+            EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, NextBaseObj);
+            Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+            if (PackState->Status != EDSLIB_SUCCESS)
+            {
+                break;
+            }
+
+            if (Status != EDSLIB_SUCCESS)
+            {
+                PackState->Status = Status;
+                break;
+            }
         }
 
         /* Record the depth that has been successfully packed */
@@ -1847,6 +1892,243 @@ void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_Da
     }
 }
 
+static EdsLib_Iterator_Rc_t EdsLib_CodecPlanCompile_Callback(const EdsLib_DatabaseObject_t *GD,
+        EdsLib_Iterator_CbType_t CbType,
+        const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
+        void *OpaqueArg)
+{
+    EdsLib_CodecPlanCompile_ControlBlock_t *CtlBlock = (EdsLib_CodecPlanCompile_ControlBlock_t *)OpaqueArg;
+    EdsLib_DataTypeDB_CodecPlan_t *Plan = CtlBlock->Plan;
+    EdsLib_DataTypeDB_CodecOp_t *PrevOp;
+    EdsLib_DataTypeDB_CodecOp_t *Op;
+    EdsLib_PackAction_t PackAction;
+    uint32_t SrcOffset;
+    uint32_t DstOffset;
+
+    if (CbType != EDSLIB_ITERATOR_CBTYPE_MEMBER)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    /*
+     * Use exactly the same decision as the interpretive path, so that
+     * executing the plan always produces identical output.
+     */
+    PackAction = EdsLib_DataTypePackUnpack_GetAction(Plan->OperMode, CbInfo);
+    if (PackAction == EDSLIB_PACKACTION_NONE)
+    {
+        return EDSLIB_ITERATOR_RC_CONTINUE;
+    }
+
+    if (PackAction == EDSLIB_PACKACTION_SUBCOMPONENTS)
+    {
+        return EDSLIB_ITERATOR_RC_DESCEND;
+    }
+
+    if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+    {
+        SrcOffset = CbInfo->StartOffset.Bytes;
+        DstOffset = CbInfo->StartOffset.Bits / 8;
+    }
+    else
+    {
+        SrcOffset = CbInfo->StartOffset.Bits / 8;
+        DstOffset = CbInfo->StartOffset.Bytes;
+    }
+
+    /*
+     * Inverting the byte order of a single byte is the same as copying it,
+     * and doing so allows it to be merged with neighboring copies.
+     */
+    if (PackAction == EDSLIB_PACKACTION_BYTECOPY_INVERT && CbInfo->DataDictPtr->SizeInfo.Bytes == 1)
+    {
+        PackAction = EDSLIB_PACKACTION_BYTECOPY_STRAIGHT;
+    }
+
+    /*
+     * Merge adjacent straight copies into a single operation.  Fields that
+     * are byte aligned and already in the correct byte order are contiguous
+     * in both representations as long as there is no padding in between,
+     * so these typically collapse into a few large copies.
+     */
+    if (PackAction == EDSLIB_PACKACTION_BYTECOPY_STRAIGHT && Plan->NumOps > 0)
+    {
+        PrevOp = &Plan->Ops[Plan->NumOps - 1];
+        if (PrevOp->OpCode == EDSLIB_PACKACTION_BYTECOPY_STRAIGHT &&
+                (PrevOp->SrcOffset + PrevOp->Length) == SrcOffset &&
+                (PrevOp->DstOffset + PrevOp->Length) == DstOffset)
+        {
+            PrevOp->Length += CbInfo->DataDictPtr->SizeInfo.Bytes;
+            return EDSLIB_ITERATOR_RC_CONTINUE;
+        }
+    }
+
+    if (Plan->NumOps >= EDSLIB_CODECPLAN_MAX_OPS)
+    {
+        CtlBlock->Status = EDSLIB_INSUFFICIENT_MEMORY;
+        return EDSLIB_ITERATOR_RC_STOP;
+    }
+
+    Op = &Plan->Ops[Plan->NumOps];
+    ++Plan->NumOps;
+
+    Op->OpCode = PackAction;
+    Op->AlignBits = CbInfo->StartOffset.Bits & 0x07;
+    Op->SrcOffset = SrcOffset;
+    Op->DstOffset = DstOffset;
+    Op->Length = CbInfo->DataDictPtr->SizeInfo.Bytes;
+    Op->DataDictPtr = CbInfo->DataDictPtr;
+
+    return EDSLIB_ITERATOR_RC_CONTINUE;
+}
+
+int32_t EdsLib_CodecPlanCompile_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj,
+        EdsLib_DataTypeDB_CodecPlan_t *Plan)
+{
+    EdsLib_CodecPlanCompile_ControlBlock_t CtlBlock;
+    const EdsLib_DataTypeDB_Entry_t *DataDictPtr;
+    uint32_t DestSize;
+    uint32_t CoveredSize;
+    uint16_t i;
+    int32_t Status;
+
+    EDSLIB_DECLARE_ITERATOR_CB(IteratorState,
+            EDSLIB_ITERATOR_MAX_DEEP_DEPTH,
+            EdsLib_CodecPlanCompile_Callback,
+            &CtlBlock);
+
+    DataDictPtr = EdsLib_DataTypeDB_GetEntry(GD, RefObj);
+    if (DataDictPtr == NULL || DataDictPtr->SizeInfo.Bits == 0)
+    {
+        return EDSLIB_INCOMPLETE_DB_OBJECT;
+    }
+
+    Plan->NumOps = 0;
+    Plan->Size = DataDictPtr->SizeInfo;
+
+    memset(&CtlBlock, 0, sizeof(CtlBlock));
+    CtlBlock.Plan = Plan;
+
+    EDSLIB_RESET_ITERATOR_FROM_REFOBJ(IteratorState, *RefObj);
+    Status = EdsLib_DataTypeIterator_Impl(GD, &IteratorState.Cb);
+    if (Status == EDSLIB_SUCCESS)
+    {
+        Status = CtlBlock.Status;
+    }
+
+    if (Status != EDSLIB_SUCCESS)
+    {
+        Plan->NumOps = 0;
+        return Status;
+    }
+
+    /*
+     * The destination only needs to be cleared beforehand if some part of it
+     * will not be completely overwritten by byte copies.  Bitwise operations
+     * merge into the existing content, and padding or (when packing) special
+     * fields are not written at all.
+     */
+    if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+    {
+        DestSize = (Plan->Size.Bits + 7) / 8;
+    }
+    else
+    {
+        DestSize = Plan->Size.Bytes;
+    }
+
+    CoveredSize = 0;
+    Plan->ClearDest = false;
+    for (i = 0; i < Plan->NumOps; ++i)
+    {
+        if (Plan->Ops[i].OpCode == EDSLIB_PACKACTION_BITPACK)
+        {
+            Plan->ClearDest = true;
+        }
+        else
+        {
+            CoveredSize += Plan->Ops[i].Length;
+        }
+    }
+
+    if (CoveredSize < DestSize)
+    {
+        Plan->ClearDest = true;
+    }
+
+    return EDSLIB_SUCCESS;
+}
+
+void EdsLib_CodecPlanExecute_Impl(const EdsLib_DataTypeDB_CodecPlan_t *Plan, void *DestBuffer, const void *SourceBuffer)
+{
+    const EdsLib_DataTypeDB_CodecOp_t *Op;
+    const uint8_t *SrcPtr;
+    uint8_t *DstPtr;
+    uint32_t Size;
+    uint16_t i;
+
+    if (Plan->ClearDest)
+    {
+        if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+        {
+            memset(DestBuffer, 0, (Plan->Size.Bits + 7) / 8);
+        }
+        else
+        {
+            memset(DestBuffer, 0, Plan->Size.Bytes);
+        }
+    }
+
+    Op = Plan->Ops;
+    for (i = 0; i < Plan->NumOps; ++i)
+    {
+        SrcPtr = SourceBuffer;
+        SrcPtr += Op->SrcOffset;
+        DstPtr = DestBuffer;
+        DstPtr += Op->DstOffset;
+
+        switch(Op->OpCode)
+        {
+        case EDSLIB_PACKACTION_BYTECOPY_STRAIGHT:
+        {
+            memcpy(DstPtr, SrcPtr, Op->Length);
+            break;
+        }
+        case EDSLIB_PACKACTION_BYTECOPY_INVERT:
+        {
+            Size = Op->Length;
+            DstPtr += Size;
+            while(Size > 0)
+            {
+                --DstPtr;
+                *DstPtr = *SrcPtr;
+                ++SrcPtr;
+                --Size;
+            }
+            break;
+        }
+        case EDSLIB_PACKACTION_BITPACK:
+        {
+            if (Plan->OperMode == EDSLIB_BITPACK_OPERMODE_PACK)
+            {
+                EdsLib_Internal_DoBitwisePack(DstPtr, SrcPtr, Op->DataDictPtr, Op->AlignBits);
+            }
+            else
+            {
+                EdsLib_Internal_DoBitwiseUnpack(DstPtr, SrcPtr, Op->DataDictPtr, Op->AlignBits);
+            }
+            break;
+        }
+        default:
+        {
+            break;
+        }
+        }
+
+        ++Op;
+    }
+}
+
 EdsLib_Iterator_Rc_t EdsLib_PackedObject_PostProc_Callback(const EdsLib_DatabaseObject_t *GD,
         EdsLib_Iterator_CbType_t CbType,
         const EdsLib_DataTypeIterator_StackEntry_t *CbInfo,
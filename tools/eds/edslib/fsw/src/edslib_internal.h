@@ -246,6 +246,12 @@ typedef struct
     int32_t Status;
 } EdsLib_DataTypePackUnpack_ControlBlock_t;
 
+typedef struct
+{
+    EdsLib_DataTypeDB_CodecPlan_t *Plan;
+    int32_t Status;
+} EdsLib_CodecPlanCompile_ControlBlock_t;
+
 typedef struct
 {
     void *BasePtr;
@@ -411,6 +417,8 @@ int32_t EdsLib_DataTypeDB_ConstraintIterator_Impl(const EdsLib_DatabaseObject_t
 int32_t EdsLib_DataTypeDB_ConstraintIterator(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t BaseId, EdsLib_Id_t DerivedId, EdsLib_ConstraintCallback_t Callback, void *CbArg);
 
 void EdsLib_DataTypePackUnpack_Impl(const EdsLib_DatabaseObject_t *GD, EdsLib_DataTypePackUnpack_ControlBlock_t *PackState);
+int32_t EdsLib_CodecPlanCompile_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DatabaseRef_t *RefObj, EdsLib_DataTypeDB_CodecPlan_t *Plan);
+void EdsLib_CodecPlanExecute_Impl(const EdsLib_DataTypeDB_CodecPlan_t *Plan, void *DestBuffer, const void *SourceBuffer);
 int32_t EdsLib_DataTypeIdentifyBuffer_Impl(const EdsLib_DatabaseObject_t *GD, const EdsLib_DataTypeDB_Entry_t *DataDictPtr, const void *Buffer, uint16_t *DerivTableIndex, EdsLib_DatabaseRef_t *ActualObj);
 
 void EdsLib_DataTypeConstraintEntityLookup_Impl(const EdsLib_DataTypeDB_Entry_t *DataDictPtr, uint16_t ConstraintIdx, const EdsLib_DatabaseRef_t **RefObjPtr, EdsLib_SizeInfo_t *Offset);
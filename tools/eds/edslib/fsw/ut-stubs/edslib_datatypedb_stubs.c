@@ -58,6 +58,44 @@ int32_t EdsLib_DataTypeDB_BaseCheck(const EdsLib_DatabaseObject_t *GD, EdsLib_Id
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_BaseCheck, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_CompilePackPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_CompilePackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                          EdsLib_DataTypeDB_CodecPlan_t *Plan)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_CompilePackPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompilePackPlan, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompilePackPlan, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompilePackPlan, EdsLib_DataTypeDB_CodecPlan_t *, Plan);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_CompilePackPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_CompilePackPlan, int32_t);
+}
+
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_CompileUnpackPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_CompileUnpackPlan(const EdsLib_DatabaseObject_t *GD, EdsLib_Id_t EdsId,
+                                            EdsLib_DataTypeDB_CodecPlan_t *Plan)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_CompileUnpackPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompileUnpackPlan, const EdsLib_DatabaseObject_t *, GD);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompileUnpackPlan, EdsLib_Id_t, EdsId);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_CompileUnpackPlan, EdsLib_DataTypeDB_CodecPlan_t *, Plan);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_CompileUnpackPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_CompileUnpackPlan, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_ConstraintIterator()
@@ -349,6 +387,27 @@ int32_t EdsLib_DataTypeDB_PackPartialObject(const EdsLib_DatabaseObject_t *GD, E
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_PackPartialObject, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_PackWithPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_PackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan, void *DestBuffer,
+                                       const void *SourceBuffer, uint32_t MaxPackedBitSize, uint32_t SourceByteSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_PackWithPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackWithPlan, const EdsLib_DataTypeDB_CodecPlan_t *, Plan);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackWithPlan, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackWithPlan, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackWithPlan, uint32_t, MaxPackedBitSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_PackWithPlan, uint32_t, SourceByteSize);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_PackWithPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_PackWithPlan, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_Register()
@@ -433,6 +492,27 @@ int32_t EdsLib_DataTypeDB_UnpackPartialObject(const EdsLib_DatabaseObject_t *GD,
     return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_UnpackPartialObject, int32_t);
 }
 
+/*
+ * ----------------------------------------------------
+ * Generated stub function for EdsLib_DataTypeDB_UnpackWithPlan()
+ * ----------------------------------------------------
+ */
+int32_t EdsLib_DataTypeDB_UnpackWithPlan(const EdsLib_DataTypeDB_CodecPlan_t *Plan, void *DestBuffer,
+                                         const void *SourceBuffer, uint32_t MaxNativeByteSize, uint32_t SourceBitSize)
+{
+    UT_GenStub_SetupReturnBuffer(EdsLib_DataTypeDB_UnpackWithPlan, int32_t);
+
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackWithPlan, const EdsLib_DataTypeDB_CodecPlan_t *, Plan);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackWithPlan, void *, DestBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackWithPlan, const void *, SourceBuffer);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackWithPlan, uint32_t, MaxNativeByteSize);
+    UT_GenStub_AddParam(EdsLib_DataTypeDB_UnpackWithPlan, uint32_t, SourceBitSize);
+
+    UT_GenStub_Execute(EdsLib_DataTypeDB_UnpackWithPlan, Basic, NULL);
+
+    return UT_GenStub_GetReturnValue(EdsLib_DataTypeDB_UnpackWithPlan, int32_t);
+}
+
 /*
  * ----------------------------------------------------
  * Generated stub function for EdsLib_DataTypeDB_Unregister()
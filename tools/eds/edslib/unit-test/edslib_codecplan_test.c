@@ -0,0 +1,193 @@
+/*
+ * LEW-19710-1, CCSDS SOIS Electronic Data Sheet Implementation
+ * 
+ * Copyright (c) 2020 United States Government as represented by
+ * the Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+/**
+ * \file     edslib_codecplan_test.c
+ * \ingroup  edslib
+ *
+ * Checks that precompiled codec plans produce the same output as the
+ * interpretive pack/unpack path, and compares the packet rate of both.
+ *
+ * The rates are informational only; they are intended to be compared on
+ * the same machine before and after changes to the pack/unpack logic.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "utassert.h"
+
+#include <stdint.h>
+#include <cfe_mission_cfg.h>
+#include <UTM_eds_index.h>
+
+#include "edslib_datatypedb.h"
+#include "edslib_id.h"
+#include "UTHDR_msgdefs.h"
+#include "UT1_msgdefs.h"
+
+#define CODECPLAN_TEST_ITERATIONS   200000
+#define CODECPLAN_TEST_BUFSIZE      1024
+
+extern EdsLib_DatabaseObject_t GD_BASIC;
+
+static union
+{
+    uint8_t Bytes[CODECPLAN_TEST_BUFSIZE];
+    uint64_t Align;
+} NativeBuf, NativeCheckBuf, PackedBuf, PackedCheckBuf;
+
+static EdsLib_DataTypeDB_CodecPlan_t PackPlan;
+static EdsLib_DataTypeDB_CodecPlan_t UnpackPlan;
+
+static double CodecPlan_ElapsedSec(const struct timespec *Start)
+{
+    struct timespec End;
+
+    clock_gettime(CLOCK_MONOTONIC, &End);
+
+    return (double)(End.tv_sec - Start->tv_sec) + ((double)(End.tv_nsec - Start->tv_nsec) / 1000000000.0);
+}
+
+static void CodecPlan_TestType(const char *TypeName, EdsLib_Id_t EdsId)
+{
+    EdsLib_DataTypeDB_TypeInfo_t TypeInfo;
+    EdsLib_Id_t TempId;
+    struct timespec Start;
+    double InterpRate;
+    double PlanRate;
+    int32_t Status;
+    uint32_t PackedBytes;
+    uint32_t i;
+
+    Status = EdsLib_DataTypeDB_GetTypeInfo(&GD_BASIC, EdsId, &TypeInfo);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_GetTypeInfo(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+    if (Status != EDSLIB_SUCCESS)
+    {
+        return;
+    }
+
+    PackedBytes = (TypeInfo.Size.Bits + 7) / 8;
+
+    /*
+     * Fill the native object with a pattern.  Floating point fields may end up
+     * with odd values, but this does not matter as both paths must produce
+     * the same bits regardless.
+     */
+    for (i = 0; i < sizeof(NativeBuf); ++i)
+    {
+        NativeBuf.Bytes[i] = 0xA5 ^ (i & 0xFF);
+    }
+
+    Status = EdsLib_DataTypeDB_CompilePackPlan(&GD_BASIC, EdsId, &PackPlan);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_CompilePackPlan(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+    Status = EdsLib_DataTypeDB_CompileUnpackPlan(&GD_BASIC, EdsId, &UnpackPlan);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_CompileUnpackPlan(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+    if (PackPlan.NumOps == 0 || UnpackPlan.NumOps == 0)
+    {
+        return;
+    }
+
+    /* Both paths must produce identical output */
+    memset(PackedCheckBuf.Bytes, 0xFF, sizeof(PackedCheckBuf));
+    TempId = EdsId;
+    Status = EdsLib_DataTypeDB_PackPartialObject(&GD_BASIC, &TempId, PackedCheckBuf.Bytes, NativeBuf.Bytes,
+            8 * sizeof(PackedCheckBuf), TypeInfo.Size.Bytes, 0);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_PackPartialObject(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+
+    memset(PackedBuf.Bytes, 0xFF, sizeof(PackedBuf));
+    Status = EdsLib_DataTypeDB_PackWithPlan(&PackPlan, PackedBuf.Bytes, NativeBuf.Bytes,
+            8 * sizeof(PackedBuf), TypeInfo.Size.Bytes);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_PackWithPlan(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+    UtAssert_True(memcmp(PackedBuf.Bytes, PackedCheckBuf.Bytes, PackedBytes) == 0,
+            "%s: planned pack output matches interpretive pack output", TypeName);
+
+    memset(NativeCheckBuf.Bytes, 0xFF, sizeof(NativeCheckBuf));
+    TempId = EdsId;
+    Status = EdsLib_DataTypeDB_UnpackPartialObject(&GD_BASIC, &TempId, NativeCheckBuf.Bytes, PackedBuf.Bytes,
+            sizeof(NativeCheckBuf), TypeInfo.Size.Bits, 0);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_UnpackPartialObject(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+
+    memset(NativeBuf.Bytes, 0xFF, sizeof(NativeBuf));
+    Status = EdsLib_DataTypeDB_UnpackWithPlan(&UnpackPlan, NativeBuf.Bytes, PackedBuf.Bytes,
+            sizeof(NativeBuf), TypeInfo.Size.Bits);
+    UtAssert_True(Status == EDSLIB_SUCCESS, "EdsLib_DataTypeDB_UnpackWithPlan(%s) (%d) == EDSLIB_SUCCESS",
+            TypeName, (int)Status);
+    UtAssert_True(memcmp(NativeBuf.Bytes, NativeCheckBuf.Bytes, TypeInfo.Size.Bytes) == 0,
+            "%s: planned unpack output matches interpretive unpack output", TypeName);
+
+    /* Pack rate */
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for (i = 0; i < CODECPLAN_TEST_ITERATIONS; ++i)
+    {
+        TempId = EdsId;
+        EdsLib_DataTypeDB_PackPartialObject(&GD_BASIC, &TempId, PackedCheckBuf.Bytes, NativeBuf.Bytes,
+                8 * sizeof(PackedCheckBuf), TypeInfo.Size.Bytes, 0);
+    }
+    InterpRate = CODECPLAN_TEST_ITERATIONS / CodecPlan_ElapsedSec(&Start);
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for (i = 0; i < CODECPLAN_TEST_ITERATIONS; ++i)
+    {
+        EdsLib_DataTypeDB_PackWithPlan(&PackPlan, PackedBuf.Bytes, NativeBuf.Bytes,
+                8 * sizeof(PackedBuf), TypeInfo.Size.Bytes);
+    }
+    PlanRate = CODECPLAN_TEST_ITERATIONS / CodecPlan_ElapsedSec(&Start);
+
+    UtPrintf("%s pack: %u bytes, %u plan ops, interpretive %.0f packets/s, plan %.0f packets/s",
+            TypeName, (unsigned int)PackedBytes, (unsigned int)PackPlan.NumOps, InterpRate, PlanRate);
+
+    /* Unpack rate */
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for (i = 0; i < CODECPLAN_TEST_ITERATIONS; ++i)
+    {
+        TempId = EdsId;
+        EdsLib_DataTypeDB_UnpackPartialObject(&GD_BASIC, &TempId, NativeCheckBuf.Bytes, PackedBuf.Bytes,
+                sizeof(NativeCheckBuf), TypeInfo.Size.Bits, 0);
+    }
+    InterpRate = CODECPLAN_TEST_ITERATIONS / CodecPlan_ElapsedSec(&Start);
+
+    clock_gettime(CLOCK_MONOTONIC, &Start);
+    for (i = 0; i < CODECPLAN_TEST_ITERATIONS; ++i)
+    {
+        EdsLib_DataTypeDB_UnpackWithPlan(&UnpackPlan, NativeBuf.Bytes, PackedBuf.Bytes,
+                sizeof(NativeBuf), TypeInfo.Size.Bits);
+    }
+    PlanRate = CODECPLAN_TEST_ITERATIONS / CodecPlan_ElapsedSec(&Start);
+
+    UtPrintf("%s unpack: %u bytes, %u plan ops, interpretive %.0f packets/s, plan %.0f packets/s",
+            TypeName, (unsigned int)TypeInfo.Size.Bytes, (unsigned int)UnpackPlan.NumOps, InterpRate, PlanRate);
+}
+
+void EdsLib_CodecPlan_Test(void)
+{
+    CodecPlan_TestType("UT1/Tlm1", EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_Tlm1_t_DATADICTIONARY));
+    CodecPlan_TestType("UT1/Cmd", EDSLIB_MAKE_ID(UTM_EDS_UT1_INDEX, UT1_Cmd_t_DATADICTIONARY));
+    CodecPlan_TestType("UTHDR/BasePacket", EDSLIB_MAKE_ID(UTM_EDS_UTHDR_INDEX, UTHDR_BasePacket_Intf_t_DATADICTIONARY));
+}
@@ -33,11 +33,13 @@
 extern void EdsLib_Basic_Test(void);
 extern void EdsLib_Full_Test(void);
 extern void EdsLib_StringConv_Test(void);
+extern void EdsLib_CodecPlan_Test(void);
 
 void UtTest_Setup(void)
 {
     UtTest_Add(EdsLib_Basic_Test, NULL, NULL, "EDS Basic");
     UtTest_Add(EdsLib_Full_Test, NULL, NULL, "EDS Full");
     UtTest_Add(EdsLib_StringConv_Test, NULL, NULL, "EDS String Conversions");
+    UtTest_Add(EdsLib_CodecPlan_Test, NULL, NULL, "EDS Codec Plan");
 }
 